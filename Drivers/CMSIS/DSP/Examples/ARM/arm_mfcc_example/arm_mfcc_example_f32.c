@@ -0,0 +1,316 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2021 ARM Limited. All rights reserved.
+*
+* $Date:         18 October 2026
+* $Revision:     V1.10.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_mfcc_example_f32.c
+*
+* Description:   Frame rate of the MFCC and of the fused log-mel front end.
+*
+* Target Processor: Cortex-M and Cortex-A cores
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup MFCCExample MFCC Example
+ *
+ * \par Description:
+ * \par
+ * Measures the number of frames per time unit processed by arm_mfcc_f32(),
+ * arm_mfcc_q15() and by arm_logmel_batch_f32() followed by the DCT, on the
+ * sliding frames of a keyword spotting front end (512-point frames,
+ * 40 mel filters, 13 coefficients).
+ * \par
+ * The fused front end does not modify its input, so the overlapping frames
+ * are read directly from the signal. arm_mfcc_f32() and arm_mfcc_q15()
+ * modify their input: each frame is first copied, as an application has to.
+ * \par
+ * The coefficients of the fused front end are checked against the
+ * arm_mfcc_f32() ones.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c signal_f32 input signal, NB_FRAMES overlapping frames
+ * \li \c filterPos, \c filterLengths, \c filterCoefs_f32 triangular mel filters
+ * \li \c dctCoefs_f32 DCT-II matrix
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_mfcc_init_f32()
+ * - arm_mfcc_f32()
+ * - arm_mfcc_init_q15()
+ * - arm_mfcc_q15()
+ * - arm_logmel_batch_f32()
+ * - arm_mat_mult_f32()
+ * - arm_profile_timestamp()
+ *
+ * <b> Refer  </b>
+ * \link arm_mfcc_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_mfcc_example_f32.c
+  */
+
+#include <math.h>
+#include "arm_math.h"
+#include "dsp/profile_functions.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define FFT_LEN         512
+#define NB_MEL          40
+#define NB_DCT          13
+#define HOP_LEN         160
+#define NB_FRAMES       16
+#define SIGNAL_LEN      ((NB_FRAMES - 1) * HOP_LEN + FFT_LEN)
+#define SAMPLE_RATE     16000.0f
+#define DELTA           (1.0e-3f)
+
+/* Upper bound of the filter coefficients: each bin is in at most two filters */
+#define MAX_FILTER_COEFS (2 * (FFT_LEN / 2 + 1))
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+float32_t signal_f32[SIGNAL_LEN];
+q15_t     signal_q15[SIGNAL_LEN];
+
+float32_t frame_f32[FFT_LEN];
+q15_t     frame_q15[FFT_LEN];
+
+float32_t tmp_f32[2 * FFT_LEN + 2];
+q31_t     tmp_q31[2 * FFT_LEN];
+
+float32_t mfccOut_f32[NB_FRAMES * NB_DCT];
+q15_t     mfccOut_q15[NB_FRAMES * NB_DCT];
+float32_t logMel_f32[NB_FRAMES * NB_MEL];
+float32_t fusedOut_f32[NB_FRAMES * NB_DCT];
+
+/* ----------------------------------------------------------------------
+* Filter bank, window and DCT, computed at startup
+* ------------------------------------------------------------------- */
+uint32_t  filterPos[NB_MEL];
+uint32_t  filterLengths[NB_MEL];
+float32_t filterCoefs_f32[MAX_FILTER_COEFS];
+q15_t     filterCoefs_q15[MAX_FILTER_COEFS];
+float32_t windowCoefs_f32[FFT_LEN];
+q15_t     windowCoefs_q15[FFT_LEN];
+float32_t dctCoefs_f32[NB_DCT * NB_MEL];
+q15_t     dctCoefs_q15[NB_DCT * NB_MEL];
+
+static float32_t toMel(float32_t f)
+{
+  return (1127.0f * logf(1.0f + f / 700.0f));
+}
+
+static float32_t toBin(float32_t mel)
+{
+  return (700.0f * (expf(mel / 1127.0f) - 1.0f) * FFT_LEN / SAMPLE_RATE);
+}
+
+/* Triangular mel filters between 20 Hz and 4 kHz, stored without their zeros */
+static uint32_t init_tables(void)
+{
+  uint32_t i, k, nbCoefs = 0;
+  float32_t melLow = toMel(20.0f);
+  float32_t melStep = (toMel(4000.0f) - melLow) / (NB_MEL + 1);
+
+  for (i = 0; i < NB_MEL; i++)
+  {
+    float32_t left = toBin(melLow + i * melStep);
+    float32_t center = toBin(melLow + (i + 1) * melStep);
+    float32_t right = toBin(melLow + (i + 2) * melStep);
+    uint32_t start = (uint32_t) ceilf(left);
+    uint32_t stop = (uint32_t) floorf(right);
+
+    if (stop < start)
+    {
+      stop = start;
+    }
+
+    filterPos[i] = start;
+    filterLengths[i] = stop - start + 1;
+    for (k = start; k <= stop; k++)
+    {
+      float32_t w = (k <= center) ? (k - left) / (center - left) : (right - k) / (right - center);
+
+      filterCoefs_f32[nbCoefs++] = (w > 0.0f) ? w : 0.0f;
+    }
+  }
+
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    windowCoefs_f32[i] = 0.54f - 0.46f * cosf(2.0f * PI * i / FFT_LEN);
+  }
+
+  for (i = 0; i < NB_DCT; i++)
+  {
+    for (k = 0; k < NB_MEL; k++)
+    {
+      dctCoefs_f32[i * NB_MEL + k] = sqrtf(2.0f / NB_MEL) * cosf(PI * i * (k + 0.5f) / NB_MEL);
+    }
+  }
+
+  arm_float_to_q15(filterCoefs_f32, filterCoefs_q15, nbCoefs);
+  arm_float_to_q15(windowCoefs_f32, windowCoefs_q15, FFT_LEN);
+  arm_float_to_q15(dctCoefs_f32, dctCoefs_q15, NB_DCT * NB_MEL);
+
+  /* Two tones in noise */
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    signal_f32[i] = 0.5f * sinf(2.0f * PI * 440.0f * i / SAMPLE_RATE)
+                  + 0.2f * sinf(2.0f * PI * 1800.0f * i / SAMPLE_RATE)
+                  + 0.05f * cosf(12345.678f * i * i);
+  }
+  arm_float_to_q15(signal_f32, signal_q15, SIGNAL_LEN);
+
+  return (nbCoefs);
+}
+
+#if defined(SEMIHOSTING)
+static void report(const char *name, uint32_t elapsed)
+{
+  printf("%-28s %10u per frame\n", name, (unsigned int) (elapsed / NB_FRAMES));
+}
+#endif
+
+/* ----------------------------------------------------------------------
+* MFCC benchmark
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  arm_status status;
+  arm_mfcc_instance_f32 mfcc_f32;
+  arm_mfcc_instance_q15 mfcc_q15;
+  arm_matrix_instance_f32 logMelMat, dctMatT, fusedMat;
+  float32_t dctT_f32[NB_MEL * NB_DCT];
+  uint32_t t0, tMfccF32, tMfccQ15, tFused;
+  uint32_t i, k;
+  float32_t maxDiff = 0.0f;
+
+  init_tables();
+  arm_profile_init();
+
+  status = arm_mfcc_init_f32(&mfcc_f32, FFT_LEN, NB_MEL, NB_DCT,
+                             dctCoefs_f32, filterPos, filterLengths,
+                             filterCoefs_f32, windowCoefs_f32);
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = arm_mfcc_init_q15(&mfcc_q15, FFT_LEN, NB_MEL, NB_DCT,
+                               dctCoefs_q15, filterPos, filterLengths,
+                               filterCoefs_q15, windowCoefs_q15);
+  }
+
+#if defined(SEMIHOSTING)
+  printf("START\n");
+#endif
+
+  /* The batch DCT is one matrix product: (frames x mel) * (mel x dct) */
+  arm_mat_init_f32(&logMelMat, NB_FRAMES, NB_MEL, logMel_f32);
+  arm_mat_init_f32(&dctMatT, NB_MEL, NB_DCT, dctT_f32);
+  arm_mat_init_f32(&fusedMat, NB_FRAMES, NB_DCT, fusedOut_f32);
+  for (i = 0; i < NB_DCT; i++)
+  {
+    for (k = 0; k < NB_MEL; k++)
+    {
+      dctT_f32[k * NB_DCT + i] = dctCoefs_f32[i * NB_MEL + k];
+    }
+  }
+
+  /* arm_mfcc_f32: the frame is copied because the function modifies it */
+  t0 = arm_profile_timestamp();
+  for (i = 0; i < NB_FRAMES; i++)
+  {
+    arm_copy_f32(signal_f32 + i * HOP_LEN, frame_f32, FFT_LEN);
+    arm_mfcc_f32(&mfcc_f32, frame_f32, mfccOut_f32 + i * NB_DCT, tmp_f32);
+  }
+  tMfccF32 = arm_profile_timestamp() - t0;
+
+  /* arm_mfcc_q15 */
+  t0 = arm_profile_timestamp();
+  for (i = 0; (i < NB_FRAMES) && (status == ARM_MATH_SUCCESS); i++)
+  {
+    arm_copy_q15(signal_q15 + i * HOP_LEN, frame_q15, FFT_LEN);
+    status = arm_mfcc_q15(&mfcc_q15, frame_q15, mfccOut_q15 + i * NB_DCT, tmp_q31);
+  }
+  tMfccQ15 = arm_profile_timestamp() - t0;
+
+  /* Fused front end, all the frames in one call, then one DCT */
+  t0 = arm_profile_timestamp();
+  arm_logmel_batch_f32(&mfcc_f32, signal_f32, HOP_LEN, NB_FRAMES, logMel_f32, tmp_f32);
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = arm_mat_mult_f32(&logMelMat, &dctMatT, &fusedMat);
+  }
+  tFused = arm_profile_timestamp() - t0;
+
+  for (i = 0; i < NB_FRAMES * NB_DCT; i++)
+  {
+    float32_t diff = fabsf(fusedOut_f32[i] - mfccOut_f32[i]);
+
+    maxDiff = (diff > maxDiff) ? diff : maxDiff;
+  }
+
+#if defined(SEMIHOSTING)
+  report("arm_mfcc_f32", tMfccF32);
+  report("arm_mfcc_q15", tMfccQ15);
+  report("arm_logmel_batch_f32 + DCT", tFused);
+  printf("max difference with arm_mfcc_f32: %f\n", (double) maxDiff);
+#else
+  (void) tMfccF32;
+  (void) tMfccQ15;
+  (void) tFused;
+#endif
+
+  if ((status != ARM_MATH_SUCCESS) || (maxDiff > DELTA))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+
+}
+
+ /** \endlink */
@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2021 ARM Limited. All rights reserved.
+*
+* $Date:         18 October 2026
+* $Revision:     V1.10.0
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_quantize_example_f32.c
+*
+* Description:   Rounding of the affine quantization functions.
+*
+* Target Processor: Cortex-M and Cortex-A cores
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the License); you may
+* not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an AS IS BASIS, WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+* -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup QuantizeExample Quantization Example
+ *
+ * \par Description:
+ * \par
+ * Quantizes ties (0.5, 1.5, 2.5), the floats just below them (0.49999997,
+ * 1.4999999) and just above them (0.50000006), of both signs, with the
+ * three rounding modes, and compares each output with the rounding of the
+ * exact quotient.
+ * \par
+ * The values are repeated so that each of them is quantized in the vector
+ * loop and in the scalar tail of the vector versions: the 16 sample loop
+ * of the int8 functions, the 8 sample loop of the int16 functions and the
+ * 4 channel loop of the per-channel functions. The scales are powers of
+ * two, so the quotients are exact.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c edge_f32 ties and their neighbours, quotients of the quantization
+ * \li \c scale_f32, \c zeroPoint per-channel scales and zero points
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_quantize_f32_s8()
+ * - arm_quantize_f32_s16()
+ * - arm_quantize_per_channel_f32_s8()
+ * - arm_quantize_per_channel_f32_s16()
+ *
+ * <b> Refer  </b>
+ * \link arm_quantize_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_quantize_example_f32.c
+  */
+
+#include <math.h>
+#include "arm_math.h"
+
+#if defined(SEMIHOSTING)
+#include <stdio.h>
+#endif
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NB_EDGES        14
+#define NB_CHANNELS     7
+/* 32 + 10 samples for the int8 loop, 40 + 2 for the int16 loop */
+#define NB_SAMPLES      (3 * NB_EDGES)
+#define NB_VECTORS      (NB_SAMPLES / NB_CHANNELS)
+#define SCALE           (0.5f)
+#define ZERO_POINT      (3)
+
+/* ----------------------------------------------------------------------
+* Test data
+* ------------------------------------------------------------------- */
+/* 0.49999997f is the largest float below 0.5f: adding 0.5f to it gives 1.0f */
+const float32_t edge_f32[NB_EDGES] =
+{
+  1.5f, -1.5f, 2.5f, -2.5f, 0.5f, -0.5f, 0.49999997f, -0.49999997f,
+  0.50000006f, -0.50000006f, 1.49999988f, -1.49999988f, 0.49999997f, -0.49999997f
+};
+
+const float32_t scale_f32[NB_CHANNELS] = { 1.0f, 0.5f, 0.25f, 2.0f, 1.0f, 0.5f, 0.25f };
+const int32_t   zeroPoint[NB_CHANNELS] = { 0, 1, -2, 3, -4, 5, -6 };
+
+float32_t input_f32[NB_SAMPLES];
+q7_t      output_q7[NB_SAMPLES];
+q15_t     output_q15[NB_SAMPLES];
+
+static int32_t round_ref(float32_t in, arm_quant_rounding rounding)
+{
+  switch (rounding)
+  {
+    case ARM_QUANT_ROUND_HALF_EVEN:
+      return ((int32_t) rintf(in));
+
+    case ARM_QUANT_ROUND_TOWARD_ZERO:
+      return ((int32_t) truncf(in));
+
+    default:
+      return ((int32_t) roundf(in));
+  }
+}
+
+/* Number of outputs that differ from the rounding of the exact quotient */
+static uint32_t check(
+  const q7_t * pQ7,
+  const q15_t * pQ15,
+  uint32_t numChannels,
+  const int32_t * pZeroPoint,
+  arm_quant_rounding rounding)
+{
+  uint32_t i, errors = 0U;
+
+  for (i = 0U; i < NB_SAMPLES; i++)
+  {
+    int32_t ref = round_ref(edge_f32[i % NB_EDGES], rounding) + pZeroPoint[i % numChannels];
+
+    errors += (pQ7[i] != ref) ? 1U : 0U;
+    errors += (pQ15[i] != ref) ? 1U : 0U;
+  }
+
+  return (errors);
+}
+
+/* ----------------------------------------------------------------------
+* Quantization rounding test
+* ------------------------------------------------------------------- */
+int32_t main(void)
+{
+  arm_status status;
+  arm_quant_rounding rounding;
+  int32_t zeroPointT[1] = { ZERO_POINT };
+  uint32_t mode, i, errors = 0U;
+
+#if defined(SEMIHOSTING)
+  printf("START\n");
+#endif
+
+  for (mode = 0U; mode < 3U; mode++)
+  {
+    rounding = (arm_quant_rounding) mode;
+
+    /* Per-tensor: in / SCALE is the edge value */
+    for (i = 0U; i < NB_SAMPLES; i++)
+    {
+      input_f32[i] = edge_f32[i % NB_EDGES] * SCALE;
+    }
+    arm_quantize_f32_s8(input_f32, output_q7, NB_SAMPLES, SCALE, ZERO_POINT, rounding);
+    arm_quantize_f32_s16(input_f32, output_q15, NB_SAMPLES, SCALE, ZERO_POINT, rounding);
+    errors += check(output_q7, output_q15, 1U, zeroPointT, rounding);
+
+    /* Per-channel: 4 channels in the vector loop, 3 in the scalar loop */
+    for (i = 0U; i < NB_SAMPLES; i++)
+    {
+      input_f32[i] = edge_f32[i % NB_EDGES] * scale_f32[i % NB_CHANNELS];
+    }
+    arm_quantize_per_channel_f32_s8(input_f32, output_q7, NB_VECTORS, NB_CHANNELS,
+                                    scale_f32, zeroPoint, rounding);
+    arm_quantize_per_channel_f32_s16(input_f32, output_q15, NB_VECTORS, NB_CHANNELS,
+                                     scale_f32, zeroPoint, rounding);
+    errors += check(output_q7, output_q15, NB_CHANNELS, zeroPoint, rounding);
+  }
+
+#if defined(SEMIHOSTING)
+  printf("%u outputs differ from the reference\n", (unsigned int) errors);
+#endif
+
+  status = (errors != 0U) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+#if defined (SEMIHOSTING)
+    printf("FAILURE\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+  else
+  {
+#if defined (SEMIHOSTING)
+    printf("SUCCESS\n");
+#else
+    while (1);                             /* main function does not return */
+#endif
+  }
+
+}
+
+ /** \endlink */
@@ -0,0 +1,176 @@
+/******************************************************************************
+ * @file     profile_functions.h
+ * @brief    Public header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2021 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _PROFILE_FUNCTIONS_H_
+#define _PROFILE_FUNCTIONS_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @defgroup groupProfile Profiling Functions
+ *
+ * Entry/exit instrumentation of the library entry points.
+ *
+ * Profiling is off by default and costs nothing when off: the library
+ * sources are not modified. When the library is built with the PROFILE
+ * option, Scripts/Profile/arm_profile_gen_wrappers.py generates one wrapper
+ * per public function and the application is linked with <code>--wrap</code>
+ * (GNU ld, lld) or <code>$Sub$$</code> (armlink) so that every call goes
+ * through ARM_PROFILE_ENTER() / ARM_PROFILE_EXIT().
+ *
+ * Events are stored in the lock-free ring ::arm_profile_ring. A raw image
+ * of that structure (fwrite on a host, a debugger memory dump on a target)
+ * is decoded by Scripts/Profile/arm_profile_report.py into a per-function
+ * time and call-count profile.
+ *
+ * Timestamps are read from DWT CYCCNT on Cortex-M and from
+ * clock_gettime(CLOCK_MONOTONIC) in nanoseconds elsewhere. Define
+ * ARM_PROFILE_TIMESTAMP() to use another 32-bit time base.
+ */
+
+/**
+ * @addtogroup groupProfile
+ * @{
+ */
+
+#if !defined(ARM_PROFILE_RING_SIZE)
+/**
+ * @brief Number of records in the ring. Must be a power of two.
+ */
+#define ARM_PROFILE_RING_SIZE 1024U
+#endif
+
+#if (ARM_PROFILE_RING_SIZE & (ARM_PROFILE_RING_SIZE - 1U)) != 0U
+#error "ARM_PROFILE_RING_SIZE must be a power of two"
+#endif
+
+/**
+ * @brief Value of arm_profile_ring_t::magic, used by the host tool to validate a dump.
+ */
+#define ARM_PROFILE_MAGIC       0x464F5250U
+
+/**
+ * @brief Record flag for a function entry.
+ */
+#define ARM_PROFILE_EVENT_ENTER 0U
+
+/**
+ * @brief Record flag for a function exit.
+ */
+#define ARM_PROFILE_EVENT_EXIT  1U
+
+  /**
+   * @brief One profiling event.
+   */
+  typedef struct
+  {
+    uint32_t timestamp;   /**< Timestamp of the event */
+    uint32_t blockSize;   /**< Block size of the call (0 when the function has none) */
+    uint16_t id;          /**< Function identifier assigned by the wrapper generator */
+    uint16_t event;       /**< ARM_PROFILE_EVENT_ENTER or ARM_PROFILE_EVENT_EXIT */
+  } arm_profile_record;
+
+  /**
+   * @brief Event ring. The layout is read by the host tool: keep it in sync.
+   */
+  typedef struct
+  {
+    uint32_t magic;                                       /**< ARM_PROFILE_MAGIC */
+    uint32_t numRecords;                                  /**< Capacity of the ring */
+    volatile uint32_t head;                               /**< Number of events recorded since reset */
+    uint32_t reserved;                                    /**< Padding, always 0 */
+    arm_profile_record records[ARM_PROFILE_RING_SIZE];    /**< Events, indexed by head modulo numRecords */
+  } arm_profile_ring_t;
+
+  /**
+   * @brief Event ring filled by the hooks.
+   */
+  extern arm_profile_ring_t arm_profile_ring;
+
+  /**
+   * @brief  Enables the time base and empties the ring.
+   */
+  void arm_profile_init(void);
+
+  /**
+   * @brief  Empties the ring.
+   */
+  void arm_profile_reset(void);
+
+  /**
+   * @brief  Returns the current timestamp.
+   * @return timestamp
+   */
+  uint32_t arm_profile_timestamp(void);
+
+  /**
+   * @brief  Records a function entry.
+   * @param[in]  id         function identifier
+   * @param[in]  blockSize  block size of the call
+   */
+  void arm_profile_enter(
+        uint16_t id,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Records a function exit.
+   * @param[in]  id         function identifier
+   */
+  void arm_profile_exit(
+        uint16_t id);
+
+  /**
+   * @brief  Copies the retained events in chronological order.
+   * @param[out] pDst        points to the destination records
+   * @param[in]  maxRecords  capacity of the destination
+   * @return     number of records copied
+   */
+  uint32_t arm_profile_read(
+        arm_profile_record * pDst,
+        uint32_t maxRecords);
+
+#if defined(ARM_MATH_PROFILE)
+  #define ARM_PROFILE_ENTER(ID, BLOCKSIZE) arm_profile_enter((uint16_t) (ID), (uint32_t) (BLOCKSIZE))
+  #define ARM_PROFILE_EXIT(ID)             arm_profile_exit((uint16_t) (ID))
+#else
+  #define ARM_PROFILE_ENTER(ID, BLOCKSIZE) ((void) 0)
+  #define ARM_PROFILE_EXIT(ID)             ((void) 0)
+#endif
+
+/**
+ * @} end of groupProfile group
+ */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef _PROFILE_FUNCTIONS_H_ */
@@ -187,6 +187,164 @@ extern "C"
         uint32_t blockSize);
 
 
+  /**
+   * @brief Rounding mode used by the affine quantization functions
+   */
+  typedef enum
+  {
+    ARM_QUANT_ROUND_HALF_AWAY   = 0,
+             /**< Round to nearest, ties away from zero (TensorFlow Lite / CMSIS-NN) */
+    ARM_QUANT_ROUND_HALF_EVEN   = 1,
+             /**< Round to nearest, ties to even */
+    ARM_QUANT_ROUND_TOWARD_ZERO = 2
+             /**< Truncate toward zero */
+  } arm_quant_rounding;
+
+
+  /**
+   * @brief  Quantizes a floating-point vector to int8 with an affine mapping.
+   * @param[in]  pSrc       points to the floating-point input vector
+   * @param[out] pDst       points to the int8 output vector
+   * @param[in]  blockSize  number of samples to process
+   * @param[in]  scale      quantization scale
+   * @param[in]  zeroPoint  quantization zero point
+   * @param[in]  rounding   rounding mode
+   */
+  void arm_quantize_f32_s8(
+  const float32_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint,
+        arm_quant_rounding rounding);
+
+
+  /**
+   * @brief  Quantizes a floating-point vector to int16 with an affine mapping.
+   * @param[in]  pSrc       points to the floating-point input vector
+   * @param[out] pDst       points to the int16 output vector
+   * @param[in]  blockSize  number of samples to process
+   * @param[in]  scale      quantization scale
+   * @param[in]  zeroPoint  quantization zero point
+   * @param[in]  rounding   rounding mode
+   */
+  void arm_quantize_f32_s16(
+  const float32_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint,
+        arm_quant_rounding rounding);
+
+
+  /**
+   * @brief  Quantizes a channel-last floating-point tensor to int8 with per-channel scales.
+   * @param[in]  pSrc         points to the floating-point input tensor
+   * @param[out] pDst         points to the int8 output tensor
+   * @param[in]  numVectors   number of vectors of numChannels samples
+   * @param[in]  numChannels  number of channels (innermost dimension)
+   * @param[in]  pScale       points to the numChannels quantization scales
+   * @param[in]  pZeroPoint   points to the numChannels zero points, or NULL for symmetric quantization
+   * @param[in]  rounding     rounding mode
+   */
+  void arm_quantize_per_channel_f32_s8(
+  const float32_t * pSrc,
+        q7_t * pDst,
+        uint32_t numVectors,
+        uint32_t numChannels,
+  const float32_t * pScale,
+  const int32_t * pZeroPoint,
+        arm_quant_rounding rounding);
+
+
+  /**
+   * @brief  Quantizes a channel-last floating-point tensor to int16 with per-channel scales.
+   * @param[in]  pSrc         points to the floating-point input tensor
+   * @param[out] pDst         points to the int16 output tensor
+   * @param[in]  numVectors   number of vectors of numChannels samples
+   * @param[in]  numChannels  number of channels (innermost dimension)
+   * @param[in]  pScale       points to the numChannels quantization scales
+   * @param[in]  pZeroPoint   points to the numChannels zero points, or NULL for symmetric quantization
+   * @param[in]  rounding     rounding mode
+   */
+  void arm_quantize_per_channel_f32_s16(
+  const float32_t * pSrc,
+        q15_t * pDst,
+        uint32_t numVectors,
+        uint32_t numChannels,
+  const float32_t * pScale,
+  const int32_t * pZeroPoint,
+        arm_quant_rounding rounding);
+
+
+  /**
+   * @brief  Dequantizes an int8 vector to floating-point with an affine mapping.
+   * @param[in]  pSrc       points to the int8 input vector
+   * @param[out] pDst       points to the floating-point output vector
+   * @param[in]  blockSize  number of samples to process
+   * @param[in]  scale      quantization scale
+   * @param[in]  zeroPoint  quantization zero point
+   */
+  void arm_dequantize_s8_f32(
+  const q7_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint);
+
+
+  /**
+   * @brief  Dequantizes an int16 vector to floating-point with an affine mapping.
+   * @param[in]  pSrc       points to the int16 input vector
+   * @param[out] pDst       points to the floating-point output vector
+   * @param[in]  blockSize  number of samples to process
+   * @param[in]  scale      quantization scale
+   * @param[in]  zeroPoint  quantization zero point
+   */
+  void arm_dequantize_s16_f32(
+  const q15_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint);
+
+
+  /**
+   * @brief  Dequantizes a channel-last int8 tensor to floating-point with per-channel scales.
+   * @param[in]  pSrc         points to the int8 input tensor
+   * @param[out] pDst         points to the floating-point output tensor
+   * @param[in]  numVectors   number of vectors of numChannels samples
+   * @param[in]  numChannels  number of channels (innermost dimension)
+   * @param[in]  pScale       points to the numChannels quantization scales
+   * @param[in]  pZeroPoint   points to the numChannels zero points, or NULL for symmetric quantization
+   */
+  void arm_dequantize_per_channel_s8_f32(
+  const q7_t * pSrc,
+        float32_t * pDst,
+        uint32_t numVectors,
+        uint32_t numChannels,
+  const float32_t * pScale,
+  const int32_t * pZeroPoint);
+
+
+  /**
+   * @brief  Dequantizes a channel-last int16 tensor to floating-point with per-channel scales.
+   * @param[in]  pSrc         points to the int16 input tensor
+   * @param[out] pDst         points to the floating-point output tensor
+   * @param[in]  numVectors   number of vectors of numChannels samples
+   * @param[in]  numChannels  number of channels (innermost dimension)
+   * @param[in]  pScale       points to the numChannels quantization scales
+   * @param[in]  pZeroPoint   points to the numChannels zero points, or NULL for symmetric quantization
+   */
+  void arm_dequantize_per_channel_s16_f32(
+  const q15_t * pSrc,
+        float32_t * pDst,
+        uint32_t numVectors,
+        uint32_t numChannels,
+  const float32_t * pScale,
+  const int32_t * pZeroPoint);
+
+
 
 
   
@@ -633,6 +633,40 @@ arm_status arm_mfcc_init_f32(
   float32_t *pTmp
   );
 
+/**
+  @brief         Log-mel spectrum F32
+  @param[in]    S       points to the mfcc instance structure
+  @param[in]     pSrc points to the input samples
+  @param[out]     pDst  points to the output log-mel values
+  @param[inout]     pTmp  points to a temporary buffer of complex
+  @return        none
+ */
+  void arm_logmel_f32(
+  const arm_mfcc_instance_f32 * S,
+  const float32_t *pSrc,
+  float32_t *pDst,
+  float32_t *pTmp
+  );
+
+/**
+  @brief         Log-mel spectrum F32 of a batch of frames
+  @param[in]    S       points to the mfcc instance structure
+  @param[in]     pSrc points to the input signal
+  @param[in]     hopLength  number of samples between the start of two frames
+  @param[in]     numFrames  number of frames
+  @param[out]     pDst  points to the output log-mel values
+  @param[inout]     pTmp  points to a temporary buffer of complex
+  @return        none
+ */
+  void arm_logmel_batch_f32(
+  const arm_mfcc_instance_f32 * S,
+  const float32_t *pSrc,
+  uint32_t hopLength,
+  uint32_t numFrames,
+  float32_t *pDst,
+  float32_t *pTmp
+  );
+
 typedef struct
   {
      const q31_t *dctCoefs; /**< Internal DCT coefficients */
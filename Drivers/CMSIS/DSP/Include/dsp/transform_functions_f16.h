@@ -198,6 +198,40 @@ arm_status arm_mfcc_init_f16(
   float16_t *pTmp
   );
 
+/**
+  @brief         Log-mel spectrum F16
+  @param[in]    S       points to the mfcc instance structure
+  @param[in]     pSrc points to the input samples
+  @param[out]     pDst  points to the output log-mel values
+  @param[inout]     pTmp  points to a temporary buffer of complex
+  @return        none
+ */
+  void arm_logmel_f16(
+  const arm_mfcc_instance_f16 * S,
+  const float16_t *pSrc,
+  float16_t *pDst,
+  float16_t *pTmp
+  );
+
+/**
+  @brief         Log-mel spectrum F16 of a batch of frames
+  @param[in]    S       points to the mfcc instance structure
+  @param[in]     pSrc points to the input signal
+  @param[in]     hopLength  number of samples between the start of two frames
+  @param[in]     numFrames  number of frames
+  @param[out]     pDst  points to the output log-mel values
+  @param[inout]     pTmp  points to a temporary buffer of complex
+  @return        none
+ */
+  void arm_logmel_batch_f16(
+  const arm_mfcc_instance_f16 * S,
+  const float16_t *pSrc,
+  uint32_t hopLength,
+  uint32_t numFrames,
+  float16_t *pDst,
+  float16_t *pTmp
+  );
+
   
 #endif /* defined(ARM_FLOAT16_SUPPORTED)*/
 
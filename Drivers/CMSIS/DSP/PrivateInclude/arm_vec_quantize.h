@@ -0,0 +1,260 @@
+/******************************************************************************
+ * @file     arm_vec_quantize.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2021 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_VEC_QUANTIZE_H_
+#define _ARM_VEC_QUANTIZE_H_
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * The quantization kernels compute in / scale like the TensorFlow Lite reference
+ * quantizer. A plain multiplication by the reciprocal of scale differs from the
+ * division in the last bit for some inputs, which changes the result of about one
+ * in eight exact ties, so the vector versions refine the product with one fused
+ * multiply-add step, which gives the correctly rounded quotient.
+ * The quotient is then clamped to [qmin - zeroPoint, qmax - zeroPoint] before
+ * rounding. The bounds are integers, so rounding cannot leave the range. NaN is
+ * clamped to the lower bound (and quantized to qmin) on all paths, so the integer
+ * conversion never sees a value it cannot represent.
+ */
+
+/**
+  @brief         Rounds a scaled and clamped sample to an integer.
+  @param[in]     in        value to round
+  @param[in]     rounding  rounding mode
+  @return        rounded value
+ */
+__STATIC_FORCEINLINE int32_t arm_quant_round_f32(
+  float32_t in,
+  arm_quant_rounding rounding)
+{
+  switch (rounding)
+  {
+    case ARM_QUANT_ROUND_HALF_EVEN:
+      return ((int32_t) rintf(in));
+
+    case ARM_QUANT_ROUND_TOWARD_ZERO:
+      return ((int32_t) in);
+
+    default:
+      return ((int32_t) roundf(in));
+  }
+}
+
+/**
+  @brief         Quantizes one sample.
+  @param[in]     in        input value
+  @param[in]     scale     quantization scale
+  @param[in]     zeroPoint quantization zero point
+  @param[in]     lo        lower clamping bound (qmin - zeroPoint)
+  @param[in]     hi        upper clamping bound (qmax - zeroPoint)
+  @param[in]     rounding  rounding mode
+  @return        quantized value in [qmin, qmax]
+ */
+__STATIC_FORCEINLINE int32_t arm_quantize_sample_f32(
+  float32_t in,
+  float32_t scale,
+  int32_t zeroPoint,
+  float32_t lo,
+  float32_t hi,
+  arm_quant_rounding rounding)
+{
+  float32_t scaled = in / scale;
+
+  /* written so that NaN fails the first test and becomes lo */
+  scaled = (scaled >= lo) ? scaled : lo;
+  scaled = (scaled <= hi) ? scaled : hi;
+
+  return (arm_quant_round_f32(scaled, rounding) + zeroPoint);
+}
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/**
+  @brief         Quantizes 4 samples.
+  @param[in]     in        input vector
+  @param[in]     scale     quantization scales
+  @param[in]     invScale  reciprocal of the quantization scales
+  @param[in]     zeroPoint quantization zero points
+  @param[in]     lo        lower clamping bounds (qmin - zeroPoint)
+  @param[in]     hi        upper clamping bounds (qmax - zeroPoint)
+  @param[in]     rounding  rounding mode
+  @return        quantized values in [qmin, qmax]
+ */
+__STATIC_FORCEINLINE int32x4_t arm_vec_quantize_f32(
+  f32x4_t in,
+  f32x4_t scale,
+  f32x4_t invScale,
+  int32x4_t zeroPoint,
+  f32x4_t lo,
+  f32x4_t hi,
+  arm_quant_rounding rounding)
+{
+  f32x4_t scaled;
+  int32x4_t rounded;
+
+  /* q = in * invScale is within one ulp of in / scale. Clamped to one beyond the
+     bounds it stays exact in range and finite, so that the residual in - q * scale
+     (exact with vfms) is NaN only for NaN inputs, and q + residual * invScale is
+     the correctly rounded quotient. vmaxnm/vminnm map NaN to the bound. */
+  scaled = vmulq(in, invScale);
+  scaled = vmaxnmq(scaled, vsubq(lo, vdupq_n_f32(1.0f)));
+  scaled = vminnmq(scaled, vaddq(hi, vdupq_n_f32(1.0f)));
+  scaled = vfmaq(scaled, vfmsq(in, scaled, scale), invScale);
+  scaled = vmaxnmq(scaled, lo);
+  scaled = vminnmq(scaled, hi);
+
+  switch (rounding)
+  {
+    case ARM_QUANT_ROUND_HALF_EVEN:
+      rounded = vcvtnq_s32_f32(scaled);
+      break;
+
+    case ARM_QUANT_ROUND_TOWARD_ZERO:
+      rounded = vcvtq_s32_f32(scaled);
+      break;
+
+    default:
+      rounded = vcvtaq_s32_f32(scaled);
+      break;
+  }
+
+  return (vaddq(rounded, zeroPoint));
+}
+
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/**
+  @brief         Clamps 4 samples, NaN becomes lo.
+  @param[in]     in        input vector
+  @param[in]     lo        lower clamping bounds
+  @param[in]     hi        upper clamping bounds
+  @return        clamped values
+ */
+__STATIC_FORCEINLINE float32x4_t arm_vec_quant_clamp_f32(
+  float32x4_t in,
+  float32x4_t lo,
+  float32x4_t hi)
+{
+  /* vmaxq_f32 would propagate NaN: select on a compare that NaN fails */
+  in = vbslq_f32(vcgeq_f32(in, lo), in, lo);
+  return (vminq_f32(in, hi));
+}
+
+/**
+  @brief         Quantizes 4 samples.
+  @param[in]     in        input vector
+  @param[in]     scale     quantization scales
+  @param[in]     invScale  reciprocal of the quantization scales
+  @param[in]     zeroPoint quantization zero points
+  @param[in]     lo        lower clamping bounds (qmin - zeroPoint)
+  @param[in]     hi        upper clamping bounds (qmax - zeroPoint)
+  @param[in]     rounding  rounding mode
+  @return        quantized values in [qmin, qmax]
+ */
+__STATIC_FORCEINLINE int32x4_t arm_vec_quantize_f32(
+  float32x4_t in,
+  float32x4_t scale,
+  float32x4_t invScale,
+  int32x4_t zeroPoint,
+  float32x4_t lo,
+  float32x4_t hi,
+  arm_quant_rounding rounding)
+{
+  float32x4_t scaled;
+  int32x4_t rounded;
+
+#if defined(__aarch64__)
+  (void) invScale;
+  scaled = vdivq_f32(in, scale);
+#elif defined(__ARM_FEATURE_FMA)
+  {
+    float32x4_t one = vdupq_n_f32(1.0f);
+
+    /* see the MVE version */
+    scaled = vmulq_f32(in, invScale);
+    scaled = arm_vec_quant_clamp_f32(scaled, vsubq_f32(lo, one), vaddq_f32(hi, one));
+    scaled = vfmaq_f32(scaled, vfmsq_f32(in, scaled, scale), invScale);
+  }
+#else
+  /* no vector division and no fused multiply-add: divide lane by lane */
+  (void) invScale;
+  scaled = vsetq_lane_f32(vgetq_lane_f32(in, 0) / vgetq_lane_f32(scale, 0), in, 0);
+  scaled = vsetq_lane_f32(vgetq_lane_f32(in, 1) / vgetq_lane_f32(scale, 1), scaled, 1);
+  scaled = vsetq_lane_f32(vgetq_lane_f32(in, 2) / vgetq_lane_f32(scale, 2), scaled, 2);
+  scaled = vsetq_lane_f32(vgetq_lane_f32(in, 3) / vgetq_lane_f32(scale, 3), scaled, 3);
+#endif
+  scaled = arm_vec_quant_clamp_f32(scaled, lo, hi);
+
+  switch (rounding)
+  {
+    case ARM_QUANT_ROUND_HALF_EVEN:
+#if defined(__aarch64__)
+      rounded = vcvtnq_s32_f32(scaled);
+#else
+      /* |scaled| < 2^22: adding 1.5 * 2^23 leaves round-to-nearest-even(scaled)
+         in the low mantissa bits, which is recovered by an integer subtraction. */
+      rounded = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(scaled, vdupq_n_f32(12582912.0f))),
+                          vdupq_n_s32(0x4B400000));
+#endif
+      break;
+
+    case ARM_QUANT_ROUND_TOWARD_ZERO:
+      rounded = vcvtq_s32_f32(scaled);
+      break;
+
+    default:
+#if defined(__aarch64__)
+      rounded = vcvtaq_s32_f32(scaled);
+#else
+      {
+        /* scaled + copysign(0.5, scaled) rounds away the largest float below 0.5:
+           compare the exact fractional part instead */
+        int32x4_t truncated = vcvtq_s32_f32(scaled);
+        float32x4_t frac = vsubq_f32(scaled, vcvtq_f32_s32(truncated));
+        int32x4_t away = vbslq_s32(vcltq_f32(scaled, vdupq_n_f32(0.0f)), vdupq_n_s32(-1), vdupq_n_s32(1));
+
+        rounded = vaddq_s32(truncated, vandq_s32(vreinterpretq_s32_u32(vcageq_f32(frac, vdupq_n_f32(0.5f))), away));
+      }
+#endif
+      break;
+  }
+
+  return (vaddq_s32(rounded, zeroPoint));
+}
+
+#endif /* defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_VEC_QUANTIZE_H_ */
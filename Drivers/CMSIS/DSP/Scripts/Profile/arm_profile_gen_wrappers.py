@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010-2021 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Generate profiling wrappers for the public CMSIS-DSP functions.
+
+The prototypes are read from the public headers given on the command line.
+The output directory receives:
+
+  arm_profile_wrap_<function>.c  one wrapper per function, calling
+                                 ARM_PROFILE_ENTER/EXIT around the real one
+  arm_profile_wrappers.rsp       linker response file with one --wrap option
+                                 per function (GNU ld / lld only, pass it
+                                 with -Wl,@arm_profile_wrappers.rsp)
+  arm_profile_functions.txt      function names, one per line; line N is
+                                 function id N. Give it to arm_profile_report.py.
+
+Each wrapper is in its own file so that, once archived, a wrapper (and the
+function it calls) is only linked in when the application uses it.
+
+With --linker armlink, the wrappers use the $Sub$$/$Super$$ convention
+instead and no response file is needed.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Parameter names taken as the block size of a call, by priority
+BLOCK_SIZE_NAMES = ["blockSize", "numSamples", "fftLen", "vecDim", "nbVectors",
+                    "numPoints", "length", "len", "n"]
+
+PROTOTYPE = re.compile(
+    r"(?:^|(?<=[;}]))\s*"
+    r"(?P<ret>(?:const\s+)?[A-Za-z_]\w*(?:\s+[A-Za-z_]\w*)*\s*\**)\s*"
+    r"(?P<name>arm_\w+)\s*"
+    r"\((?P<args>[^(){};#]*)\)\s*;",
+    re.S)
+
+QUALIFIERS = {"extern", "static", "inline", "__STATIC_INLINE", "__STATIC_FORCEINLINE"}
+
+
+def strip_comments(text):
+    """Remove comments, keeping the line structure."""
+    text = re.sub(r"/\*.*?\*/", lambda m: "\n" * m.group(0).count("\n"), text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    text = re.sub(r"\\\n", " ", text)
+    return text
+
+
+def segments(text):
+    """Split a header at preprocessor directives.
+
+    Yield (code, conditions) where conditions is the list of #if expressions
+    guarding the code, ignoring the include guard and __cplusplus blocks.
+    """
+    stack = []
+    code = []
+    for line in text.split("\n"):
+        m = re.match(r"\s*#\s*(\w+)\s*(.*)", line)
+        if m is None:
+            code.append(line)
+            continue
+        yield "\n".join(code), [c for c in stack if c is not None]
+        code = []
+        directive, expr = m.group(1), m.group(2).strip()
+        if directive in ("if", "ifdef", "ifndef"):
+            if directive == "ifdef":
+                expr = "defined(%s)" % expr
+            elif directive == "ifndef":
+                expr = "!defined(%s)" % expr
+            ignored = "__cplusplus" in expr or (directive == "ifndef" and not stack
+                                                 and expr.endswith("_H_)"))
+            stack.append(None if ignored else expr)
+        elif directive == "elif" and stack:
+            stack[-1] = None if stack[-1] is None else expr
+        elif directive == "else" and stack:
+            stack[-1] = None if stack[-1] is None else "!(%s)" % stack[-1]
+        elif directive == "endif" and stack:
+            stack.pop()
+    yield "\n".join(code), [c for c in stack if c is not None]
+
+
+def parse_args(args):
+    """Return the list of (declaration, name) of the parameters, or None."""
+    args = " ".join(args.split())
+    if args in ("", "void"):
+        return []
+    params = []
+    for p in args.split(","):
+        p = p.strip()
+        m = re.match(r"(.*?)(\w+)\s*(\[[^\]]*\])?$", p)
+        if m is None or not m.group(1).strip():
+            return None
+        params.append((p, m.group(2)))
+    return params
+
+
+def parse_header(path):
+    with open(path, "r") as f:
+        text = strip_comments(f.read())
+    functions = []
+    for code, conditions in segments(text):
+        code = re.sub(r"\bextern\s+\"C\"\s*\{", " ", code)
+        for m in PROTOTYPE.finditer(code):
+            ret = " ".join(m.group("ret").split())
+            words = [w for w in ret.replace("*", " ").split() if w not in QUALIFIERS]
+            if not words:
+                continue
+            ret = " ".join(w for w in ret.split() if w not in QUALIFIERS)
+            params = parse_args(m.group("args"))
+            if params is None:
+                sys.stderr.write("%s: skipping %s\n" % (path, m.group("name")))
+                continue
+            functions.append((ret, m.group("name"), params, conditions))
+    return functions
+
+
+def block_size(params):
+    names = [n for _, n in params]
+    for candidate in BLOCK_SIZE_NAMES:
+        if candidate in names:
+            return candidate
+    return "0U"
+
+
+def wrapper(fid, ret, name, params, conditions, linker):
+    if linker == "armlink":
+        wrap, real = "$Sub$$" + name, "$Super$$" + name
+    else:
+        wrap, real = "__wrap_" + name, "__real_" + name
+    decl = ",\n  ".join(p for p, _ in params) if params else "void"
+    call = ", ".join(n for _, n in params)
+    returns = ret != "void"
+
+    lines = []
+    if conditions:
+        lines.append("#if %s" % " && ".join("(%s)" % c for c in conditions))
+    lines.append("extern %s %s(\n  %s);\n" % (ret, real, decl))
+    lines.append("%s %s(\n  %s)\n{" % (ret, wrap, decl))
+    if returns:
+        lines.append("  %s profileResult;\n" % ret)
+    lines.append("  ARM_PROFILE_ENTER(%dU, %s);" % (fid, block_size(params)))
+    if returns:
+        lines.append("  profileResult = %s(%s);" % (real, call))
+    else:
+        lines.append("  %s(%s);" % (real, call))
+    lines.append("  ARM_PROFILE_EXIT(%dU);" % fid)
+    if returns:
+        lines.append("\n  return (profileResult);")
+    lines.append("}")
+    if conditions:
+        lines.append("#endif")
+    lines.append("\n")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("headers", nargs="+", help="public headers to scan")
+    parser.add_argument("-o", "--output-dir", required=True, help="output directory")
+    parser.add_argument("--linker", choices=["gnu", "armlink"], default="gnu")
+    args = parser.parse_args()
+
+    functions = []
+    seen = set()
+    for h in args.headers:
+        for ret, name, params, conditions in parse_header(h):
+            if name.startswith("arm_profile_") or name in seen:
+                continue
+            seen.add(name)
+            functions.append((ret, name, params, conditions))
+
+    if len(functions) > 0xFFFF:
+        sys.exit("too many functions for 16-bit identifiers")
+
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+
+    includes = "".join('#include "dsp/%s"\n' % os.path.basename(h) for h in args.headers)
+    for fid, (ret, name, params, conditions) in enumerate(functions):
+        with open(os.path.join(args.output_dir, "arm_profile_wrap_%s.c" % name), "w") as f:
+            f.write("/* Generated by arm_profile_gen_wrappers.py: do not edit. */\n\n")
+            f.write("#ifndef ARM_MATH_PROFILE\n#define ARM_MATH_PROFILE\n#endif\n\n")
+            f.write('#include "arm_math_types.h"\n')
+            f.write('#include "dsp/profile_functions.h"\n')
+            f.write(includes)
+            f.write("\n")
+            f.write(wrapper(fid, ret, name, params, conditions, args.linker))
+
+    if args.linker == "gnu":
+        with open(os.path.join(args.output_dir, "arm_profile_wrappers.rsp"), "w") as f:
+            for _, name, _, _ in functions:
+                f.write("--wrap=%s\n" % name)
+
+    with open(os.path.join(args.output_dir, "arm_profile_functions.txt"), "w") as f:
+        for _, name, _, _ in functions:
+            f.write(name + "\n")
+
+
+if __name__ == "__main__":
+    main()
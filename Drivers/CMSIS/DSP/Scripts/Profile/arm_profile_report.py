@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010-2021 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Aggregate a CMSIS-DSP profiling dump into a per-function profile.
+
+The dump is a raw little-endian image of arm_profile_ring, for instance:
+
+  host:  fwrite(&arm_profile_ring, sizeof(arm_profile_ring), 1, f);
+  gdb:   dump binary memory prof.bin &arm_profile_ring (&arm_profile_ring + 1)
+
+The names file is arm_profile_functions.txt, written by arm_profile_gen_wrappers.py.
+
+Nested calls are accounted both ways: "total" includes the callees,
+"self" does not.
+"""
+
+import argparse
+import struct
+import sys
+
+ARM_PROFILE_MAGIC = 0x464F5250
+HEADER = struct.Struct("<IIII")
+RECORD = struct.Struct("<IIHH")
+EVENT_ENTER = 0
+EVENT_EXIT = 1
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit("%s: truncated dump" % path)
+    magic, size, head, _ = HEADER.unpack_from(data, 0)
+    if magic != ARM_PROFILE_MAGIC:
+        sys.exit("%s: bad magic 0x%08X" % (path, magic))
+    if len(data) < HEADER.size + size * RECORD.size:
+        sys.exit("%s: truncated dump" % path)
+    count = min(head, size)
+    records = []
+    for i in range(count):
+        index = (head - count + i) % size
+        records.append(RECORD.unpack_from(data, HEADER.size + index * RECORD.size))
+    return records, head - count
+
+
+def aggregate(records):
+    stats = {}
+    stack = []
+    unmatched = 0
+    for timestamp, block_size, fid, event in records:
+        if event == EVENT_ENTER:
+            stack.append([fid, timestamp, block_size, 0])
+            continue
+        if not stack or stack[-1][0] != fid:
+            # Entry lost in the ring wrap, or events from another context
+            unmatched += 1
+            stack = []
+            continue
+        _, start, block_size, children = stack.pop()
+        elapsed = (timestamp - start) & 0xFFFFFFFF
+        s = stats.setdefault(fid, {"calls": 0, "total": 0, "self": 0, "samples": 0})
+        s["calls"] += 1
+        s["total"] += elapsed
+        s["self"] += elapsed - children
+        s["samples"] += block_size
+        if stack:
+            stack[-1][3] += elapsed
+    return stats, unmatched
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="raw image of arm_profile_ring")
+    parser.add_argument("names", help="function names written by arm_profile_gen_wrappers.py")
+    parser.add_argument("--unit", default="cycles",
+                        help="unit of the timestamps (cycles on Cortex-M, ns on a host)")
+    parser.add_argument("--sort", choices=["self", "total", "calls"], default="self")
+    args = parser.parse_args()
+
+    with open(args.names, "r") as f:
+        names = [line.strip() for line in f]
+
+    records, lost = load(args.dump)
+    stats, unmatched = aggregate(records)
+
+    grand = sum(s["self"] for s in stats.values()) or 1
+    width = max([len("function")] + [len(names[i]) if i < len(names) else 8 for i in stats])
+    print("%-*s %10s %14s %14s %7s %12s %12s" % (width, "function", "calls", "self", "total",
+                                                 "self%", "per call", "per sample"))
+    for fid, s in sorted(stats.items(), key=lambda kv: kv[1][args.sort], reverse=True):
+        name = names[fid] if fid < len(names) else "id%d" % fid
+        per_sample = "%.2f" % (s["total"] / s["samples"]) if s["samples"] else "-"
+        print("%-*s %10d %14d %14d %6.1f%% %12.1f %12s" % (
+            width, name, s["calls"], s["self"], s["total"], 100.0 * s["self"] / grand,
+            s["total"] / s["calls"], per_sample))
+    print("\ntime unit: %s" % args.unit)
+    if lost:
+        print("%d older events overwritten by the ring" % lost)
+    if unmatched:
+        print("%d exit events without a matching entry ignored" % unmatched)
+
+
+if __name__ == "__main__":
+    main()
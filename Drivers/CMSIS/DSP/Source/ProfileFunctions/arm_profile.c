@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_profile.c
+ * Description:  Event ring and time base used by the profiling hooks
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/profile_functions.h"
+
+#if !defined(ARM_PROFILE_TIMESTAMP)
+  #if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    /* Architectural DWT / CoreDebug addresses: no device header needed */
+    #define ARM_PROFILE_DWT_CTRL      (*(volatile uint32_t *) 0xE0001000UL)
+    #define ARM_PROFILE_DWT_CYCCNT    (*(volatile uint32_t *) 0xE0001004UL)
+    #define ARM_PROFILE_DEMCR         (*(volatile uint32_t *) 0xE000EDFCUL)
+    #define ARM_PROFILE_TIMESTAMP()   ARM_PROFILE_DWT_CYCCNT
+  #else
+    #include <time.h>
+    #define ARM_PROFILE_HOST_CLOCK
+  #endif
+#endif
+
+/*
+ * Writers reserve a slot with an atomic increment of head, so hooks can be
+ * called from several threads or interrupt levels without a lock. A reader
+ * racing with a writer may see the record being overwritten: stop the
+ * workload (or accept one torn record) before reading the ring.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__ARM_ARCH_6M__)
+  #define ARM_PROFILE_RESERVE()     __atomic_fetch_add(&arm_profile_ring.head, 1U, __ATOMIC_RELAXED)
+#else
+  /* No lock-free increment available: single execution context only */
+  #define ARM_PROFILE_RESERVE()     (arm_profile_ring.head++)
+#endif
+
+/**
+  @ingroup groupProfile
+ */
+
+/**
+  @addtogroup groupProfile
+  @{
+ */
+
+arm_profile_ring_t arm_profile_ring = {
+  ARM_PROFILE_MAGIC,
+  ARM_PROFILE_RING_SIZE,
+  0U,
+  0U,
+  { { 0U, 0U, 0U, 0U } }
+};
+
+/**
+  @brief         Enables the time base and empties the ring.
+  @return        none
+
+  @par           Details
+                   On Cortex-M, the DWT cycle counter is enabled. It must be
+                   implemented by the core (it is optional on Armv6-M and Armv8-M baseline).
+ */
+void arm_profile_init(void)
+{
+#if defined(ARM_PROFILE_DWT_CYCCNT)
+  ARM_PROFILE_DEMCR |= (1UL << 24);       /* TRCENA */
+  ARM_PROFILE_DWT_CYCCNT = 0U;
+  ARM_PROFILE_DWT_CTRL |= 1UL;            /* CYCCNTENA */
+#endif
+
+  arm_profile_reset();
+}
+
+/**
+  @brief         Empties the ring.
+  @return        none
+ */
+void arm_profile_reset(void)
+{
+  arm_profile_ring.magic = ARM_PROFILE_MAGIC;
+  arm_profile_ring.numRecords = ARM_PROFILE_RING_SIZE;
+  arm_profile_ring.head = 0U;
+}
+
+/**
+  @brief         Returns the current timestamp.
+  @return        DWT cycle count on Cortex-M, nanoseconds (modulo 2^32) elsewhere
+ */
+uint32_t arm_profile_timestamp(void)
+{
+#if defined(ARM_PROFILE_HOST_CLOCK)
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((uint32_t) ((uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec));
+#else
+  return ((uint32_t) ARM_PROFILE_TIMESTAMP());
+#endif
+}
+
+/**
+  @brief         Records a function entry.
+  @param[in]     id         function identifier
+  @param[in]     blockSize  block size of the call
+  @return        none
+ */
+void arm_profile_enter(
+  uint16_t id,
+  uint32_t blockSize)
+{
+  arm_profile_record *pRec;
+
+  pRec = &arm_profile_ring.records[ARM_PROFILE_RESERVE() & (ARM_PROFILE_RING_SIZE - 1U)];
+  pRec->id = id;
+  pRec->event = ARM_PROFILE_EVENT_ENTER;
+  pRec->blockSize = blockSize;
+  /* Read the time last so that the hook overhead is not charged to the callee */
+  pRec->timestamp = arm_profile_timestamp();
+}
+
+/**
+  @brief         Records a function exit.
+  @param[in]     id         function identifier
+  @return        none
+ */
+void arm_profile_exit(
+  uint16_t id)
+{
+  arm_profile_record *pRec;
+  uint32_t timestamp;
+
+  /* Read the time first so that the hook overhead is not charged to the callee */
+  timestamp = arm_profile_timestamp();
+
+  pRec = &arm_profile_ring.records[ARM_PROFILE_RESERVE() & (ARM_PROFILE_RING_SIZE - 1U)];
+  pRec->timestamp = timestamp;
+  pRec->blockSize = 0U;
+  pRec->id = id;
+  pRec->event = ARM_PROFILE_EVENT_EXIT;
+}
+
+/**
+  @brief         Copies the retained events in chronological order.
+  @param[out]    pDst        points to the destination records
+  @param[in]     maxRecords  capacity of the destination
+  @return        number of records copied
+
+  @par           Details
+                   When more than ARM_PROFILE_RING_SIZE events were recorded, only
+                   the most recent ones are retained. At most maxRecords of the most
+                   recent events are returned.
+ */
+uint32_t arm_profile_read(
+  arm_profile_record * pDst,
+  uint32_t maxRecords)
+{
+  uint32_t head = arm_profile_ring.head;
+  uint32_t count = (head < ARM_PROFILE_RING_SIZE) ? head : ARM_PROFILE_RING_SIZE;
+  uint32_t i;
+
+  if (count > maxRecords)
+  {
+    count = maxRecords;
+  }
+
+  for (i = 0U; i < count; i++)
+  {
+    pDst[i] = arm_profile_ring.records[(head - count + i) & (ARM_PROFILE_RING_SIZE - 1U)];
+  }
+
+  return (count);
+}
+
+/**
+  @} end of groupProfile group
+ */
@@ -61,3 +61,12 @@
 #include "arm_q7_to_float.c"
 #include "arm_q7_to_q15.c"
 #include "arm_q7_to_q31.c"
+
+#include "arm_quantize_f32_s8.c"
+#include "arm_quantize_f32_s16.c"
+#include "arm_quantize_per_channel_f32_s8.c"
+#include "arm_quantize_per_channel_f32_s16.c"
+#include "arm_dequantize_s8_f32.c"
+#include "arm_dequantize_s16_f32.c"
+#include "arm_dequantize_per_channel_s8_f32.c"
+#include "arm_dequantize_per_channel_s16_f32.c"
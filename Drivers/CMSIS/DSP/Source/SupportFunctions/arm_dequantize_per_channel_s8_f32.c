@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dequantize_per_channel_s8_f32.c
+ * Description:  Per-channel affine dequantization of an int8 tensor to floating-point
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup quantize_x
+  @{
+ */
+
+/**
+  @brief         Dequantizes a channel-last int8 tensor to floating-point with per-channel scales.
+  @param[in]     pSrc         points to the int8 input tensor
+  @param[out]    pDst         points to the floating-point output tensor
+  @param[in]     numVectors   number of vectors of numChannels samples
+  @param[in]     numChannels  number of channels (innermost dimension)
+  @param[in]     pScale       points to the numChannels quantization scales
+  @param[in]     pZeroPoint   points to the numChannels zero points, or NULL for symmetric quantization
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[v * numChannels + c] = pScale[c] * (pSrc[v * numChannels + c] - pZeroPoint[c]);
+  </pre>
+ */
+void arm_dequantize_per_channel_s8_f32(
+  const q7_t * pSrc,
+        float32_t * pDst,
+        uint32_t numVectors,
+        uint32_t numChannels,
+  const float32_t * pScale,
+  const int32_t * pZeroPoint)
+{
+        uint32_t chan = 0U;                            /* Channel index */
+        uint32_t blkCnt;                               /* Loop counter */
+  const q7_t *pIn;                                     /* Source pointer */
+        float32_t *pOut;                               /* Destination pointer */
+
+#if ((defined(ARM_MATH_MVEF) || defined(ARM_MATH_NEON)) && !defined(ARM_MATH_AUTOVECTORIZE))
+  static const int32_t zeros[4] = { 0, 0, 0, 0 };
+
+  /* Compute 4 channels at a time.
+   ** a second loop below computes the remaining 1 to 3 channels. */
+  for (; chan + 4U <= numChannels; chan += 4U)
+  {
+    const int32_t *pZp = (pZeroPoint != NULL) ? &pZeroPoint[chan] : zeros;
+
+#if defined(ARM_MATH_MVEF)
+    f32x4_t   scaleV = vld1q(&pScale[chan]);
+    int32x4_t zeroPointV = vld1q(pZp);
+#else
+    float32x4_t scaleV = vld1q_f32(&pScale[chan]);
+    int32x4_t zeroPointV = vld1q_s32(pZp);
+    int16x8_t inV;
+#endif
+
+    pIn = pSrc + chan;
+    pOut = pDst + chan;
+    blkCnt = numVectors;
+
+    while (blkCnt > 0U)
+    {
+#if defined(ARM_MATH_MVEF)
+      vst1q(pOut, vmulq(vcvtq_f32_s32(vsubq(vldrbq_s32(pIn), zeroPointV)), scaleV));
+#else
+      /* Load exactly 4 bytes: the row may end the tensor */
+      inV = vmovl_s8(vreinterpret_s8_s32(vld1_lane_s32((const int32_t *) pIn, vdup_n_s32(0), 0)));
+      vst1q_f32(pOut, vmulq_f32(vcvtq_f32_s32(vsubq_s32(vmovl_s16(vget_low_s16(inV)), zeroPointV)), scaleV));
+#endif
+      pIn += numChannels;
+      pOut += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+#endif /* ((defined(ARM_MATH_MVEF) || defined(ARM_MATH_NEON)) && !defined(ARM_MATH_AUTOVECTORIZE)) */
+
+  for (; chan < numChannels; chan++)
+  {
+    float32_t scaleC = pScale[chan];
+    int32_t zeroPointC = (pZeroPoint != NULL) ? pZeroPoint[chan] : 0;
+
+    pIn = pSrc + chan;
+    pOut = pDst + chan;
+    blkCnt = numVectors;
+
+    while (blkCnt > 0U)
+    {
+      /* C = scale[c] * (A - zeroPoint[c]) */
+      *pOut = scaleC * (float32_t) ((int32_t) *pIn - zeroPointC);
+      pIn += numChannels;
+      pOut += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+  @} end of quantize_x group
+ */
@@ -0,0 +1,201 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dequantize_s8_f32.c
+ * Description:  Affine dequantization of an int8 vector to floating-point
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup quantize_x
+  @{
+ */
+
+/**
+  @brief         Dequantizes an int8 vector to floating-point with an affine mapping.
+  @param[in]     pSrc       points to the int8 input vector
+  @param[out]    pDst       points to the floating-point output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     scale      quantization scale
+  @param[in]     zeroPoint  quantization zero point
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = scale * (pSrc[n] - zeroPoint);   0 <= n < blockSize.
+  </pre>
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_dequantize_s8_f32(
+  const q7_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    int32x4_t vecSrc;
+
+    blkCnt = blockSize >> 2;
+    while (blkCnt > 0U)
+    {
+        /* C = scale * (A - zeroPoint) */
+        vecSrc = vldrbq_s32(pSrc);
+        pSrc += 4;
+        vstrwq(pDst, vmulq(vcvtq_f32_s32(vsubq(vecSrc, zeroPoint)), scale));
+        pDst += 4;
+        /*
+         * Decrement the blockSize loop counter
+         */
+        blkCnt--;
+    }
+
+  blkCnt = blockSize & 3;
+  while (blkCnt > 0U)
+  {
+    /* C = scale * (A - zeroPoint) */
+    *pDst++ = scale * (float32_t) ((int32_t) *pSrc++ - zeroPoint);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+#else
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_dequantize_s8_f32(
+  const q7_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint)
+{
+  const q7_t *pIn = pSrc;                              /* Src pointer */
+  uint32_t blkCnt;                               /* loop counter */
+
+  int8x16_t inV;
+  int16x8_t inVLO, inVHI;
+  int32x4_t zeroPointV = vdupq_n_s32(zeroPoint);
+
+  blkCnt = blockSize >> 4U;
+
+  /* Compute 16 outputs at a time.
+   ** a second loop below computes the remaining 1 to 15 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = scale * (A - zeroPoint) */
+    inV = vld1q_s8(pIn);
+    pIn += 16;
+
+    inVLO = vmovl_s8(vget_low_s8(inV));
+    inVHI = vmovl_s8(vget_high_s8(inV));
+
+    vst1q_f32(pDst, vmulq_n_f32(vcvtq_f32_s32(vsubq_s32(vmovl_s16(vget_low_s16(inVLO)), zeroPointV)), scale));
+    pDst += 4;
+
+    vst1q_f32(pDst, vmulq_n_f32(vcvtq_f32_s32(vsubq_s32(vmovl_s16(vget_high_s16(inVLO)), zeroPointV)), scale));
+    pDst += 4;
+
+    vst1q_f32(pDst, vmulq_n_f32(vcvtq_f32_s32(vsubq_s32(vmovl_s16(vget_low_s16(inVHI)), zeroPointV)), scale));
+    pDst += 4;
+
+    vst1q_f32(pDst, vmulq_n_f32(vcvtq_f32_s32(vsubq_s32(vmovl_s16(vget_high_s16(inVHI)), zeroPointV)), scale));
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize & 0xF;
+
+  while (blkCnt > 0U)
+  {
+    /* C = scale * (A - zeroPoint) */
+    *pDst++ = scale * (float32_t) ((int32_t) *pIn++ - zeroPoint);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+#else
+void arm_dequantize_s8_f32(
+  const q7_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+  const q7_t *pIn = pSrc;                              /* Source pointer */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = scale * (A - zeroPoint) */
+    *pDst++ = scale * (float32_t) ((int32_t) *pIn++ - zeroPoint);
+    *pDst++ = scale * (float32_t) ((int32_t) *pIn++ - zeroPoint);
+    *pDst++ = scale * (float32_t) ((int32_t) *pIn++ - zeroPoint);
+    *pDst++ = scale * (float32_t) ((int32_t) *pIn++ - zeroPoint);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = scale * (A - zeroPoint) */
+    *pDst++ = scale * (float32_t) ((int32_t) *pIn++ - zeroPoint);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+}
+#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of quantize_x group
+ */
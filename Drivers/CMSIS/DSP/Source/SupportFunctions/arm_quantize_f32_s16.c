@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quantize_f32_s16.c
+ * Description:  Affine quantization of a floating-point vector to int16
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_vec_quantize.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup quantize_x
+  @{
+ */
+
+/**
+  @brief         Quantizes a floating-point vector to int16 with an affine mapping.
+  @param[in]     pSrc       points to the floating-point input vector
+  @param[out]    pDst       points to the int16 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     scale      quantization scale
+  @param[in]     zeroPoint  quantization zero point, in [-32768 32767]
+  @param[in]     rounding   rounding mode
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = clamp(round(pSrc[n] / scale) + zeroPoint, -32768, 32767);   0 <= n < blockSize.
+  </pre>
+                   The result is that of a division by scale on all code paths, the vector
+                   versions correct the product with the reciprocal by one fused multiply-add
+                   step. NaN inputs are quantized to the lowest value.
+                   ARM_QUANT_ROUND_HALF_AWAY matches the TensorFlow Lite reference quantizer.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_quantize_f32_s16(
+  const float32_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint,
+        arm_quant_rounding rounding)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    float32_t invScale = 1.0f / scale;
+    float32_t lo = (float32_t) (-32768 - zeroPoint);
+    float32_t hi = (float32_t) (32767 - zeroPoint);
+    f32x4_t   scaleV = vdupq_n_f32(scale);
+    f32x4_t   invScaleV = vdupq_n_f32(invScale);
+    f32x4_t   loV = vdupq_n_f32(lo);
+    f32x4_t   hiV = vdupq_n_f32(hi);
+    int32x4_t zeroPointV = vdupq_n_s32(zeroPoint);
+    int32x4_t vecDst;
+
+    blkCnt = blockSize >> 2;
+    while (blkCnt > 0U)
+    {
+        /* C = clamp(round(A / scale) + zeroPoint) */
+        vecDst = arm_vec_quantize_f32(vld1q(pSrc), scaleV, invScaleV, zeroPointV, loV, hiV, rounding);
+        pSrc += 4;
+        vstrhq_s32(pDst, vecDst);
+        pDst += 4;
+        /*
+         * Decrement the blockSize loop counter
+         */
+        blkCnt--;
+    }
+
+    blkCnt = blockSize & 3;
+    while (blkCnt > 0U)
+    {
+      /* C = clamp(round(A / scale) + zeroPoint) */
+      *pDst++ = (q15_t) arm_quantize_sample_f32(*pSrc++, scale, zeroPoint, lo, hi, rounding);
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+}
+#else
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_quantize_f32_s16(
+  const float32_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint,
+        arm_quant_rounding rounding)
+{
+  const float32_t *pIn = pSrc;                         /* Src pointer */
+  uint32_t blkCnt;                               /* loop counter */
+  float32_t invScale = 1.0f / scale;
+  float32_t lo = (float32_t) (-32768 - zeroPoint);
+  float32_t hi = (float32_t) (32767 - zeroPoint);
+
+  float32x4_t scaleV = vdupq_n_f32(scale);
+  float32x4_t invScaleV = vdupq_n_f32(invScale);
+  float32x4_t loV = vdupq_n_f32(lo);
+  float32x4_t hiV = vdupq_n_f32(hi);
+  int32x4_t zeroPointV = vdupq_n_s32(zeroPoint);
+  int32x4_t cvt0, cvt1;
+
+  blkCnt = blockSize >> 3U;
+
+  /* Compute 8 outputs at a time.
+   ** a second loop below computes the remaining 1 to 7 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = clamp(round(A / scale) + zeroPoint) */
+    cvt0 = arm_vec_quantize_f32(vld1q_f32(pIn), scaleV, invScaleV, zeroPointV, loV, hiV, rounding);
+    cvt1 = arm_vec_quantize_f32(vld1q_f32(pIn + 4), scaleV, invScaleV, zeroPointV, loV, hiV, rounding);
+    pIn += 8;
+
+    /* Values are already within [-32768 32767]: plain narrowing is enough */
+    vst1q_s16(pDst, vcombine_s16(vmovn_s32(cvt0), vmovn_s32(cvt1)));
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize & 0x7;
+
+  while (blkCnt > 0U)
+  {
+    /* C = clamp(round(A / scale) + zeroPoint) */
+    *pDst++ = (q15_t) arm_quantize_sample_f32(*pIn++, scale, zeroPoint, lo, hi, rounding);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+#else
+void arm_quantize_f32_s16(
+  const float32_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize,
+        float32_t scale,
+        int32_t zeroPoint,
+        arm_quant_rounding rounding)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t lo = (float32_t) (-32768 - zeroPoint);
+        float32_t hi = (float32_t) (32767 - zeroPoint);
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = clamp(round(A / scale) + zeroPoint) */
+    *pDst++ = (q15_t) arm_quantize_sample_f32(*pIn++, scale, zeroPoint, lo, hi, rounding);
+    *pDst++ = (q15_t) arm_quantize_sample_f32(*pIn++, scale, zeroPoint, lo, hi, rounding);
+    *pDst++ = (q15_t) arm_quantize_sample_f32(*pIn++, scale, zeroPoint, lo, hi, rounding);
+    *pDst++ = (q15_t) arm_quantize_sample_f32(*pIn++, scale, zeroPoint, lo, hi, rounding);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = clamp(round(A / scale) + zeroPoint) */
+    *pDst++ = (q15_t) arm_quantize_sample_f32(*pIn++, scale, zeroPoint, lo, hi, rounding);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+}
+#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of quantize_x group
+ */
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quantize_per_channel_f32_s8.c
+ * Description:  Per-channel affine quantization of a floating-point tensor to int8
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_vec_quantize.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup quantize_x
+  @{
+ */
+
+/**
+  @brief         Quantizes a channel-last floating-point tensor to int8 with per-channel scales.
+  @param[in]     pSrc         points to the floating-point input tensor
+  @param[out]    pDst         points to the int8 output tensor
+  @param[in]     numVectors   number of vectors of numChannels samples
+  @param[in]     numChannels  number of channels (innermost dimension)
+  @param[in]     pScale       points to the numChannels quantization scales
+  @param[in]     pZeroPoint   points to the numChannels zero points, or NULL for symmetric quantization
+  @param[in]     rounding     rounding mode
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[v * numChannels + c] = clamp(round(pSrc[v * numChannels + c] / pScale[c]) + pZeroPoint[c], -128, 127);
+  </pre>
+                   The tensor is processed channel group by channel group so that the
+                   reciprocal of each scale (used by the vector versions, which correct
+                   the product to the quotient) is computed only once.
+ */
+void arm_quantize_per_channel_f32_s8(
+  const float32_t * pSrc,
+        q7_t * pDst,
+        uint32_t numVectors,
+        uint32_t numChannels,
+  const float32_t * pScale,
+  const int32_t * pZeroPoint,
+        arm_quant_rounding rounding)
+{
+        uint32_t chan = 0U;                            /* Channel index */
+        uint32_t blkCnt;                               /* Loop counter */
+  const float32_t *pIn;                                /* Source pointer */
+        q7_t *pOut;                                    /* Destination pointer */
+
+#if ((defined(ARM_MATH_MVEF) || defined(ARM_MATH_NEON)) && !defined(ARM_MATH_AUTOVECTORIZE))
+  float32_t invScale[4];
+  int32_t zeroPoint[4];
+  uint32_t i;
+
+  /* Compute 4 channels at a time.
+   ** a second loop below computes the remaining 1 to 3 channels. */
+  for (; chan + 4U <= numChannels; chan += 4U)
+  {
+    for (i = 0U; i < 4U; i++)
+    {
+      invScale[i] = 1.0f / pScale[chan + i];
+      zeroPoint[i] = (pZeroPoint != NULL) ? pZeroPoint[chan + i] : 0;
+    }
+
+#if defined(ARM_MATH_MVEF)
+    f32x4_t   scaleV = vld1q(&pScale[chan]);
+    f32x4_t   invScaleV = vld1q(invScale);
+    int32x4_t zeroPointV = vld1q(zeroPoint);
+    f32x4_t   loV = vcvtq_f32_s32(vsubq(vdupq_n_s32(-128), zeroPointV));
+    f32x4_t   hiV = vcvtq_f32_s32(vsubq(vdupq_n_s32(127), zeroPointV));
+#else
+    float32x4_t scaleV = vld1q_f32(&pScale[chan]);
+    float32x4_t invScaleV = vld1q_f32(invScale);
+    int32x4_t zeroPointV = vld1q_s32(zeroPoint);
+    float32x4_t loV = vcvtq_f32_s32(vsubq_s32(vdupq_n_s32(-128), zeroPointV));
+    float32x4_t hiV = vcvtq_f32_s32(vsubq_s32(vdupq_n_s32(127), zeroPointV));
+    int16x4_t outV;
+    int8x8_t out8V;
+#endif
+
+    pIn = pSrc + chan;
+    pOut = pDst + chan;
+    blkCnt = numVectors;
+
+    while (blkCnt > 0U)
+    {
+#if defined(ARM_MATH_MVEF)
+      vstrbq_s32(pOut, arm_vec_quantize_f32(vld1q(pIn), scaleV, invScaleV, zeroPointV, loV, hiV, rounding));
+#else
+      /* Values are already within [-128 127]: plain narrowing is enough */
+      outV = vmovn_s32(arm_vec_quantize_f32(vld1q_f32(pIn), scaleV, invScaleV, zeroPointV, loV, hiV, rounding));
+      out8V = vmovn_s16(vcombine_s16(outV, outV));
+
+      /* pOut is only byte aligned: store the 4 lanes one by one */
+      vst1_lane_s8(pOut, out8V, 0);
+      vst1_lane_s8(pOut + 1, out8V, 1);
+      vst1_lane_s8(pOut + 2, out8V, 2);
+      vst1_lane_s8(pOut + 3, out8V, 3);
+#endif
+      pIn += numChannels;
+      pOut += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+#endif /* ((defined(ARM_MATH_MVEF) || defined(ARM_MATH_NEON)) && !defined(ARM_MATH_AUTOVECTORIZE)) */
+
+  for (; chan < numChannels; chan++)
+  {
+    float32_t scaleC = pScale[chan];
+    int32_t zeroPointC = (pZeroPoint != NULL) ? pZeroPoint[chan] : 0;
+    float32_t lo = (float32_t) (-128 - zeroPointC);
+    float32_t hi = (float32_t) (127 - zeroPointC);
+
+    pIn = pSrc + chan;
+    pOut = pDst + chan;
+    blkCnt = numVectors;
+
+    while (blkCnt > 0U)
+    {
+      /* C = clamp(round(A / scale[c]) + zeroPoint[c]) */
+      *pOut = (q7_t) arm_quantize_sample_f32(*pIn, scaleC, zeroPointC, lo, hi, rounding);
+      pIn += numChannels;
+      pOut += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+  @} end of quantize_x group
+ */
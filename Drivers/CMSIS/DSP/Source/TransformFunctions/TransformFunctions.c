@@ -50,6 +50,8 @@
 
 #include "arm_mfcc_init_f32.c"
 #include "arm_mfcc_f32.c"
+#include "arm_logmel_f32.c"
+#include "arm_logmel_batch_f32.c"
 
 #include "arm_mfcc_init_q31.c"
 #include "arm_mfcc_q31.c"
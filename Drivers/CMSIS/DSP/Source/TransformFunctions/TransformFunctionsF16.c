@@ -38,6 +38,8 @@
 
 #include "arm_mfcc_init_f16.c"
 #include "arm_mfcc_f16.c"
+#include "arm_logmel_f16.c"
+#include "arm_logmel_batch_f16.c"
 
 /* Deprecated */
 #include "arm_cfft_radix2_init_f16.c"
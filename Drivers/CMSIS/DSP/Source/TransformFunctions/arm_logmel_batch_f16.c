@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_logmel_batch_f16.c
+ * Description:  Log-mel spectrum of a sequence of overlapping frames
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "dsp/transform_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupTransforms
+ */
+
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Log-mel spectrum F16 of a batch of frames
+  @param[in]     S          points to the mfcc instance structure
+  @param[in]     pSrc       points to the input signal
+  @param[in]     hopLength  number of samples between the start of two frames
+  @param[in]     numFrames  number of frames
+  @param[out]    pDst       points to the output log-mel values
+  @param[inout]  pTmp       points to a temporary buffer
+
+  @return        none
+
+  @par           Description
+                   Frame n starts at pSrc + n * hopLength and has fftLen samples.
+                   Its nbMelFilters log-mel values are written at
+                   pDst + n * nbMelFilters, so the output is a
+                   numFrames x nbMelFilters row-major matrix.
+                   The input signal must hold
+                   (numFrames - 1) * hopLength + fftLen samples.
+
+                   The frames may overlap: the input is not modified.
+                   The temporary buffer is the one of arm_logmel_f16(),
+                   reused for all frames.
+ */
+void arm_logmel_batch_f16(
+  const arm_mfcc_instance_f16 * S,
+  const float16_t *pSrc,
+  uint32_t hopLength,
+  uint32_t numFrames,
+  float16_t *pDst,
+  float16_t *pTmp
+  )
+{
+  while (numFrames > 0U)
+  {
+    arm_logmel_f16(S, pSrc, pDst, pTmp);
+
+    pSrc += hopLength;
+    pDst += S->nbMelFilters;
+
+    numFrames--;
+  }
+}
+
+#endif /* defined(ARM_FLOAT16_SUPPORTED) */
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_logmel_f16.c
+ * Description:  Log-mel spectrum of a frame, fused MFCC front end
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2021 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "dsp/transform_functions_f16.h"
+#include "dsp/statistics_functions_f16.h"
+#include "dsp/basic_math_functions_f16.h"
+#include "dsp/complex_math_functions_f16.h"
+#include "dsp/fast_math_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupTransforms
+ */
+
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Log-mel spectrum F16
+  @param[in]     S     points to the mfcc instance structure
+  @param[in]     pSrc  points to the input samples
+  @param[out]    pDst  points to the output log-mel values
+  @param[inout]  pTmp  points to a temporary buffer
+
+  @return        none
+
+  @par           Description
+                   Computes the nbMelFilters log-mel energies of a frame of
+                   fftLen samples. They are the values arm_mfcc_f16() passes
+                   to the DCT, so the MFCC of the frame is the product of the
+                   DCT matrix of the instance with pDst.
+
+                   Compared to arm_mfcc_f16():
+                   - the input is not modified;
+                   - normalization and windowing are done in a single pass;
+                   - the spectrum magnitude is computed in place, in the
+                     FFT output, and only for the bins covered by the filters;
+                   - the log is computed directly in the output buffer.
+
+                   The filter positions must be non-decreasing, which is the
+                   case for filterbanks generated by the CMSIS-DSP scripts.
+
+                   The temporary buffer has a 2*fft length size when MFCC
+                   is implemented with CFFT.
+                   It has length 2 * FFT Length + 2 when implemented with RFFT
+                   (default implementation).
+ */
+void arm_logmel_f16(
+  const arm_mfcc_instance_f16 * S,
+  const float16_t *pSrc,
+  float16_t *pDst,
+  float16_t *pTmp
+  )
+{
+  float16_t maxValue;
+  float16_t invMax;
+  uint32_t  index;
+  uint32_t  blkCnt;
+  uint32_t  i;
+  uint32_t  magDone;
+  float16_t result;
+  const float16_t *pIn = pSrc;
+  const float16_t *pWin = S->windowCoefs;
+  const float16_t *coefs = S->filterCoefs;
+  float16_t *pOut = pTmp;
+  float16_t *pSpec;
+
+  /* Normalize and multiply by window in a single pass */
+  arm_absmax_f16(pSrc,S->fftLen,&maxValue,&index);
+  invMax = ((_Float16)maxValue != 0.0f16) ? 1.0f16 / (_Float16)maxValue : 0.0f16;
+
+#if defined(ARM_MFCC_CFFT_BASED)
+  /* The windowed frame is written as complex data, ready for the CFFT */
+  blkCnt = S->fftLen;
+  while (blkCnt > 0U)
+  {
+    *pOut++ = ((_Float16)*pIn++ * (_Float16)invMax) * (_Float16)*pWin++;
+    *pOut++ = 0.0f16;
+
+    blkCnt--;
+  }
+
+  arm_cfft_f16(&(S->cfft),pTmp,0,1);
+  pSpec = pTmp;
+#else
+
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+  blkCnt = S->fftLen >> 3;
+  while (blkCnt > 0U)
+  {
+    vst1q(pOut, vmulq(vmulq(vld1q(pIn), invMax), vld1q(pWin)));
+    pIn += 8;
+    pWin += 8;
+    pOut += 8;
+
+    blkCnt--;
+  }
+  blkCnt = S->fftLen & 7;
+#elif defined(ARM_MATH_NEON_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+  blkCnt = S->fftLen >> 3;
+  while (blkCnt > 0U)
+  {
+    vst1q_f16(pOut, vmulq_f16(vmulq_n_f16(vld1q_f16(pIn), invMax), vld1q_f16(pWin)));
+    pIn += 8;
+    pWin += 8;
+    pOut += 8;
+
+    blkCnt--;
+  }
+  blkCnt = S->fftLen & 7;
+#else
+  blkCnt = S->fftLen;
+#endif
+
+  while (blkCnt > 0U)
+  {
+    *pOut++ = ((_Float16)*pIn++ * (_Float16)invMax) * (_Float16)*pWin++;
+
+    blkCnt--;
+  }
+
+  /* Default RFFT based implementation */
+  pSpec = pTmp + S->fftLen;
+  arm_rfft_fast_f16(&(S->rfft),pTmp,pSpec,0);
+  /* Unpack real values */
+  pSpec[S->fftLen]=pSpec[1];
+  pSpec[S->fftLen+1]=0.0f16;
+  pSpec[1]=0.0f16;
+#endif
+
+  /* Apply MEL filters.
+     Bin k magnitude is stored at pSpec[k]: this location holds
+     parts of bin k/2, already consumed when bins are visited in
+     increasing order. Bins no filter covers are never computed. */
+  magDone = 0;
+  for(i=0; i<S->nbMelFilters; i++)
+  {
+      uint32_t start = S->filterPos[i];
+      uint32_t end = start + S->filterLengths[i];
+
+      if (magDone < start)
+      {
+        magDone = start;
+      }
+      if (end > magDone)
+      {
+        arm_cmplx_mag_f16(pSpec + 2*magDone, pSpec + magDone, end - magDone);
+        magDone = end;
+      }
+
+      arm_dot_prod_f16(pSpec+start,
+        coefs,
+        S->filterLengths[i],
+        &result);
+
+      coefs += S->filterLengths[i];
+
+      pDst[i] = result;
+  }
+
+  /* Compute the log */
+  arm_offset_f16(pDst,1.0e-4f16,pDst,S->nbMelFilters);
+  arm_vlog_f16(pDst,pDst,S->nbMelFilters);
+}
+
+#endif /* defined(ARM_FLOAT16_SUPPORTED) */
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark.h
+ * Description:  Shared definitions of the CMSIS-NN host benchmark
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef ARM_NN_BENCHMARK_H
+#define ARM_NN_BENCHMARK_H
+
+#include "arm_nnfunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A timed kernel is called until BENCH_MIN_TIME nanoseconds have elapsed, at most BENCH_MAX_ITER times */
+#define BENCH_MIN_TIME (50000000U)
+#define BENCH_MAX_ITER (10000)
+
+/* Set by --quick: every kernel is called once, for the bit-exactness checks only */
+extern int32_t bench_quick;
+
+/* Number of failed checks */
+extern int32_t bench_failures;
+
+/**
+ * @brief Time a kernel call
+ *
+ * @param[out]     time_ns   Time of one call in nanoseconds
+ * @param[in]      call      Statement to time. It is run once before the timing, so its results can be
+ *                           checked even with --quick.
+ */
+#define BENCH_TIME(time_ns, call)                                                                                      \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        uint32_t bench_start_;                                                                                         \
+        uint32_t bench_elapsed_ = 0;                                                                                   \
+        int32_t bench_iter_ = 0;                                                                                       \
+                                                                                                                       \
+        call;                                                                                                          \
+        bench_start_ = arm_nn_profile_timestamp();                                                                     \
+        while (!bench_quick && bench_elapsed_ < BENCH_MIN_TIME && bench_iter_ < BENCH_MAX_ITER)                        \
+        {                                                                                                              \
+            call;                                                                                                      \
+            bench_iter_++;                                                                                             \
+            bench_elapsed_ = arm_nn_profile_timestamp() - bench_start_;                                                \
+        }                                                                                                              \
+        (time_ns) = (bench_iter_ > 0) ? (double)bench_elapsed_ / bench_iter_ : 0.0;                                    \
+    } while (0)
+
+/**
+ * @brief Uniform random integer in [lo, hi], reproducible from run to run
+ */
+int32_t bench_rand(const int32_t lo, const int32_t hi);
+
+/**
+ * @brief Allocate and fill a buffer of random s8 values in [lo, hi]
+ */
+int8_t *bench_alloc_s8(const int32_t size, const int32_t lo, const int32_t hi);
+
+/**
+ * @brief Random per-channel requantization
+ *
+ * @param[out]     bias       num_ch biases, can be NULL
+ * @param[out]     mult       num_ch multipliers
+ * @param[out]     shift      num_ch shifts
+ * @param[in]      num_ch     Number of channels
+ * @param[in]      depth      Accumulation depth. The shifts are chosen so that the outputs of random data
+ *                            spread over the s8 range instead of saturating.
+ */
+void bench_fill_quant(int32_t *bias, int32_t *mult, int32_t *shift, const int32_t num_ch, const int32_t depth);
+
+/**
+ * @brief Check that two outputs are identical. A difference is reported and counted as a failure.
+ *
+ * @return         1 if the outputs are identical, 0 otherwise
+ */
+int32_t bench_check_exact(const char *name, const int8_t *output, const int8_t *ref, const int32_t size);
+
+/**
+ * @brief Print the title and the column names of a table
+ *
+ * @param[in]      title      Table title
+ * @param[in]      base_name  Name of the baseline the kernel is compared to, NULL for none
+ */
+void bench_header(const char *title, const char *base_name);
+
+/**
+ * @brief Print one line of a table
+ *
+ * @param[in]      name       Layer or shape
+ * @param[in]      macs       Multiply-accumulates of one call, 0 if not relevant
+ * @param[in]      time_ns    Time of one call of the kernel
+ * @param[in]      base_ns    Time of one call of the baseline, 0 for none
+ * @param[in]      exact      Result of the bit-exactness check
+ */
+void bench_report(const char *name,
+                  const uint64_t macs,
+                  const double time_ns,
+                  const double base_ns,
+                  const int32_t exact);
+
+/* Reference kernels, written for clarity. Same arguments as the CMSIS-NN function of the same name. */
+void ref_convolve_s8(const cmsis_nn_conv_params *conv_params,
+                     const cmsis_nn_per_channel_quant_params *quant_params,
+                     const cmsis_nn_dims *input_dims,
+                     const int8_t *input,
+                     const cmsis_nn_dims *filter_dims,
+                     const int8_t *filter,
+                     const int32_t *bias,
+                     const cmsis_nn_dims *output_dims,
+                     int8_t *output);
+
+void ref_depthwise_conv_s8(const cmsis_nn_dw_conv_params *dw_conv_params,
+                           const cmsis_nn_per_channel_quant_params *quant_params,
+                           const cmsis_nn_dims *input_dims,
+                           const int8_t *input,
+                           const cmsis_nn_dims *filter_dims,
+                           const int8_t *filter,
+                           const int32_t *bias,
+                           const cmsis_nn_dims *output_dims,
+                           int8_t *output);
+
+void ref_fully_connected_s8(const cmsis_nn_fc_params *fc_params,
+                            const cmsis_nn_per_tensor_quant_params *quant_params,
+                            const cmsis_nn_dims *input_dims,
+                            const int8_t *input,
+                            const cmsis_nn_dims *filter_dims,
+                            const int8_t *filter,
+                            const int32_t *bias,
+                            const cmsis_nn_dims *output_dims,
+                            int8_t *output);
+
+void ref_transpose_conv_s8(const cmsis_nn_conv_params *conv_params,
+                           const cmsis_nn_per_channel_quant_params *quant_params,
+                           const cmsis_nn_dims *input_dims,
+                           const int8_t *input,
+                           const cmsis_nn_dims *filter_dims,
+                           const int8_t *filter,
+                           const int32_t *bias,
+                           const cmsis_nn_dims *output_dims,
+                           int8_t *output);
+
+void ref_batch_matmul_s8(const cmsis_nn_bmm_params *bmm_params,
+                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                         const cmsis_nn_dims *input_lhs_dims,
+                         const int8_t *input_lhs,
+                         const cmsis_nn_dims *input_rhs_dims,
+                         const int8_t *input_rhs,
+                         const cmsis_nn_dims *output_dims,
+                         int8_t *output);
+
+void ref_pad_s8(const int8_t *input,
+                int8_t *output,
+                const int8_t pad_value,
+                const cmsis_nn_dims *input_size,
+                const cmsis_nn_dims *pre_pad,
+                const cmsis_nn_dims *post_pad);
+
+void ref_transpose_s8(const int8_t *input,
+                      int8_t *output,
+                      const cmsis_nn_dims *input_dims,
+                      const cmsis_nn_dims *output_dims,
+                      const cmsis_nn_transpose_params *transpose_params);
+
+/* Benchmark groups, selected by name on the command line */
+void bench_mobilenet(void);
+void bench_parallel(void);
+void bench_kernels(void);
+void bench_rnn(void);
+void bench_packed(void);
+void bench_s4(void);
+void bench_fused(void);
+void bench_conv3x3(void);
+void bench_stream(void);
+void bench_batch(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM_NN_BENCHMARK_H */
@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_batch.c
+ * Description:  Batched depthwise convolution and pooling against one call per image
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * The depthwise convolution kernels (3x3, opt and generic) and the s8
+ * average and max pooling on N = 2 to 4 images in one call, against the
+ * same kernel called once per image with N = 1. The outputs must be bit
+ * exact. The batched opt kernel gets its buffer for N > 1, which holds the
+ * columns of two images on DSP.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef arm_status (*bench_dw_kernel)(const cmsis_nn_context *ctx,
+                                      const cmsis_nn_dw_conv_params *dw_conv_params,
+                                      const cmsis_nn_per_channel_quant_params *quant_params,
+                                      const cmsis_nn_dims *input_dims,
+                                      const q7_t *input_data,
+                                      const cmsis_nn_dims *filter_dims,
+                                      const q7_t *filter_data,
+                                      const cmsis_nn_dims *bias_dims,
+                                      const int32_t *bias_data,
+                                      const cmsis_nn_dims *output_dims,
+                                      q7_t *output_data);
+
+typedef arm_status (*bench_pool_kernel)(const cmsis_nn_context *ctx,
+                                        const cmsis_nn_pool_params *pool_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data);
+
+/* The baseline: one call per image */
+static void dw_per_image(bench_dw_kernel kernel,
+                         const cmsis_nn_context *ctx,
+                         const cmsis_nn_dw_conv_params *dw_params,
+                         const cmsis_nn_per_channel_quant_params *quant_params,
+                         const cmsis_nn_dims *input_dims,
+                         const int8_t *input,
+                         const cmsis_nn_dims *filter_dims,
+                         const int8_t *filter,
+                         const cmsis_nn_dims *bias_dims,
+                         const int32_t *bias,
+                         const cmsis_nn_dims *output_dims,
+                         int8_t *output)
+{
+    const int32_t input_size = input_dims->h * input_dims->w * input_dims->c;
+    const int32_t output_size = output_dims->h * output_dims->w * output_dims->c;
+    cmsis_nn_dims image_input_dims = *input_dims;
+    cmsis_nn_dims image_output_dims = *output_dims;
+
+    image_input_dims.n = 1;
+    image_output_dims.n = 1;
+    for (int32_t i = 0; i < input_dims->n; i++)
+    {
+        kernel(ctx,
+               dw_params,
+               quant_params,
+               &image_input_dims,
+               input + i * input_size,
+               filter_dims,
+               filter,
+               bias_dims,
+               bias,
+               &image_output_dims,
+               output + i * output_size);
+    }
+}
+
+static void pool_per_image(bench_pool_kernel kernel,
+                           const cmsis_nn_context *ctx,
+                           const cmsis_nn_pool_params *pool_params,
+                           const cmsis_nn_dims *input_dims,
+                           const int8_t *input,
+                           const cmsis_nn_dims *filter_dims,
+                           const cmsis_nn_dims *output_dims,
+                           int8_t *output)
+{
+    const int32_t input_size = input_dims->h * input_dims->w * input_dims->c;
+    const int32_t output_size = output_dims->h * output_dims->w * output_dims->c;
+    cmsis_nn_dims image_input_dims = *input_dims;
+    cmsis_nn_dims image_output_dims = *output_dims;
+
+    image_input_dims.n = 1;
+    image_output_dims.n = 1;
+    for (int32_t i = 0; i < input_dims->n; i++)
+    {
+        kernel(ctx,
+               pool_params,
+               &image_input_dims,
+               input + i * input_size,
+               filter_dims,
+               &image_output_dims,
+               output + i * output_size);
+    }
+}
+
+static void bench_batch_dw(const char *layer,
+                           bench_dw_kernel kernel,
+                           const int32_t batches,
+                           const int32_t hw,
+                           const int32_t in_ch,
+                           const int32_t ch_mult,
+                           const int32_t kernel_size,
+                           const int32_t stride)
+{
+    const int32_t pad = kernel_size / 2;
+    const int32_t out_hw = (hw + 2 * pad - kernel_size) / stride + 1;
+    const int32_t out_ch = in_ch * ch_mult;
+    const cmsis_nn_dw_conv_params dw_params = {bench_rand(-127, 128),
+                                               bench_rand(-20, 20),
+                                               ch_mult,
+                                               {stride, stride},
+                                               {pad, pad},
+                                               {1, 1},
+                                               {-128, 127}};
+    const cmsis_nn_dims input_dims = {batches, hw, hw, in_ch};
+    const cmsis_nn_dims filter_dims = {1, kernel_size, kernel_size, out_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {batches, out_hw, out_hw, out_ch};
+    const int32_t out_size = batches * out_hw * out_hw * out_ch;
+    int8_t *input = bench_alloc_s8(batches * hw * hw * in_ch, -128, 127);
+    int8_t *filter = bench_alloc_s8(kernel_size * kernel_size * out_ch, -127, 127);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(out_ch * sizeof(int32_t));
+    const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+    int8_t *output = malloc(out_size);
+    int8_t *per_image = malloc(out_size);
+    cmsis_nn_context ctx;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    bench_fill_quant(bias, mult, shift, out_ch, kernel_size * kernel_size);
+    /* The size for N > 1 also covers the calls on one image */
+    ctx.size = arm_depthwise_conv_s8_opt_get_buffer_size(&input_dims, &filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+
+    /* Different fills, so that an image the batched call does not write fails the check */
+    memset(output, 0x55, out_size);
+    memset(per_image, 0x2a, out_size);
+    BENCH_TIME(time_ns,
+               kernel(&ctx, &dw_params, &quant_params, &input_dims, input, &filter_dims, filter, &bias_dims, bias,
+                      &output_dims, output));
+    BENCH_TIME(base_ns,
+               dw_per_image(kernel, &ctx, &dw_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                            &bias_dims, bias, &output_dims, per_image));
+
+    snprintf(name, sizeof(name), "%s N=%d", layer, (int)batches);
+    bench_report(name,
+                 (uint64_t)out_size * kernel_size * kernel_size,
+                 time_ns,
+                 base_ns,
+                 bench_check_exact(name, output, per_image, out_size));
+
+    free(ctx.buf);
+    free(per_image);
+    free(output);
+    free(shift);
+    free(mult);
+    free(bias);
+    free(filter);
+    free(input);
+}
+
+static void bench_batch_pool(const char *layer,
+                             bench_pool_kernel kernel,
+                             const int32_t batches,
+                             const int32_t hw,
+                             const int32_t ch,
+                             const int32_t kernel_size,
+                             const int32_t stride)
+{
+    const int32_t out_hw = (hw - kernel_size) / stride + 1;
+    const cmsis_nn_pool_params pool_params = {{stride, stride}, {0, 0}, {-100, 110}};
+    const cmsis_nn_dims input_dims = {batches, hw, hw, ch};
+    const cmsis_nn_dims filter_dims = {1, kernel_size, kernel_size, 1};
+    const cmsis_nn_dims output_dims = {batches, out_hw, out_hw, ch};
+    const int32_t out_size = batches * out_hw * out_hw * ch;
+    int8_t *input = bench_alloc_s8(batches * hw * hw * ch, -128, 127);
+    int8_t *output = malloc(out_size);
+    int8_t *per_image = malloc(out_size);
+    cmsis_nn_context ctx;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    /* Only the average pooling uses a buffer */
+    ctx.size = arm_avgpool_s8_get_buffer_size(out_hw, ch);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+
+    memset(output, 0x55, out_size);
+    memset(per_image, 0x2a, out_size);
+    BENCH_TIME(time_ns, kernel(&ctx, &pool_params, &input_dims, input, &filter_dims, &output_dims, output));
+    BENCH_TIME(base_ns,
+               pool_per_image(kernel, &ctx, &pool_params, &input_dims, input, &filter_dims, &output_dims, per_image));
+
+    snprintf(name, sizeof(name), "%s N=%d", layer, (int)batches);
+    bench_report(name,
+                 (uint64_t)out_size * kernel_size * kernel_size,
+                 time_ns,
+                 base_ns,
+                 bench_check_exact(name, output, per_image, out_size));
+
+    free(ctx.buf);
+    free(per_image);
+    free(output);
+    free(input);
+}
+
+void bench_batch(void)
+{
+    bench_header("Depthwise convolution and pooling on N images, against one call per image", "per image us");
+
+    for (int32_t batches = 2; batches <= 4; batches++)
+    {
+        /* MobileNet v1 0.25 depthwise layers, stride 1 and 2 */
+        bench_batch_dw("dw 3x3 16x16x64 s1", arm_depthwise_conv_3x3_s8, batches, 16, 64, 1, 3, 1);
+        bench_batch_dw("dw opt 3x3 16x16x64 s2", arm_depthwise_conv_s8_opt, batches, 16, 64, 1, 3, 2);
+        /* Channels not a multiple of 4, for the leftover channels of the opt kernel */
+        bench_batch_dw("dw opt 5x5 12x12x30 s1", arm_depthwise_conv_s8_opt, batches, 12, 30, 1, 5, 1);
+        bench_batch_dw("dw generic 3x3 12x12x16 x2", arm_depthwise_conv_s8, batches, 12, 16, 2, 3, 1);
+        /* Global average pooling of MobileNet v1 0.25, and a 2x2 and a 3x3 pooling */
+        bench_batch_pool("avgpool 4x4 4x4x256", arm_avgpool_s8, batches, 4, 256, 4, 1);
+        bench_batch_pool("avgpool 2x2 16x16x30 s2", arm_avgpool_s8, batches, 16, 30, 2, 2);
+        bench_batch_pool("maxpool 3x3 16x16x30 s2", arm_max_pool_s8, batches, 16, 30, 3, 2);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_conv3x3.c
+ * Description:  Row buffer 3x3 convolution against the im2col convolution
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * arm_convolve_3x3_s8() against arm_convolve_s8(), per shape. The name of each
+ * shape gives the buffer sizes of the two, in bytes.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static void bench_conv3x3_shape(const int32_t hw, const int32_t in_ch, const int32_t out_ch, const int32_t stride)
+{
+    const int32_t out_hw = (hw + stride - 1) / stride;
+    const cmsis_nn_conv_params conv_params = {
+        bench_rand(-127, 128), bench_rand(-128, 127), {stride, stride}, {1, 1}, {1, 1}, {-128, 127}};
+    const cmsis_nn_dims input_dims = {1, hw, hw, in_ch};
+    const cmsis_nn_dims filter_dims = {out_ch, 3, 3, in_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {1, out_hw, out_hw, out_ch};
+    const int32_t out_size = out_hw * out_hw * out_ch;
+    int8_t *input = bench_alloc_s8(hw * hw * in_ch, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * 9 * in_ch, -127, 127);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(out_ch * sizeof(int32_t));
+    const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+    int8_t *output = malloc(out_size);
+    int8_t *im2col = malloc(out_size);
+    cmsis_nn_context direct_ctx;
+    cmsis_nn_context ctx;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    bench_fill_quant(bias, mult, shift, out_ch, 9 * in_ch);
+    ctx.size = arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+    direct_ctx.size = arm_convolve_3x3_s8_get_buffer_size(&input_dims, &filter_dims);
+    direct_ctx.buf = malloc(direct_ctx.size > 0 ? direct_ctx.size : 1);
+
+    BENCH_TIME(time_ns,
+               arm_convolve_3x3_s8(&direct_ctx, &conv_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                                   &bias_dims, bias, &output_dims, output));
+    BENCH_TIME(base_ns,
+               arm_convolve_s8(&ctx, &conv_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                               &bias_dims, bias, &output_dims, im2col));
+
+    snprintf(name,
+             sizeof(name),
+             "3x3 %dx%dx%d->%d%s, %d/%d B",
+             (int)hw,
+             (int)hw,
+             (int)in_ch,
+             (int)out_ch,
+             (stride == 2) ? " s2" : "",
+             (int)direct_ctx.size,
+             (int)ctx.size);
+    bench_report(
+        name, (uint64_t)out_size * 9 * in_ch, time_ns, base_ns, bench_check_exact(name, output, im2col, out_size));
+
+    free(direct_ctx.buf);
+    free(ctx.buf);
+    free(im2col);
+    free(output);
+    free(shift);
+    free(mult);
+    free(bias);
+    free(filter);
+    free(input);
+}
+
+void bench_conv3x3(void)
+{
+    bench_header("arm_convolve_3x3_s8() against arm_convolve_s8(), buffer bytes of both", "im2col us");
+
+    bench_conv3x3_shape(16, 16, 16, 1);
+    bench_conv3x3_shape(8, 32, 32, 1);
+    bench_conv3x3_shape(32, 8, 8, 1);
+    bench_conv3x3_shape(4, 64, 64, 1);
+    bench_conv3x3_shape(16, 16, 32, 2);
+}
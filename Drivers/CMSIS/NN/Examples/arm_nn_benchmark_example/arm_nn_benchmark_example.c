@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_example.c
+ * Description:  Host benchmark and bit-exactness checks of the CMSIS-NN kernels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * Usage: arm_nn_benchmark_example [--quick] [group...]
+ *
+ * Runs the benchmark groups given on the command line, or all of them. Each
+ * group times kernels on a set of shapes and checks that their outputs are
+ * bit exact with a baseline: a reference kernel, or the CMSIS-NN function
+ * the kernel replaces. With --quick the kernels are only called once, for
+ * the checks. The program returns 0 when all the checks pass.
+ *
+ * Times are in nanoseconds from arm_nn_profile_timestamp(). Build the library
+ * with -DNEON=ON on an AArch64 host to measure the Neon kernels.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+} bench_group;
+
+static const bench_group groups[] = {
+    {"mobilenet", bench_mobilenet},
+    {"parallel", bench_parallel},
+    {"kernels", bench_kernels},
+    {"rnn", bench_rnn},
+    {"packed", bench_packed},
+    {"s4", bench_s4},
+    {"fused", bench_fused},
+    {"conv3x3", bench_conv3x3},
+    {"stream", bench_stream},
+    {"batch", bench_batch},
+};
+
+#define NUM_GROUPS ((int32_t)(sizeof(groups) / sizeof(groups[0])))
+
+int32_t bench_quick = 0;
+int32_t bench_failures = 0;
+
+static uint32_t bench_seed = 12345U;
+
+int32_t bench_rand(const int32_t lo, const int32_t hi)
+{
+    bench_seed = bench_seed * 1664525U + 1013904223U;
+
+    return lo + (int32_t)((bench_seed >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+int8_t *bench_alloc_s8(const int32_t size, const int32_t lo, const int32_t hi)
+{
+    int8_t *buf = malloc(size > 0 ? size : 1);
+
+    for (int32_t i = 0; i < size; i++)
+    {
+        buf[i] = (int8_t)bench_rand(lo, hi);
+    }
+
+    return buf;
+}
+
+void bench_fill_quant(int32_t *bias, int32_t *mult, int32_t *shift, const int32_t num_ch, const int32_t depth)
+{
+    int32_t log2_depth = 0;
+
+    while ((1 << (log2_depth + 1)) <= depth)
+    {
+        log2_depth++;
+    }
+
+    for (int32_t i = 0; i < num_ch; i++)
+    {
+        if (bias != NULL)
+        {
+            bias[i] = bench_rand(-5000, 5000);
+        }
+        mult[i] = bench_rand(1 << 30, INT32_MAX);
+        shift[i] = -7 - log2_depth / 2 - bench_rand(0, 1);
+    }
+}
+
+int32_t bench_check_exact(const char *name, const int8_t *output, const int8_t *ref, const int32_t size)
+{
+    for (int32_t i = 0; i < size; i++)
+    {
+        if (output[i] != ref[i])
+        {
+            printf("%s: output %d is %d instead of %d\n", name, (int)i, output[i], ref[i]);
+            bench_failures++;
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static const char *bench_base_name;
+
+void bench_header(const char *title, const char *base_name)
+{
+    bench_base_name = base_name;
+
+    printf("\n%s\n", title);
+    if (base_name != NULL)
+    {
+        printf("%-40s %12s %10s %8s %10s %8s %s\n", "", "MACs", "time us", "GMAC/s", base_name, "speedup", "exact");
+    }
+    else
+    {
+        printf("%-40s %12s %10s %8s %s\n", "", "MACs", "time us", "GMAC/s", "exact");
+    }
+}
+
+void bench_report(const char *name,
+                  const uint64_t macs,
+                  const double time_ns,
+                  const double base_ns,
+                  const int32_t exact)
+{
+    const double gmacs = (time_ns > 0.0) ? (double)macs / time_ns : 0.0;
+
+    printf("%-40s %12llu %10.1f %8.2f", name, (unsigned long long)macs, time_ns / 1000.0, gmacs);
+    if (bench_base_name != NULL)
+    {
+        printf(" %10.1f %8.2f", base_ns / 1000.0, (time_ns > 0.0) ? base_ns / time_ns : 0.0);
+    }
+    printf(" %s\n", exact ? "yes" : "NO");
+}
+
+int main(int argc, char *argv[])
+{
+    int32_t selected = 0;
+
+    for (int32_t i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--quick") == 0)
+        {
+            bench_quick = 1;
+        }
+        else
+        {
+            int32_t g = 0;
+
+            while (g < NUM_GROUPS && strcmp(argv[i], groups[g].name) != 0)
+            {
+                g++;
+            }
+            if (g == NUM_GROUPS)
+            {
+                printf("unknown group %s, groups:", argv[i]);
+                for (g = 0; g < NUM_GROUPS; g++)
+                {
+                    printf(" %s", groups[g].name);
+                }
+                printf("\n");
+                return 2;
+            }
+            selected++;
+        }
+    }
+
+    for (int32_t g = 0; g < NUM_GROUPS; g++)
+    {
+        int32_t run = (selected == 0);
+
+        for (int32_t i = 1; i < argc && !run; i++)
+        {
+            run = (strcmp(argv[i], groups[g].name) == 0);
+        }
+        if (run)
+        {
+            groups[g].run();
+        }
+    }
+
+    printf("\n%s (%d failed checks)\n", bench_failures == 0 ? "SUCCESS" : "FAILURE", (int)bench_failures);
+
+    return (bench_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_fused.c
+ * Description:  Fused convolution and residual addition against the separate layers
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * The fused convolution and addition against arm_convolve_wrapper_s8()
+ * followed by arm_elementwise_add_s8(), per residual block. The 1x1
+ * projection blocks of MobileNetV2 call arm_convolve_1x1_add_s8(), which
+ * arm_convolve_add_wrapper_s8() only selects with ARM_NN_CONV_ADD_FUSED. The
+ * 3x3 block of a ResNet basic block calls arm_convolve_add_wrapper_s8(), and
+ * shows the cost of the wrapper falling back to the separate layers.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* The sequence arm_convolve_add_wrapper_s8() replaces */
+static void conv_then_add(const cmsis_nn_context *ctx,
+                          const cmsis_nn_conv_params *conv_params,
+                          const cmsis_nn_per_channel_quant_params *quant_params,
+                          const cmsis_nn_add_params *add_params,
+                          const cmsis_nn_dims *input_dims,
+                          const int8_t *input,
+                          const cmsis_nn_dims *filter_dims,
+                          const int8_t *filter,
+                          const cmsis_nn_dims *bias_dims,
+                          const int32_t *bias,
+                          const int8_t *residual,
+                          const cmsis_nn_dims *output_dims,
+                          int8_t *output)
+{
+    arm_convolve_wrapper_s8(
+        ctx, conv_params, quant_params, input_dims, input, filter_dims, filter, bias_dims, bias, output_dims, output);
+    arm_elementwise_add_s8(output,
+                           residual,
+                           add_params->input_1_offset,
+                           add_params->input_1_mult,
+                           add_params->input_1_shift,
+                           add_params->input_2_offset,
+                           add_params->input_2_mult,
+                           add_params->input_2_shift,
+                           add_params->left_shift,
+                           output,
+                           add_params->output_offset,
+                           add_params->output_mult,
+                           add_params->output_shift,
+                           add_params->activation.min,
+                           add_params->activation.max,
+                           output_dims->n * output_dims->h * output_dims->w * output_dims->c);
+}
+
+static void bench_fused_block(const char *block,
+                              const int32_t hw,
+                              const int32_t in_ch,
+                              const int32_t out_ch,
+                              const int32_t kernel)
+{
+    const int32_t pad = kernel / 2;
+    const int32_t depth = kernel * kernel * in_ch;
+    const cmsis_nn_conv_params conv_params = {
+        bench_rand(-127, 128), bench_rand(-20, 20), {1, 1}, {pad, pad}, {1, 1}, {-128, 127}};
+    /* The convolution result is input 1 of the addition */
+    const cmsis_nn_add_params add_params = {-conv_params.output_offset,
+                                            bench_rand(1 << 30, INT32_MAX),
+                                            bench_rand(-3, 0),
+                                            bench_rand(-127, 128),
+                                            bench_rand(1 << 30, INT32_MAX),
+                                            bench_rand(-3, 0),
+                                            20,
+                                            bench_rand(-20, 20),
+                                            bench_rand(1 << 30, INT32_MAX),
+                                            bench_rand(-21, -18),
+                                            {-128, 127}};
+    const cmsis_nn_dims input_dims = {1, hw, hw, in_ch};
+    const cmsis_nn_dims filter_dims = {out_ch, kernel, kernel, in_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {1, hw, hw, out_ch};
+    const int32_t out_size = hw * hw * out_ch;
+    int8_t *input = bench_alloc_s8(hw * hw * in_ch, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * depth, -127, 127);
+    int8_t *residual = bench_alloc_s8(out_size, -128, 127);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(out_ch * sizeof(int32_t));
+    const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+    int8_t *output = malloc(out_size);
+    int8_t *separate = malloc(out_size);
+    cmsis_nn_context ctx;
+    cmsis_nn_context fused_ctx;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    bench_fill_quant(bias, mult, shift, out_ch, depth);
+    ctx.size = arm_convolve_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+    fused_ctx.size = arm_convolve_add_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+    fused_ctx.buf = malloc(fused_ctx.size > 0 ? fused_ctx.size : 1);
+
+    if (kernel == 1)
+    {
+        BENCH_TIME(time_ns,
+                   arm_convolve_1x1_add_s8(&fused_ctx, &conv_params, &quant_params, &add_params, &input_dims, input,
+                                           &filter_dims, filter, &bias_dims, bias, residual, &output_dims, output));
+    }
+    else
+    {
+        BENCH_TIME(time_ns,
+                   arm_convolve_add_wrapper_s8(&fused_ctx, &conv_params, &quant_params, &add_params, &input_dims,
+                                               input, &filter_dims, filter, &bias_dims, bias, residual, &output_dims,
+                                               output));
+    }
+    BENCH_TIME(base_ns,
+               conv_then_add(&ctx, &conv_params, &quant_params, &add_params, &input_dims, input, &filter_dims, filter,
+                             &bias_dims, bias, residual, &output_dims, separate));
+
+    snprintf(name,
+             sizeof(name),
+             "%s %dx%d %dx%dx%d->%d%s",
+             block,
+             (int)kernel,
+             (int)kernel,
+             (int)hw,
+             (int)hw,
+             (int)in_ch,
+             (int)out_ch,
+             (kernel == 1) ? "" : ", wrapper");
+    bench_report(name,
+                 (uint64_t)out_size * depth,
+                 time_ns,
+                 base_ns,
+                 bench_check_exact(name, output, separate, out_size));
+
+    free(fused_ctx.buf);
+    free(ctx.buf);
+    free(separate);
+    free(output);
+    free(shift);
+    free(mult);
+    free(bias);
+    free(residual);
+    free(filter);
+    free(input);
+}
+
+void bench_fused(void)
+{
+    bench_header("Convolution and residual addition, fused against the separate layers", "separate us");
+
+    /* MobileNetV2 1.0 at 160x160, projection of each block with a residual connection */
+    bench_fused_block("mnv2 block 3", 40, 144, 24, 1);
+    bench_fused_block("mnv2 block 5", 20, 192, 32, 1);
+    bench_fused_block("mnv2 block 8", 10, 384, 64, 1);
+    bench_fused_block("mnv2 block 12", 10, 576, 96, 1);
+    bench_fused_block("mnv2 block 15", 5, 960, 160, 1);
+    /* ResNet basic block, second 3x3 convolution */
+    bench_fused_block("resnet block", 16, 32, 32, 3);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_kernels.c
+ * Description:  Timings of the transpose convolution, batch matmul, pad and transpose operators
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * arm_transpose_conv_s8(), arm_batch_matmul_s8(), arm_pad_s8() and
+ * arm_transpose_s8() on decoder upsampling, attention and layout change
+ * shapes, against the reference kernels.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static void bench_transpose_conv(const int32_t in_hw, const int32_t in_ch, const int32_t out_ch)
+{
+    /* 4x4 kernel, stride 2 and padding 1 double the height and width */
+    const int32_t out_hw = in_hw * 2;
+    const cmsis_nn_conv_params conv_params = {
+        bench_rand(-127, 128), bench_rand(-128, 127), {2, 2}, {1, 1}, {1, 1}, {-128, 127}};
+    const cmsis_nn_dims input_dims = {1, in_hw, in_hw, in_ch};
+    const cmsis_nn_dims filter_dims = {out_ch, 4, 4, in_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {1, out_hw, out_hw, out_ch};
+    const int32_t out_size = out_hw * out_hw * out_ch;
+    int8_t *input = bench_alloc_s8(in_hw * in_hw * in_ch, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * 4 * 4 * in_ch, -127, 127);
+    int8_t *output = malloc(out_size);
+    int8_t *ref = malloc(out_size);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(out_ch * sizeof(int32_t));
+    const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+    cmsis_nn_context ctx;
+    double time_ns = 0.0;
+    double ref_ns = 0.0;
+    char name[64];
+
+    /* Each output pixel gathers 2x2 of the 4x4 taps */
+    bench_fill_quant(bias, mult, shift, out_ch, 4 * in_ch);
+    ctx.size = arm_transpose_conv_s8_get_buffer_size(&input_dims, &filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+
+    BENCH_TIME(time_ns,
+               arm_transpose_conv_s8(&ctx, &conv_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                                     &bias_dims, bias, &output_dims, output));
+    BENCH_TIME(ref_ns,
+               ref_transpose_conv_s8(
+                   &conv_params, &quant_params, &input_dims, input, &filter_dims, filter, bias, &output_dims, ref));
+
+    snprintf(name, sizeof(name), "transpose conv %dx%dx%d->%d", (int)in_hw, (int)in_hw, (int)in_ch, (int)out_ch);
+    bench_report(name, (uint64_t)out_size * 4 * in_ch, time_ns, ref_ns, bench_check_exact(name, output, ref, out_size));
+
+    free(ctx.buf);
+    free(shift);
+    free(mult);
+    free(bias);
+    free(ref);
+    free(output);
+    free(filter);
+    free(input);
+}
+
+static void bench_batch_matmul(
+    const int32_t batches, const int32_t rows, const int32_t depth, const int32_t cols, const int32_t adj_y)
+{
+    const cmsis_nn_bmm_params bmm_params = {
+        0, adj_y, {bench_rand(-127, 128), bench_rand(-127, 128), bench_rand(-128, 127), {-128, 127}}};
+    const cmsis_nn_dims lhs_dims = {1, batches, rows, depth};
+    const cmsis_nn_dims rhs_dims = {1, batches, adj_y ? cols : depth, adj_y ? depth : cols};
+    const cmsis_nn_dims output_dims = {1, batches, rows, cols};
+    const int32_t out_size = batches * rows * cols;
+    int8_t *lhs = bench_alloc_s8(batches * rows * depth, -128, 127);
+    int8_t *rhs = bench_alloc_s8(batches * depth * cols, -128, 127);
+    int8_t *output = malloc(out_size);
+    int8_t *ref = malloc(out_size);
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_context ctx;
+    double time_ns = 0.0;
+    double ref_ns = 0.0;
+    char name[64];
+
+    bench_fill_quant(NULL, &quant_params.multiplier, &quant_params.shift, 1, depth);
+    ctx.size = arm_batch_matmul_s8_get_buffer_size(&bmm_params, &lhs_dims, &rhs_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+
+    BENCH_TIME(time_ns,
+               arm_batch_matmul_s8(
+                   &ctx, &bmm_params, &quant_params, &lhs_dims, lhs, &rhs_dims, rhs, &output_dims, output));
+    BENCH_TIME(ref_ns,
+               ref_batch_matmul_s8(&bmm_params, &quant_params, &lhs_dims, lhs, &rhs_dims, rhs, &output_dims, ref));
+
+    snprintf(name,
+             sizeof(name),
+             "batch matmul %dx%dx%dx%d%s",
+             (int)batches,
+             (int)rows,
+             (int)depth,
+             (int)cols,
+             adj_y ? " adj_y" : "");
+    bench_report(name, (uint64_t)out_size * depth, time_ns, ref_ns, bench_check_exact(name, output, ref, out_size));
+
+    free(ctx.buf);
+    free(ref);
+    free(output);
+    free(rhs);
+    free(lhs);
+}
+
+static void bench_pad(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *pre_pad, const cmsis_nn_dims *post_pad)
+{
+    const int32_t in_size = input_dims->n * input_dims->h * input_dims->w * input_dims->c;
+    const int32_t out_size = (pre_pad->n + input_dims->n + post_pad->n) * (pre_pad->h + input_dims->h + post_pad->h) *
+        (pre_pad->w + input_dims->w + post_pad->w) * (pre_pad->c + input_dims->c + post_pad->c);
+    int8_t *input = bench_alloc_s8(in_size, -128, 127);
+    int8_t *output = malloc(out_size);
+    int8_t *ref = malloc(out_size);
+    double time_ns = 0.0;
+    double ref_ns = 0.0;
+    char name[64];
+
+    BENCH_TIME(time_ns, arm_pad_s8(input, output, -3, input_dims, pre_pad, post_pad));
+    BENCH_TIME(ref_ns, ref_pad_s8(input, ref, -3, input_dims, pre_pad, post_pad));
+
+    snprintf(name,
+             sizeof(name),
+             "pad %dx%dx%d, %s",
+             (int)input_dims->h,
+             (int)input_dims->w,
+             (int)input_dims->c,
+             (pre_pad->c + post_pad->c > 0) ? "channels" : "borders");
+    bench_report(name, 0, time_ns, ref_ns, bench_check_exact(name, output, ref, out_size));
+
+    free(ref);
+    free(output);
+    free(input);
+}
+
+static void bench_transpose(const cmsis_nn_dims *input_dims, const uint32_t *permutations, const char *layout)
+{
+    const int32_t in_size[4] = {input_dims->n, input_dims->h, input_dims->w, input_dims->c};
+    const cmsis_nn_transpose_params transpose_params = {4, permutations};
+    const cmsis_nn_dims output_dims = {
+        in_size[permutations[0]], in_size[permutations[1]], in_size[permutations[2]], in_size[permutations[3]]};
+    const int32_t size = in_size[0] * in_size[1] * in_size[2] * in_size[3];
+    int8_t *input = bench_alloc_s8(size, -128, 127);
+    int8_t *output = malloc(size);
+    int8_t *ref = malloc(size);
+    double time_ns = 0.0;
+    double ref_ns = 0.0;
+    char name[64];
+
+    BENCH_TIME(time_ns, arm_transpose_s8(input, output, input_dims, &output_dims, &transpose_params));
+    BENCH_TIME(ref_ns, ref_transpose_s8(input, ref, input_dims, &output_dims, &transpose_params));
+
+    snprintf(name,
+             sizeof(name),
+             "transpose %dx%dx%d, %s",
+             (int)input_dims->h,
+             (int)input_dims->w,
+             (int)input_dims->c,
+             layout);
+    bench_report(name, 0, time_ns, ref_ns, bench_check_exact(name, output, ref, size));
+
+    free(ref);
+    free(output);
+    free(input);
+}
+
+void bench_kernels(void)
+{
+    const cmsis_nn_dims pad_input = {1, 32, 32, 16};
+    const cmsis_nn_dims pad_border = {0, 1, 1, 0};
+    const cmsis_nn_dims channel_input = {1, 16, 16, 13};
+    const cmsis_nn_dims channel_pre = {0, 0, 0, 0};
+    const cmsis_nn_dims channel_post = {0, 0, 0, 3};
+    const cmsis_nn_dims transpose_input = {1, 32, 32, 16};
+    const uint32_t nhwc_to_nchw[4] = {0, 3, 1, 2};
+    const uint32_t swap_hw[4] = {0, 2, 1, 3};
+
+    bench_header("Transpose convolution, batch matmul, pad and transpose", "ref us");
+
+    bench_transpose_conv(8, 64, 32);
+    bench_transpose_conv(16, 32, 16);
+    bench_batch_matmul(4, 64, 32, 64, 0);
+    bench_batch_matmul(4, 64, 32, 64, 1);
+    bench_pad(&pad_input, &pad_border, &pad_border);
+    bench_pad(&channel_input, &channel_pre, &channel_post);
+    bench_transpose(&transpose_input, nhwc_to_nchw, "NHWC to NCHW");
+    bench_transpose(&transpose_input, swap_hw, "H and W swapped");
+}
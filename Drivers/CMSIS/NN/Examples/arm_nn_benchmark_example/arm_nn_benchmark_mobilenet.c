@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_mobilenet.c
+ * Description:  Per-layer timings of MobileNet v1
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * The layers of MobileNet v1 0.25, 128x128 input, through the layer
+ * functions called by TensorFlow Lite Micro: arm_convolve_wrapper_s8(),
+ * arm_depthwise_conv_wrapper_s8() and arm_fully_connected_s8(). Run it on
+ * a build with and without -DNEON=ON to compare the Neon kernels with the
+ * portable ones. Every layer is checked against the reference kernels.
+ */
+
+#include "arm_nn_benchmark.h"
+#include "arm_nnsupportfunctions.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef enum
+{
+    LAYER_CONV,
+    LAYER_DW,
+    LAYER_FC
+} layer_type;
+
+typedef struct
+{
+    layer_type type;
+    int32_t in_hw;  /* Input height and width */
+    int32_t in_ch;
+    int32_t out_ch;
+    int32_t kernel; /* Kernel height and width */
+    int32_t stride;
+    int32_t repeat; /* Number of identical layers in the network */
+} mobilenet_layer;
+
+static const mobilenet_layer mobilenet_v1_025[] = {
+    {LAYER_CONV, 128, 3, 8, 3, 2, 1},  {LAYER_DW, 64, 8, 8, 3, 1, 1},     {LAYER_CONV, 64, 8, 16, 1, 1, 1},
+    {LAYER_DW, 64, 16, 16, 3, 2, 1},   {LAYER_CONV, 32, 16, 32, 1, 1, 1}, {LAYER_DW, 32, 32, 32, 3, 1, 1},
+    {LAYER_CONV, 32, 32, 32, 1, 1, 1}, {LAYER_DW, 32, 32, 32, 3, 2, 1},   {LAYER_CONV, 16, 32, 64, 1, 1, 1},
+    {LAYER_DW, 16, 64, 64, 3, 1, 1},   {LAYER_CONV, 16, 64, 64, 1, 1, 1}, {LAYER_DW, 16, 64, 64, 3, 2, 1},
+    {LAYER_CONV, 8, 64, 128, 1, 1, 1}, {LAYER_DW, 8, 128, 128, 3, 1, 5},  {LAYER_CONV, 8, 128, 128, 1, 1, 5},
+    {LAYER_DW, 8, 128, 128, 3, 2, 1},  {LAYER_CONV, 4, 128, 256, 1, 1, 1}, {LAYER_DW, 4, 256, 256, 3, 1, 1},
+    {LAYER_CONV, 4, 256, 256, 1, 1, 1}, {LAYER_FC, 1, 256, 1001, 1, 1, 1},
+};
+
+#define NUM_LAYERS ((int32_t)(sizeof(mobilenet_v1_025) / sizeof(mobilenet_v1_025[0])))
+
+static const char *layer_names[] = {"conv", "depthwise", "fully connected"};
+
+void bench_mobilenet(void)
+{
+    double total_ns = 0.0;
+    uint64_t total_macs = 0;
+    int32_t all_exact = 1;
+
+    bench_header("MobileNet v1 0.25 128x128, per layer", NULL);
+
+    for (int32_t l = 0; l < NUM_LAYERS; l++)
+    {
+        const mobilenet_layer *layer = &mobilenet_v1_025[l];
+        const int32_t out_hw = (layer->in_hw + layer->stride - 1) / layer->stride;
+        /* SAME padding, the odd row and column go at the end as in TensorFlow Lite */
+        const int32_t pad = MAX((out_hw - 1) * layer->stride + layer->kernel - layer->in_hw, 0) / 2;
+        const cmsis_nn_dims input_dims = {1, layer->in_hw, layer->in_hw, layer->in_ch};
+        const cmsis_nn_dims output_dims = {1, out_hw, out_hw, layer->out_ch};
+        const cmsis_nn_dims bias_dims = {1, 1, 1, layer->out_ch};
+        const cmsis_nn_activation act = {-128, 127};
+        const int32_t in_size = layer->in_hw * layer->in_hw * layer->in_ch;
+        const int32_t out_size = out_hw * out_hw * layer->out_ch;
+        int8_t *input = bench_alloc_s8(in_size, -128, 127);
+        int8_t *output = malloc(out_size);
+        int8_t *ref = malloc(out_size);
+        int32_t *bias = malloc(layer->out_ch * sizeof(int32_t));
+        int32_t *mult = malloc(layer->out_ch * sizeof(int32_t));
+        int32_t *shift = malloc(layer->out_ch * sizeof(int32_t));
+        cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+        cmsis_nn_context ctx = {NULL, 0};
+        int8_t *filter = NULL;
+        uint64_t macs = 0;
+        double time_ns = 0.0;
+        char name[64];
+        int32_t exact;
+
+        if (layer->type == LAYER_CONV)
+        {
+            const cmsis_nn_conv_params conv_params = {
+                bench_rand(-127, 128), bench_rand(-128, 127), {layer->stride, layer->stride}, {pad, pad}, {1, 1}, act};
+            const cmsis_nn_dims filter_dims = {layer->out_ch, layer->kernel, layer->kernel, layer->in_ch};
+            const int32_t depth = layer->kernel * layer->kernel * layer->in_ch;
+
+            filter = bench_alloc_s8(layer->out_ch * depth, -127, 127);
+            bench_fill_quant(bias, mult, shift, layer->out_ch, depth);
+            ctx.size = arm_convolve_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
+            ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+            BENCH_TIME(time_ns,
+                       arm_convolve_wrapper_s8(&ctx, &conv_params, &quant_params, &input_dims, input, &filter_dims,
+                                               filter, &bias_dims, bias, &output_dims, output));
+            ref_convolve_s8(
+                &conv_params, &quant_params, &input_dims, input, &filter_dims, filter, bias, &output_dims, ref);
+            macs = (uint64_t)out_size * depth;
+        }
+        else if (layer->type == LAYER_DW)
+        {
+            const cmsis_nn_dw_conv_params dw_params = {bench_rand(-127, 128),
+                                                       bench_rand(-128, 127),
+                                                       1,
+                                                       {layer->stride, layer->stride},
+                                                       {pad, pad},
+                                                       {1, 1},
+                                                       act};
+            const cmsis_nn_dims filter_dims = {1, layer->kernel, layer->kernel, layer->out_ch};
+            const int32_t depth = layer->kernel * layer->kernel;
+
+            filter = bench_alloc_s8(layer->out_ch * depth, -127, 127);
+            bench_fill_quant(bias, mult, shift, layer->out_ch, depth);
+            ctx.size =
+                arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_params, &input_dims, &filter_dims, &output_dims);
+            ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+            BENCH_TIME(time_ns,
+                       arm_depthwise_conv_wrapper_s8(&ctx, &dw_params, &quant_params, &input_dims, input, &filter_dims,
+                                                     filter, &bias_dims, bias, &output_dims, output));
+            ref_depthwise_conv_s8(
+                &dw_params, &quant_params, &input_dims, input, &filter_dims, filter, bias, &output_dims, ref);
+            macs = (uint64_t)out_size * depth;
+        }
+        else
+        {
+            const cmsis_nn_fc_params fc_params = {bench_rand(-127, 128), 0, bench_rand(-128, 127), act};
+            const cmsis_nn_dims fc_input_dims = {1, 1, 1, layer->in_ch};
+            const cmsis_nn_dims filter_dims = {layer->in_ch, 1, 1, layer->out_ch};
+            const cmsis_nn_dims fc_output_dims = {1, 1, 1, layer->out_ch};
+            cmsis_nn_per_tensor_quant_params fc_quant;
+
+            filter = bench_alloc_s8(layer->out_ch * layer->in_ch, -127, 127);
+            bench_fill_quant(bias, mult, shift, layer->out_ch, layer->in_ch);
+            fc_quant.multiplier = mult[0];
+            fc_quant.shift = shift[0];
+            ctx.size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+            ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+            BENCH_TIME(time_ns,
+                       arm_fully_connected_s8(&ctx, &fc_params, &fc_quant, &fc_input_dims, input, &filter_dims, filter,
+                                              &bias_dims, bias, &fc_output_dims, output));
+            ref_fully_connected_s8(
+                &fc_params, &fc_quant, &fc_input_dims, input, &filter_dims, filter, bias, &fc_output_dims, ref);
+            macs = (uint64_t)out_size * layer->in_ch;
+        }
+
+        snprintf(name,
+                 sizeof(name),
+                 "%2d %s %dx%dx%d->%d%s",
+                 (int)l,
+                 layer_names[layer->type],
+                 (int)layer->in_hw,
+                 (int)layer->in_hw,
+                 (int)layer->in_ch,
+                 (int)layer->out_ch,
+                 (layer->repeat > 1) ? " (x5)" : (layer->stride == 2) ? " s2" : "");
+        exact = bench_check_exact(name, output, ref, out_size);
+        bench_report(name, macs, time_ns, 0.0, exact);
+
+        total_ns += time_ns * layer->repeat;
+        total_macs += macs * layer->repeat;
+        all_exact &= exact;
+
+        free(ctx.buf);
+        free(filter);
+        free(shift);
+        free(mult);
+        free(bias);
+        free(ref);
+        free(output);
+        free(input);
+    }
+
+    bench_report("network", total_macs, total_ns, 0.0, all_exact);
+}
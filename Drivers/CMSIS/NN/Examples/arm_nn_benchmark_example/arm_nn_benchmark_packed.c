@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_packed.c
+ * Description:  Pre-packed against unpacked s8 weights
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * arm_fully_connected_packed_s8() against arm_fully_connected_s8() on the
+ * same weights, for one batch and for batches that share each pass over the
+ * weights. The weights are packed at run time by pack_s8_weights(), which
+ * writes the layout of convert_to_packed_s8_weights() in
+ * Scripts/NNFunctions/fully_connected_opt_weight_generation.py.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Size of the packed weights of rows output channels of cols values */
+static int32_t packed_size(const int32_t rows, const int32_t cols)
+{
+    return ((rows + 3) / 4) * 4 * (cols + (int32_t)sizeof(int32_t));
+}
+
+static int8_t *pack_s8_weights(const int8_t *weights,
+                               const int32_t *bias,
+                               const int32_t rows,
+                               const int32_t cols,
+                               const int32_t input_offset)
+{
+    const int32_t full_cols = cols - cols % 4;
+    int8_t *packed = malloc(packed_size(rows, cols));
+    int8_t *dst = packed;
+
+    for (int32_t row_base = 0; row_base < rows; row_base += 4)
+    {
+        /* Padding rows are zero */
+        const int8_t *row[4];
+
+        for (int32_t r = 0; r < 4; r++)
+        {
+            row[r] = (row_base + r < rows) ? &weights[(row_base + r) * cols] : NULL;
+        }
+
+        /* Bias with the input offset folded in, little endian */
+        for (int32_t r = 0; r < 4; r++)
+        {
+            uint32_t folded = 0;
+
+            if (row[r] != NULL)
+            {
+                int32_t sum = 0;
+
+                for (int32_t c = 0; c < cols; c++)
+                {
+                    sum += row[r][c];
+                }
+                folded = (uint32_t)((bias != NULL ? bias[row_base + r] : 0) + input_offset * sum);
+            }
+            for (int32_t byte = 0; byte < 4; byte++)
+            {
+                *dst++ = (int8_t)(folded >> (8 * byte));
+            }
+        }
+
+        /* For each group of 4 columns, the 4 columns of each row, then the left over columns of each row */
+        for (int32_t col = 0; col < full_cols; col += 4)
+        {
+            for (int32_t r = 0; r < 4; r++)
+            {
+                for (int32_t c = col; c < col + 4; c++)
+                {
+                    *dst++ = (row[r] != NULL) ? row[r][c] : 0;
+                }
+            }
+        }
+        for (int32_t r = 0; r < 4; r++)
+        {
+            for (int32_t c = full_cols; c < cols; c++)
+            {
+                *dst++ = (row[r] != NULL) ? row[r][c] : 0;
+            }
+        }
+    }
+
+    return packed;
+}
+
+static void bench_packed_fc(const int32_t batches, const int32_t depth, const int32_t out_ch)
+{
+    const cmsis_nn_fc_params fc_params = {bench_rand(-127, 128), 0, bench_rand(-128, 127), {-128, 127}};
+    const cmsis_nn_dims input_dims = {batches, 1, 1, depth};
+    const cmsis_nn_dims filter_dims = {depth, 1, 1, out_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {batches, 1, 1, out_ch};
+    const int32_t out_size = batches * out_ch;
+    int8_t *input = bench_alloc_s8(batches * depth, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * depth, -127, 127);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int8_t *packed = NULL;
+    int8_t *output = malloc(out_size);
+    int8_t *unpacked = malloc(out_size);
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_context ctx;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    bench_fill_quant(NULL, &quant_params.multiplier, &quant_params.shift, 1, depth);
+    for (int32_t i = 0; i < out_ch; i++)
+    {
+        bias[i] = bench_rand(-5000, 5000);
+    }
+    packed = pack_s8_weights(filter, bias, out_ch, depth, fc_params.input_offset);
+    ctx.size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+
+    BENCH_TIME(time_ns,
+               arm_fully_connected_packed_s8(
+                   &ctx, &fc_params, &quant_params, &input_dims, input, &filter_dims, packed, &output_dims, output));
+    BENCH_TIME(base_ns,
+               arm_fully_connected_s8(&ctx, &fc_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                                      &bias_dims, bias, &output_dims, unpacked));
+
+    snprintf(name, sizeof(name), "fully connected %d->%d, batch %d", (int)depth, (int)out_ch, (int)batches);
+    bench_report(name,
+                 (uint64_t)out_size * depth,
+                 time_ns,
+                 base_ns,
+                 bench_check_exact(name, output, unpacked, out_size));
+
+    free(ctx.buf);
+    free(unpacked);
+    free(output);
+    free(packed);
+    free(bias);
+    free(filter);
+    free(input);
+}
+
+void bench_packed(void)
+{
+    bench_header("Pre-packed s8 weights against arm_fully_connected_s8()", "unpacked us");
+
+    bench_packed_fc(1, 256, 1001);
+    bench_packed_fc(1, 1024, 1000);
+    bench_packed_fc(1, 250, 30);
+    bench_packed_fc(2, 512, 512);
+    bench_packed_fc(3, 512, 512);
+    bench_packed_fc(4, 512, 512);
+}
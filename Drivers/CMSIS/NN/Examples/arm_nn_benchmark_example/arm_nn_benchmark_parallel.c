@@ -0,0 +1,332 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_parallel.c
+ * Description:  Thread scaling of the parallel layer functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * arm_convolve_parallel_s8(), arm_depthwise_conv_parallel_s8() and
+ * arm_fully_connected_parallel_s8() with 1 to BENCH_MAX_THREADS workers,
+ * scheduled on a pthread pool. The baseline is the single-threaded wrapper,
+ * whose output must be reproduced exactly for every number of workers.
+ * The speedup is only meaningful on a host with that many idle cores.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_MAX_THREADS (8)
+
+/* Pool of BENCH_MAX_THREADS - 1 threads. The calling thread runs tasks too. */
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    pthread_t threads[BENCH_MAX_THREADS - 1];
+    int32_t num_threads; /* Threads taking part in the current call, besides the caller */
+    uint32_t generation; /* Incremented by each parallel_for call */
+    int32_t stop;
+    cmsis_nn_task task;
+    void *args;
+    int32_t num_tasks;
+    int32_t next;      /* Next task to run */
+    int32_t completed; /* Number of completed tasks */
+} bench_pool;
+
+/* Run the tasks of the current call until there is none left. Called with the lock held. */
+static void pool_run_tasks(bench_pool *pool)
+{
+    while (pool->next < pool->num_tasks)
+    {
+        const int32_t task = pool->next++;
+
+        pthread_mutex_unlock(&pool->lock);
+        pool->task(pool->args, task);
+        pthread_mutex_lock(&pool->lock);
+
+        if (++pool->completed == pool->num_tasks)
+        {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+}
+
+typedef struct
+{
+    bench_pool *pool;
+    int32_t index;
+} pool_thread_args;
+
+static void *pool_thread(void *arg)
+{
+    const pool_thread_args *thread_args = arg;
+    bench_pool *pool = thread_args->pool;
+    const int32_t index = thread_args->index;
+    uint32_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop)
+    {
+        if (pool->generation != seen)
+        {
+            seen = pool->generation;
+            if (index < pool->num_threads)
+            {
+                pool_run_tasks(pool);
+            }
+        }
+        else
+        {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/* parallel_for callback of cmsis_nn_parallel_context */
+static void pool_parallel_for(void *scheduler, cmsis_nn_task task, void *args, int32_t num_tasks)
+{
+    bench_pool *pool = scheduler;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->args = args;
+    pool->num_tasks = num_tasks;
+    pool->next = 0;
+    pool->completed = 0;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+
+    pool_run_tasks(pool);
+    while (pool->completed < pool->num_tasks)
+    {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+typedef enum
+{
+    SHAPE_CONV,
+    SHAPE_DW,
+    SHAPE_FC
+} shape_type;
+
+typedef struct
+{
+    shape_type type;
+    int32_t in_hw; /* Input height and width */
+    int32_t in_ch;
+    int32_t out_ch;
+    int32_t kernel; /* Kernel height and width */
+} parallel_shape;
+
+static const parallel_shape parallel_shapes[] = {
+    {SHAPE_CONV, 32, 32, 32, 3},
+    {SHAPE_CONV, 32, 64, 64, 1},
+    {SHAPE_DW, 64, 32, 32, 3},
+    {SHAPE_FC, 1, 1024, 1000, 1},
+};
+
+#define NUM_SHAPES ((int32_t)(sizeof(parallel_shapes) / sizeof(parallel_shapes[0])))
+
+static const char *shape_names[] = {"conv", "depthwise", "fully connected"};
+
+void bench_parallel(void)
+{
+    bench_pool pool;
+    pool_thread_args thread_args[BENCH_MAX_THREADS - 1];
+    cmsis_nn_context worker_ctx[BENCH_MAX_THREADS];
+
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.start, NULL);
+    pthread_cond_init(&pool.done, NULL);
+    pool.num_threads = 0;
+    pool.generation = 0;
+    pool.stop = 0;
+    for (int32_t i = 0; i < BENCH_MAX_THREADS - 1; i++)
+    {
+        thread_args[i].pool = &pool;
+        thread_args[i].index = i;
+        pthread_create(&pool.threads[i], NULL, pool_thread, &thread_args[i]);
+    }
+
+    bench_header("Parallel layers, 1 to 8 threads", "serial us");
+
+    for (int32_t s = 0; s < NUM_SHAPES; s++)
+    {
+        const parallel_shape *shape = &parallel_shapes[s];
+        const int32_t pad = shape->kernel / 2;
+        const int32_t depth = (shape->type == SHAPE_DW) ? shape->kernel * shape->kernel
+                                                         : shape->kernel * shape->kernel * shape->in_ch;
+        const cmsis_nn_dims input_dims = {1, shape->in_hw, shape->in_hw, shape->in_ch};
+        const cmsis_nn_dims output_dims = {1, shape->in_hw, shape->in_hw, shape->out_ch};
+        const cmsis_nn_dims bias_dims = {1, 1, 1, shape->out_ch};
+        const cmsis_nn_dims conv_filter_dims = {shape->out_ch, shape->kernel, shape->kernel, shape->in_ch};
+        const cmsis_nn_dims dw_filter_dims = {1, shape->kernel, shape->kernel, shape->out_ch};
+        const cmsis_nn_dims fc_filter_dims = {shape->in_ch, 1, 1, shape->out_ch};
+        const cmsis_nn_activation act = {-128, 127};
+        const cmsis_nn_conv_params conv_params = {
+            bench_rand(-127, 128), bench_rand(-128, 127), {1, 1}, {pad, pad}, {1, 1}, act};
+        const cmsis_nn_dw_conv_params dw_params = {
+            conv_params.input_offset, conv_params.output_offset, 1, {1, 1}, {pad, pad}, {1, 1}, act};
+        const cmsis_nn_fc_params fc_params = {conv_params.input_offset, 0, conv_params.output_offset, act};
+        const int32_t out_size = shape->in_hw * shape->in_hw * shape->out_ch;
+        const uint64_t macs = (uint64_t)out_size * depth;
+        int8_t *input = bench_alloc_s8(shape->in_hw * shape->in_hw * shape->in_ch, -128, 127);
+        int8_t *filter = bench_alloc_s8(shape->out_ch * depth, -127, 127);
+        int8_t *serial = malloc(out_size);
+        int8_t *output = malloc(out_size);
+        int32_t *bias = malloc(shape->out_ch * sizeof(int32_t));
+        int32_t *mult = malloc(shape->out_ch * sizeof(int32_t));
+        int32_t *shift = malloc(shape->out_ch * sizeof(int32_t));
+        const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+        cmsis_nn_per_tensor_quant_params fc_quant;
+        cmsis_nn_context ctx;
+        int32_t worker_size;
+        double base_ns = 0.0;
+
+        bench_fill_quant(bias, mult, shift, shape->out_ch, depth);
+        fc_quant.multiplier = mult[0];
+        fc_quant.shift = shift[0];
+
+        switch (shape->type)
+        {
+        case SHAPE_CONV:
+            ctx.size =
+                arm_convolve_wrapper_s8_get_buffer_size(&conv_params, &input_dims, &conv_filter_dims, &output_dims);
+            worker_size =
+                arm_convolve_parallel_s8_get_buffer_size(&conv_params, &input_dims, &conv_filter_dims, &output_dims);
+            break;
+        case SHAPE_DW:
+            ctx.size =
+                arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_params, &input_dims, &dw_filter_dims, &output_dims);
+            worker_size =
+                arm_depthwise_conv_parallel_s8_get_buffer_size(&dw_params, &input_dims, &dw_filter_dims, &output_dims);
+            break;
+        default:
+            ctx.size = arm_fully_connected_s8_get_buffer_size(&fc_filter_dims);
+            worker_size = ctx.size;
+            break;
+        }
+        ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+        for (int32_t w = 0; w < BENCH_MAX_THREADS; w++)
+        {
+            worker_ctx[w].size = worker_size;
+            worker_ctx[w].buf = malloc(worker_size > 0 ? worker_size : 1);
+        }
+
+        switch (shape->type)
+        {
+        case SHAPE_CONV:
+            BENCH_TIME(base_ns,
+                       arm_convolve_wrapper_s8(&ctx, &conv_params, &quant_params, &input_dims, input,
+                                               &conv_filter_dims, filter, &bias_dims, bias, &output_dims, serial));
+            break;
+        case SHAPE_DW:
+            BENCH_TIME(base_ns,
+                       arm_depthwise_conv_wrapper_s8(&ctx, &dw_params, &quant_params, &input_dims, input,
+                                                     &dw_filter_dims, filter, &bias_dims, bias, &output_dims, serial));
+            break;
+        default:
+            BENCH_TIME(base_ns,
+                       arm_fully_connected_s8(&ctx, &fc_params, &fc_quant, &input_dims, input, &fc_filter_dims,
+                                              filter, &bias_dims, bias, &output_dims, serial));
+            break;
+        }
+
+        for (int32_t num_workers = 1; num_workers <= BENCH_MAX_THREADS; num_workers++)
+        {
+            const cmsis_nn_parallel_context parallel_ctx = {pool_parallel_for, &pool, num_workers, worker_ctx};
+            double time_ns = 0.0;
+            char name[64];
+
+            pool.num_threads = num_workers - 1;
+            switch (shape->type)
+            {
+            case SHAPE_CONV:
+                BENCH_TIME(time_ns,
+                           arm_convolve_parallel_s8(&parallel_ctx, &conv_params, &quant_params, &input_dims, input,
+                                                    &conv_filter_dims, filter, &bias_dims, bias, &output_dims, output));
+                break;
+            case SHAPE_DW:
+                BENCH_TIME(time_ns,
+                           arm_depthwise_conv_parallel_s8(&parallel_ctx, &dw_params, &quant_params, &input_dims,
+                                                          input, &dw_filter_dims, filter, &bias_dims, bias,
+                                                          &output_dims, output));
+                break;
+            default:
+                BENCH_TIME(time_ns,
+                           arm_fully_connected_parallel_s8(&parallel_ctx, &fc_params, &fc_quant, &input_dims, input,
+                                                           &fc_filter_dims, filter, &bias_dims, bias, &output_dims,
+                                                           output));
+                break;
+            }
+
+            snprintf(name,
+                     sizeof(name),
+                     "%s %dx%dx%d->%d, %d thr",
+                     shape_names[shape->type],
+                     (int)shape->in_hw,
+                     (int)shape->in_hw,
+                     (int)shape->in_ch,
+                     (int)shape->out_ch,
+                     (int)num_workers);
+            bench_report(name, macs, time_ns, base_ns, bench_check_exact(name, output, serial, out_size));
+        }
+
+        for (int32_t w = 0; w < BENCH_MAX_THREADS; w++)
+        {
+            free(worker_ctx[w].buf);
+        }
+        free(ctx.buf);
+        free(shift);
+        free(mult);
+        free(bias);
+        free(output);
+        free(serial);
+        free(filter);
+        free(input);
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.stop = 1;
+    pthread_cond_broadcast(&pool.start);
+    pthread_mutex_unlock(&pool.lock);
+    for (int32_t i = 0; i < BENCH_MAX_THREADS - 1; i++)
+    {
+        pthread_join(pool.threads[i], NULL);
+    }
+    pthread_cond_destroy(&pool.done);
+    pthread_cond_destroy(&pool.start);
+    pthread_mutex_destroy(&pool.lock);
+}
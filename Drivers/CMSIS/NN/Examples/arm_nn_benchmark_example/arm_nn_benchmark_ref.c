@@ -0,0 +1,383 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_ref.c
+ * Description:  Reference kernels of the CMSIS-NN host benchmark
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * Straightforward loops over the output, following the TensorFlow Lite
+ * Micro reference kernels. Only the requantization is shared with the
+ * library: arm_nn_requantize() is TFLM MultiplyByQuantizedMultiplier().
+ */
+
+#include "arm_nn_benchmark.h"
+#include "arm_nnsupportfunctions.h"
+
+static int8_t ref_output(const int64_t acc,
+                         const int32_t mult,
+                         const int32_t shift,
+                         const int32_t offset,
+                         const cmsis_nn_activation *act)
+{
+    int32_t out = arm_nn_requantize((int32_t)acc, mult, shift) + offset;
+
+    out = MAX(out, act->min);
+    out = MIN(out, act->max);
+
+    return (int8_t)out;
+}
+
+void ref_convolve_s8(const cmsis_nn_conv_params *conv_params,
+                     const cmsis_nn_per_channel_quant_params *quant_params,
+                     const cmsis_nn_dims *input_dims,
+                     const int8_t *input,
+                     const cmsis_nn_dims *filter_dims,
+                     const int8_t *filter,
+                     const int32_t *bias,
+                     const cmsis_nn_dims *output_dims,
+                     int8_t *output)
+{
+    const int32_t in_h = input_dims->h, in_w = input_dims->w, in_ch = input_dims->c;
+    const int32_t k_h = filter_dims->h, k_w = filter_dims->w;
+
+    for (int32_t n = 0; n < output_dims->n; n++)
+    {
+        for (int32_t y = 0; y < output_dims->h; y++)
+        {
+            for (int32_t x = 0; x < output_dims->w; x++)
+            {
+                for (int32_t oc = 0; oc < output_dims->c; oc++)
+                {
+                    int64_t acc = (bias != NULL) ? bias[oc] : 0;
+
+                    for (int32_t ky = 0; ky < k_h; ky++)
+                    {
+                        const int32_t iy = y * conv_params->stride.h - conv_params->padding.h +
+                            ky * conv_params->dilation.h;
+
+                        for (int32_t kx = 0; kx < k_w; kx++)
+                        {
+                            const int32_t ix = x * conv_params->stride.w - conv_params->padding.w +
+                                kx * conv_params->dilation.w;
+
+                            if (iy < 0 || iy >= in_h || ix < 0 || ix >= in_w)
+                            {
+                                continue;
+                            }
+                            for (int32_t ic = 0; ic < in_ch; ic++)
+                            {
+                                acc += (int64_t)(input[((n * in_h + iy) * in_w + ix) * in_ch + ic] +
+                                                 conv_params->input_offset) *
+                                    filter[((oc * k_h + ky) * k_w + kx) * in_ch + ic];
+                            }
+                        }
+                    }
+                    *output++ = ref_output(acc,
+                                           quant_params->multiplier[oc],
+                                           quant_params->shift[oc],
+                                           conv_params->output_offset,
+                                           &conv_params->activation);
+                }
+            }
+        }
+    }
+}
+
+void ref_depthwise_conv_s8(const cmsis_nn_dw_conv_params *dw_conv_params,
+                           const cmsis_nn_per_channel_quant_params *quant_params,
+                           const cmsis_nn_dims *input_dims,
+                           const int8_t *input,
+                           const cmsis_nn_dims *filter_dims,
+                           const int8_t *filter,
+                           const int32_t *bias,
+                           const cmsis_nn_dims *output_dims,
+                           int8_t *output)
+{
+    const int32_t in_h = input_dims->h, in_w = input_dims->w, in_ch = input_dims->c;
+    const int32_t k_h = filter_dims->h, k_w = filter_dims->w;
+    const int32_t out_ch = output_dims->c;
+
+    for (int32_t n = 0; n < output_dims->n; n++)
+    {
+        for (int32_t y = 0; y < output_dims->h; y++)
+        {
+            for (int32_t x = 0; x < output_dims->w; x++)
+            {
+                for (int32_t oc = 0; oc < out_ch; oc++)
+                {
+                    const int32_t ic = oc / dw_conv_params->ch_mult;
+                    int64_t acc = (bias != NULL) ? bias[oc] : 0;
+
+                    for (int32_t ky = 0; ky < k_h; ky++)
+                    {
+                        const int32_t iy = y * dw_conv_params->stride.h - dw_conv_params->padding.h +
+                            ky * dw_conv_params->dilation.h;
+
+                        for (int32_t kx = 0; kx < k_w; kx++)
+                        {
+                            const int32_t ix = x * dw_conv_params->stride.w - dw_conv_params->padding.w +
+                                kx * dw_conv_params->dilation.w;
+
+                            if (iy < 0 || iy >= in_h || ix < 0 || ix >= in_w)
+                            {
+                                continue;
+                            }
+                            acc += (int64_t)(input[((n * in_h + iy) * in_w + ix) * in_ch + ic] +
+                                             dw_conv_params->input_offset) *
+                                filter[(ky * k_w + kx) * out_ch + oc];
+                        }
+                    }
+                    *output++ = ref_output(acc,
+                                           quant_params->multiplier[oc],
+                                           quant_params->shift[oc],
+                                           dw_conv_params->output_offset,
+                                           &dw_conv_params->activation);
+                }
+            }
+        }
+    }
+}
+
+void ref_fully_connected_s8(const cmsis_nn_fc_params *fc_params,
+                            const cmsis_nn_per_tensor_quant_params *quant_params,
+                            const cmsis_nn_dims *input_dims,
+                            const int8_t *input,
+                            const cmsis_nn_dims *filter_dims,
+                            const int8_t *filter,
+                            const int32_t *bias,
+                            const cmsis_nn_dims *output_dims,
+                            int8_t *output)
+{
+    const int32_t depth = filter_dims->n;
+
+    for (int32_t b = 0; b < input_dims->n; b++)
+    {
+        for (int32_t oc = 0; oc < output_dims->c; oc++)
+        {
+            int64_t acc = (bias != NULL) ? bias[oc] : 0;
+
+            for (int32_t i = 0; i < depth; i++)
+            {
+                acc += (int64_t)(input[b * depth + i] + fc_params->input_offset) *
+                    (filter[oc * depth + i] + fc_params->filter_offset);
+            }
+            *output++ = ref_output(
+                acc, quant_params->multiplier, quant_params->shift, fc_params->output_offset, &fc_params->activation);
+        }
+    }
+}
+
+void ref_transpose_conv_s8(const cmsis_nn_conv_params *conv_params,
+                           const cmsis_nn_per_channel_quant_params *quant_params,
+                           const cmsis_nn_dims *input_dims,
+                           const int8_t *input,
+                           const cmsis_nn_dims *filter_dims,
+                           const int8_t *filter,
+                           const int32_t *bias,
+                           const cmsis_nn_dims *output_dims,
+                           int8_t *output)
+{
+    const int32_t in_h = input_dims->h, in_w = input_dims->w, in_ch = input_dims->c;
+    const int32_t k_h = filter_dims->h, k_w = filter_dims->w;
+    const int32_t stride_h = conv_params->stride.h, stride_w = conv_params->stride.w;
+
+    for (int32_t n = 0; n < output_dims->n; n++)
+    {
+        for (int32_t y = 0; y < output_dims->h; y++)
+        {
+            for (int32_t x = 0; x < output_dims->w; x++)
+            {
+                for (int32_t oc = 0; oc < output_dims->c; oc++)
+                {
+                    int64_t acc = (bias != NULL) ? bias[oc] : 0;
+
+                    /* Gather form of the scatter of TFLM: input pixel (iy, ix) contributes to
+                       output pixel (iy * stride + ky - pad, ix * stride + kx - pad) */
+                    for (int32_t ky = 0; ky < k_h; ky++)
+                    {
+                        const int32_t iy_stride = y + conv_params->padding.h - ky;
+                        const int32_t iy = iy_stride / stride_h;
+
+                        if (iy_stride < 0 || iy_stride % stride_h != 0 || iy >= in_h)
+                        {
+                            continue;
+                        }
+                        for (int32_t kx = 0; kx < k_w; kx++)
+                        {
+                            const int32_t ix_stride = x + conv_params->padding.w - kx;
+                            const int32_t ix = ix_stride / stride_w;
+
+                            if (ix_stride < 0 || ix_stride % stride_w != 0 || ix >= in_w)
+                            {
+                                continue;
+                            }
+                            for (int32_t ic = 0; ic < in_ch; ic++)
+                            {
+                                acc += (int64_t)(input[((n * in_h + iy) * in_w + ix) * in_ch + ic] +
+                                                 conv_params->input_offset) *
+                                    filter[((oc * k_h + ky) * k_w + kx) * in_ch + ic];
+                            }
+                        }
+                    }
+                    *output++ = ref_output(acc,
+                                           quant_params->multiplier[oc],
+                                           quant_params->shift[oc],
+                                           conv_params->output_offset,
+                                           &conv_params->activation);
+                }
+            }
+        }
+    }
+}
+
+void ref_batch_matmul_s8(const cmsis_nn_bmm_params *bmm_params,
+                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                         const cmsis_nn_dims *input_lhs_dims,
+                         const int8_t *input_lhs,
+                         const cmsis_nn_dims *input_rhs_dims,
+                         const int8_t *input_rhs,
+                         const cmsis_nn_dims *output_dims,
+                         int8_t *output)
+{
+    const cmsis_nn_fc_params *fc_params = &bmm_params->fc_params;
+    const int32_t rows = output_dims->w;
+    const int32_t cols = output_dims->c;
+    const int32_t depth = bmm_params->adj_x ? input_lhs_dims->w : input_lhs_dims->c;
+
+    for (int32_t n = 0; n < output_dims->n; n++)
+    {
+        for (int32_t h = 0; h < output_dims->h; h++)
+        {
+            /* Batch dimensions of size 1 are broadcast */
+            const int32_t lhs_batch =
+                (input_lhs_dims->n == 1 ? 0 : n) * input_lhs_dims->h + (input_lhs_dims->h == 1 ? 0 : h);
+            const int32_t rhs_batch =
+                (input_rhs_dims->n == 1 ? 0 : n) * input_rhs_dims->h + (input_rhs_dims->h == 1 ? 0 : h);
+            const int8_t *lhs = input_lhs + lhs_batch * rows * depth;
+            const int8_t *rhs = input_rhs + rhs_batch * depth * cols;
+
+            for (int32_t m = 0; m < rows; m++)
+            {
+                for (int32_t c = 0; c < cols; c++)
+                {
+                    int64_t acc = 0;
+
+                    for (int32_t k = 0; k < depth; k++)
+                    {
+                        const int32_t lhs_val = bmm_params->adj_x ? lhs[k * rows + m] : lhs[m * depth + k];
+                        const int32_t rhs_val = bmm_params->adj_y ? rhs[c * depth + k] : rhs[k * cols + c];
+
+                        acc += (int64_t)(lhs_val + fc_params->input_offset) * (rhs_val + fc_params->filter_offset);
+                    }
+                    *output++ = ref_output(acc,
+                                           quant_params->multiplier,
+                                           quant_params->shift,
+                                           fc_params->output_offset,
+                                           &fc_params->activation);
+                }
+            }
+        }
+    }
+}
+
+void ref_pad_s8(const int8_t *input,
+                int8_t *output,
+                const int8_t pad_value,
+                const cmsis_nn_dims *input_size,
+                const cmsis_nn_dims *pre_pad,
+                const cmsis_nn_dims *post_pad)
+{
+    const int32_t out_n = pre_pad->n + input_size->n + post_pad->n;
+    const int32_t out_h = pre_pad->h + input_size->h + post_pad->h;
+    const int32_t out_w = pre_pad->w + input_size->w + post_pad->w;
+    const int32_t out_c = pre_pad->c + input_size->c + post_pad->c;
+
+    for (int32_t n = 0; n < out_n; n++)
+    {
+        for (int32_t h = 0; h < out_h; h++)
+        {
+            for (int32_t w = 0; w < out_w; w++)
+            {
+                for (int32_t c = 0; c < out_c; c++)
+                {
+                    const int32_t in_n = n - pre_pad->n, in_h = h - pre_pad->h;
+                    const int32_t in_w = w - pre_pad->w, in_c = c - pre_pad->c;
+
+                    if (in_n >= 0 && in_n < input_size->n && in_h >= 0 && in_h < input_size->h && in_w >= 0 &&
+                        in_w < input_size->w && in_c >= 0 && in_c < input_size->c)
+                    {
+                        *output++ =
+                            input[((in_n * input_size->h + in_h) * input_size->w + in_w) * input_size->c + in_c];
+                    }
+                    else
+                    {
+                        *output++ = pad_value;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ref_transpose_s8(const int8_t *input,
+                      int8_t *output,
+                      const cmsis_nn_dims *input_dims,
+                      const cmsis_nn_dims *output_dims,
+                      const cmsis_nn_transpose_params *transpose_params)
+{
+    const int32_t in_size[4] = {input_dims->n, input_dims->h, input_dims->w, input_dims->c};
+    const int32_t first = 4 - transpose_params->num_dims;
+    int32_t perm[4];
+    int32_t out_index[4];
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        perm[i] = (i < first) ? i : first + (int32_t)transpose_params->permutations[i - first];
+    }
+
+    for (out_index[0] = 0; out_index[0] < output_dims->n; out_index[0]++)
+    {
+        for (out_index[1] = 0; out_index[1] < output_dims->h; out_index[1]++)
+        {
+            for (out_index[2] = 0; out_index[2] < output_dims->w; out_index[2]++)
+            {
+                for (out_index[3] = 0; out_index[3] < output_dims->c; out_index[3]++)
+                {
+                    int32_t in_index[4];
+
+                    for (int32_t i = 0; i < 4; i++)
+                    {
+                        in_index[perm[i]] = out_index[i];
+                    }
+                    *output++ =
+                        input[((in_index[0] * in_size[1] + in_index[1]) * in_size[2] + in_index[2]) * in_size[3] +
+                              in_index[3]];
+                }
+            }
+        }
+    }
+}
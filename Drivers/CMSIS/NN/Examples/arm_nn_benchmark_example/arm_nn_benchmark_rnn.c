@@ -0,0 +1,389 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_rnn.c
+ * Description:  Per-step latency of the LSTM and GRU layers
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * arm_lstm_unidirectional_s8_s16() and arm_gru_unidirectional_s8_s16() on
+ * keyword spotting and speech sizes, batch 1. A sequence of RNN_STEPS steps
+ * is run in one call, then streamed one step per call as a real-time
+ * application does. The time per step of both is reported. The streamed
+ * output must be bit exact with the single call. The kernels are not bit
+ * exact with TFLM, so they are checked against a float model of the layer
+ * instead, to within RNN_MAX_ERROR output steps.
+ */
+
+#include "arm_nn_benchmark.h"
+#include "arm_nnsupportfunctions.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RNN_STEPS (16)
+#define RNN_MAX_ERROR (1)
+
+/* Accumulator scale of the gates, before the activations: Q3.12 */
+#define GATE_SCALE (4096.0)
+
+typedef struct
+{
+    int32_t input_size;
+    int32_t hidden_size;
+} rnn_shape;
+
+static const rnn_shape rnn_shapes[] = {
+    {40, 64},
+    {64, 128},
+    {128, 256},
+};
+
+#define NUM_SHAPES ((int32_t)(sizeof(rnn_shapes) / sizeof(rnn_shapes[0])))
+
+/* Quantization of the data: input in [-2, 2], output and hidden state in [-1, 1] */
+static const double input_scale = 4.0 / 255;
+static const int32_t input_zp = 3;
+static const double output_scale = 2.0 / 255;
+static const int32_t output_zp = -2;
+
+static void quantize_multiplier(const double scale, int32_t *multiplier, int32_t *shift)
+{
+    int exponent;
+    const double fraction = frexp(scale, &exponent);
+    int64_t q = llround(fraction * (double)(1LL << 31));
+
+    if (q == (1LL << 31))
+    {
+        q /= 2;
+        exponent++;
+    }
+    *multiplier = (int32_t)q;
+    *shift = exponent;
+}
+
+static double sigmoid(const double x) { return 1.0 / (1.0 + exp(-x)); }
+
+/* Largest difference, in output steps, between the s8 output and the float hidden state */
+static int32_t output_error(const int8_t *output, const double *hidden, const int32_t size)
+{
+    int32_t max_error = 0;
+
+    for (int32_t i = 0; i < size; i++)
+    {
+        const int32_t expected = (int32_t)lrint(hidden[i] / output_scale) + output_zp;
+        const int32_t error = abs(output[i] - MAX(-128, MIN(127, expected)));
+
+        max_error = MAX(max_error, error);
+    }
+
+    return max_error;
+}
+
+/* Float LSTM on the dequantized data. Returns the largest output error in output steps. */
+static int32_t lstm_float_error(const rnn_shape *shape,
+                                const int8_t *input,
+                                const int8_t *input_weights,
+                                const int8_t *recurrent_weights,
+                                const int32_t *bias,
+                                const double weight_scale,
+                                const int8_t *output)
+{
+    const int32_t in_size = shape->input_size, hid_size = shape->hidden_size;
+    double *hidden = calloc(hid_size, sizeof(double));
+    double *cell = calloc(hid_size, sizeof(double));
+    double *gates = malloc(4 * hid_size * sizeof(double));
+    int32_t max_error = 0;
+
+    for (int32_t t = 0; t < RNN_STEPS; t++)
+    {
+        for (int32_t r = 0; r < 4 * hid_size; r++)
+        {
+            double acc = bias[r] * input_scale * weight_scale;
+
+            for (int32_t k = 0; k < in_size; k++)
+            {
+                acc +=
+                    input_weights[r * in_size + k] * weight_scale * (input[t * in_size + k] - input_zp) * input_scale;
+            }
+            for (int32_t k = 0; k < hid_size; k++)
+            {
+                acc += recurrent_weights[r * hid_size + k] * weight_scale * hidden[k];
+            }
+            gates[r] = acc;
+        }
+        for (int32_t j = 0; j < hid_size; j++)
+        {
+            cell[j] = sigmoid(gates[hid_size + j]) * cell[j] + sigmoid(gates[j]) * tanh(gates[2 * hid_size + j]);
+            hidden[j] = sigmoid(gates[3 * hid_size + j]) * tanh(cell[j]);
+        }
+        max_error = MAX(max_error, output_error(&output[t * hid_size], hidden, hid_size));
+
+        /* The hidden state of the next step is the s8 output */
+        for (int32_t j = 0; j < hid_size; j++)
+        {
+            hidden[j] = (output[t * hid_size + j] - output_zp) * output_scale;
+        }
+    }
+
+    free(gates);
+    free(cell);
+    free(hidden);
+
+    return max_error;
+}
+
+/* Float GRU on the dequantized data. Returns the largest output error in output steps. */
+static int32_t gru_float_error(const rnn_shape *shape,
+                               const int8_t *input,
+                               const int8_t *input_weights,
+                               const int8_t *recurrent_weights,
+                               const int32_t *bias,
+                               const int32_t *recurrent_bias,
+                               const double weight_scale,
+                               const int8_t *output)
+{
+    const int32_t in_size = shape->input_size, hid_size = shape->hidden_size;
+    const double recurrent_scale = weight_scale / 32768.0;
+    double *hidden = calloc(hid_size, sizeof(double));
+    double *gates_x = malloc(3 * hid_size * sizeof(double));
+    double *gates_h = malloc(3 * hid_size * sizeof(double));
+    int32_t max_error = 0;
+
+    for (int32_t t = 0; t < RNN_STEPS; t++)
+    {
+        for (int32_t r = 0; r < 3 * hid_size; r++)
+        {
+            double acc_x = bias[r] * input_scale * weight_scale;
+            double acc_h = recurrent_bias[r] * recurrent_scale;
+
+            for (int32_t k = 0; k < in_size; k++)
+            {
+                acc_x +=
+                    input_weights[r * in_size + k] * weight_scale * (input[t * in_size + k] - input_zp) * input_scale;
+            }
+            for (int32_t k = 0; k < hid_size; k++)
+            {
+                acc_h += recurrent_weights[r * hid_size + k] * weight_scale * hidden[k];
+            }
+            gates_x[r] = acc_x;
+            gates_h[r] = acc_h;
+        }
+        for (int32_t j = 0; j < hid_size; j++)
+        {
+            const double z = sigmoid(gates_x[j] + gates_h[j]);
+            const double r = sigmoid(gates_x[hid_size + j] + gates_h[hid_size + j]);
+            const double n = tanh(gates_x[2 * hid_size + j] + r * gates_h[2 * hid_size + j]);
+
+            hidden[j] = (1.0 - z) * n + z * hidden[j];
+        }
+        max_error = MAX(max_error, output_error(&output[t * hid_size], hidden, hid_size));
+    }
+
+    free(gates_h);
+    free(gates_x);
+    free(hidden);
+
+    return max_error;
+}
+
+/* Run the RNN_STEPS steps from the initial state, steps_per_call steps per call */
+static void lstm_run(const cmsis_nn_context *ctx,
+                     const cmsis_nn_lstm_params *lstm_params,
+                     const cmsis_nn_rnn_gates *gates,
+                     const rnn_shape *shape,
+                     const int32_t steps_per_call,
+                     const int8_t *input,
+                     int8_t *output,
+                     int8_t *hidden,
+                     int16_t *cell)
+{
+    const cmsis_nn_dims input_dims = {1, steps_per_call, 1, shape->input_size};
+    const cmsis_nn_dims output_dims = {1, steps_per_call, 1, shape->hidden_size};
+
+    memset(hidden, output_zp, shape->hidden_size);
+    memset(cell, 0, shape->hidden_size * sizeof(int16_t));
+    for (int32_t t = 0; t < RNN_STEPS; t += steps_per_call)
+    {
+        arm_lstm_unidirectional_s8_s16(ctx,
+                                       lstm_params,
+                                       gates,
+                                       &input_dims,
+                                       &input[t * shape->input_size],
+                                       &output_dims,
+                                       &output[t * shape->hidden_size],
+                                       hidden,
+                                       cell);
+    }
+}
+
+/* Run the RNN_STEPS steps from the initial state, steps_per_call steps per call */
+static void gru_run(const cmsis_nn_context *ctx,
+                    const cmsis_nn_gru_params *gru_params,
+                    const cmsis_nn_rnn_gates *gates,
+                    const rnn_shape *shape,
+                    const int32_t steps_per_call,
+                    const int8_t *input,
+                    int8_t *output,
+                    int16_t *hidden)
+{
+    const cmsis_nn_dims input_dims = {1, steps_per_call, 1, shape->input_size};
+    const cmsis_nn_dims output_dims = {1, steps_per_call, 1, shape->hidden_size};
+
+    memset(hidden, 0, shape->hidden_size * sizeof(int16_t));
+    for (int32_t t = 0; t < RNN_STEPS; t += steps_per_call)
+    {
+        arm_gru_unidirectional_s8_s16(ctx,
+                                      gru_params,
+                                      gates,
+                                      &input_dims,
+                                      &input[t * shape->input_size],
+                                      &output_dims,
+                                      &output[t * shape->hidden_size],
+                                      hidden);
+    }
+}
+
+static void bench_rnn_shape(const rnn_shape *shape, const int32_t gru)
+{
+    const int32_t in_size = shape->input_size, hid_size = shape->hidden_size;
+    const int32_t num_gates = gru ? 3 : 4;
+    const int32_t rows = num_gates * hid_size;
+    /* Weights in +-2 / sqrt(fan in), so that the gates are not all saturated */
+    const double weight_scale = 2.0 / sqrt((double)(in_size + hid_size)) / 127;
+    const cmsis_nn_dims input_dims = {1, RNN_STEPS, 1, in_size};
+    const cmsis_nn_dims output_dims = {1, RNN_STEPS, 1, hid_size};
+    int8_t *input = bench_alloc_s8(RNN_STEPS * in_size, -128, 127);
+    int8_t *input_weights = bench_alloc_s8(rows * in_size, -127, 127);
+    int8_t *recurrent_weights = bench_alloc_s8(rows * hid_size, -127, 127);
+    int32_t *bias = malloc(rows * sizeof(int32_t));
+    int32_t *recurrent_bias = malloc(rows * sizeof(int32_t));
+    int8_t *output = malloc(RNN_STEPS * hid_size);
+    int8_t *streamed = malloc(RNN_STEPS * hid_size);
+    int8_t *hidden = malloc(hid_size);
+    int16_t *state = malloc(hid_size * sizeof(int16_t));
+    int32_t input_mult[4], input_shift[4], recurrent_mult[4], recurrent_shift[4];
+    cmsis_nn_rnn_gates gates;
+    cmsis_nn_context ctx;
+    double sequence_ns = 0.0;
+    double step_ns = 0.0;
+    int32_t exact;
+    int32_t error;
+    char name[64];
+
+    /* Biases in [-1, 1] */
+    for (int32_t r = 0; r < rows; r++)
+    {
+        bias[r] = (int32_t)lrint(bench_rand(-1000, 1000) / 1000.0 / (input_scale * weight_scale));
+        recurrent_bias[r] = (int32_t)lrint(bench_rand(-1000, 1000) / 1000.0 / (weight_scale / 32768.0));
+    }
+    for (int32_t g = 0; g < num_gates; g++)
+    {
+        quantize_multiplier(input_scale * weight_scale * GATE_SCALE, &input_mult[g], &input_shift[g]);
+        /* The recurrent input is the s8 hidden state of the LSTM, the s16 Q0.15 state of the GRU */
+        quantize_multiplier((gru ? 1.0 / 32768.0 : output_scale) * weight_scale * GATE_SCALE,
+                            &recurrent_mult[g],
+                            &recurrent_shift[g]);
+    }
+    gates.input_weights = input_weights;
+    gates.recurrent_weights = recurrent_weights;
+    gates.bias = bias;
+    gates.recurrent_bias = gru ? recurrent_bias : NULL;
+    gates.input_multipliers = input_mult;
+    gates.input_shifts = input_shift;
+    gates.recurrent_multipliers = recurrent_mult;
+    gates.recurrent_shifts = recurrent_shift;
+
+    if (gru)
+    {
+        cmsis_nn_gru_params gru_params = {0, -input_zp, output_zp, 0, 0};
+
+        quantize_multiplier(1.0 / 32768.0 / output_scale, &gru_params.output_multiplier, &gru_params.output_shift);
+        ctx.size = arm_gru_unidirectional_s8_s16_get_buffer_size(&input_dims, &output_dims);
+        ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+
+        BENCH_TIME(sequence_ns, gru_run(&ctx, &gru_params, &gates, shape, RNN_STEPS, input, output, state));
+        BENCH_TIME(step_ns, gru_run(&ctx, &gru_params, &gates, shape, 1, input, streamed, state));
+        error = gru_float_error(
+            shape, input, input_weights, recurrent_weights, bias, recurrent_bias, weight_scale, output);
+    }
+    else
+    {
+        cmsis_nn_lstm_params lstm_params = {0, -input_zp, output_zp, -11, 0, 0, 0};
+
+        quantize_multiplier(1.0 / (1 << 30) / output_scale, &lstm_params.hidden_multiplier, &lstm_params.hidden_shift);
+        ctx.size = arm_lstm_unidirectional_s8_s16_get_buffer_size(&input_dims, &output_dims);
+        ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+
+        BENCH_TIME(sequence_ns,
+                   lstm_run(&ctx, &lstm_params, &gates, shape, RNN_STEPS, input, output, hidden, state));
+        BENCH_TIME(step_ns, lstm_run(&ctx, &lstm_params, &gates, shape, 1, input, streamed, hidden, state));
+        error = lstm_float_error(shape, input, input_weights, recurrent_weights, bias, weight_scale, output);
+    }
+
+    snprintf(name,
+             sizeof(name),
+             "%s %d->%d, error %d",
+             gru ? "gru" : "lstm",
+             (int)in_size,
+             (int)hid_size,
+             (int)error);
+    exact = bench_check_exact(name, streamed, output, RNN_STEPS * hid_size);
+    if (error > RNN_MAX_ERROR)
+    {
+        printf("%s: error of %d output steps to the float model\n", name, (int)error);
+        bench_failures++;
+        exact = 0;
+    }
+    bench_report(
+        name, (uint64_t)rows * (in_size + hid_size), step_ns / RNN_STEPS, sequence_ns / RNN_STEPS, exact);
+
+    free(ctx.buf);
+    free(state);
+    free(hidden);
+    free(streamed);
+    free(output);
+    free(recurrent_bias);
+    free(bias);
+    free(recurrent_weights);
+    free(input_weights);
+    free(input);
+}
+
+void bench_rnn(void)
+{
+    bench_header("LSTM and GRU, time per step streamed one step per call", "seq us");
+
+    for (int32_t s = 0; s < NUM_SHAPES; s++)
+    {
+        bench_rnn_shape(&rnn_shapes[s], 0);
+    }
+    for (int32_t s = 0; s < NUM_SHAPES; s++)
+    {
+        bench_rnn_shape(&rnn_shapes[s], 1);
+    }
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_s4.c
+ * Description:  Throughput of the s4 weight layers against the s8 ones
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * arm_fully_connected_s4(), arm_convolve_s4() and arm_depthwise_conv_s4()
+ * against arm_fully_connected_s8(), arm_convolve_s8() and
+ * arm_depthwise_conv_s8() on the same weights in [-8, 7], unpacked. The s4
+ * weights take half the memory; the outputs must be bit exact.
+ */
+
+#include "arm_nn_benchmark.h"
+#include "arm_nnsupportfunctions.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* s4 weights have 4 bits less than the s8 ones bench_fill_quant() is made for */
+#define S4_SHIFT_ADJUST (4)
+
+/* Weight i is the low nibble of byte i / 2 if i is even, the high nibble otherwise */
+static int8_t *pack_s4_weights(const int8_t *weights, const int32_t size)
+{
+    int8_t *packed = calloc((size + 1) / 2, 1);
+
+    for (int32_t i = 0; i < size; i++)
+    {
+        packed[i / 2] |= (int8_t)((weights[i] & 0xF) << ((i & 1) * 4));
+    }
+
+    return packed;
+}
+
+static void fill_s4_quant(int32_t *bias, int32_t *mult, int32_t *shift, const int32_t num_ch, const int32_t depth)
+{
+    bench_fill_quant(bias, mult, shift, num_ch, depth);
+    for (int32_t i = 0; i < num_ch; i++)
+    {
+        shift[i] += S4_SHIFT_ADJUST;
+    }
+}
+
+static void bench_s4_fc(const int32_t batches, const int32_t depth, const int32_t out_ch)
+{
+    const cmsis_nn_fc_params fc_params = {bench_rand(-127, 128), 0, bench_rand(-128, 127), {-128, 127}};
+    const cmsis_nn_dims input_dims = {batches, 1, 1, depth};
+    const cmsis_nn_dims filter_dims = {depth, 1, 1, out_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {batches, 1, 1, out_ch};
+    const int32_t out_size = batches * out_ch;
+    int8_t *input = bench_alloc_s8(batches * depth, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * depth, -8, 7);
+    int8_t *packed = pack_s4_weights(filter, out_ch * depth);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int8_t *output = malloc(out_size);
+    int8_t *output_s8 = malloc(out_size);
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_context ctx;
+    cmsis_nn_context ctx_s4;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    fill_s4_quant(NULL, &quant_params.multiplier, &quant_params.shift, 1, depth);
+    for (int32_t i = 0; i < out_ch; i++)
+    {
+        bias[i] = bench_rand(-5000, 5000);
+    }
+    ctx.size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+    ctx_s4.size = arm_fully_connected_s4_get_buffer_size(&filter_dims);
+    ctx_s4.buf = malloc(ctx_s4.size > 0 ? ctx_s4.size : 1);
+
+    BENCH_TIME(time_ns,
+               arm_fully_connected_s4(&ctx_s4, &fc_params, &quant_params, &input_dims, input, &filter_dims, packed,
+                                      &bias_dims, bias, &output_dims, output));
+    BENCH_TIME(base_ns,
+               arm_fully_connected_s8(&ctx, &fc_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                                      &bias_dims, bias, &output_dims, output_s8));
+
+    snprintf(name, sizeof(name), "fully connected %d->%d, batch %d", (int)depth, (int)out_ch, (int)batches);
+    bench_report(name,
+                 (uint64_t)out_size * depth,
+                 time_ns,
+                 base_ns,
+                 bench_check_exact(name, output, output_s8, out_size));
+
+    free(ctx_s4.buf);
+    free(ctx.buf);
+    free(output_s8);
+    free(output);
+    free(bias);
+    free(packed);
+    free(filter);
+    free(input);
+}
+
+static void bench_s4_conv(const int32_t in_hw, const int32_t in_ch, const int32_t out_ch, const int32_t kernel)
+{
+    const int32_t pad = kernel / 2;
+    const int32_t depth = kernel * kernel * in_ch;
+    const cmsis_nn_conv_params conv_params = {
+        bench_rand(-127, 128), bench_rand(-128, 127), {1, 1}, {pad, pad}, {1, 1}, {-128, 127}};
+    const cmsis_nn_dims input_dims = {1, in_hw, in_hw, in_ch};
+    const cmsis_nn_dims filter_dims = {out_ch, kernel, kernel, in_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {1, in_hw, in_hw, out_ch};
+    const int32_t out_size = in_hw * in_hw * out_ch;
+    int8_t *input = bench_alloc_s8(in_hw * in_hw * in_ch, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * depth, -8, 7);
+    int8_t *packed = pack_s4_weights(filter, out_ch * depth);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(out_ch * sizeof(int32_t));
+    const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+    int8_t *output = malloc(out_size);
+    int8_t *output_s8 = malloc(out_size);
+    cmsis_nn_context ctx;
+    cmsis_nn_context ctx_s4;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    fill_s4_quant(bias, mult, shift, out_ch, depth);
+    ctx.size = arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+    ctx_s4.size = arm_convolve_s4_get_buffer_size(&input_dims, &filter_dims);
+    ctx_s4.buf = malloc(ctx_s4.size > 0 ? ctx_s4.size : 1);
+
+    BENCH_TIME(time_ns,
+               arm_convolve_s4(&ctx_s4, &conv_params, &quant_params, &input_dims, input, &filter_dims, packed,
+                               &bias_dims, bias, &output_dims, output));
+    BENCH_TIME(base_ns,
+               arm_convolve_s8(&ctx, &conv_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                               &bias_dims, bias, &output_dims, output_s8));
+
+    snprintf(name,
+             sizeof(name),
+             "conv %dx%d %dx%dx%d->%d",
+             (int)kernel,
+             (int)kernel,
+             (int)in_hw,
+             (int)in_hw,
+             (int)in_ch,
+             (int)out_ch);
+    bench_report(name,
+                 (uint64_t)out_size * depth,
+                 time_ns,
+                 base_ns,
+                 bench_check_exact(name, output, output_s8, out_size));
+
+    free(ctx_s4.buf);
+    free(ctx.buf);
+    free(output_s8);
+    free(output);
+    free(shift);
+    free(mult);
+    free(bias);
+    free(packed);
+    free(filter);
+    free(input);
+}
+
+static void bench_s4_depthwise(const int32_t in_hw, const int32_t ch, const int32_t stride)
+{
+    const int32_t out_hw = (in_hw + stride - 1) / stride;
+    const int32_t pad = MAX((out_hw - 1) * stride + 3 - in_hw, 0) / 2;
+    const cmsis_nn_dw_conv_params dw_params = {
+        bench_rand(-127, 128), bench_rand(-128, 127), 1, {stride, stride}, {pad, pad}, {1, 1}, {-128, 127}};
+    const cmsis_nn_dims input_dims = {1, in_hw, in_hw, ch};
+    const cmsis_nn_dims filter_dims = {1, 3, 3, ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, ch};
+    const cmsis_nn_dims output_dims = {1, out_hw, out_hw, ch};
+    const int32_t out_size = out_hw * out_hw * ch;
+    int8_t *input = bench_alloc_s8(in_hw * in_hw * ch, -128, 127);
+    int8_t *filter = bench_alloc_s8(9 * ch, -8, 7);
+    int8_t *packed = pack_s4_weights(filter, 9 * ch);
+    int32_t *bias = malloc(ch * sizeof(int32_t));
+    int32_t *mult = malloc(ch * sizeof(int32_t));
+    int32_t *shift = malloc(ch * sizeof(int32_t));
+    const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+    int8_t *output = malloc(out_size);
+    int8_t *output_s8 = malloc(out_size);
+    const cmsis_nn_context ctx = {NULL, 0};
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    fill_s4_quant(bias, mult, shift, ch, 9);
+
+    BENCH_TIME(time_ns,
+               arm_depthwise_conv_s4(&ctx, &dw_params, &quant_params, &input_dims, input, &filter_dims, packed,
+                                     &bias_dims, bias, &output_dims, output));
+    BENCH_TIME(base_ns,
+               arm_depthwise_conv_s8(&ctx, &dw_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                                     &bias_dims, bias, &output_dims, output_s8));
+
+    snprintf(name,
+             sizeof(name),
+             "depthwise 3x3 %dx%dx%d%s",
+             (int)in_hw,
+             (int)in_hw,
+             (int)ch,
+             (stride == 2) ? " s2" : "");
+    bench_report(
+        name, (uint64_t)out_size * 9, time_ns, base_ns, bench_check_exact(name, output, output_s8, out_size));
+
+    free(output_s8);
+    free(output);
+    free(shift);
+    free(mult);
+    free(bias);
+    free(packed);
+    free(filter);
+    free(input);
+}
+
+void bench_s4(void)
+{
+    bench_header("s4 weights against the s8 layers on the unpacked weights", "s8 us");
+
+    bench_s4_fc(1, 256, 1001);
+    bench_s4_fc(1, 1024, 1000);
+    bench_s4_fc(4, 512, 512);
+    bench_s4_fc(1, 250, 31);
+    bench_s4_conv(32, 64, 64, 1);
+    bench_s4_conv(16, 32, 64, 3);
+    bench_s4_conv(16, 3, 13, 3);
+    bench_s4_depthwise(32, 64, 1);
+    bench_s4_depthwise(32, 64, 2);
+}
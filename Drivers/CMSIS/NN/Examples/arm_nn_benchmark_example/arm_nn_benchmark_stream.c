@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_benchmark_stream.c
+ * Description:  Streamed weights against resident weights
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * arm_convolve_stream_s8() and arm_fully_connected_stream_s8() against
+ * arm_convolve_s8() and arm_fully_connected_s8() on resident weights.
+ *
+ * The weight stream simulates a DMA from external memory: a tile fetched at
+ * time t is ready at t + latency, the latency proportional to its size, and
+ * wait() spins until then. The bandwidth is set so that fetching the whole
+ * filter takes a given share of the time of the resident kernel, e.g. 50%.
+ * The tile is only copied in wait(), so a kernel reading a tile before
+ * waiting for it fails the bit-exactness check. The rows marked "serial"
+ * wait for each tile in fetch(), without any overlap with the computation.
+ */
+
+#include "arm_nn_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const int8_t *filter;
+    int32_t tile_bytes;
+    double ns_per_byte;
+    int32_t serial;
+    /* The fetch in flight: the kernels wait for a tile before fetching the next one */
+    int8_t *dst;
+    int32_t tile;
+    int32_t size;
+    uint32_t ready;
+} bench_stream_state;
+
+static void bench_stream_wait(void *state, int32_t tile)
+{
+    bench_stream_state *s = (bench_stream_state *)state;
+
+    if (s->dst == NULL || s->tile != tile)
+    {
+        printf("stream: wait for tile %d, which is not being fetched\n", (int)tile);
+        bench_failures++;
+        return;
+    }
+    while ((int32_t)(arm_nn_profile_timestamp() - s->ready) < 0)
+    {
+    }
+    memcpy(s->dst, s->filter + tile * s->tile_bytes, s->size);
+    s->dst = NULL;
+}
+
+static void bench_stream_fetch(void *state, int32_t tile, int8_t *dst, int32_t size)
+{
+    bench_stream_state *s = (bench_stream_state *)state;
+
+    s->dst = dst;
+    s->tile = tile;
+    s->size = size;
+    s->ready = arm_nn_profile_timestamp() + (uint32_t)(size * s->ns_per_byte);
+    if (s->serial)
+    {
+        bench_stream_wait(state, tile);
+        /* The kernel waits again */
+        s->dst = dst;
+    }
+}
+
+/* Fetch of the whole filter in share times base_ns */
+static void bench_stream_init(bench_stream_state *s,
+                              cmsis_nn_weight_stream *stream,
+                              const int8_t *filter,
+                              const int32_t filter_size,
+                              const int32_t row_size,
+                              const int32_t tile_ch,
+                              const double share,
+                              const double base_ns,
+                              const int32_t serial)
+{
+    s->filter = filter;
+    s->tile_bytes = tile_ch * row_size;
+    s->ns_per_byte = share * base_ns / filter_size;
+    s->serial = serial;
+    s->dst = NULL;
+    stream->fetch = bench_stream_fetch;
+    stream->wait = bench_stream_wait;
+    stream->stream = s;
+    stream->tile_ch = tile_ch;
+}
+
+static void bench_stream_conv(const char *layer,
+                              const int32_t hw,
+                              const int32_t in_ch,
+                              const int32_t out_ch,
+                              const int32_t kernel,
+                              const int32_t tile_ch)
+{
+    static const double shares[] = {0.5, 0.5, 1.5};
+    static const int32_t serials[] = {0, 1, 0};
+    const int32_t pad = kernel / 2;
+    const int32_t depth = kernel * kernel * in_ch;
+    const cmsis_nn_conv_params conv_params = {
+        bench_rand(-127, 128), bench_rand(-20, 20), {1, 1}, {pad, pad}, {1, 1}, {-128, 127}};
+    const cmsis_nn_dims input_dims = {1, hw, hw, in_ch};
+    const cmsis_nn_dims filter_dims = {out_ch, kernel, kernel, in_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {1, hw, hw, out_ch};
+    const int32_t out_size = hw * hw * out_ch;
+    int8_t *input = bench_alloc_s8(hw * hw * in_ch, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * depth, -127, 127);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(out_ch * sizeof(int32_t));
+    const cmsis_nn_per_channel_quant_params quant_params = {mult, shift};
+    int8_t *output = malloc(out_size);
+    int8_t *resident = malloc(out_size);
+    cmsis_nn_weight_stream stream = {NULL, NULL, NULL, tile_ch};
+    bench_stream_state state;
+    cmsis_nn_context ctx;
+    cmsis_nn_context stream_ctx;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    bench_fill_quant(bias, mult, shift, out_ch, depth);
+    ctx.size = arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+    stream_ctx.size = arm_convolve_stream_s8_get_buffer_size(&stream, &input_dims, &filter_dims, &output_dims);
+    stream_ctx.buf = malloc(stream_ctx.size);
+
+    BENCH_TIME(base_ns,
+               arm_convolve_s8(&ctx, &conv_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                               &bias_dims, bias, &output_dims, resident));
+
+    for (int32_t i = 0; i < (int32_t)(sizeof(shares) / sizeof(shares[0])); i++)
+    {
+        bench_stream_init(&state, &stream, filter, out_ch * depth, depth, tile_ch, shares[i], base_ns, serials[i]);
+        memset(output, 0, out_size);
+        BENCH_TIME(time_ns,
+                   arm_convolve_stream_s8(&stream_ctx, &stream, &conv_params, &quant_params, &input_dims, input,
+                                          &filter_dims, &bias_dims, bias, &output_dims, output));
+
+        snprintf(name,
+                 sizeof(name),
+                 "%s, fetch %d%%%s",
+                 layer,
+                 (int)(shares[i] * 100.0),
+                 serials[i] ? ", serial" : "");
+        bench_report(name,
+                     (uint64_t)out_size * depth,
+                     time_ns,
+                     base_ns,
+                     bench_check_exact(name, output, resident, out_size));
+    }
+
+    free(stream_ctx.buf);
+    free(ctx.buf);
+    free(resident);
+    free(output);
+    free(shift);
+    free(mult);
+    free(bias);
+    free(filter);
+    free(input);
+}
+
+static void bench_stream_fc(const char *layer,
+                            const int32_t batches,
+                            const int32_t depth,
+                            const int32_t out_ch,
+                            const int32_t tile_ch)
+{
+    static const double shares[] = {0.5, 0.5, 1.5};
+    static const int32_t serials[] = {0, 1, 0};
+    const cmsis_nn_fc_params fc_params = {bench_rand(-127, 128), 0, bench_rand(-128, 127), {-128, 127}};
+    const cmsis_nn_dims input_dims = {batches, 1, 1, depth};
+    const cmsis_nn_dims filter_dims = {depth, 1, 1, out_ch};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, out_ch};
+    const cmsis_nn_dims output_dims = {batches, 1, 1, out_ch};
+    const int32_t out_size = batches * out_ch;
+    int8_t *input = bench_alloc_s8(batches * depth, -128, 127);
+    int8_t *filter = bench_alloc_s8(out_ch * depth, -127, 127);
+    int32_t *bias = malloc(out_ch * sizeof(int32_t));
+    int8_t *output = malloc(out_size);
+    int8_t *resident = malloc(out_size);
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_weight_stream stream = {NULL, NULL, NULL, tile_ch};
+    bench_stream_state state;
+    cmsis_nn_context ctx;
+    cmsis_nn_context stream_ctx;
+    double time_ns = 0.0;
+    double base_ns = 0.0;
+    char name[64];
+
+    bench_fill_quant(NULL, &quant_params.multiplier, &quant_params.shift, 1, depth);
+    for (int32_t i = 0; i < out_ch; i++)
+    {
+        bias[i] = bench_rand(-5000, 5000);
+    }
+    ctx.size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(ctx.size > 0 ? ctx.size : 1);
+    stream_ctx.size = arm_fully_connected_stream_s8_get_buffer_size(&stream, &filter_dims);
+    stream_ctx.buf = malloc(stream_ctx.size);
+
+    BENCH_TIME(base_ns,
+               arm_fully_connected_s8(&ctx, &fc_params, &quant_params, &input_dims, input, &filter_dims, filter,
+                                      &bias_dims, bias, &output_dims, resident));
+
+    for (int32_t i = 0; i < (int32_t)(sizeof(shares) / sizeof(shares[0])); i++)
+    {
+        bench_stream_init(&state, &stream, filter, out_ch * depth, depth, tile_ch, shares[i], base_ns, serials[i]);
+        memset(output, 0, out_size);
+        BENCH_TIME(time_ns,
+                   arm_fully_connected_stream_s8(&stream_ctx, &stream, &fc_params, &quant_params, &input_dims,
+                                                 input, &filter_dims, &bias_dims, bias, &output_dims, output));
+
+        snprintf(name,
+                 sizeof(name),
+                 "%s, fetch %d%%%s",
+                 layer,
+                 (int)(shares[i] * 100.0),
+                 serials[i] ? ", serial" : "");
+        bench_report(name,
+                     (uint64_t)out_size * depth,
+                     time_ns,
+                     base_ns,
+                     bench_check_exact(name, output, resident, out_size));
+    }
+
+    free(stream_ctx.buf);
+    free(ctx.buf);
+    free(resident);
+    free(output);
+    free(bias);
+    free(filter);
+    free(input);
+}
+
+void bench_stream(void)
+{
+    bench_header("Streamed weights, with the fetch of the filter taking a share of the resident time", "resident us");
+
+    /* Tiles of 32 output channels: 4 tiles, the first fetch is not overlapped */
+    bench_stream_conv("conv3x3 10x10x64->128", 10, 64, 128, 3, 32);
+    /* 1x1 projection, 8 tiles, and a tile size that does not divide C_OUT */
+    bench_stream_conv("conv1x1 7x7x512->512", 7, 512, 512, 1, 64);
+    bench_stream_conv("conv1x1 7x7x512->100", 7, 512, 100, 1, 24);
+    /* MobileNet classifier: one pass over 1 MB of weights per inference */
+    bench_stream_fc("fc 1024->1000", 1, 1024, 1000, 128);
+    bench_stream_fc("fc 1024->1000 x4", 4, 1024, 1000, 128);
+}
@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generated by gen_model.py, do not edit */
+
+#include "arm_nn_graph_tflite_data.h"
+
+/* Read in place: the int32 biases must be 4-byte aligned */
+const uint8_t tflite_model[TFLITE_MODEL_SIZE] __ALIGNED(16) = {
+    0x18, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xfc, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+    0x7c, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xd8, 0x07, 0x00, 0x00, 0xdc, 0x07, 0x00, 0x00,
+    0xe0, 0x07, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+    0x68, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00,
+    0x28, 0x03, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00,
+    0x08, 0x05, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00,
+    0x88, 0x06, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xcd, 0xcc, 0x4c, 0x3d, 0x01, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x17, 0x1e, 0x85, 0x3b, 0xf4, 0xca, 0x04, 0x3c, 0x10, 0x7c, 0xf8, 0x3b,
+    0xa9, 0x88, 0x46, 0x3b, 0x28, 0x2a, 0xa4, 0x3b, 0xc6, 0xe0, 0xaf, 0x3b, 0x8e, 0xdb, 0xef, 0x3b,
+    0x17, 0x0e, 0xb9, 0x3b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0a, 0xd7, 0x23, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xad, 0xca, 0xa7, 0x3b,
+    0xdf, 0x85, 0x20, 0x3c, 0xce, 0x71, 0xe5, 0x3b, 0x75, 0x5d, 0xf7, 0x3b, 0x2d, 0x40, 0xca, 0x3b,
+    0xb9, 0x87, 0x92, 0x3b, 0x8f, 0x3a, 0xa9, 0x3b, 0x1f, 0x19, 0x1c, 0x3c, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8f, 0xc2, 0xf5, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0xdc, 0xdf, 0xd4, 0x3b, 0xf6, 0x2f, 0xa7, 0x3b, 0x2f, 0x88, 0x08, 0x3c,
+    0x3f, 0x2b, 0xe0, 0x3b, 0xec, 0xa7, 0x11, 0x3c, 0x8f, 0xc2, 0x00, 0x3c, 0xe7, 0x4c, 0xdf, 0x3b,
+    0xc6, 0xee, 0x8c, 0x3b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0xd7, 0xa3, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xec, 0x51, 0x38, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xec, 0x51, 0x38, 0x3d,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xec, 0x51, 0x38, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xec, 0x51, 0x38, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x6f, 0x12, 0x83, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xec, 0x51, 0xb8, 0x3d,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+    0x40, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
+    0x6c, 0x02, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x14, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+    0x20, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00,
+    0x48, 0x02, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+    0xf9, 0x03, 0x41, 0x73, 0x89, 0xa5, 0x52, 0x72, 0xc0, 0xd0, 0x5e, 0xec, 0xc6, 0x54, 0xc2, 0xe9,
+    0x25, 0x0d, 0x96, 0x88, 0x5d, 0x41, 0x56, 0x0a, 0x51, 0xd5, 0xf4, 0x4a, 0xa0, 0xce, 0xa0, 0xf4,
+    0x7a, 0xa3, 0xe2, 0xe7, 0x67, 0xb4, 0x01, 0xc3, 0x86, 0x40, 0x90, 0xc8, 0x00, 0xfc, 0x9e, 0x7b,
+    0x40, 0x76, 0x98, 0x39, 0xcb, 0x0b, 0x6c, 0xc7, 0x3a, 0xa9, 0xd3, 0x78, 0xec, 0x04, 0xcb, 0x9e,
+    0xed, 0x1f, 0xf5, 0x47, 0xdd, 0x1d, 0x46, 0x6a, 0xed, 0x8b, 0x38, 0x07, 0x5f, 0xf6, 0xde, 0x90,
+    0xf5, 0x24, 0x45, 0x5a, 0xb7, 0x18, 0x4e, 0xc3, 0xd8, 0x57, 0x15, 0x02, 0x2c, 0x03, 0x7b, 0x41,
+    0x8e, 0xa6, 0x0b, 0x52, 0x92, 0x2f, 0x42, 0x49, 0x5f, 0xb1, 0x0e, 0x4d, 0xdc, 0xb1, 0xfb, 0x95,
+    0xb9, 0x5b, 0x2b, 0x5c, 0x57, 0x60, 0xd0, 0xf9, 0x1e, 0xc6, 0x6b, 0x82, 0x56, 0x25, 0xc1, 0x38,
+    0xea, 0x56, 0x7f, 0xc8, 0xf8, 0xb7, 0x31, 0x24, 0x58, 0x4e, 0x7a, 0x76, 0x65, 0xa7, 0x8b, 0xfb,
+    0xd8, 0x65, 0x4c, 0xec, 0x13, 0x17, 0x64, 0x87, 0xfd, 0x2c, 0xf4, 0x6b, 0x73, 0x53, 0xf7, 0x62,
+    0x93, 0x29, 0xc5, 0xbf, 0x2e, 0x44, 0x63, 0xb6, 0x5f, 0x54, 0xd1, 0x90, 0x45, 0x53, 0xf6, 0xaa,
+    0xa6, 0xe0, 0x42, 0xd1, 0x89, 0x31, 0x3e, 0xae, 0x0f, 0xe6, 0x00, 0x82, 0x22, 0xc3, 0x0e, 0xec,
+    0x1c, 0x9c, 0xdd, 0x22, 0x44, 0xe2, 0x87, 0x39, 0x01, 0x27, 0xa9, 0xee, 0x62, 0x5e, 0xd1, 0x22,
+    0x96, 0x4f, 0xc5, 0xd8, 0x77, 0x0b, 0x60, 0xb3, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0x01, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x59, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0x9e, 0xfe, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x55, 0xfe, 0xff, 0xff,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+    0xb9, 0x16, 0xf5, 0x57, 0x33, 0x3a, 0x12, 0xde, 0xc8, 0xf3, 0x12, 0xde, 0xa6, 0x9c, 0x8c, 0xb4,
+    0xe8, 0xc9, 0xae, 0xd1, 0x37, 0xd0, 0x6b, 0x14, 0xa4, 0x78, 0x61, 0x46, 0xa9, 0x4a, 0x33, 0x42,
+    0x36, 0x19, 0xd8, 0x6b, 0x7b, 0x30, 0xdc, 0x00, 0x10, 0x94, 0x97, 0xfd, 0x10, 0xb7, 0xc4, 0xa2,
+    0x6a, 0x02, 0xc7, 0x49, 0x75, 0xcc, 0x66, 0x45, 0x4b, 0x07, 0x69, 0xa7, 0x97, 0x77, 0xfd, 0xe7,
+    0x3b, 0xcc, 0x23, 0x58, 0x4d, 0xa0, 0x78, 0x3c, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0xc6, 0x00, 0x00, 0x00, 0xc7, 0xfe, 0xff, 0xff, 0xa6, 0x01, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff,
+    0xb9, 0x01, 0x00, 0x00, 0xf3, 0xfe, 0xff, 0xff, 0x69, 0xfe, 0xff, 0xff, 0x55, 0x01, 0x00, 0x00,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x76, 0xb4, 0x88, 0x7c, 0x2c, 0x42, 0x50, 0xdc, 0x5d, 0x24, 0x25, 0xe2, 0xd8, 0xe2, 0x37, 0x01,
+    0x86, 0x85, 0xb2, 0xfe, 0x19, 0x78, 0x47, 0xc9, 0x04, 0x3f, 0x62, 0xf1, 0x37, 0xb6, 0xf6, 0x67,
+    0xe2, 0x85, 0x4a, 0xce, 0xf0, 0x7f, 0xe3, 0xc3, 0xbc, 0x59, 0xb7, 0x1b, 0xbd, 0x4e, 0x38, 0x21,
+    0xed, 0xdd, 0x73, 0x43, 0xe4, 0x87, 0xa1, 0xf2, 0xf6, 0xdf, 0x7b, 0xfa, 0x4b, 0xa1, 0xe0, 0xb9,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
+    0xd8, 0x48, 0x4a, 0xc1, 0x0a, 0x94, 0x64, 0x76, 0xdd, 0x0a, 0x0a, 0x46, 0x92, 0x07, 0x58, 0x1c,
+    0x0e, 0x89, 0x6c, 0xb0, 0xda, 0x2d, 0xf6, 0x12, 0x17, 0xa9, 0x84, 0x73, 0x4f, 0xa8, 0x2b, 0x03,
+    0x3d, 0xa5, 0x33, 0x37, 0x7f, 0xc7, 0xee, 0xa3, 0x84, 0x8c, 0xf3, 0xad, 0x3e, 0xb1, 0x20, 0x09,
+    0xd5, 0xf4, 0x7f, 0x75, 0xc7, 0x74, 0xb8, 0x4c, 0xd9, 0x2c, 0x26, 0x58, 0xe2, 0x70, 0x61, 0x86,
+    0x9a, 0x9f, 0x25, 0xdc, 0xa8, 0x98, 0x6a, 0x19, 0x89, 0xc3, 0x28, 0xc4, 0x43, 0xca, 0x22, 0x99,
+    0x4f, 0x3d, 0x0a, 0x26, 0x91, 0x1b, 0xf5, 0x89, 0x88, 0xee, 0x39, 0x2f, 0xad, 0xa8, 0xc0, 0xe3,
+    0xa4, 0x86, 0xdd, 0x95, 0xb3, 0xb8, 0xe2, 0xea, 0x8e, 0xf7, 0x68, 0x62, 0xa4, 0xd1, 0x28, 0x86,
+    0x13, 0x53, 0x49, 0x90, 0xc6, 0x98, 0x01, 0x76, 0x4c, 0x41, 0x41, 0xd7, 0x7a, 0xa2, 0xa3, 0xe3,
+    0xf6, 0xd7, 0xf8, 0x5f, 0xf7, 0xeb, 0x23, 0x95, 0x64, 0x6d, 0x86, 0x1f, 0x7e, 0x9e, 0xa7, 0x9d,
+    0x6b, 0xf7, 0x75, 0x98, 0x30, 0x22, 0x09, 0x1e, 0xa1, 0x89, 0x1e, 0x4e, 0x66, 0x49, 0xf6, 0x6a,
+    0x89, 0x2b, 0x03, 0x31, 0x5e, 0xaa, 0x47, 0x87, 0xf6, 0x91, 0xbf, 0x76, 0xe8, 0x25, 0x74, 0x72,
+    0x97, 0xda, 0x7e, 0x41, 0xec, 0x91, 0x26, 0xab, 0x68, 0xc7, 0xf2, 0x0d, 0xfe, 0x0f, 0x4e, 0x00,
+    0xd7, 0xed, 0x4b, 0x13, 0xf7, 0x77, 0xc1, 0xf5, 0x75, 0x56, 0x13, 0x8f, 0x0f, 0xe3, 0x77, 0x0f,
+    0x13, 0x1f, 0xe9, 0xc0, 0x03, 0xe6, 0x54, 0x72, 0xf7, 0x26, 0xb2, 0x16, 0xa8, 0x91, 0xb5, 0x8e,
+    0x5d, 0xb6, 0x6a, 0xa4, 0x2c, 0x7b, 0x9d, 0x81, 0xc9, 0xde, 0xfd, 0x8f, 0x92, 0x24, 0x97, 0x8c,
+    0xe2, 0x92, 0xa6, 0x95, 0xfc, 0xc6, 0x54, 0x13, 0xd5, 0x4e, 0xb3, 0xc5, 0xa4, 0xc9, 0xe9, 0x53,
+    0xdd, 0x3f, 0x58, 0xa1, 0x3a, 0x4e, 0xda, 0x54, 0x4e, 0xae, 0xaa, 0x20, 0xeb, 0xb3, 0x79, 0xbf,
+    0xac, 0xfe, 0xde, 0x06, 0xd3, 0xfb, 0xf7, 0x0a, 0x68, 0xb7, 0xeb, 0x47, 0x68, 0xc7, 0x73, 0x69,
+    0xc7, 0x04, 0x36, 0xce, 0xb9, 0xad, 0xf7, 0xfc, 0x39, 0xe0, 0xfe, 0x1f, 0x3e, 0x00, 0xaf, 0x8a,
+    0x00, 0x55, 0x13, 0x8e, 0x9b, 0x54, 0xd0, 0x50, 0xab, 0x6c, 0xad, 0x2a, 0xf3, 0xa9, 0xd6, 0xf1,
+    0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x13, 0xfe, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x57, 0xfd, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00,
+    0x30, 0x03, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x3c, 0x01, 0x00, 0x00,
+    0x0b, 0x03, 0x00, 0x00, 0xeb, 0xfd, 0xff, 0xff};
+
+const int8_t tflite_input[192] = {
+    -89, -38, 117, 11, -112, -19, 121, -97, -69, 119, -115, 48, 8, 85, 106, -37,
+    -52, 113, 26, 79, -121, 122, -18, -78, 38, -6, 60, -30, -53, 29, 106, -64,
+    34, -103, -87, -6, -113, 35, 20, -30, 64, 124, 108, -25, 26, -52, -106, 80,
+    -25, -9, -23, -59, 51, -55, -123, 114, 53, 118, 85, 37, 125, -57, -88, 54,
+    47, -73, 124, -46, 122, 10, -82, -26, -95, -39, 13, 121, 119, -85, 44, 29,
+    -32, -119, 13, -105, 80, -75, 70, 125, -3, 57, -24, 94, 50, -116, -31, 46,
+    -2, -16, -14, -22, 7, 53, -55, -50, -1, 3, -3, -62, 55, -28, 26, 8,
+    76, -88, -88, -58, 120, -21, -121, -7, -57, 76, -123, 36, -119, 15, 76, 94,
+    -98, -78, -88, -102, -122, -28, -11, -93, 86, 14, 74, 18, 10, -95, -28, 55,
+    -66, 14, 36, -20, 127, 106, 30, 91, 75, -72, -66, -86, -100, 106, -26, -88,
+    -54, 65, -37, -48, 20, -36, -21, 13, -39, 109, 50, -128, 80, -87, 9, 56,
+    -66, -28, 103, -55, -98, 118, -28, -61, 109, 54, 55, 118, -109, 67, 26, 53};
+
+const int8_t tflite_ref_logits[10] = {
+    16, 18, 11, 11, 25, 16, 12, 11, 25, 11};
+
+const int8_t tflite_ref_conv1_weights[216] = {
+    -7, 3, 65, 115, -119, -91, 82, 114, -64, -48, 94, -20, -58, 84, -62, -23,
+    37, 13, -106, -120, 93, 65, 86, 10, 81, -43, -12, 74, -96, -50, -96, -12,
+    122, -93, -30, -25, 103, -76, 1, -61, -122, 64, -112, -56, 0, -4, -98, 123,
+    64, 118, -104, 57, -53, 11, 108, -57, 58, -87, -45, 120, -20, 4, -53, -98,
+    -19, 31, -11, 71, -35, 29, 70, 106, -19, -117, 56, 7, 95, -10, -34, -112,
+    -11, 36, 69, 90, -73, 24, 78, -61, -40, 87, 21, 2, 44, 3, 123, 65,
+    -114, -90, 11, 82, -110, 47, 66, 73, 95, -79, 14, 77, -36, -79, -5, -107,
+    -71, 91, 43, 92, 87, 96, -48, -7, 30, -58, 107, -126, 86, 37, -63, 56,
+    -22, 86, 127, -56, -8, -73, 49, 36, 88, 78, 122, 118, 101, -89, -117, -5,
+    -40, 101, 76, -20, 19, 23, 100, -121, -3, 44, -12, 107, 115, 83, -9, 98,
+    -109, 41, -59, -65, 46, 68, 99, -74, 95, 84, -47, -112, 69, 83, -10, -86,
+    -90, -32, 66, -47, -119, 49, 62, -82, 15, -26, 0, -126, 34, -61, 14, -20,
+    28, -100, -35, 34, 68, -30, -121, 57, 1, 39, -87, -18, 98, 94, -47, 34,
+    -106, 79, -59, -40, 119, 11, 96, -77};
+
+const int32_t tflite_ref_conv1_bias[8] = {
+    258, 496, -423, -257, -354, -244, -189, -427};
+
+const int8_t tflite_ref_dw_weights[72] = {
+    -71, 22, -11, 87, 51, 58, 18, -34, -56, -13, 18, -34, -90, -100, -116, -76,
+    -24, -55, -82, -47, 55, -48, 107, 20, -92, 120, 97, 70, -87, 74, 51, 66,
+    54, 25, -40, 107, 123, 48, -36, 0, 16, -108, -105, -3, 16, -73, -60, -94,
+    106, 2, -57, 73, 117, -52, 102, 69, 75, 7, 105, -89, -105, 119, -3, -25,
+    59, -52, 35, 88, 77, -96, 120, 60};
+
+const int32_t tflite_ref_dw_bias[8] = {
+    198, -313, 422, -108, 441, -269, -407, 341};
+
+const int8_t tflite_ref_conv2_weights[64] = {
+    118, -76, -120, 124, 44, 66, 80, -36, 93, 36, 37, -30, -40, -30, 55, 1,
+    -122, -123, -78, -2, 25, 120, 71, -55, 4, 63, 98, -15, 55, -74, -10, 103,
+    -30, -123, 74, -50, -16, 127, -29, -61, -68, 89, -73, 27, -67, 78, 56, 33,
+    -19, -35, 115, 67, -28, -121, -95, -14, -10, -33, 123, -6, 75, -95, -32, -71};
+
+const int8_t tflite_ref_fc_weights[320] = {
+    -40, 72, 74, -63, 10, -108, 100, 118, -35, 10, 10, 70, -110, 7, 88, 28,
+    14, -119, 108, -80, -38, 45, -10, 18, 23, -87, -124, 115, 79, -88, 43, 3,
+    61, -91, 51, 55, 127, -57, -18, -93, -124, -116, -13, -83, 62, -79, 32, 9,
+    -43, -12, 127, 117, -57, 116, -72, 76, -39, 44, 38, 88, -30, 112, 97, -122,
+    -102, -97, 37, -36, -88, -104, 106, 25, -119, -61, 40, -60, 67, -54, 34, -103,
+    79, 61, 10, 38, -111, 27, -11, -119, -120, -18, 57, 47, -83, -88, -64, -29,
+    -92, -122, -35, -107, -77, -72, -30, -22, -114, -9, 104, 98, -92, -47, 40, -122,
+    19, 83, 73, -112, -58, -104, 1, 118, 76, 65, 65, -41, 122, -94, -93, -29,
+    -10, -41, -8, 95, -9, -21, 35, -107, 100, 109, -122, 31, 126, -98, -89, -99,
+    107, -9, 117, -104, 48, 34, 9, 30, -95, -119, 30, 78, 102, 73, -10, 106,
+    -119, 43, 3, 49, 94, -86, 71, -121, -10, -111, -65, 118, -24, 37, 116, 114,
+    -105, -38, 126, 65, -20, -111, 38, -85, 104, -57, -14, 13, -2, 15, 78, 0,
+    -41, -19, 75, 19, -9, 119, -63, -11, 117, 86, 19, -113, 15, -29, 119, 15,
+    19, 31, -23, -64, 3, -26, 84, 114, -9, 38, -78, 22, -88, -111, -75, -114,
+    93, -74, 106, -92, 44, 123, -99, -127, -55, -34, -3, -113, -110, 36, -105, -116,
+    -30, -110, -90, -107, -4, -58, 84, 19, -43, 78, -77, -59, -92, -55, -23, 83,
+    -35, 63, 88, -95, 58, 78, -38, 84, 78, -82, -86, 32, -21, -77, 121, -65,
+    -84, -2, -34, 6, -45, -5, -9, 10, 104, -73, -21, 71, 104, -57, 115, 105,
+    -57, 4, 54, -50, -71, -83, -9, -4, 57, -32, -2, 31, 62, 0, -81, -118,
+    0, 85, 19, -114, -101, 84, -48, 80, -85, 108, -83, 42, -13, -87, -42, -15};
+
+const int32_t tflite_ref_fc_bias[10] = {
+    -493, -110, -681, 238, 816, -214, -88, 316,
+    779, -533};
+
+const int32_t tflite_ref_conv1_mult[8] = {
+    1395838612, 1392433332, 1302775089, 2081778158, 1721391424, 1844214789, 1257544847, 1940442792};
+
+const int32_t tflite_ref_conv1_shift[8] = {
+    -7, -6, -6, -8, -7, -7, -6, -7};
+
+const int32_t tflite_ref_conv1_act[2] = {
+    -128, 22};
+
+const int32_t tflite_ref_dw_mult[8] = {
+    1876718421, 1795418624, 1283146923, 1383365717, 1131067819, 1638912171, 1892791467, 1745928021};
+
+const int32_t tflite_ref_dw_shift[8] = {
+    -7, -6, -6, -6, -6, -7, -7, -6};
+
+const int32_t tflite_ref_dw_act[2] = {
+    5, 127};
+
+const int32_t tflite_ref_conv2_mult[8] = {
+    1339290240, 2103703680, 1717969728, 1410348960, 1832775936, 1620175680, 1404884640, 1773343872};
+
+const int32_t tflite_ref_conv2_shift[8] = {
+    -6, -7, -6, -6, -6, -6, -6, -7};
+
+const int32_t tflite_ref_conv2_act[2] = {
+    -128, 127};
+
+const int32_t tflite_ref_add[6] = {
+    1073741824, 0, 1431655765, -1, 1431655676, -19};
+
+const int32_t tflite_ref_max_pool_act[2] = {
+    -20, 24};
+
+const int32_t tflite_ref_fc[4] = {
+    1099511690, -8, 11, 127};
+
+const int32_t tflite_ref_softmax[3] = {
+    1546188288, 23, -248};
+
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generated by gen_model.py, do not edit */
+
+#ifndef ARM_NN_GRAPH_TFLITE_DATA_H
+#define ARM_NN_GRAPH_TFLITE_DATA_H
+
+#include "arm_nn_math_types.h"
+
+#define TFLITE_MODEL_SIZE (4136)
+
+/* Zero points of the activation tensors */
+#define TFLITE_INPUT_ZP (-3)
+#define TFLITE_CONV1_ZP (-128)
+#define TFLITE_DW_ZP (5)
+#define TFLITE_CONV2_ZP (-7)
+#define TFLITE_ADD_ZP (2)
+#define TFLITE_POOL_ZP (2)
+#define TFLITE_FC_ZP (11)
+#define TFLITE_SOFTMAX_ZP (-128)
+
+extern const uint8_t tflite_model[TFLITE_MODEL_SIZE];
+extern const int8_t tflite_input[192];
+extern const int8_t tflite_ref_logits[10];
+extern const int8_t tflite_ref_conv1_weights[216];
+extern const int32_t tflite_ref_conv1_bias[8];
+extern const int8_t tflite_ref_dw_weights[72];
+extern const int32_t tflite_ref_dw_bias[8];
+extern const int8_t tflite_ref_conv2_weights[64];
+extern const int8_t tflite_ref_fc_weights[320];
+extern const int32_t tflite_ref_fc_bias[10];
+extern const int32_t tflite_ref_conv1_mult[8];
+extern const int32_t tflite_ref_conv1_shift[8];
+extern const int32_t tflite_ref_conv1_act[2];
+extern const int32_t tflite_ref_dw_mult[8];
+extern const int32_t tflite_ref_dw_shift[8];
+extern const int32_t tflite_ref_dw_act[2];
+extern const int32_t tflite_ref_conv2_mult[8];
+extern const int32_t tflite_ref_conv2_shift[8];
+extern const int32_t tflite_ref_conv2_act[2];
+extern const int32_t tflite_ref_add[6];
+extern const int32_t tflite_ref_max_pool_act[2];
+extern const int32_t tflite_ref_fc[4];
+extern const int32_t tflite_ref_softmax[3];
+
+#endif
@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_tflite_example_s8.c
+ * Description:  Host test of arm_nn_graph_load_tflite()
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * Loads the model of arm_nn_graph_tflite_data.c, written by gen_model.py, and checks:
+ * - the layers and their quantization parameters against the TFLM formulas,
+ * - the weights and biases found in place in the model,
+ * - the output of the graph against a direct chain of kernel calls, whose
+ *   logits are checked against the TFLM integer reference kernels,
+ * - that every truncation of the model is rejected, and that models with
+ *   one corrupted byte are either rejected or run within their arena.
+ *
+ * Build it with AddressSanitizer and UndefinedBehaviorSanitizer to check the
+ * last point. The program returns 0 when all the checks pass.
+ */
+
+#include "arm_nn_graph_tflite_data.h"
+#include "arm_nnfunctions.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_LAYERS (9)
+#define INPUT_SIZE (8 * 8 * 3)
+#define OUTPUT_SIZE (10)
+
+/* Values xored into each byte of the model by the corruption test */
+#define CORRUPTION_STEP (37)
+
+static int32_t failures;
+
+#define CHECK(cond)                                                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(cond))                                                                                                   \
+        {                                                                                                              \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);                                            \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+static void check_per_channel(const cmsis_nn_graph *graph,
+                              const cmsis_nn_graph_layer *layer,
+                              const int32_t *multipliers,
+                              const int32_t *shifts,
+                              const int32_t num_ch)
+{
+    int32_t mult;
+    int32_t shift;
+
+    for (int32_t i = 0; i < num_ch; i++)
+    {
+        memcpy(&mult, graph->quant_params + layer->multipliers + i * 4, 4);
+        memcpy(&shift, graph->quant_params + layer->shifts + i * 4, 4);
+        CHECK(mult == multipliers[i]);
+        CHECK(shift == shifts[i]);
+    }
+}
+
+/* Parameters of the layers read from the model */
+static void check_layers(const cmsis_nn_graph *graph)
+{
+    const cmsis_nn_graph_layer *l = graph->layers;
+
+    CHECK(graph->num_layers == NUM_LAYERS);
+
+    CHECK(l[0].op == ARM_NN_GRAPH_OP_CONV_S8);
+    CHECK(l[0].padding.h == 1 && l[0].padding.w == 1);
+    CHECK(l[0].input_offset == -TFLITE_INPUT_ZP && l[0].output_offset == TFLITE_CONV1_ZP);
+    CHECK(l[0].activation.min == tflite_ref_conv1_act[0] && l[0].activation.max == tflite_ref_conv1_act[1]);
+    check_per_channel(graph, &l[0], tflite_ref_conv1_mult, tflite_ref_conv1_shift, 8);
+    CHECK(memcmp(graph->params + l[0].weights, tflite_ref_conv1_weights, sizeof(tflite_ref_conv1_weights)) == 0);
+    CHECK(memcmp(graph->params + l[0].bias, tflite_ref_conv1_bias, sizeof(tflite_ref_conv1_bias)) == 0);
+
+    /* SAME padding of a stride 2 window: the extra row and column are at the end */
+    CHECK(l[1].op == ARM_NN_GRAPH_OP_DEPTHWISE_CONV_S8);
+    CHECK(l[1].stride.h == 2 && l[1].stride.w == 2 && l[1].padding.h == 0 && l[1].padding.w == 0);
+    CHECK(l[1].ch_mult == 1);
+    CHECK(l[1].activation.min == tflite_ref_dw_act[0] && l[1].activation.max == tflite_ref_dw_act[1]);
+    check_per_channel(graph, &l[1], tflite_ref_dw_mult, tflite_ref_dw_shift, 8);
+    CHECK(memcmp(graph->params + l[1].weights, tflite_ref_dw_weights, sizeof(tflite_ref_dw_weights)) == 0);
+    CHECK(memcmp(graph->params + l[1].bias, tflite_ref_dw_bias, sizeof(tflite_ref_dw_bias)) == 0);
+
+    CHECK(l[2].op == ARM_NN_GRAPH_OP_CONV_S8);
+    CHECK(l[2].bias == -1 && l[2].padding.w == 0);
+    CHECK(l[2].activation.min == tflite_ref_conv2_act[0] && l[2].activation.max == tflite_ref_conv2_act[1]);
+    check_per_channel(graph, &l[2], tflite_ref_conv2_mult, tflite_ref_conv2_shift, 8);
+    CHECK(memcmp(graph->params + l[2].weights, tflite_ref_conv2_weights, sizeof(tflite_ref_conv2_weights)) == 0);
+
+    CHECK(l[3].op == ARM_NN_GRAPH_OP_ADD_S8 && l[3].left_shift == 20);
+    CHECK(l[3].input_multiplier == tflite_ref_add[0] && l[3].input_shift == tflite_ref_add[1]);
+    CHECK(l[3].input_2_multiplier == tflite_ref_add[2] && l[3].input_2_shift == tflite_ref_add[3]);
+    CHECK(l[3].multiplier == tflite_ref_add[4] && l[3].shift == tflite_ref_add[5]);
+
+    CHECK(l[4].op == ARM_NN_GRAPH_OP_AVGPOOL_S8);
+    CHECK(l[4].filter_dims.h == 2 && l[4].filter_dims.w == 2 && l[4].padding.w == 0);
+
+    CHECK(l[5].op == ARM_NN_GRAPH_OP_MAX_POOL_S8 && l[5].padding.w == 0);
+    CHECK(l[5].activation.min == tflite_ref_max_pool_act[0] && l[5].activation.max == tflite_ref_max_pool_act[1]);
+
+    CHECK(l[6].op == ARM_NN_GRAPH_OP_RESHAPE_S8);
+
+    CHECK(l[7].op == ARM_NN_GRAPH_OP_FULLY_CONNECTED_S8);
+    CHECK(l[7].filter_dims.n == 32 && l[7].output_dims.c == OUTPUT_SIZE);
+    CHECK(l[7].multiplier == tflite_ref_fc[0] && l[7].shift == tflite_ref_fc[1]);
+    CHECK(l[7].activation.min == tflite_ref_fc[2] && l[7].activation.max == tflite_ref_fc[3]);
+    CHECK(memcmp(graph->params + l[7].weights, tflite_ref_fc_weights, sizeof(tflite_ref_fc_weights)) == 0);
+    CHECK(memcmp(graph->params + l[7].bias, tflite_ref_fc_bias, sizeof(tflite_ref_fc_bias)) == 0);
+
+    CHECK(l[8].op == ARM_NN_GRAPH_OP_SOFTMAX_S8);
+    CHECK(l[8].multiplier == tflite_ref_softmax[0] && l[8].shift == tflite_ref_softmax[1]);
+    CHECK(l[8].diff_min == tflite_ref_softmax[2]);
+}
+
+/* The model computed by direct kernel calls, with the reference parameters */
+static void run_reference(const int8_t *input, int8_t *output)
+{
+    static int8_t conv1_out[8 * 8 * 8], dw_out[4 * 4 * 8], conv2_out[4 * 4 * 8], add_out[4 * 4 * 8];
+    static int8_t avg_out[2 * 2 * 8], max_out[2 * 2 * 8], logits[OUTPUT_SIZE];
+    static int8_t scratch[4096];
+    cmsis_nn_context ctx = {scratch, sizeof(scratch)};
+    const cmsis_nn_dims bias_dims = {1, 1, 1, 8};
+
+    const cmsis_nn_dims conv1_in = {1, 8, 8, 3}, conv1_filter = {8, 3, 3, 3}, conv1_dims = {1, 8, 8, 8};
+    const cmsis_nn_conv_params conv1_params = {-TFLITE_INPUT_ZP,
+                                               TFLITE_CONV1_ZP,
+                                               {1, 1},
+                                               {1, 1},
+                                               {1, 1},
+                                               {tflite_ref_conv1_act[0], tflite_ref_conv1_act[1]}};
+    const cmsis_nn_per_channel_quant_params conv1_quant = {(int32_t *)tflite_ref_conv1_mult,
+                                                           (int32_t *)tflite_ref_conv1_shift};
+
+    const cmsis_nn_dims dw_filter = {1, 3, 3, 8}, dw_dims = {1, 4, 4, 8};
+    const cmsis_nn_dw_conv_params dw_params = {
+        -TFLITE_CONV1_ZP, TFLITE_DW_ZP, 1, {2, 2}, {0, 0}, {1, 1}, {tflite_ref_dw_act[0], tflite_ref_dw_act[1]}};
+    const cmsis_nn_per_channel_quant_params dw_quant = {(int32_t *)tflite_ref_dw_mult, (int32_t *)tflite_ref_dw_shift};
+
+    const cmsis_nn_dims conv2_filter = {8, 1, 1, 8};
+    const cmsis_nn_conv_params conv2_params = {-TFLITE_DW_ZP,
+                                               TFLITE_CONV2_ZP,
+                                               {1, 1},
+                                               {0, 0},
+                                               {1, 1},
+                                               {tflite_ref_conv2_act[0], tflite_ref_conv2_act[1]}};
+    const cmsis_nn_per_channel_quant_params conv2_quant = {(int32_t *)tflite_ref_conv2_mult,
+                                                           (int32_t *)tflite_ref_conv2_shift};
+
+    const cmsis_nn_pool_params avg_params = {{2, 2}, {0, 0}, {-128, 127}};
+    const cmsis_nn_pool_params max_params = {{1, 1}, {0, 0}, {tflite_ref_max_pool_act[0], tflite_ref_max_pool_act[1]}};
+    const cmsis_nn_dims pool_filter = {1, 2, 2, 1}, pool_dims = {1, 2, 2, 8};
+
+    const cmsis_nn_fc_params fc_params = {
+        -TFLITE_POOL_ZP, 0, TFLITE_FC_ZP, {tflite_ref_fc[2], tflite_ref_fc[3]}};
+    const cmsis_nn_per_tensor_quant_params fc_quant = {tflite_ref_fc[0], tflite_ref_fc[1]};
+    const cmsis_nn_dims fc_in = {1, 1, 1, 32}, fc_filter = {32, 1, 1, OUTPUT_SIZE};
+    const cmsis_nn_dims fc_bias = {1, 1, 1, OUTPUT_SIZE}, fc_dims = {1, 1, 1, OUTPUT_SIZE};
+
+    CHECK(arm_convolve_wrapper_s8(&ctx, &conv1_params, &conv1_quant, &conv1_in, input, &conv1_filter,
+                                  tflite_ref_conv1_weights, &bias_dims, tflite_ref_conv1_bias, &conv1_dims,
+                                  conv1_out) == ARM_MATH_SUCCESS);
+    CHECK(arm_depthwise_conv_wrapper_s8(&ctx, &dw_params, &dw_quant, &conv1_dims, conv1_out, &dw_filter,
+                                        tflite_ref_dw_weights, &bias_dims, tflite_ref_dw_bias, &dw_dims,
+                                        dw_out) == ARM_MATH_SUCCESS);
+    CHECK(arm_convolve_wrapper_s8(&ctx, &conv2_params, &conv2_quant, &dw_dims, dw_out, &conv2_filter,
+                                  tflite_ref_conv2_weights, &bias_dims, NULL, &dw_dims, conv2_out) == ARM_MATH_SUCCESS);
+    CHECK(arm_elementwise_add_s8(dw_out, conv2_out, -TFLITE_DW_ZP, tflite_ref_add[0], tflite_ref_add[1],
+                                 -TFLITE_CONV2_ZP, tflite_ref_add[2], tflite_ref_add[3], 20, add_out, TFLITE_ADD_ZP,
+                                 tflite_ref_add[4], tflite_ref_add[5], -128, 127, 4 * 4 * 8) == ARM_MATH_SUCCESS);
+    CHECK(arm_avgpool_s8(&ctx, &avg_params, &dw_dims, add_out, &pool_filter, &pool_dims, avg_out) ==
+          ARM_MATH_SUCCESS);
+    CHECK(arm_max_pool_s8(&ctx, &max_params, &pool_dims, avg_out, &pool_filter, &pool_dims, max_out) ==
+          ARM_MATH_SUCCESS);
+    CHECK(arm_fully_connected_s8(&ctx, &fc_params, &fc_quant, &fc_in, max_out, &fc_filter, tflite_ref_fc_weights,
+                                 &fc_bias, tflite_ref_fc_bias, &fc_dims, logits) == ARM_MATH_SUCCESS);
+
+    /* The kernels give the logits of the TFLM reference kernels */
+    CHECK(memcmp(logits, tflite_ref_logits, OUTPUT_SIZE) == 0);
+
+    arm_softmax_s8(logits, 1, OUTPUT_SIZE, tflite_ref_softmax[0], tflite_ref_softmax[1], tflite_ref_softmax[2],
+                   output);
+}
+
+/* Plans the graph and runs it on the input, or on a zero input if input is NULL */
+static arm_status plan_and_run(const cmsis_nn_graph *graph, const int8_t *input, int8_t *output)
+{
+    const int32_t plan_buf_size = arm_nn_graph_plan_get_buffer_size(graph);
+    cmsis_nn_context plan_ctx = {malloc(plan_buf_size > 0 ? plan_buf_size : 4), plan_buf_size};
+    cmsis_nn_graph_plan plan = {malloc(sizeof(int32_t) * (graph->num_tensors + graph->num_layers)), 0, 0};
+    int8_t *arena = NULL;
+    arm_status status = arm_nn_graph_plan(&plan_ctx, graph, &plan);
+
+    if (status == ARM_MATH_SUCCESS)
+    {
+        arena = calloc((plan.arena_size + 3) / 4 + 1, 4);
+        if (input != NULL)
+        {
+            memcpy(arena + plan.offsets[graph->input], input, INPUT_SIZE);
+        }
+        status = arm_nn_graph_run_s8(graph, &plan, arena);
+        if (output != NULL && status == ARM_MATH_SUCCESS)
+        {
+            memcpy(output, arena + plan.offsets[graph->output], OUTPUT_SIZE);
+            printf("arena %d bytes, %d without reuse\n", (int)plan.arena_size, (int)plan.naive_size);
+        }
+    }
+
+    free(arena);
+    free(plan.offsets);
+    free(plan_ctx.buf);
+
+    return status;
+}
+
+static void test_model(void)
+{
+    const int32_t buf_size = arm_nn_graph_load_tflite_get_buffer_size(tflite_model, TFLITE_MODEL_SIZE);
+    cmsis_nn_context ctx = {NULL, buf_size};
+    cmsis_nn_graph graph;
+    int8_t output[OUTPUT_SIZE];
+    int8_t ref_output[OUTPUT_SIZE];
+
+    CHECK(buf_size > 0);
+    if (buf_size <= 0)
+    {
+        return;
+    }
+    printf("model %d bytes, load buffer %d bytes\n", TFLITE_MODEL_SIZE, (int)buf_size);
+
+    ctx.buf = malloc(buf_size);
+    CHECK(arm_nn_graph_load_tflite(&ctx, tflite_model, TFLITE_MODEL_SIZE, &graph) == ARM_MATH_SUCCESS);
+    check_layers(&graph);
+
+    CHECK(plan_and_run(&graph, tflite_input, output) == ARM_MATH_SUCCESS);
+    run_reference(tflite_input, ref_output);
+    CHECK(memcmp(output, ref_output, OUTPUT_SIZE) == 0);
+
+    free(ctx.buf);
+}
+
+static void test_malformed_models(void)
+{
+    uint8_t *model = malloc(TFLITE_MODEL_SIZE);
+    int32_t num_loaded = 0;
+    int32_t num_tried = 0;
+
+    /* Every truncation is rejected before anything is read past the end */
+    for (int32_t size = 0; size < TFLITE_MODEL_SIZE; size++)
+    {
+        uint8_t *truncated = malloc(size > 0 ? size : 1);
+
+        memcpy(truncated, tflite_model, size);
+        CHECK(arm_nn_graph_load_tflite_get_buffer_size(truncated, size) < 0);
+        free(truncated);
+    }
+
+    /* A model with one corrupted byte is rejected, or runs within its arena */
+    memcpy(model, tflite_model, TFLITE_MODEL_SIZE);
+    for (int32_t pos = 0; pos < TFLITE_MODEL_SIZE; pos++)
+    {
+        for (int32_t v = 0; v < 256; v += CORRUPTION_STEP)
+        {
+            int32_t buf_size;
+
+            model[pos] ^= (uint8_t)(v | 1);
+            buf_size = arm_nn_graph_load_tflite_get_buffer_size(model, TFLITE_MODEL_SIZE);
+            num_tried++;
+            if (buf_size >= 0 && buf_size < (1 << 20))
+            {
+                cmsis_nn_context ctx = {malloc(buf_size > 0 ? buf_size : 4), buf_size};
+                cmsis_nn_graph graph;
+
+                if (arm_nn_graph_load_tflite(&ctx, model, TFLITE_MODEL_SIZE, &graph) == ARM_MATH_SUCCESS)
+                {
+                    num_loaded++;
+                    (void)plan_and_run(&graph, NULL, NULL);
+                }
+                free(ctx.buf);
+            }
+            model[pos] = tflite_model[pos];
+        }
+    }
+    printf("%d corrupted models, %d loaded\n", (int)num_tried, (int)num_loaded);
+
+    free(model);
+}
+
+int main(void)
+{
+    test_model();
+    test_malformed_models();
+
+    printf("%s\n", failures == 0 ? "SUCCESS" : "FAILURE");
+
+    return (failures == 0) ? 0 : 1;
+}
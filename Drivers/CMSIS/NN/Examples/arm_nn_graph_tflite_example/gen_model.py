@@ -0,0 +1,512 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010-2022 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Data of the arm_nn_graph_tflite_example.
+
+Writes a TensorFlow Lite flatbuffer built by hand, without the TensorFlow
+package, with one operator of each kind read by arm_nn_graph_load_tflite():
+
+  CONV_2D 3x3 SAME relu6 -> DEPTHWISE_CONV_2D 3x3 stride 2 SAME relu
+  -> CONV_2D 1x1 VALID without bias -> ADD -> AVERAGE_POOL_2D 2x2 VALID
+  -> MAX_POOL_2D 2x2 SAME relu_n1_to_1 -> RESHAPE -> FULLY_CONNECTED relu
+  -> SOFTMAX
+
+together with:
+- the quantization parameters computed with the TFLM formulas,
+- the constant tensors, to check the offsets found by the loader,
+- an input and the logits (FULLY_CONNECTED output) of the TFLM integer
+  reference kernels, computed here independently of CMSIS-NN.
+
+Usage: gen_model.py [output directory]
+"""
+
+import math
+import os
+import struct
+import sys
+
+import numpy as np
+
+# ---------------------------------------------------------------------------
+# Flatbuffer writer: tables and vectors, children written after their parent
+# ---------------------------------------------------------------------------
+
+
+class Table:
+    def __init__(self, fields):
+        self.fields = fields  # field number -> (kind, value)
+
+
+class Vector:
+    def __init__(self, kind, items):
+        self.kind = kind
+        self.items = items
+
+
+class Builder:
+    SCALARS = {'u8': 'B', 'i8': 'b', 'i32': 'i', 'f32': 'f'}
+    ELEMENTS = {'i32': 'i', 'f32': 'f', 'i64': 'q'}
+
+    def __init__(self):
+        self.buf = bytearray()
+
+    def align(self, n, extra=0):
+        while (len(self.buf) + extra) % n:
+            self.buf.append(0)
+
+    def put(self, fmt, value):
+        pos = len(self.buf)
+        self.buf.extend(struct.pack('<' + fmt, value))
+        return pos
+
+    def patch(self, pos, target):
+        struct.pack_into('<I', self.buf, pos, target - pos)
+
+    def write(self, obj):
+        if isinstance(obj, Table):
+            return self.write_table(obj)
+        return self.write_vector(obj)
+
+    def write_table(self, table):
+        present = sorted(table.fields)
+        num_slots = present[-1] + 1 if present else 0
+        self.align(2)
+        vtable = len(self.buf)
+        self.put('H', 4 + 2 * num_slots)
+        self.put('H', 4 + 4 * len(present))
+        for i in range(num_slots):
+            self.put('H', 4 + 4 * present.index(i) if i in table.fields else 0)
+        self.align(4)
+        pos = len(self.buf)
+        self.put('i', pos - vtable)
+        children = []
+        for i in present:
+            kind, value = table.fields[i]
+            if kind == 'off':
+                children.append((self.put('I', 0), value))
+            else:
+                self.buf.extend(struct.pack('<' + self.SCALARS[kind], value).ljust(4, b'\0'))
+        for slot, child in children:
+            self.patch(slot, self.write(child))
+        return pos
+
+    def write_vector(self, vector):
+        # Constant data is 16-byte aligned like in the files of the TFLite converter
+        if vector.kind == 'u8':
+            self.align(16, 4)
+        elif vector.kind == 'i64':
+            self.align(8, 4)
+        else:
+            self.align(4)
+        pos = self.put('I', len(vector.items))
+        if vector.kind == 'off':
+            slots = [self.put('I', 0) for _ in vector.items]
+            for slot, child in zip(slots, vector.items):
+                self.patch(slot, self.write(child))
+        elif vector.kind == 'u8':
+            self.buf.extend(bytes(vector.items))
+        else:
+            for v in vector.items:
+                self.put(self.ELEMENTS[vector.kind], v)
+        return pos
+
+    def finish(self, root):
+        self.put('I', 0)
+        self.buf.extend(b'TFL3')
+        self.patch(0, self.write(root))
+        return bytes(self.buf)
+
+
+# ---------------------------------------------------------------------------
+# Model
+# ---------------------------------------------------------------------------
+
+INT32 = 2
+INT8 = 9
+
+ACT_NONE, ACT_RELU, ACT_RELU_N1_TO_1, ACT_RELU6 = 0, 1, 2, 3
+SAME, VALID = 0, 1
+
+rng = np.random.default_rng(1)
+f32 = np.float32
+
+tensors = []
+buffers = [b'']
+
+
+def tensor(shape, scale, zero_point, ttype=INT8, data=None, scales=None):
+    buffer = 0
+    if data is not None:
+        buffers.append(data)
+        buffer = len(buffers) - 1
+    tensors.append(dict(shape=shape, scale=f32(scale), zp=zero_point, type=ttype, buffer=buffer,
+                        scales=[f32(s) for s in scales] if scales is not None else [f32(scale)],
+                        data=data))
+    return len(tensors) - 1
+
+
+def weights(shape):
+    return rng.integers(-127, 128, shape).astype(np.int8)
+
+
+def biases(n, bound):
+    return rng.integers(-bound, bound, n).astype(np.int32)
+
+
+w1, b1, s1 = weights((8, 3, 3, 3)), biases(8, 500), rng.uniform(0.002, 0.01, 8)
+w2, b2, s2 = weights((1, 3, 3, 8)), biases(8, 500), rng.uniform(0.002, 0.01, 8)
+w3, s3 = weights((8, 1, 1, 8)), rng.uniform(0.002, 0.01, 8)
+w8, b8 = weights((10, 32)), biases(10, 900)
+
+x = tensor([1, 8, 8, 3], 0.05, -3)
+tw1 = tensor([8, 3, 3, 3], 0, 0, data=w1.tobytes(), scales=s1)
+tb1 = tensor([8], 0, 0, ttype=INT32, data=b1.tobytes())
+t1 = tensor([1, 8, 8, 8], 0.04, -128)
+tw2 = tensor([1, 3, 3, 8], 0, 0, data=w2.tobytes(), scales=s2)
+tb2 = tensor([8], 0, 0, ttype=INT32, data=b2.tobytes())
+t2 = tensor([1, 4, 4, 8], 0.03, 5)
+tw3 = tensor([8, 1, 1, 8], 0, 0, data=w3.tobytes(), scales=s3)
+t3 = tensor([1, 4, 4, 8], 0.02, -7)
+t4 = tensor([1, 4, 4, 8], 0.045, 2)
+t5 = tensor([1, 2, 2, 8], 0.045, 2)
+t6 = tensor([1, 2, 2, 8], 0.045, 2)
+t7 = tensor([1, 32], 0.045, 2)
+tw8 = tensor([10, 32], 0.004, 0, data=w8.tobytes())
+tb8 = tensor([10], 0, 0, ttype=INT32, data=b8.tobytes())
+t8 = tensor([1, 10], 0.09, 11)
+t9 = tensor([1, 10], 1.0 / 256, -128)
+
+# BuiltinOperator values. RESHAPE only sets builtin_code, the others also set
+# the deprecated code, so that the loader takes the maximum of the two.
+ADD, AVERAGE_POOL_2D, CONV_2D, DEPTHWISE_CONV_2D = 0, 1, 3, 4
+FULLY_CONNECTED, MAX_POOL_2D, RESHAPE, SOFTMAX = 9, 17, 22, 25
+opcodes = [CONV_2D, DEPTHWISE_CONV_2D, ADD, AVERAGE_POOL_2D, MAX_POOL_2D, RESHAPE, FULLY_CONNECTED, SOFTMAX]
+opcode_tables = [Table({3: ('i32', c)}) if c == RESHAPE else Table({0: ('i8', c), 3: ('i32', c)})
+                 for c in opcodes]
+
+# BuiltinOptions union types
+CONV_2D_OPTIONS, DEPTHWISE_CONV_2D_OPTIONS, POOL_2D_OPTIONS = 1, 2, 5
+FULLY_CONNECTED_OPTIONS, SOFTMAX_OPTIONS, ADD_OPTIONS = 8, 9, 11
+
+
+def operator(code, inputs, outputs, options_type=None, options=None):
+    fields = {0: ('i32', opcodes.index(code)), 1: ('off', Vector('i32', inputs)), 2: ('off', Vector('i32', outputs))}
+    if options is not None:
+        fields[3] = ('u8', options_type)
+        fields[4] = ('off', Table(options))
+    return Table(fields)
+
+
+operators = [
+    operator(CONV_2D, [x, tw1, tb1], [t1], CONV_2D_OPTIONS,
+             {0: ('i8', SAME), 1: ('i32', 1), 2: ('i32', 1), 3: ('i8', ACT_RELU6)}),
+    operator(DEPTHWISE_CONV_2D, [t1, tw2, tb2], [t2], DEPTHWISE_CONV_2D_OPTIONS,
+             {0: ('i8', SAME), 1: ('i32', 2), 2: ('i32', 2), 3: ('i32', 1), 4: ('i8', ACT_RELU)}),
+    operator(CONV_2D, [t2, tw3, -1], [t3], CONV_2D_OPTIONS, {0: ('i8', VALID)}),
+    operator(ADD, [t2, t3], [t4], ADD_OPTIONS, {0: ('i8', ACT_NONE)}),
+    operator(AVERAGE_POOL_2D, [t4], [t5], POOL_2D_OPTIONS,
+             {0: ('i8', VALID), 1: ('i32', 2), 2: ('i32', 2), 3: ('i32', 2), 4: ('i32', 2)}),
+    operator(MAX_POOL_2D, [t5], [t6], POOL_2D_OPTIONS,
+             {0: ('i8', SAME), 1: ('i32', 1), 2: ('i32', 1), 3: ('i32', 2), 4: ('i32', 2),
+              5: ('i8', ACT_RELU_N1_TO_1)}),
+    operator(RESHAPE, [t6], [t7]),
+    operator(FULLY_CONNECTED, [t7, tw8, tb8], [t8], FULLY_CONNECTED_OPTIONS, {0: ('i8', ACT_RELU)}),
+    operator(SOFTMAX, [t8], [t9], SOFTMAX_OPTIONS, {0: ('f32', 1.0)}),
+]
+
+
+def tensor_table(t):
+    quantization = Table({2: ('off', Vector('f32', t['scales'])),
+                          3: ('off', Vector('i64', [t['zp']] * len(t['scales'])))})
+    return Table({0: ('off', Vector('i32', t['shape'])), 1: ('i8', t['type']), 2: ('i32', t['buffer']),
+                  4: ('off', quantization)})
+
+
+subgraph = Table({0: ('off', Vector('off', [tensor_table(t) for t in tensors])),
+                  1: ('off', Vector('i32', [x])),
+                  2: ('off', Vector('i32', [t9])),
+                  3: ('off', Vector('off', operators))})
+buffer_tables = [Table({0: ('off', Vector('u8', list(b)))}) if b else Table({}) for b in buffers]
+model = Builder().finish(Table({0: ('i32', 3),
+                                1: ('off', Vector('off', opcode_tables)),
+                                2: ('off', Vector('off', [subgraph])),
+                                4: ('off', Vector('off', buffer_tables))}))
+
+# ---------------------------------------------------------------------------
+# Quantization parameters (TFLM)
+# ---------------------------------------------------------------------------
+
+
+def quantize_multiplier(d):
+    if d == 0:
+        return 0, 0
+    m, e = math.frexp(d)
+    q = int(math.floor(m * (1 << 31) + 0.5))  # std::round, m > 0
+    if q == (1 << 31):
+        q //= 2
+        e += 1
+    if e < -31:
+        return 0, 0
+    return q, e
+
+
+def activation_range(act, t):
+    def quantize(f):
+        q = f32(f) / t['scale']
+        return t['zp'] + int(math.copysign(math.floor(abs(q) + 0.5), q))  # std::round
+    if act == ACT_RELU:
+        return max(-128, quantize(0)), 127
+    if act == ACT_RELU6:
+        return max(-128, quantize(0)), min(127, quantize(6))
+    if act == ACT_RELU_N1_TO_1:
+        return max(-128, quantize(-1)), min(127, quantize(1))
+    return -128, 127
+
+
+def per_channel(inp, filt, out):
+    return [quantize_multiplier(float(tensors[inp]['scale']) * float(s) / float(tensors[out]['scale']))
+            for s in tensors[filt]['scales']]
+
+
+conv1_q, conv1_act = per_channel(x, tw1, t1), activation_range(ACT_RELU6, tensors[t1])
+dw_q, dw_act = per_channel(t1, tw2, t2), activation_range(ACT_RELU, tensors[t2])
+conv2_q, conv2_act = per_channel(t2, tw3, t3), activation_range(ACT_NONE, tensors[t3])
+
+ADD_LEFT_SHIFT = 20
+twice_max = 2 * float(max(tensors[t2]['scale'], tensors[t3]['scale']))
+add_q = (quantize_multiplier(float(tensors[t2]['scale']) / twice_max),
+         quantize_multiplier(float(tensors[t3]['scale']) / twice_max),
+         quantize_multiplier(twice_max / ((1 << ADD_LEFT_SHIFT) * float(tensors[t4]['scale']))))
+max_pool_act = activation_range(ACT_RELU_N1_TO_1, tensors[t6])
+fc_q = quantize_multiplier(float(tensors[t7]['scale'] * tensors[tw8]['scale']) / float(tensors[t8]['scale']))
+fc_act = activation_range(ACT_RELU, tensors[t8])
+
+SOFTMAX_INPUT_BITS = 5
+softmax_q = quantize_multiplier(min(1.0 * float(tensors[t8]['scale']) * (1 << (31 - SOFTMAX_INPUT_BITS)),
+                                    (1 << 31) - 1.0))
+softmax_diff_min = -int(math.floor(1.0 * ((1 << SOFTMAX_INPUT_BITS) - 1) * (1 << (31 - SOFTMAX_INPUT_BITS)) /
+                                   (1 << softmax_q[1])))
+
+# ---------------------------------------------------------------------------
+# TFLM integer reference kernels, up to the logits
+# ---------------------------------------------------------------------------
+
+
+def srdhm(a, b):
+    if a == b == -(1 << 31):
+        return (1 << 31) - 1
+    ab = a * b
+    nudged = ab + ((1 << 30) if ab >= 0 else 1 - (1 << 30))
+    # C division, rounding toward zero
+    return nudged // (1 << 31) if nudged >= 0 else -(-nudged // (1 << 31))
+
+
+def rdbpot(v, exponent):
+    mask = (1 << exponent) - 1
+    remainder = v & mask
+    threshold = (mask >> 1) + (1 if v < 0 else 0)
+    return (v >> exponent) + (1 if remainder > threshold else 0)
+
+
+def requantize(v, q):
+    m, shift = q
+    return rdbpot(srdhm(v * (1 << max(shift, 0)), m), max(-shift, 0))
+
+
+def clamp(v, act):
+    return min(max(v, act[0]), act[1])
+
+
+def same_padding(size, filt, stride):
+    out = (size + stride - 1) // stride
+    return out, max((out - 1) * stride + filt - size, 0) // 2
+
+
+def conv(inp, in_zp, w, b, q, out_zp, act, stride, padding):
+    n_out, fh, fw, _ = w.shape
+    h, wd, _ = inp.shape
+    if padding == SAME:
+        oh, ph = same_padding(h, fh, stride)
+        ow, pw = same_padding(wd, fw, stride)
+    else:
+        oh, ph = (h - fh) // stride + 1, 0
+        ow, pw = (wd - fw) // stride + 1, 0
+    out = np.zeros((oh, ow, n_out), dtype=np.int64)
+    for y in range(oh):
+        for xx in range(ow):
+            for o in range(n_out):
+                acc = int(b[o]) if b is not None else 0
+                for ky in range(fh):
+                    for kx in range(fw):
+                        iy, ix = y * stride - ph + ky, xx * stride - pw + kx
+                        if 0 <= iy < h and 0 <= ix < wd:
+                            acc += int(np.dot(inp[iy, ix].astype(np.int64) - in_zp, w[o, ky, kx].astype(np.int64)))
+                out[y, xx, o] = clamp(requantize(acc, q[o]) + out_zp, act)
+    return out
+
+
+def depthwise_conv(inp, in_zp, w, b, q, out_zp, act, stride):
+    _, fh, fw, ch = w.shape
+    h, wd, _ = inp.shape
+    oh, ph = same_padding(h, fh, stride)
+    ow, pw = same_padding(wd, fw, stride)
+    out = np.zeros((oh, ow, ch), dtype=np.int64)
+    for y in range(oh):
+        for xx in range(ow):
+            for c in range(ch):
+                acc = int(b[c])
+                for ky in range(fh):
+                    for kx in range(fw):
+                        iy, ix = y * stride - ph + ky, xx * stride - pw + kx
+                        if 0 <= iy < h and 0 <= ix < wd:
+                            acc += (int(inp[iy, ix, c]) - in_zp) * int(w[0, ky, kx, c])
+                out[y, xx, c] = clamp(requantize(acc, q[c]) + out_zp, act)
+    return out
+
+
+def add(a, a_zp, b, b_zp, out_zp):
+    out = np.zeros(a.shape, dtype=np.int64)
+    for i, (va, vb) in enumerate(zip(a.flat, b.flat)):
+        sa = requantize((int(va) - a_zp) * (1 << ADD_LEFT_SHIFT), add_q[0])
+        sb = requantize((int(vb) - b_zp) * (1 << ADD_LEFT_SHIFT), add_q[1])
+        out.flat[i] = clamp(requantize(sa + sb, add_q[2]) + out_zp, (-128, 127))
+    return out
+
+
+def average_pool(inp, size):
+    h, w, ch = inp.shape
+    out = np.zeros((h // size, w // size, ch), dtype=np.int64)
+    for y in range(h // size):
+        for xx in range(w // size):
+            for c in range(ch):
+                acc = int(inp[y * size:(y + 1) * size, xx * size:(xx + 1) * size, c].sum())
+                count = size * size
+                acc = (acc + count // 2) // count if acc > 0 else -((-acc + count // 2) // count)
+                out[y, xx, c] = clamp(acc, (-128, 127))
+    return out
+
+
+def max_pool_same(inp, size, act):
+    h, w, ch = inp.shape
+    out = np.zeros(inp.shape, dtype=np.int64)
+    _, pad = same_padding(h, size, 1)
+    for y in range(h):
+        for xx in range(w):
+            window = inp[max(y - pad, 0):min(y - pad + size, h), max(xx - pad, 0):min(xx - pad + size, w)]
+            for c in range(ch):
+                out[y, xx, c] = clamp(int(window[:, :, c].max()), act)
+    return out
+
+
+def fully_connected(inp, in_zp, w, b, out_zp):
+    return np.array([clamp(requantize(int(np.dot(inp.astype(np.int64) - in_zp, w[o].astype(np.int64))) + int(b[o]),
+                                      fc_q) + out_zp, fc_act) for o in range(w.shape[0])])
+
+
+z = {t: tensors[t]['zp'] for t in (x, t1, t2, t3, t4, t7, t8)}
+model_input = rng.integers(-128, 128, (8, 8, 3)).astype(np.int8)
+a1 = conv(model_input, z[x], w1, b1, conv1_q, z[t1], conv1_act, 1, SAME)
+a2 = depthwise_conv(a1, z[t1], w2, b2, dw_q, z[t2], dw_act, 2)
+a3 = conv(a2, z[t2], w3, None, conv2_q, z[t3], conv2_act, 1, VALID)
+a4 = add(a2, z[t2], a3, z[t3], z[t4])
+a5 = average_pool(a4, 2)
+a6 = max_pool_same(a5, 2, max_pool_act)
+logits = fully_connected(a6.reshape(-1), z[t7], w8, b8, z[t8])
+
+# ---------------------------------------------------------------------------
+# C data
+# ---------------------------------------------------------------------------
+
+LICENSE = """/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generated by gen_model.py, do not edit */
+
+"""
+
+
+def c_array(declaration, values, per_line, fmt='{}'):
+    values = [fmt.format(int(v)) for v in values]
+    lines = [', '.join(values[i:i + per_line]) for i in range(0, len(values), per_line)]
+    return '%s = {\n    %s};\n\n' % (declaration, ',\n    '.join(lines))
+
+
+arrays = [
+    ('int8_t', 'tflite_input', model_input.reshape(-1)),
+    ('int8_t', 'tflite_ref_logits', logits),
+    ('int8_t', 'tflite_ref_conv1_weights', w1.reshape(-1)),
+    ('int32_t', 'tflite_ref_conv1_bias', b1),
+    ('int8_t', 'tflite_ref_dw_weights', w2.reshape(-1)),
+    ('int32_t', 'tflite_ref_dw_bias', b2),
+    ('int8_t', 'tflite_ref_conv2_weights', w3.reshape(-1)),
+    ('int8_t', 'tflite_ref_fc_weights', w8.reshape(-1)),
+    ('int32_t', 'tflite_ref_fc_bias', b8),
+    ('int32_t', 'tflite_ref_conv1_mult', [m for m, _ in conv1_q]),
+    ('int32_t', 'tflite_ref_conv1_shift', [s for _, s in conv1_q]),
+    ('int32_t', 'tflite_ref_conv1_act', conv1_act),
+    ('int32_t', 'tflite_ref_dw_mult', [m for m, _ in dw_q]),
+    ('int32_t', 'tflite_ref_dw_shift', [s for _, s in dw_q]),
+    ('int32_t', 'tflite_ref_dw_act', dw_act),
+    ('int32_t', 'tflite_ref_conv2_mult', [m for m, _ in conv2_q]),
+    ('int32_t', 'tflite_ref_conv2_shift', [s for _, s in conv2_q]),
+    ('int32_t', 'tflite_ref_conv2_act', conv2_act),
+    ('int32_t', 'tflite_ref_add', [v for q in add_q for v in q]),
+    ('int32_t', 'tflite_ref_max_pool_act', max_pool_act),
+    ('int32_t', 'tflite_ref_fc', list(fc_q) + list(fc_act)),
+    ('int32_t', 'tflite_ref_softmax', list(softmax_q) + [softmax_diff_min]),
+]
+
+out_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+
+with open(os.path.join(out_dir, 'arm_nn_graph_tflite_data.h'), 'w') as f:
+    f.write(LICENSE)
+    f.write('#ifndef ARM_NN_GRAPH_TFLITE_DATA_H\n#define ARM_NN_GRAPH_TFLITE_DATA_H\n\n')
+    f.write('#include "arm_nn_math_types.h"\n\n')
+    f.write('#define TFLITE_MODEL_SIZE (%d)\n\n' % len(model))
+    f.write('/* Zero points of the activation tensors */\n')
+    for name, t in (('INPUT', x), ('CONV1', t1), ('DW', t2), ('CONV2', t3), ('ADD', t4), ('POOL', t6),
+                    ('FC', t8), ('SOFTMAX', t9)):
+        f.write('#define TFLITE_%s_ZP (%d)\n' % (name, tensors[t]['zp']))
+    f.write('\n')
+    f.write('extern const uint8_t tflite_model[TFLITE_MODEL_SIZE];\n')
+    for ctype, name, values in arrays:
+        f.write('extern const %s %s[%d];\n' % (ctype, name, len(values)))
+    f.write('\n#endif\n')
+
+with open(os.path.join(out_dir, 'arm_nn_graph_tflite_data.c'), 'w') as f:
+    f.write(LICENSE)
+    f.write('#include "arm_nn_graph_tflite_data.h"\n\n')
+    f.write('/* Read in place: the int32 biases must be 4-byte aligned */\n')
+    f.write(c_array('const uint8_t tflite_model[TFLITE_MODEL_SIZE] __ALIGNED(16)', model, 16, '0x{:02x}'))
+    for ctype, name, values in arrays:
+        f.write(c_array('const %s %s[%d]' % (ctype, name, len(values)), values, 16 if ctype == 'int8_t' else 8))
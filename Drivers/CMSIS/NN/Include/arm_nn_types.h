@@ -22,8 +22,8 @@
  * Description:  Public header file to contain the CMSIS-NN structs for the
  *               TensorFlowLite micro compliant functions
  *
- * $Date:        22. Februari 2022
- * $Revision:    V.2.1.0
+ * $Date:        18. October 2026
+ * $Revision:    V.2.8.0
  *
  * Target Processor:  Cortex-M cores
  * -------------------------------------------------------------------- */
@@ -117,6 +117,23 @@ typedef struct
     cmsis_nn_activation activation;
 } cmsis_nn_fc_params;
 
+/** CMSIS-NN object for a residual addition fused in the requantization of a convolution.
+ *  The parameters of arm_elementwise_add_s8(), input 1 being the convolution result and input 2 the residual. */
+typedef struct
+{
+    int32_t input_1_offset; /**< Zero value of the convolution result, negated */
+    int32_t input_1_mult;
+    int32_t input_1_shift;
+    int32_t input_2_offset; /**< Zero value of the residual, negated */
+    int32_t input_2_mult;
+    int32_t input_2_shift;
+    int32_t left_shift;
+    int32_t output_offset;
+    int32_t output_mult;
+    int32_t output_shift;
+    cmsis_nn_activation activation; /**< Clamp of the sum, e.g. the ReLU6 range of the block output */
+} cmsis_nn_add_params;
+
 /** CMSIS-NN object for SVDF layer parameters */
 typedef struct
 {
@@ -127,6 +144,42 @@ typedef struct
     cmsis_nn_activation output_activation;
 } cmsis_nn_svdf_params;
 
+/** CMSIS-NN object for the gate weights of a LSTM or GRU layer.
+ *  The weights of all the gates are stacked in one matrix, gate after gate. */
+typedef struct
+{
+    const int8_t *input_weights;          /**< Format: [gates * hidden_size, input_size] */
+    const int8_t *recurrent_weights;      /**< Format: [gates * hidden_size, hidden_size] */
+    const int32_t *bias;                  /**< Optional, added to the input part. Format: [gates * hidden_size] */
+    const int32_t *recurrent_bias;        /**< Optional, added to the recurrent part. Format: [gates * hidden_size] */
+    const int32_t *input_multipliers;     /**< Per gate multiplier from the input part to the gate scale */
+    const int32_t *input_shifts;          /**< Per gate shift from the input part to the gate scale */
+    const int32_t *recurrent_multipliers; /**< Per gate multiplier from the recurrent part to the gate scale */
+    const int32_t *recurrent_shifts;      /**< Per gate shift from the recurrent part to the gate scale */
+} cmsis_nn_rnn_gates;
+
+/** CMSIS-NN object for LSTM layer parameters */
+typedef struct
+{
+    int32_t time_major;        /**< Non-zero if the input and output are [time, batch, C] instead of [batch, time, C] */
+    int32_t input_offset;      /**< Zero value for the input tensor */
+    int32_t output_offset;     /**< Zero value for the output tensor, which is also the hidden state */
+    int32_t cell_scale_power;  /**< The cell state scale is 2^cell_scale_power */
+    int32_t cell_clip;         /**< Clipping of the cell state, at the cell state scale. 0 for no clipping */
+    int32_t hidden_multiplier; /**< Multiplier from output gate * tanh(cell), Q0.30, to the output */
+    int32_t hidden_shift;      /**< Shift from output gate * tanh(cell), Q0.30, to the output */
+} cmsis_nn_lstm_params;
+
+/** CMSIS-NN object for GRU layer parameters */
+typedef struct
+{
+    int32_t time_major;        /**< Non-zero if the input and output are [time, batch, C] instead of [batch, time, C] */
+    int32_t input_offset;      /**< Zero value for the input tensor */
+    int32_t output_offset;     /**< Zero value for the output tensor */
+    int32_t output_multiplier; /**< Multiplier from the hidden state, Q0.15, to the output */
+    int32_t output_shift;      /**< Shift from the hidden state, Q0.15, to the output */
+} cmsis_nn_gru_params;
+
 /** CMSIS-NN object for Softmax s16 layer parameters */
 typedef struct
 {
@@ -134,4 +187,163 @@ typedef struct
     const int16_t *one_by_one_lut;
 } cmsis_nn_softmax_lut_s16;
 
+/** CMSIS-NN object for Batch Matmul layer parameters */
+typedef struct
+{
+    int32_t adj_x;                /**< Non-zero if the left-hand side matrices are transposed */
+    int32_t adj_y;                /**< Non-zero if the right-hand side matrices are transposed */
+    cmsis_nn_fc_params fc_params; /**< input_offset and filter_offset are the zero values of the left-hand side
+                                       and right-hand side tensors */
+} cmsis_nn_bmm_params;
+
+/** CMSIS-NN object for Transpose layer parameters */
+typedef struct
+{
+    int32_t num_dims;             /**< Number of dimensions, 1 to 4. They are the last ones of [N, H, W, C] */
+    const uint32_t *permutations; /**< For each output dimension, the input dimension it is taken from */
+} cmsis_nn_transpose_params;
+
+/** CMSIS-NN task of a parallel layer function. Computes part task of the layer described by args */
+typedef void (*cmsis_nn_task)(void *args, int32_t task);
+
+/** CMSIS-NN object for the parallel layer functions */
+typedef struct
+{
+    /** Scheduler callback. Must run task(args, i) once for each i in [0, num_tasks), possibly concurrently,
+        and return when all of them have completed */
+    void (*parallel_for)(void *scheduler, cmsis_nn_task task, void *args, int32_t num_tasks);
+    void *scheduler;             /**< Scheduler state passed to parallel_for */
+    int32_t num_workers;         /**< Maximum number of tasks of a call */
+    const cmsis_nn_context *ctx; /**< Scratch buffers, one per task. num_workers entries */
+} cmsis_nn_parallel_context;
+
+/** CMSIS-NN object for the weight streaming layer functions. The filter is read in tiles of tile_ch output channels:
+    tile t holds the filter rows of output channels [t * tile_ch, (t + 1) * tile_ch), the last tile may be shorter */
+typedef struct
+{
+    /** Starts copying size bytes of tile to dst, e.g. by DMA. May return before the copy has completed */
+    void (*fetch)(void *stream, int32_t tile, int8_t *dst, int32_t size);
+    /** Returns when the copy of tile started by fetch has completed */
+    void (*wait)(void *stream, int32_t tile);
+    void *stream;    /**< Stream state passed to fetch and wait, e.g. the source address of the filter */
+    int32_t tile_ch; /**< Output channels per tile. A multiple of 4 keeps the kernels on their 4-channel paths */
+} cmsis_nn_weight_stream;
+
+/** CMSIS-NN graph operators */
+typedef enum
+{
+    ARM_NN_GRAPH_OP_CONV_S8 = 0,            /**< arm_convolve_wrapper_s8() */
+    ARM_NN_GRAPH_OP_DEPTHWISE_CONV_S8 = 1,  /**< arm_depthwise_conv_wrapper_s8() */
+    ARM_NN_GRAPH_OP_FULLY_CONNECTED_S8 = 2, /**< arm_fully_connected_s8() */
+    ARM_NN_GRAPH_OP_AVGPOOL_S8 = 3,         /**< arm_avgpool_s8() */
+    ARM_NN_GRAPH_OP_MAX_POOL_S8 = 4,        /**< arm_max_pool_s8() */
+    ARM_NN_GRAPH_OP_SOFTMAX_S8 = 5,         /**< arm_softmax_s8() */
+    ARM_NN_GRAPH_OP_ADD_S8 = 6,             /**< arm_elementwise_add_s8() */
+    ARM_NN_GRAPH_OP_RESHAPE_S8 = 7,         /**< arm_reshape_s8() */
+    ARM_NN_GRAPH_OP_CONV_ADD_S8 = 8,        /**< arm_convolve_add_wrapper_s8(), made by arm_nn_graph_fuse_s8() */
+    ARM_NN_GRAPH_OP_COUNT = 9               /**< Number of operators */
+} arm_nn_graph_op;
+
+/** CMSIS-NN object for one layer of a graph.
+ *  All the members are 32-bit integers, so a layer list can be serialized as an int32 array. */
+typedef struct
+{
+    int32_t op;                /**< Operator, one of arm_nn_graph_op */
+    int32_t input;             /**< Index of the input tensor */
+    int32_t input_2;           /**< Index of the second input tensor for ARM_NN_GRAPH_OP_ADD_S8 and
+                                    ARM_NN_GRAPH_OP_CONV_ADD_S8, -1 otherwise */
+    int32_t output;            /**< Index of the output tensor */
+    cmsis_nn_dims input_dims;  /**< Input tensor dimensions */
+    cmsis_nn_dims filter_dims; /**< Filter dimensions or pooling window */
+    cmsis_nn_dims output_dims; /**< Output tensor dimensions */
+    cmsis_nn_tile stride;
+    cmsis_nn_tile padding;
+    cmsis_nn_tile dilation;
+    int32_t ch_mult;             /**< Channel multiplier of a depthwise convolution */
+    int32_t input_offset;        /**< Zero value for the input tensor */
+    int32_t input_2_offset;      /**< Zero value for the second input tensor */
+    int32_t output_offset;       /**< Zero value for the output tensor */
+    cmsis_nn_activation activation;
+    int32_t multiplier;          /**< Per-tensor output multiplier. Input beta multiplier for softmax */
+    int32_t shift;               /**< Per-tensor output shift. Input beta shift for softmax */
+    int32_t input_multiplier;    /**< Input multiplier of an addition */
+    int32_t input_shift;         /**< Input shift of an addition */
+    int32_t input_2_multiplier;  /**< Second input multiplier of an addition */
+    int32_t input_2_shift;       /**< Second input shift of an addition */
+    int32_t left_shift;          /**< Left shift of the inputs of an addition */
+    int32_t diff_min;            /**< Softmax diff_min */
+    int32_t weights;             /**< Byte offset of the int8 weights in the parameters, -1 if not used */
+    int32_t bias;                /**< Byte offset of the int32 bias in the parameters, -1 if no bias */
+    int32_t multipliers;         /**< Byte offset of the per-channel multipliers in the parameters */
+    int32_t shifts;              /**< Byte offset of the per-channel shifts in the parameters */
+    int32_t conv_output_offset;  /**< Zero value of the convolution result of ARM_NN_GRAPH_OP_CONV_ADD_S8 */
+    cmsis_nn_activation conv_activation; /**< Activation of the convolution of ARM_NN_GRAPH_OP_CONV_ADD_S8 */
+} cmsis_nn_graph_layer;
+
+/** CMSIS-NN object for a graph of s8 layers */
+typedef struct
+{
+    const cmsis_nn_graph_layer *layers; /**< Layers, in execution order */
+    int32_t num_layers;                 /**< Number of layers */
+    const int32_t *tensor_sizes;        /**< Size in bytes of each tensor */
+    int32_t num_tensors;                /**< Number of tensors */
+    int32_t input;                      /**< Index of the graph input tensor */
+    int32_t output;                     /**< Index of the graph output tensor */
+    const int8_t *params;               /**< Weights, biases and per-channel quantization parameters */
+    const int8_t *quant_params;         /**< Per-channel quantization parameters, if not in params. Can be NULL */
+} cmsis_nn_graph;
+
+/** CMSIS-NN object for the arena plan of a graph */
+typedef struct
+{
+    int32_t *offsets;   /**< Arena offsets of the tensors, then of the scratch buffer of each layer.
+                             num_tensors + num_layers values, provided by the caller */
+    int32_t arena_size; /**< Arena size in bytes */
+    int32_t naive_size; /**< Size in bytes of one buffer per tensor plus the largest scratch buffer */
+} cmsis_nn_graph_plan;
+
+/** CMSIS-NN kernels recorded by the profiling hooks. The values are read by
+ *  Scripts/NNFunctions/arm_nn_profile_report.py: append new kernels at the end. */
+typedef enum
+{
+    ARM_NN_PROFILE_CONV_S8 = 0,           /**< arm_convolve_s8() called by arm_convolve_wrapper_s8() */
+    ARM_NN_PROFILE_CONV_1X1_S8_FAST = 1,  /**< arm_convolve_1x1_s8_fast() called by arm_convolve_wrapper_s8() */
+    ARM_NN_PROFILE_CONV_1_X_N_S8 = 2,     /**< arm_convolve_1_x_n_s8() called by arm_convolve_wrapper_s8() */
+    ARM_NN_PROFILE_CONV_S16 = 3,          /**< arm_convolve_s16() called by arm_convolve_wrapper_s16() */
+    ARM_NN_PROFILE_CONV_FAST_S16 = 4,     /**< arm_convolve_fast_s16() called by arm_convolve_wrapper_s16() */
+    ARM_NN_PROFILE_DW_CONV_S8 = 5,        /**< arm_depthwise_conv_s8() called by arm_depthwise_conv_wrapper_s8() */
+    ARM_NN_PROFILE_DW_CONV_S8_OPT = 6,    /**< arm_depthwise_conv_s8_opt() called by arm_depthwise_conv_wrapper_s8() */
+    ARM_NN_PROFILE_DW_CONV_3X3_S8 = 7,    /**< arm_depthwise_conv_3x3_s8() called by arm_depthwise_conv_wrapper_s8() */
+    ARM_NN_PROFILE_FC_S8 = 8,             /**< arm_fully_connected_s8() */
+    ARM_NN_PROFILE_FC_S16 = 9,            /**< arm_fully_connected_s16() */
+    ARM_NN_PROFILE_CONV_1X1_ADD_S8 = 10,  /**< arm_convolve_1x1_add_s8() called by arm_convolve_add_wrapper_s8() */
+    ARM_NN_PROFILE_ADD_S8 = 11,           /**< arm_elementwise_add_s8() */
+    ARM_NN_PROFILE_CONV_3X3_S8 = 12,      /**< arm_convolve_3x3_s8() called by arm_convolve_wrapper_s8() */
+    ARM_NN_PROFILE_KERNEL_COUNT = 13      /**< Number of kernels */
+} arm_nn_profile_kernel;
+
+/** CMSIS-NN object for one profiled layer call.
+ *  The layout is read by the host tool: keep it in sync. */
+typedef struct
+{
+    int32_t kernel;            /**< Kernel variant, one of arm_nn_profile_kernel */
+    int32_t status;            /**< Status returned by the kernel */
+    uint32_t elapsed;          /**< Time spent in the kernel, in the unit of arm_nn_profile_timestamp() */
+    int32_t scratch_size;      /**< Scratch buffer size in bytes required by the kernel */
+    cmsis_nn_dims input_dims;  /**< Input tensor dimensions */
+    cmsis_nn_dims filter_dims; /**< Filter dimensions */
+    cmsis_nn_dims output_dims; /**< Output tensor dimensions */
+    uint64_t macs;             /**< Multiply-accumulates computed by the layer */
+} cmsis_nn_profile_record;
+
+/** CMSIS-NN object for the header of the profiling ring. The records follow the header in the buffer
+ *  given to arm_nn_profile_init(). The layout is read by the host tool: keep it in sync. */
+typedef struct
+{
+    uint32_t magic;         /**< ARM_NN_PROFILE_MAGIC */
+    uint32_t num_records;   /**< Capacity of the ring */
+    volatile uint32_t head; /**< Number of layer calls recorded since reset */
+    uint32_t record_size;   /**< sizeof(cmsis_nn_profile_record) */
+} cmsis_nn_profile_log;
+
 #endif // _ARM_NN_TYPES_H
@@ -21,8 +21,8 @@
  * Title:        arm_nnfunctions.h
  * Description:  Public header file for CMSIS NN Library
  *
- * $Date:        19 April 2022
- * $Revision:    V.9.0.0
+ * $Date:        18 October 2026
+ * $Revision:    V.9.13.0
  *
  * Target Processor:  Cortex-M CPUs
  * -------------------------------------------------------------------- */
@@ -45,6 +45,7 @@
    * - Pooling Functions
    * - Softmax Functions
    * - Basic math Functions
+   * - Graph Functions
    *
    * The library has separate functions for operating on different weight and activation data
    * types including 8-bit integers (q7_t) and 16-bit integers (q15_t). The descrition of the
@@ -231,6 +232,114 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params *conv
                                                 const cmsis_nn_dims *filter_dims,
                                                 const cmsis_nn_dims *output_dims);
 
+/**
+ * @brief s8 convolution layer split across several workers.
+ *
+ * @param[in]      parallel_ctx   Scheduler and scratch buffers of the workers. Each scratch buffer must hold
+ *                                arm_convolve_parallel_s8_get_buffer_size() bytes.
+ * @param[in]      conv_params    Convolution parameters, as for arm_convolve_wrapper_s8()
+ * @param[in]      quant_params   Per-channel quantization info.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns the first status which is not <code>ARM_MATH_SUCCESS</code> among the
+ *             tasks, or <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - The output rows are split in at most parallel_ctx->num_workers tasks, each one a convolution of the
+ *      input rows it needs, computed by arm_convolve_wrapper_s8() with the scratch buffer of the task.
+ *    - The output is bit exact with arm_convolve_wrapper_s8().
+ *
+ */
+arm_status arm_convolve_parallel_s8(const cmsis_nn_parallel_context *parallel_ctx,
+                                    const cmsis_nn_conv_params *conv_params,
+                                    const cmsis_nn_per_channel_quant_params *quant_params,
+                                    const cmsis_nn_dims *input_dims,
+                                    const q7_t *input_data,
+                                    const cmsis_nn_dims *filter_dims,
+                                    const q7_t *filter_data,
+                                    const cmsis_nn_dims *bias_dims,
+                                    const int32_t *bias_data,
+                                    const cmsis_nn_dims *output_dims,
+                                    q7_t *output_data);
+
+/**
+ * @brief Get the size of the scratch buffer of each worker of arm_convolve_parallel_s8()
+ *
+ * @param[in]      conv_params    Convolution parameters
+ * @param[in]      input_dims     Input (activation) dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      filter_dims    Filter dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ *
+ * @return         The function returns required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_parallel_s8_get_buffer_size(const cmsis_nn_conv_params *conv_params,
+                                                 const cmsis_nn_dims *input_dims,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief s8 convolution layer with the filter read in tiles through a weight stream.
+ *
+ * @param[in, out] ctx            Function context. The buffer must hold arm_convolve_stream_s8_get_buffer_size() bytes
+ * @param[in]      stream         Weight stream. Its fetch callback copies the filter rows of a tile of output channels
+ * @param[in]      conv_params    Convolution parameters, as for arm_convolve_s8()
+ * @param[in]      quant_params   Per-channel quantization info.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns the status of arm_convolve_s8(), or <code>ARM_MATH_ARGUMENT_ERROR</code> if
+ *             ctx->buf is NULL or stream->tile_ch is less than 1.
+ *
+ * @details
+ *    - Two tiles are held in ctx->buf. While a tile is computed by arm_convolve_s8() for all the batches, the
+ *      next one is fetched into the other buffer, so a fetch that returns before its copy has completed (e.g. a
+ *      DMA from external flash) overlaps with the computation. stream->wait is called before a tile is used.
+ *    - With more than one tile, the output channels of a tile are computed in ctx->buf and then copied to the
+ *      output. The im2col of the input is repeated for each tile, so tiles should be as large as memory allows.
+ *    - The output is bit exact with arm_convolve_s8().
+ *
+ */
+arm_status arm_convolve_stream_s8(const cmsis_nn_context *ctx,
+                                  const cmsis_nn_weight_stream *stream,
+                                  const cmsis_nn_conv_params *conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const cmsis_nn_dims *bias_dims,
+                                  const int32_t *bias_data,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data);
+
+/**
+ * @brief Get the size of the buffer required by arm_convolve_stream_s8()
+ *
+ * @param[in]      stream         Weight stream. Only tile_ch is used.
+ * @param[in]      input_dims     Input (activation) dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      filter_dims    Filter dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ *
+ * @return         The function returns required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_stream_s8_get_buffer_size(const cmsis_nn_weight_stream *stream,
+                                               const cmsis_nn_dims *input_dims,
+                                               const cmsis_nn_dims *filter_dims,
+                                               const cmsis_nn_dims *output_dims);
+
 /**
  * @brief s16 convolution layer wrapper function with the main purpose to call the optimal kernel available in
  cmsis-nn
@@ -339,6 +448,119 @@ arm_status arm_convolve_s8(const cmsis_nn_context *ctx,
  */
 int32_t arm_convolve_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s8 convolution function with packed s4 weights
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                arm_convolve_s4_get_buffer_size will return the buffer_size if required
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK are the
+ *                                spatial filter dimensions
+ * @param[in]      packed_filter  Filter data pointer. Data type: int4, packed two per byte
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the buffer is required and missing, or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - The weights are packed two per byte, in the order of the s8 weights: weight i is the low nibble of
+ *      byte i / 2 when i is even and the high nibble when i is odd. An odd number of weights is padded with a
+ *      zero nibble. Scripts/NNFunctions/fully_connected_opt_weight_generation.py packs s8 weights in [-8, 7].
+ *    - Results are bit exact with arm_convolve_s8() on the unpacked weights. The weights are unpacked in the
+ *      matrix multiplication, once for two output pixels. 1x1 convolutions with unit stride and no padding
+ *      read the input directly and need no buffer.
+ *
+ */
+arm_status arm_convolve_s4(const cmsis_nn_context *ctx,
+                           const cmsis_nn_conv_params *conv_params,
+                           const cmsis_nn_per_channel_quant_params *quant_params,
+                           const cmsis_nn_dims *input_dims,
+                           const q7_t *input_data,
+                           const cmsis_nn_dims *filter_dims,
+                           const q7_t *packed_filter,
+                           const cmsis_nn_dims *bias_dims,
+                           const int32_t *bias_data,
+                           const cmsis_nn_dims *output_dims,
+                           q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for s8 convolution function with packed s4 weights
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK
+ *                                        are the spatial filter dimensions
+ * @return          The function returns  required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_s4_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief Basic s8 transpose convolution function
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                arm_transpose_conv_s8_get_buffer_size will return the buffer_size if required
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, pads,...).
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ *                                conv_params->padding is the padding of the equivalent forward convolution, i.e.
+ *                                the number of rows and columns removed at the top and left of the full output.
+ *                                conv_params->dilation must be 1.
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK are the
+ *                                spatial filter dimensions
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the dilation is not 1 or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro (TRANSPOSE_CONV)
+ *    2. Output pixel (y, x) is the sum, over the filter taps (ky, kx) with
+ *       y + pad_y - ky = in_y * stride_y and x + pad_x - kx = in_x * stride_x, of the input pixel (in_y, in_x)
+ *       multiplied by the tap. The taps of each output pixel are gathered in the ctx buffer, the ones that do not
+ *       fall on an input pixel being set to the input zero value, and the output channels are computed by the
+ *       matrix multiplication kernel of the s8 convolution, four output pixels at a time.
+ *
+ */
+arm_status arm_transpose_conv_s8(const cmsis_nn_context *ctx,
+                                 const cmsis_nn_conv_params *conv_params,
+                                 const cmsis_nn_per_channel_quant_params *quant_params,
+                                 const cmsis_nn_dims *input_dims,
+                                 const q7_t *input_data,
+                                 const cmsis_nn_dims *filter_dims,
+                                 const q7_t *filter_data,
+                                 const cmsis_nn_dims *bias_dims,
+                                 const int32_t *bias_data,
+                                 const cmsis_nn_dims *output_dims,
+                                 q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for s8 transpose convolution function
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK
+ *                                        are the spatial filter dimensions
+ * @return          The function returns  required buffer size(bytes)
+ *
+ */
+int32_t arm_transpose_conv_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
+
 /**
  * @brief Basic s16 convolution function
  * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
@@ -759,6 +981,132 @@ arm_status arm_convolve_1x1_s8_fast(const cmsis_nn_context *ctx,
  */
 int32_t arm_convolve_1x1_s8_fast_get_buffer_size(const cmsis_nn_dims *input_dims);
 
+/**
+ * @brief s8 1x1 convolution with a fused residual addition
+ *
+ * @param[in, out] ctx            Function context. Not used.
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      add_params     Parameters of the residual addition, as given to arm_elementwise_add_s8() with
+ *                                the convolution result as input 1
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, 1, 1, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      residual_data  Residual data pointer. Format: [N, H, W, C_OUT]. Data type: int8.
+ *                                May be equal to output_data.
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if argument constraints fail. or,
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *   - Bit exact with arm_convolve_1x1_s8_fast() followed by arm_elementwise_add_s8(). An activation such as
+ *     ReLU6 following the addition is applied by add_params->activation.
+ *   - The addition is done in the requantization of each output: the convolution result is never stored,
+ *     which saves writing and reading back N * H * W * C_OUT bytes, plus another write and read for a
+ *     separate activation.
+ *   - The following constrains on the arguments apply
+ *      -# conv_params->padding.w = conv_params->padding.h = 0
+ *      -# conv_params->stride.w = conv_params->stride.h = 1
+ *
+ */
+arm_status arm_convolve_1x1_add_s8(const cmsis_nn_context *ctx,
+                                   const cmsis_nn_conv_params *conv_params,
+                                   const cmsis_nn_per_channel_quant_params *quant_params,
+                                   const cmsis_nn_add_params *add_params,
+                                   const cmsis_nn_dims *input_dims,
+                                   const q7_t *input_data,
+                                   const cmsis_nn_dims *filter_dims,
+                                   const q7_t *filter_data,
+                                   const cmsis_nn_dims *bias_dims,
+                                   const int32_t *bias_data,
+                                   const q7_t *residual_data,
+                                   const cmsis_nn_dims *output_dims,
+                                   q7_t *output_data);
+
+/**
+ * @brief s8 convolution followed by a residual addition, fused when possible
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                arm_convolve_add_wrapper_s8_get_buffer_size will return the buffer_size if required
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ * @param[in]      quant_params   Per-channel quantization info.
+ * @param[in]      add_params     Parameters of the residual addition, the convolution result being input 1
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      residual_data  Residual data pointer. Format: [N, H, W, C_OUT]. Data type: int8.
+ *                                Must not overlap output_data unless the addition is fused.
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if argument constraints fail. or,
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *   - Calls arm_convolve_1x1_add_s8() when arm_convolve_add_s8_is_fused() is true. Otherwise, calls
+ *     arm_convolve_wrapper_s8() into output_data, then arm_elementwise_add_s8() in place.
+ *   - Results are the same in both cases, and bit exact with the separate layers.
+ *
+ */
+arm_status arm_convolve_add_wrapper_s8(const cmsis_nn_context *ctx,
+                                       const cmsis_nn_conv_params *conv_params,
+                                       const cmsis_nn_per_channel_quant_params *quant_params,
+                                       const cmsis_nn_add_params *add_params,
+                                       const cmsis_nn_dims *input_dims,
+                                       const q7_t *input_data,
+                                       const cmsis_nn_dims *filter_dims,
+                                       const q7_t *filter_data,
+                                       const cmsis_nn_dims *bias_dims,
+                                       const int32_t *bias_data,
+                                       const q7_t *residual_data,
+                                       const cmsis_nn_dims *output_dims,
+                                       q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_convolve_add_wrapper_s8
+ *
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ * @param[in]      input_dims     Input (activation) dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      filter_dims    Filter dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ *
+ * @return         The function returns required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_add_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params *conv_params,
+                                                    const cmsis_nn_dims *input_dims,
+                                                    const cmsis_nn_dims *filter_dims,
+                                                    const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief Tell whether arm_convolve_add_wrapper_s8() fuses the addition in the convolution
+ *
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ * @param[in]      filter_dims    Filter dimensions. Format: [C_OUT, HK, WK, C_IN]
+ *
+ * @return         1 for a 1x1 convolution with unit stride and no padding when ARM_NN_CONV_ADD_FUSED is defined
+ *                 on cores without MVE or Neon, 0 otherwise
+ *
+ * @details A hint for executors: when it returns 1, a convolution whose result is only read by an addition
+ *          can be run as one arm_convolve_add_wrapper_s8() call, and the convolution result needs no tensor.
+ *          The fused kernel runs at the speed of the separate layers, not faster, so it is opt-in.
+ *
+ */
+int32_t arm_convolve_add_s8_is_fused(const cmsis_nn_conv_params *conv_params, const cmsis_nn_dims *filter_dims);
+
 /**
  * @brief 1xn convolution
  *
@@ -818,6 +1166,67 @@ arm_status arm_convolve_1_x_n_s8(const cmsis_nn_context *ctx,
  */
 int32_t arm_convolve_1_x_n_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s8 3x3 convolution with a row buffer instead of im2col
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer.
+ *                                arm_convolve_3x3_s8_get_buffer_size will return the buffer_size
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, 3, 3, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if argument constraints fail,
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if ctx->buf is NULL, or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *   - Supported framework : TensorFlow Lite Micro
+ *   - Bit exact with arm_convolve_s8(): the accumulation is the same, only the order of the reads changes.
+ *   - Each row of 3 taps is a contiguous run of 3 * C_IN input bytes matching 3 * C_IN filter bytes. It is
+ *     extended to s16 once per output pixel and used by all the output channels, as in
+ *     arm_nn_mat_mult_kernel_s8_s16(). Padded taps are skipped. Two output pixels and two output channels are
+ *     computed at a time, the accumulators of the two pixels are kept in the buffer between the rows.
+ *   - The buffer holds 2 * 3 * C_IN * 2 + 2 * C_OUT * 4 bytes instead of the 2 * 9 * C_IN * 2 bytes of
+ *     im2col of arm_convolve_s8(). The im2col path is faster, so arm_convolve_wrapper_s8() only selects this
+ *     function for stride 1 on cores without MVE or Neon when ARM_NN_CONV_DIRECT_3X3 is defined.
+ *   - The following constrains on the arguments apply
+ *      -# filter_dims->w = filter_dims->h = 3
+ *      -# conv_params->dilation.w = conv_params->dilation.h = 1
+ *
+ */
+arm_status arm_convolve_3x3_s8(const cmsis_nn_context *ctx,
+                               const cmsis_nn_conv_params *conv_params,
+                               const cmsis_nn_per_channel_quant_params *quant_params,
+                               const cmsis_nn_dims *input_dims,
+                               const q7_t *input_data,
+                               const cmsis_nn_dims *filter_dims,
+                               const q7_t *filter_data,
+                               const cmsis_nn_dims *bias_dims,
+                               const int32_t *bias_data,
+                               const cmsis_nn_dims *output_dims,
+                               q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for arm_convolve_3x3_s8
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, 3, 3, C_IN]
+ * @return          The function returns  required buffer size(bytes)
+ *
+ */
+int32_t arm_convolve_3x3_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims);
+
 /**
  * @brief Q7 version of convolution for RGB image
  * @param[in]       Im_in       pointer to input tensor
@@ -1071,8 +1480,7 @@ arm_status arm_depthwise_separable_conv_HWC_q7_nonsquare(const q7_t *Im_in,
  * @param[in]      quant_params   Per-channel quantization info.
  *                               It contains the multiplier and shift values to be applied to each
  *                               output channel
- * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [H, W, C_IN]
- *                                Batch argument N is not used and assumed to be 1.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
  * @param[in]      input_data     Input (activation) data pointer. Data type: int8
  * @param[in]      filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
  * @param[in]      filter_data    Filter data pointer. Data type: int8
@@ -1112,8 +1520,7 @@ arm_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
  *                                dw_conv_params->dilation is not used.
  *                                Range of dw_conv_params->input_offset : [-127, 128]
  *                                Range of dw_conv_params->input_offset : [-128, 127]
- * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [H, W, C_IN]
- *                                Batch argument N is not used and assumed to be 1.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
  * @param[in]      filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
  * @param[in]      output_dims    Output tensor dimensions. Format: [1, H, W, C_OUT]
  * @return                        Size of additional memory required for optimizations in bytes.
@@ -1124,6 +1531,59 @@ int32_t arm_depthwise_conv_wrapper_s8_get_buffer_size(const cmsis_nn_dw_conv_par
                                                       const cmsis_nn_dims *filter_dims,
                                                       const cmsis_nn_dims *output_dims);
 
+/**
+ * @brief s8 depthwise convolution layer split across several workers.
+ *
+ * @param[in]      parallel_ctx   Scheduler and scratch buffers of the workers. Each scratch buffer must hold
+ *                                arm_depthwise_conv_parallel_s8_get_buffer_size() bytes.
+ * @param[in]      dw_conv_params Depthwise convolution parameters, as for arm_depthwise_conv_wrapper_s8()
+ * @param[in]      quant_params   Per-channel quantization info.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns the first status which is not <code>ARM_MATH_SUCCESS</code> among the
+ *             tasks, or <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - The output rows are split in at most parallel_ctx->num_workers tasks, each one computed by
+ *      arm_depthwise_conv_wrapper_s8() one batch at a time, with the scratch buffer of the task.
+ *    - The output is bit exact with arm_depthwise_conv_wrapper_s8().
+ *
+ */
+arm_status arm_depthwise_conv_parallel_s8(const cmsis_nn_parallel_context *parallel_ctx,
+                                          const cmsis_nn_dw_conv_params *dw_conv_params,
+                                          const cmsis_nn_per_channel_quant_params *quant_params,
+                                          const cmsis_nn_dims *input_dims,
+                                          const q7_t *input_data,
+                                          const cmsis_nn_dims *filter_dims,
+                                          const q7_t *filter_data,
+                                          const cmsis_nn_dims *bias_dims,
+                                          const int32_t *bias_data,
+                                          const cmsis_nn_dims *output_dims,
+                                          q7_t *output_data);
+
+/**
+ * @brief Get the size of the scratch buffer of each worker of arm_depthwise_conv_parallel_s8()
+ *
+ * @param[in]      dw_conv_params Depthwise convolution parameters
+ * @param[in]      input_dims     Input (activation) dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      filter_dims    Filter dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ *
+ * @return         The function returns required buffer size(bytes)
+ *
+ */
+int32_t arm_depthwise_conv_parallel_s8_get_buffer_size(const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                       const cmsis_nn_dims *input_dims,
+                                                       const cmsis_nn_dims *filter_dims,
+                                                       const cmsis_nn_dims *output_dims);
+
 /**
  * @brief Basic s8 depthwise convolution function that doesn't have any constraints on the input dimensions.
  *
@@ -1166,6 +1626,45 @@ arm_status arm_depthwise_conv_s8(const cmsis_nn_context *ctx,
                                  const cmsis_nn_dims *output_dims,
                                  q7_t *output_data);
 
+/**
+ * @brief s8 depthwise convolution function with packed s4 weights
+ *
+ * @param[in, out] ctx            Function context. Not used.
+ * @param[in]      dw_conv_params Depthwise convolution parameters (e.g. strides, dilations, pads,...)
+ *                                Range of dw_conv_params->input_offset : [-127, 128]
+ *                                Range of dw_conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each
+ *                                output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      filter_data    Filter data pointer. Data type: int4, packed two per byte
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[in, out] output_data    Output data pointer. Data type: int8
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *    - The weights are packed two per byte, in the order of the s8 weights: weight i is the low nibble of
+ *      byte i / 2 when i is even and the high nibble when i is odd. An odd number of weights is padded with a
+ *      zero nibble. Scripts/NNFunctions/fully_connected_opt_weight_generation.py packs s8 weights in [-8, 7].
+ *    - Any channel multiplier and dilation. Results are bit exact with arm_depthwise_conv_s8() on the unpacked
+ *      weights. With an even number of output channels, two channels are computed from each weight byte.
+ */
+arm_status arm_depthwise_conv_s4(const cmsis_nn_context *ctx,
+                                 const cmsis_nn_dw_conv_params *dw_conv_params,
+                                 const cmsis_nn_per_channel_quant_params *quant_params,
+                                 const cmsis_nn_dims *input_dims,
+                                 const q7_t *input_data,
+                                 const cmsis_nn_dims *filter_dims,
+                                 const q7_t *filter_data,
+                                 const cmsis_nn_dims *bias_dims,
+                                 const int32_t *bias_data,
+                                 const cmsis_nn_dims *output_dims,
+                                 q7_t *output_data);
+
 /**
  * @brief Basic s16 depthwise convolution function that doesn't have any constraints on the input dimensions.
  *
@@ -1223,6 +1722,7 @@ arm_status arm_depthwise_conv_s16(const cmsis_nn_context *ctx,
  *      -# Number of input channel equals number of output channels
  *      -# Filter height and width equals 3
  *      -# Padding along x is either 0 or 1.
+ *   - The N images of a batch are processed in one call. N of 0 is taken as 1.
  *
  */
 arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
@@ -1258,6 +1758,8 @@ arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
  *        -# Number of input channel equals number of output channels or ch_mult equals 1
  *    - q7 is used as data type eventhough it is s8 data. It is done so to be consistent with existing APIs.
  *    - Reccomended when number of channels is 4 or greater.
+ *    - The N images of a batch are processed in one call. On Cortex-M CPUs with DSP extension two images share
+ *      each load of the kernel, see arm_depthwise_conv_s8_opt_get_buffer_size().
  *
  */
 arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
@@ -1275,8 +1777,8 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
 /**
  * @brief Get the required buffer size for optimized s8 depthwise convolution
  * function with constraint that in_channel equals out_channel.
- * @param[in]       input_dims     Input (activation) tensor dimensions. Format: [1, H, W, C_IN]
- *                                 Batch argument N is not used.
+ * @param[in]       input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                                 On Cortex-M CPUs with DSP extension the buffer holds two images when N > 1.
  * @param[in]       filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
  * @return          The function returns  required buffer size in bytes
  *
@@ -1336,49 +1838,233 @@ arm_status arm_fully_connected_q7(const q7_t *pV,
  *                                fc_params->filter_offset : 0
  *                                Range of fc_params->output_offset : [-128, 127]
  * @param[in]      quant_params   Per-tensor quantization info.
- *                                It contains the multiplier and shift values to be applied to the output tensor.
+ *                                It contains the multiplier and shift values to be applied to the output tensor.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                                Input dimension is taken as Nx(H * W * C_IN)
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+ *                                N : accumulation depth and equals (H * W * C_IN) from input_dims
+ *                                C : output depth and equals C_OUT in output_dims
+ *                                H & W : Not used
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ *                                N, H, W : Not used
+ * @param[in]      bias_data      Bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
+ *                                N : Batches
+ *                                C_OUT : Output depth
+ *                                H & W : Not used.
+ * @param[in, out] output_data    Output data pointer. Data type: int8
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite
+ *    - q7 is used as data type eventhough it is s8 data. It is done so to be consistent with existing APIs.
+ */
+arm_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
+                                  const cmsis_nn_fc_params *fc_params,
+                                  const cmsis_nn_per_tensor_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *filter_data,
+                                  const cmsis_nn_dims *bias_dims,
+                                  const int32_t *bias_data,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for S8 basic fully-connected and
+ * matrix multiplication layer function for TF Lite
+ * @param[in]      filter_dims             dimension of filter
+ * @return         The function returns    required buffer size in bytes
+ *
+ */
+int32_t arm_fully_connected_s8_get_buffer_size(const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief s8 fully-connected layer function with packed s4 weights
+ *
+ * @param[in, out] ctx            Function context. Not used.
+ * @param[in]      fc_params      Fully Connected layer parameters.
+ *                                Range of fc_params->input_offset  : [-127, 128]
+ *                                fc_params->filter_offset : 0
+ *                                Range of fc_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-tensor quantization info.
+ *                                It contains the multiplier and shift values to be applied to the output tensor.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                                Input dimension is taken as Nx(H * W * C_IN)
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+ *                                N : accumulation depth and equals (H * W * C_IN) from input_dims
+ *                                C : output depth and equals C_OUT in output_dims
+ *                                H & W : Not used
+ * @param[in]      filter_data    Filter data pointer. Data type: int4, packed two per byte
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ *                                N, H, W : Not used
+ * @param[in]      bias_data      Bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
+ *                                N : Batches
+ *                                C_OUT : Output depth
+ *                                H & W : Not used.
+ * @param[in, out] output_data    Output data pointer. Data type: int8
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *    - The weights are packed two per byte, in the order of the s8 weights: weight i is the low nibble of
+ *      byte i / 2 when i is even and the high nibble when i is odd. An odd number of weights is padded with a
+ *      zero nibble. Scripts/NNFunctions/fully_connected_opt_weight_generation.py packs s8 weights in [-8, 7].
+ *    - Half the weight memory and bandwidth of arm_fully_connected_s8(), with bit exact results on the unpacked
+ *      weights. All the batches are computed in one pass, the weights being unpacked once for two batches.
+ */
+arm_status arm_fully_connected_s4(const cmsis_nn_context *ctx,
+                                  const cmsis_nn_fc_params *fc_params,
+                                  const cmsis_nn_per_tensor_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const q7_t *filter_data,
+                                  const cmsis_nn_dims *bias_dims,
+                                  const int32_t *bias_data,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data);
+
+/**
+ * @brief Get the required buffer size for s8 fully-connected layer function with packed s4 weights
+ * @param[in]      filter_dims             dimension of filter
+ * @return         The function returns    required buffer size in bytes
+ *
+ */
+int32_t arm_fully_connected_s4_get_buffer_size(const cmsis_nn_dims *filter_dims);
+
+/**
+ * @brief s8 fully-connected layer function with pre-packed weights
+ *
+ * @param[in, out] ctx            Function context. Not used.
+ * @param[in]      fc_params      Fully Connected layer parameters.
+ *                                fc_params->input_offset  : Not used, folded in the packed weights
+ *                                fc_params->filter_offset : 0
+ *                                Range of fc_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-tensor quantization info.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                                Input dimension is taken as Nx(H * W * C_IN)
+ * @param[in]      input          Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+ *                                N : accumulation depth and equals (H * W * C_IN) from input_dims
+ *                                C : output depth and equals C_OUT in output_dims
+ * @param[in]      packed_kernel  Weights and bias in the packed format. Data type: int8
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
+ * @param[out]     output         Output data pointer. Data type: int8
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *    - Packed format, generated offline by convert_to_packed_s8_weights() of
+ *      Scripts/NNFunctions/fully_connected_opt_weight_generation.py. The output channels are padded with zero rows
+ *      to a multiple of ARM_NN_PACKED_ROWS (4) and each block of 4 rows is stored as:
+ *        - 4 int32, little endian: bias[r] + input_offset * sum(weights[r])
+ *        - for each group of 4 columns, 16 bytes: the 4 columns of row 0, of row 1, of row 2 and of row 3
+ *        - the C % 4 left over columns of row 0, of row 1, of row 2 and of row 3
+ *    - Compared to arm_fully_connected_s8() with its bias, the packed weights are larger by the padding rows only.
+ *      The input offset correction and the bias are not computed at run time, and the weights are read once for
+ *      all the batches.
+ *
+ */
+arm_status arm_fully_connected_packed_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_fc_params *fc_params,
+                                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const q7_t *packed_kernel,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output);
+
+/**
+ * @brief s8 fully connected layer split across several workers.
+ *
+ * @param[in]      parallel_ctx   Scheduler and scratch buffers of the workers. Each scratch buffer must hold
+ *                                arm_fully_connected_s8_get_buffer_size() bytes.
+ * @param[in]      fc_params      Fully Connected layer parameters, as for arm_fully_connected_s8()
+ * @param[in]      quant_params   Per-tensor quantization info.
  * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
- *                                Input dimension is taken as Nx(H * W * C_IN)
  * @param[in]      input_data     Input (activation) data pointer. Data type: int8
  * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
- *                                N : accumulation depth and equals (H * W * C_IN) from input_dims
- *                                C : output depth and equals C_OUT in output_dims
- *                                H & W : Not used
  * @param[in]      filter_data    Filter data pointer. Data type: int8
  * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
- *                                N, H, W : Not used
  * @param[in]      bias_data      Bias data pointer. Data type: int32
  * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
- *                                N : Batches
- *                                C_OUT : Output depth
- *                                H & W : Not used.
- * @param[in, out] output_data    Output data pointer. Data type: int8
- * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns the first status which is not <code>ARM_MATH_SUCCESS</code> among the
+ *             tasks, or <code>ARM_MATH_SUCCESS</code> on successful completion.
  *
  * @details
- *    - Supported framework: TensorFlow Lite
- *    - q7 is used as data type eventhough it is s8 data. It is done so to be consistent with existing APIs.
+ *    - The output channels are split in at most parallel_ctx->num_workers tasks of a multiple of 4 channels,
+ *      each one computed by arm_fully_connected_s8() one batch at a time.
+ *    - The output is bit exact with arm_fully_connected_s8().
+ *
+ */
+arm_status arm_fully_connected_parallel_s8(const cmsis_nn_parallel_context *parallel_ctx,
+                                           const cmsis_nn_fc_params *fc_params,
+                                           const cmsis_nn_per_tensor_quant_params *quant_params,
+                                           const cmsis_nn_dims *input_dims,
+                                           const q7_t *input_data,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const q7_t *filter_data,
+                                           const cmsis_nn_dims *bias_dims,
+                                           const int32_t *bias_data,
+                                           const cmsis_nn_dims *output_dims,
+                                           q7_t *output_data);
+
+/**
+ * @brief s8 fully connected layer with the filter read in tiles through a weight stream.
+ *
+ * @param[in, out] ctx            Function context. The buffer must hold
+ *                                arm_fully_connected_stream_s8_get_buffer_size() bytes
+ * @param[in]      stream         Weight stream. Its fetch callback copies the filter rows of a tile of output channels
+ * @param[in]      fc_params      Fully Connected layer parameters, as for arm_fully_connected_s8()
+ * @param[in]      quant_params   Per-tensor quantization info.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns the status of arm_fully_connected_s8(), or <code>ARM_MATH_ARGUMENT_ERROR</code>
+ *             if ctx->buf is NULL or stream->tile_ch is less than 1.
+ *
+ * @details
+ *    - Two tiles are held in ctx->buf. While a tile is computed by arm_fully_connected_s8() for all the batches,
+ *      the next one is fetched into the other buffer, so a fetch that returns before its copy has completed
+ *      (e.g. a DMA from external flash) overlaps with the computation. stream->wait is called before a tile is used.
+ *    - The output is bit exact with arm_fully_connected_s8().
+ *
  */
-arm_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
-                                  const cmsis_nn_fc_params *fc_params,
-                                  const cmsis_nn_per_tensor_quant_params *quant_params,
-                                  const cmsis_nn_dims *input_dims,
-                                  const q7_t *input_data,
-                                  const cmsis_nn_dims *filter_dims,
-                                  const q7_t *filter_data,
-                                  const cmsis_nn_dims *bias_dims,
-                                  const int32_t *bias_data,
-                                  const cmsis_nn_dims *output_dims,
-                                  q7_t *output_data);
+arm_status arm_fully_connected_stream_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_weight_stream *stream,
+                                         const cmsis_nn_fc_params *fc_params,
+                                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input_data,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const cmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output_data);
 
 /**
- * @brief Get the required buffer size for S8 basic fully-connected and
- * matrix multiplication layer function for TF Lite
- * @param[in]      filter_dims             dimension of filter
- * @return         The function returns    required buffer size in bytes
+ * @brief Get the size of the buffer required by arm_fully_connected_stream_s8()
+ *
+ * @param[in]      stream         Weight stream. Only tile_ch is used.
+ * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+ *
+ * @return         The function returns required buffer size(bytes)
  *
  */
-int32_t arm_fully_connected_s8_get_buffer_size(const cmsis_nn_dims *filter_dims);
+int32_t arm_fully_connected_stream_s8_get_buffer_size(const cmsis_nn_weight_stream *stream,
+                                                      const cmsis_nn_dims *filter_dims);
 
 /**
  * @brief Basic s16 Fully Connected function.
@@ -1436,6 +2122,113 @@ arm_status arm_fully_connected_s16(const cmsis_nn_context *ctx,
  */
 int32_t arm_fully_connected_s16_get_buffer_size(const cmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s8 batch matrix multiplication function
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                arm_batch_matmul_s8_get_buffer_size will return the buffer_size if required
+ * @param[in]      bmm_params     Batch matmul parameters.
+ *                                Range of bmm_params->fc_params.input_offset  : [-127, 128]
+ *                                Range of bmm_params->fc_params.filter_offset : [-127, 128]
+ *                                Range of bmm_params->fc_params.output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-tensor quantization info.
+ *                                It contains the multiplier and shift values to be applied to the output tensor.
+ * @param[in]      input_lhs_dims Left-hand side tensor dimensions. Format: [N, H, W, C]
+ *                                N & H : batch dimensions, 1 or equal to the ones of output_dims (broadcast)
+ *                                W x C : (rows x depth) matrix, or (depth x rows) if bmm_params->adj_x is set
+ * @param[in]      input_lhs      Left-hand side data pointer. Data type: int8
+ * @param[in]      input_rhs_dims Right-hand side tensor dimensions. Format: [N, H, W, C]
+ *                                N & H : batch dimensions, 1 or equal to the ones of output_dims (broadcast)
+ *                                W x C : (depth x cols) matrix, or (cols x depth) if bmm_params->adj_y is set
+ * @param[in]      input_rhs      Right-hand side data pointer. Data type: int8
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C]
+ *                                W x C : (rows x cols) matrix
+ * @param[out]     output         Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions are not consistent or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite micro (BATCH_MATMUL)
+ *    - Each output row is computed by arm_nn_vec_mat_mult_t_s8(). The right-hand side matrix is used in place when
+ *      bmm_params->adj_y is set, otherwise it is transposed in the ctx buffer once per batch.
+ *
+ */
+arm_status arm_batch_matmul_s8(const cmsis_nn_context *ctx,
+                               const cmsis_nn_bmm_params *bmm_params,
+                               const cmsis_nn_per_tensor_quant_params *quant_params,
+                               const cmsis_nn_dims *input_lhs_dims,
+                               const q7_t *input_lhs,
+                               const cmsis_nn_dims *input_rhs_dims,
+                               const q7_t *input_rhs,
+                               const cmsis_nn_dims *output_dims,
+                               q7_t *output);
+
+/**
+ * @brief Get the required buffer size for arm_batch_matmul_s8()
+ *
+ * @param[in]      bmm_params     Batch matmul parameters
+ * @param[in]      input_lhs_dims Left-hand side tensor dimensions. Format: [N, H, W, C]
+ * @param[in]      input_rhs_dims Right-hand side tensor dimensions. Format: [N, H, W, C]
+ * @return         The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_batch_matmul_s8_get_buffer_size(const cmsis_nn_bmm_params *bmm_params,
+                                            const cmsis_nn_dims *input_lhs_dims,
+                                            const cmsis_nn_dims *input_rhs_dims);
+
+/**
+ * @brief s16 batch matrix multiplication function
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                arm_batch_matmul_s16_get_buffer_size will return the buffer_size if required
+ * @param[in]      bmm_params     Batch matmul parameters.
+ *                                bmm_params->fc_params.input_offset  : 0
+ *                                bmm_params->fc_params.filter_offset : 0
+ *                                bmm_params->fc_params.output_offset : 0
+ * @param[in]      quant_params   Per-tensor quantization info.
+ *                                It contains the multiplier and shift values to be applied to the output tensor.
+ * @param[in]      input_lhs_dims Left-hand side tensor dimensions. Format: [N, H, W, C], as for arm_batch_matmul_s8()
+ * @param[in]      input_lhs      Left-hand side data pointer. Data type: int16
+ * @param[in]      input_rhs_dims Right-hand side tensor dimensions. Format: [N, H, W, C], as for
+ *                                arm_batch_matmul_s8()
+ * @param[in]      input_rhs      Right-hand side data pointer. Data type: int16
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C]
+ * @param[out]     output         Output data pointer. Data type: int16
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions are not consistent or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite micro (BATCH_MATMUL)
+ *    - The accumulation is done on 64 bits.
+ *
+ */
+arm_status arm_batch_matmul_s16(const cmsis_nn_context *ctx,
+                                const cmsis_nn_bmm_params *bmm_params,
+                                const cmsis_nn_per_tensor_quant_params *quant_params,
+                                const cmsis_nn_dims *input_lhs_dims,
+                                const q15_t *input_lhs,
+                                const cmsis_nn_dims *input_rhs_dims,
+                                const q15_t *input_rhs,
+                                const cmsis_nn_dims *output_dims,
+                                q15_t *output);
+
+/**
+ * @brief Get the required buffer size for arm_batch_matmul_s16()
+ *
+ * @param[in]      bmm_params     Batch matmul parameters
+ * @param[in]      input_lhs_dims Left-hand side tensor dimensions. Format: [N, H, W, C]
+ * @param[in]      input_rhs_dims Right-hand side tensor dimensions. Format: [N, H, W, C]
+ * @return         The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_batch_matmul_s16_get_buffer_size(const cmsis_nn_bmm_params *bmm_params,
+                                             const cmsis_nn_dims *input_lhs_dims,
+                                             const cmsis_nn_dims *input_rhs_dims);
+
 /**
  * @brief Q7 opt fully-connected layer function
  * @param[in]       pV          pointer to input vector
@@ -1877,13 +2670,12 @@ void arm_avepool_q7_HWC(q7_t *Im_in,
  *                                Optional function {API}_get_buffer_size() provides the buffer
  *                                size if an additional buffer is required.
  * @param[in]      pool_params    Pooling parameters
- * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [H, W, C_IN]
- *                                Argument 'N' is not used.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                                N of 0 is taken as 1.
  * @param[in]      input_data     Input (activation) data pointer. Data type: int8
  * @param[in]      filter_dims    Filter tensor dimensions. Format: [H, W]
  *                                Argument N and C are not used.
- * @param[in]      output_dims    Output tensor dimensions. Format: [H, W, C_OUT]
- *                                Argument N is not used.
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
  *                                C_OUT equals C_IN.
  * @param[in, out] output_data    Output data pointer. Data type: int8
  * @return                        The function returns
@@ -1959,14 +2751,13 @@ int32_t arm_avgpool_s16_get_buffer_size(const int dim_dst_width, const int ch_sr
  *                                Optional function {API}_get_buffer_size() provides the buffer
  *                                size if an additional buffer is required.
  * @param[in]      pool_params    Pooling parameters
- * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [H, W, C_IN]
- *                                Argument 'N' is not used.
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                                N of 0 is taken as 1.
  * @param[in]      input_data     Input (activation) data pointer. The input tensor must not
  *                                overlap with the output tensor. Data type: int8
  * @param[in]      filter_dims    Filter tensor dimensions. Format: [H, W]
  *                                Argument N and C are not used.
- * @param[in]      output_dims    Output tensor dimensions. Format: [H, W, C_OUT]
- *                                Argument N is not used.
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
  *                                C_OUT equals C_IN.
  * @param[in, out] output_data    Output data pointer. Data type: int8
  * @return                        The function returns
@@ -2068,7 +2859,8 @@ void arm_softmax_q15(const q15_t *vec_in, const uint16_t dim_vec, q15_t *p_out);
 /**
  * @brief S8 softmax function
  * @param[in]  input     Pointer to the input tensor
- * @param[in]  num_rows  Number of rows in the input tensor
+ * @param[in]  num_rows  Number of rows in the input tensor. For a batched
+ *                       [N, H, W, C] tensor this is N * H * W.
  * @param[in]  row_size  Number of elements in each input row
  * @param[in]  mult      Input quantization multiplier
  * @param[in]  shift     Input quantization shift within the range [0, 31]
@@ -2237,6 +3029,71 @@ arm_status arm_depthwise_conv_u8_basic_ver1(const uint8_t *input,
  */
 void arm_reshape_s8(const int8_t *input, int8_t *output, const uint32_t total_size);
 
+/**
+ * @defgroup Pad Pad Functions
+ *
+ */
+
+/**
+ * @brief Pad a s8 tensor with a constant value
+ * @param[in]  input      points to the s8 input tensor
+ * @param[out] output     points to the s8 output tensor
+ * @param[in]  pad_value  value of the padded elements
+ * @param[in]  input_size input tensor dimensions. Format: [N, H, W, C]
+ * @param[in]  pre_pad    number of elements added before the input in each dimension. Format: [N, H, W, C]
+ * @param[in]  post_pad   number of elements added after the input in each dimension. Format: [N, H, W, C]
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if a padding is negative or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite micro (PAD, PADV2)
+ *    - The output is written in order, with one memset or memcpy per contiguous run.
+ *
+ * @note The output is expected to be in a memory area that does not overlap with the input's
+ *
+ */
+arm_status arm_pad_s8(const int8_t *input,
+                      int8_t *output,
+                      const int8_t pad_value,
+                      const cmsis_nn_dims *input_size,
+                      const cmsis_nn_dims *pre_pad,
+                      const cmsis_nn_dims *post_pad);
+
+/**
+ * @defgroup Transpose Transpose Functions
+ *
+ */
+
+/**
+ * @brief Permute the dimensions of a s8 tensor
+ * @param[in]  input            points to the s8 input tensor
+ * @param[out] output           points to the s8 output tensor
+ * @param[in]  input_dims       input tensor dimensions. Format: [N, H, W, C]
+ * @param[in]  output_dims      output tensor dimensions. Format: [N, H, W, C]
+ * @param[in]  transpose_params permutation of the last transpose_params->num_dims dimensions. The leading
+ *                              dimensions are expected to be 1.
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the permutation is not valid,
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if output_dims is not the permuted input_dims or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite micro (TRANSPOSE)
+ *    - When the innermost dimension is not moved, whole rows are copied with memcpy. Otherwise the input is read
+ *      with strides and four output elements are written at a time.
+ *
+ * @note The output is expected to be in a memory area that does not overlap with the input's
+ *
+ */
+arm_status arm_transpose_s8(const int8_t *input,
+                            int8_t *output,
+                            const cmsis_nn_dims *input_dims,
+                            const cmsis_nn_dims *output_dims,
+                            const cmsis_nn_transpose_params *transpose_params);
+
 /**
  * @defgroup Concatenation Concatenation Functions
  *
@@ -2525,6 +3382,313 @@ arm_status arm_svdf_state_s16_s8(const cmsis_nn_context *input_ctx,
                                  const cmsis_nn_dims *output_dims,
                                  q7_t *output_data);
 
+/**
+ * @defgroup RNN Recurrent Layer Functions
+ *
+ * LSTM and GRU layers with s8 input and output and s16 state. For each time step, the gate pre-activations
+ * of all the gates are computed by arm_nn_rnn_gates_s16() in one pass over the input and recurrent weights,
+ * in Q3.12, and the sigmoid and tanh activations use the look-up tables of arm_nn_activations_direct_q15().
+ *
+ * The state tensors are read at the start and written at the end of the call, so a stream can be processed
+ * a few time steps at a time.
+ */
+
+/**
+ * @brief s8 unidirectional LSTM function with 16 bit cell state
+ *
+ * @param[in, out] ctx          Function context that contains the additional buffer if required by the function.
+ *                              arm_lstm_unidirectional_s8_s16_get_buffer_size will return the buffer_size
+ * @param[in]      lstm_params  LSTM parameters
+ *                              Range of lstm_params->input_offset  : [-127, 128]
+ *                              Range of lstm_params->output_offset : [-128, 127]
+ *                              Range of lstm_params->cell_scale_power : [-15, -8]
+ * @param[in]      gates        Weights of the input, forget, cell and output gates, in that order.
+ *                              The multipliers and shifts scale the gate pre-activations to Q3.12.
+ * @param[in]      input_dims   Input tensor dimensions. Format: [N, H, W, C]
+ *                              N : batches, H : time steps, W : 1, C : input size
+ * @param[in]      input_data   Input data pointer. Data type: int8
+ * @param[in]      output_dims  Output tensor dimensions. Format: [N, H, W, C]
+ *                              N : batches, H : time steps, W : 1, C : hidden size
+ * @param[out]     output_data  Output data pointer, the hidden state of each time step. Data type: int8
+ * @param[in, out] hidden_state Hidden state of each batch. Format: [N, C]. Data type: int8
+ * @param[in, out] cell_state   Cell state of each batch. Format: [N, C]. Data type: int16
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro (UNIDIRECTIONAL_SEQUENCE_LSTM, integer 8x8_16), without
+ *       peephole, projection and layer normalization. Not bit exact to TFLu: the gates are computed with 64 bit
+ *       accumulators and the activations use look-up tables.
+ *    2. The sigmoid and tanh tables have 256 entries over [-8, 8) with linear interpolation.
+ *
+ */
+arm_status arm_lstm_unidirectional_s8_s16(const cmsis_nn_context *ctx,
+                                          const cmsis_nn_lstm_params *lstm_params,
+                                          const cmsis_nn_rnn_gates *gates,
+                                          const cmsis_nn_dims *input_dims,
+                                          const q7_t *input_data,
+                                          const cmsis_nn_dims *output_dims,
+                                          q7_t *output_data,
+                                          q7_t *hidden_state,
+                                          q15_t *cell_state);
+
+/**
+ * @brief Get the required buffer size for arm_lstm_unidirectional_s8_s16()
+ *
+ * @param[in]      input_dims   Input tensor dimensions. Format: [N, H, W, C]
+ * @param[in]      output_dims  Output tensor dimensions. Format: [N, H, W, C]
+ * @return         The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_lstm_unidirectional_s8_s16_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                       const cmsis_nn_dims *output_dims);
+
+/**
+ * @brief s8 unidirectional GRU function with 16 bit hidden state
+ *
+ * @param[in, out] ctx          Function context that contains the additional buffer if required by the function.
+ *                              arm_gru_unidirectional_s8_s16_get_buffer_size will return the buffer_size
+ * @param[in]      gru_params   GRU parameters
+ *                              Range of gru_params->input_offset  : [-127, 128]
+ *                              Range of gru_params->output_offset : [-128, 127]
+ * @param[in]      gates        Weights of the update (z), reset (r) and candidate (n) gates, in that order.
+ *                              The multipliers and shifts scale the gate pre-activations to Q3.12.
+ * @param[in]      input_dims   Input tensor dimensions. Format: [N, H, W, C]
+ *                              N : batches, H : time steps, W : 1, C : input size
+ * @param[in]      input_data   Input data pointer. Data type: int8
+ * @param[in]      output_dims  Output tensor dimensions. Format: [N, H, W, C]
+ *                              N : batches, H : time steps, W : 1, C : hidden size
+ * @param[out]     output_data  Output data pointer, the requantized hidden state of each time step. Data type: int8
+ * @param[in, out] hidden_state Hidden state of each batch, Q0.15. Format: [N, C]. Data type: int16
+ *
+ * @return     The function returns either
+ *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    The recurrent part of the candidate gate is multiplied by the reset gate (reset_after variant):
+ *      z = sigmoid(Wz x + bz + Uz h + rbz)
+ *      r = sigmoid(Wr x + br + Ur h + rbr)
+ *      n = tanh(Wn x + bn + r * (Un h + rbn))
+ *      h = (1 - z) * n + z * h
+ *
+ */
+arm_status arm_gru_unidirectional_s8_s16(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_gru_params *gru_params,
+                                         const cmsis_nn_rnn_gates *gates,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input_data,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output_data,
+                                         q15_t *hidden_state);
+
+/**
+ * @brief Get the required buffer size for arm_gru_unidirectional_s8_s16()
+ *
+ * @param[in]      input_dims   Input tensor dimensions. Format: [N, H, W, C]
+ * @param[in]      output_dims  Output tensor dimensions. Format: [N, H, W, C]
+ * @return         The function returns required buffer size in bytes
+ *
+ */
+int32_t arm_gru_unidirectional_s8_s16_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                      const cmsis_nn_dims *output_dims);
+
+/**
+ * @defgroup Graph Graph Functions
+ *
+ * Run a list of s8 layers from a single memory arena, without any allocation at run time.
+ *
+ * The graph is a constant description: the layers in execution order, the size of each tensor and a
+ * parameter blob holding the weights, biases and per-channel quantization parameters. arm_nn_graph_plan()
+ * computes once the offset in the arena of every tensor and of the scratch buffer of every layer.
+ * Tensors whose lifetimes do not overlap share memory, as do the scratch buffers, which are only alive
+ * during their layer.
+ */
+
+/**
+ * @brief Plan the arena of a graph
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer.
+ *                                The caller is expected to clear the buffer, if applicable, for security reasons.
+ *                                arm_nn_graph_plan_get_buffer_size() provides the buffer size.
+ * @param[in]      graph          Graph to plan
+ * @param[in, out] plan           Arena plan. plan->offsets must point to num_tensors + num_layers values,
+ *                                which receive the arena offsets of the tensors and then of the scratch
+ *                                buffer of each layer. plan->arena_size and plan->naive_size receive the
+ *                                size of the arena and the size needed with one buffer per tensor.
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if a layer refers to a tensor or an operator that does
+ *                  not exist, or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - The lifetime of a tensor starts with the layer writing it and ends with the last layer reading it.
+ *      The graph input is alive from the start and the graph output until the end of the graph.
+ *    - Buffers are placed by decreasing size, each one in the smallest gap left by the buffers it
+ *      overlaps in time (best fit). Offsets are multiples of 4.
+ *    - The planning cost grows with the cube of the number of buffers. It is meant to be paid once, at
+ *      initialization or ahead of time on a host: the offsets only depend on the graph.
+ *
+ */
+arm_status arm_nn_graph_plan(const cmsis_nn_context *ctx, const cmsis_nn_graph *graph, cmsis_nn_graph_plan *plan);
+
+/**
+ * @brief Get the required buffer size for arm_nn_graph_plan()
+ *
+ * @param[in]      graph          Graph to plan
+ * @return         The function returns the required buffer size in bytes
+ *
+ */
+int32_t arm_nn_graph_plan_get_buffer_size(const cmsis_nn_graph *graph);
+
+/**
+ * @brief Run a graph of s8 layers
+ *
+ * @param[in]      graph          Graph to run
+ * @param[in]      plan           Arena plan computed by arm_nn_graph_plan()
+ * @param[in, out] arena          Arena of plan->arena_size bytes, 4-byte aligned. The graph input is read at
+ *                                arena + plan->offsets[graph->input] and the graph output is written at
+ *                                arena + plan->offsets[graph->output].
+ * @return     The function returns the first status which is not <code>ARM_MATH_SUCCESS</code> among the
+ *             layers, or <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - A layer reads the parameter blob at graph->params plus the byte offsets given in the layer.
+ *      The per-channel multipliers and shifts are needed by the convolutions only. They are read at
+ *      graph->quant_params instead when it is not NULL.
+ *    - The other tensors are overwritten: only the output is valid after the call.
+ *
+ */
+arm_status arm_nn_graph_run_s8(const cmsis_nn_graph *graph, const cmsis_nn_graph_plan *plan, int8_t *arena);
+
+/**
+ * @brief Fuse the convolutions of a graph with the residual additions that follow them
+ *
+ * @param[in]      graph          Graph to fuse
+ * @param[out]     layers         Fused layers. Room for graph->num_layers layers
+ * @return         The function returns the number of fused layers
+ *
+ * @details
+ *    - An ARM_NN_GRAPH_OP_CONV_S8 layer directly followed by an ARM_NN_GRAPH_OP_ADD_S8 layer is replaced
+ *      by one ARM_NN_GRAPH_OP_CONV_ADD_S8 layer when the addition is the only reader of the convolution
+ *      result and arm_convolve_add_s8_is_fused() is true. Other layers are copied.
+ *    - Run the graph with layers and the returned number of layers. The convolution result is no longer
+ *      read or written, so arm_nn_graph_plan() gives it no memory.
+ *    - Results are bit exact with the graph before fusion.
+ *
+ */
+int32_t arm_nn_graph_fuse_s8(const cmsis_nn_graph *graph, cmsis_nn_graph_layer *layers);
+
+/**
+ * @brief Read a graph of s8 layers from a TensorFlow Lite flatbuffer, in place
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer, 4-byte aligned.
+ *                                arm_nn_graph_load_tflite_get_buffer_size() provides the buffer size.
+ *                                It holds the layers, the tensor sizes and the per-channel quantization
+ *                                parameters of the graph, and must live as long as the graph.
+ * @param[in]      model          TensorFlow Lite flatbuffer, in flash or mapped in memory. Constant data is
+ *                                not copied: the model must live as long as the graph.
+ * @param[in]      model_size     Size of the model in bytes
+ * @param[out]     graph          Graph of the model, to plan with arm_nn_graph_plan() and run with
+ *                                arm_nn_graph_run_s8()
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the model is malformed, the buffer is too small, or
+ *                  the model uses an operator or a tensor type that is not supported, or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported operators: CONV_2D, DEPTHWISE_CONV_2D, FULLY_CONNECTED, AVERAGE_POOL_2D, MAX_POOL_2D,
+ *      SOFTMAX, ADD without broadcast and RESHAPE, on int8 tensors with int32 biases. The first subgraph is
+ *      read and must have one input and one output.
+ *    - Every read of the flatbuffer is bounds checked against model_size. The tensor shapes are checked
+ *      against the operators, and each operator input must be the graph input or the output of an earlier
+ *      operator, so that a graph which loads runs within its arena.
+ *    - The quantization parameters are derived as in TensorFlow Lite Micro: results are bit exact with it.
+ *    - graph->params is the model and the weights and biases are read from their flatbuffer buffers, which
+ *      the converter aligns. An int32 bias which is not 4-byte aligned is an error.
+ *
+ */
+arm_status arm_nn_graph_load_tflite(const cmsis_nn_context *ctx,
+                                    const uint8_t *model,
+                                    const int32_t model_size,
+                                    cmsis_nn_graph *graph);
+
+/**
+ * @brief Get the required buffer size for arm_nn_graph_load_tflite()
+ *
+ * @param[in]      model          TensorFlow Lite flatbuffer
+ * @param[in]      model_size     Size of the model in bytes
+ * @return         The function returns the required buffer size in bytes, or -1 if the model is malformed
+ *                 or not supported
+ *
+ */
+int32_t arm_nn_graph_load_tflite_get_buffer_size(const uint8_t *model, const int32_t model_size);
+
+/**
+ * @defgroup NNProfile Profiling Functions
+ *
+ * Per-layer profile of an inference. When the library is built with ARM_NN_PROFILE defined (NNPROFILE
+ * option of the CMake build), arm_convolve_wrapper_s8(), arm_convolve_wrapper_s16(),
+ * arm_convolve_add_wrapper_s8(), arm_depthwise_conv_wrapper_s8(), arm_elementwise_add_s8(),
+ * arm_fully_connected_s8() and arm_fully_connected_s16() record one entry per call: the kernel variant
+ * selected, the tensor shapes, the scratch buffer size required by the kernel, the elapsed time and the
+ * number of multiply-accumulates. Without ARM_NN_PROFILE the hooks are compiled out.
+ *
+ * The entries are stored in a ring in a buffer provided by the application. A raw image of that buffer (fwrite
+ * on a host, a debugger memory dump on a target) is decoded by Scripts/NNFunctions/arm_nn_profile_report.py
+ * into a per-layer table, a summary of the MAC utilization of each kernel and a JSON export.
+ *
+ * Timestamps are read from DWT CYCCNT on Cortex-M and from clock_gettime(CLOCK_MONOTONIC) in nanoseconds
+ * elsewhere. Define ARM_NN_PROFILE_TIMESTAMP() when building the library to use another 32-bit time base.
+ */
+
+/**
+ * @brief Value of cmsis_nn_profile_log::magic, used by the host tool to validate a dump.
+ */
+#define ARM_NN_PROFILE_MAGIC (0x464E4E50U)
+
+/**
+ * @brief Start recording layer calls
+ *
+ * @param[in]      ctx            Buffer receiving the ring, 8-byte aligned. arm_nn_profile_get_buffer_size()
+ *                                gives the size for a number of records. A NULL ctx or ctx->buf stops recording.
+ * @return     The function returns either
+ *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the buffer is misaligned or too small for one record, or
+ *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - The buffer holds a cmsis_nn_profile_log header followed by the records. When more calls than records
+ *      are made, the oldest records are overwritten.
+ *    - On Cortex-M, the DWT cycle counter is enabled. It must be implemented by the core.
+ *
+ */
+arm_status arm_nn_profile_init(const cmsis_nn_context *ctx);
+
+/**
+ * @brief Get the buffer size for arm_nn_profile_init()
+ *
+ * @param[in]      num_records    Number of layer calls to retain
+ * @return         The function returns the required buffer size in bytes
+ *
+ */
+int32_t arm_nn_profile_get_buffer_size(const int32_t num_records);
+
+/**
+ * @brief Empty the ring, for instance before each profiled inference
+ *
+ */
+void arm_nn_profile_reset(void);
+
+/**
+ * @brief Current timestamp of the profiling time base
+ *
+ * @return     DWT cycle count on Cortex-M, nanoseconds (modulo 2^32) elsewhere
+ *
+ */
+uint32_t arm_nn_profile_timestamp(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,8 +21,8 @@
  * Title:        arm_nnsupportfunctions.h
  * Description:  Public header file of support functions for CMSIS NN Library
  *
- * $Date:        19. April 2022
- * $Revision:    V.7.0.1
+ * $Date:        18. October 2026
+ * $Revision:    V.7.9.0
  *
  * Target Processor:  Cortex-M CPUs
  * -------------------------------------------------------------------- */
@@ -45,6 +45,37 @@ extern "C" {
 #define MASK_IF_NON_ZERO(x) (x) != 0 ? ~0 : 0
 #define SELECT_USING_MASK(mask, a, b) ((mask) & (a)) ^ (~(mask) & (b))
 
+/**
+ * @brief Maximum number of tasks of a parallel layer function.
+ */
+#ifndef CMSIS_NN_MAX_TASKS
+#define CMSIS_NN_MAX_TASKS 16
+#endif
+
+/**
+ * @brief Number of rows in a block of the packed s8 weight format. Refer to arm_fully_connected_packed_s8().
+ */
+#define ARM_NN_PACKED_ROWS (4)
+
+/**
+ * @brief Profiling hooks of the layer functions, compiled out unless ARM_NN_PROFILE is defined.
+ *        ARM_NN_PROFILE_START() declares the start time of the call and ARM_NN_PROFILE_END() records the
+ *        kernel that ran. Refer to arm_nn_profile_init().
+ */
+#if defined(ARM_NN_PROFILE)
+#define ARM_NN_PROFILE_START() const uint32_t profile_start = arm_nn_profile_timestamp()
+#define ARM_NN_PROFILE_END(KERNEL, SCRATCH_SIZE, INPUT_DIMS, FILTER_DIMS, OUTPUT_DIMS, STATUS)                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        const uint32_t profile_elapsed = arm_nn_profile_timestamp() - profile_start;                                   \
+        arm_nn_profile_add(                                                                                            \
+            (KERNEL), profile_elapsed, (SCRATCH_SIZE), (INPUT_DIMS), (FILTER_DIMS), (OUTPUT_DIMS), (STATUS));          \
+    } while (0)
+#else
+#define ARM_NN_PROFILE_START() (void)0
+#define ARM_NN_PROFILE_END(KERNEL, SCRATCH_SIZE, INPUT_DIMS, FILTER_DIMS, OUTPUT_DIMS, STATUS) (void)0
+#endif
+
 #define MAX(A, B) ((A) > (B) ? (A) : (B))
 #define MIN(A, B) ((A) < (B) ? (A) : (B))
 #define CLAMP(x, h, l) MAX(MIN((x), (h)), (l))
@@ -470,6 +501,178 @@ arm_status arm_nn_vec_mat_mult_t_svdf_s8(const q7_t *lhs,
                                          const int32_t activation_min,
                                          const int32_t activation_max);
 
+/**
+ * @brief s8 matrix multiplication with the rhs matrix in the packed format
+ *
+ * @param[in]      lhs              Input left-hand side matrix. Format: [lhs_rows, rhs_cols]
+ * @param[in]      packed_rhs       Right-hand side matrix (transposed) in the packed format, with the bias and the
+ *                                  lhs offset correction folded in. Refer to arm_fully_connected_packed_s8().
+ * @param[out]     dst              Output matrix. Format: [lhs_rows, rhs_rows]
+ * @param[in]      dst_multipliers  Output multipliers
+ * @param[in]      dst_shifts       Output shifts
+ * @param[in]      per_channel      Non-zero if there is one multiplier and shift per rhs row, zero if
+ *                                  dst_multipliers[0] and dst_shifts[0] apply to all the rows
+ * @param[in]      lhs_rows         Number of lhs rows
+ * @param[in]      rhs_rows         Number of rhs rows, before padding to a multiple of ARM_NN_PACKED_ROWS
+ * @param[in]      rhs_cols         Number of rhs columns
+ * @param[in]      dst_offset       Offset to be applied to the output result. Range: -128 to 127
+ * @param[in]      activation_min   Minimum value to clamp the output to. Range: int8
+ * @param[in]      activation_max   Maximum value to clamp the output to. Range: int8
+ *
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details Each block of ARM_NN_PACKED_ROWS rhs rows is read once for all the lhs rows, two lhs rows per
+ *          pass: each word of the block is loaded and sign extended once for both. As the lhs offset is
+ *          folded in the bias, the inner loop is a plain s8 dot product: two SMLAD per row and word of lhs
+ *          on DSP cores, one SDOT per block and word of lhs on Neon cores with the dot product extension.
+ *
+ */
+arm_status arm_nn_mat_mult_packed_s8(const q7_t *lhs,
+                                     const q7_t *packed_rhs,
+                                     q7_t *dst,
+                                     const int32_t *dst_multipliers,
+                                     const int32_t *dst_shifts,
+                                     const int32_t per_channel,
+                                     const int32_t lhs_rows,
+                                     const int32_t rhs_rows,
+                                     const int32_t rhs_cols,
+                                     const int32_t dst_offset,
+                                     const int32_t activation_min,
+                                     const int32_t activation_max);
+
+/**
+ * @brief s8 matrix multiplication with a residual addition in the requantization
+ *
+ * @param[in]      lhs              Pointer to the lhs matrix. Format: [lhs_rows, rhs_cols]
+ * @param[in]      rhs              Pointer to the rhs matrix. Format: [rhs_rows, rhs_cols]
+ * @param[in]      bias             Pointer to the bias vector. Format: [rhs_rows]. Can be NULL
+ * @param[in]      residual         Pointer to the residual matrix. Format: [lhs_rows, rhs_rows]
+ * @param[out]     dst              Pointer to the output matrix. Format: [lhs_rows, rhs_rows]. May be residual
+ * @param[in]      dst_multipliers  Per-channel multipliers of the matrix product. Format: [rhs_rows]
+ * @param[in]      dst_shifts       Per-channel shifts of the matrix product. Format: [rhs_rows]
+ * @param[in]      lhs_rows         Number of lhs rows
+ * @param[in]      rhs_rows         Number of rhs rows
+ * @param[in]      rhs_cols         Number of columns of both matrices
+ * @param[in]      lhs_offset       Offset added to the lhs elements. Range: [-127, 128]
+ * @param[in]      dst_offset       Offset added to the requantized product
+ * @param[in]      activation_min   Minimum value to clamp the requantized product to. Range: int8
+ * @param[in]      activation_max   Maximum value to clamp the requantized product to. Range: int8
+ * @param[in]      add_params       Parameters of the addition of the clamped product (input 1) and the residual
+ *
+ * @return         The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details Outputs are bit exact with arm_nn_mat_mult_nt_t_s8() followed by arm_elementwise_add_s8(). Two
+ *          lhs rows are multiplied by two rhs rows at a time.
+ *
+ */
+arm_status arm_nn_mat_mult_nt_t_add_s8(const q7_t *lhs,
+                                       const q7_t *rhs,
+                                       const q31_t *bias,
+                                       const q7_t *residual,
+                                       q7_t *dst,
+                                       const int32_t *dst_multipliers,
+                                       const int32_t *dst_shifts,
+                                       const int32_t lhs_rows,
+                                       const int32_t rhs_rows,
+                                       const int32_t rhs_cols,
+                                       const int32_t lhs_offset,
+                                       const int32_t dst_offset,
+                                       const int32_t activation_min,
+                                       const int32_t activation_max,
+                                       const cmsis_nn_add_params *add_params);
+
+/**
+ * @brief s8 rows by packed s4 weights matrix multiplication with requantization
+ *
+ * @param[in]      lhs              Pointer to the lhs matrix. Format: [lhs_rows, rhs_cols]
+ * @param[in]      packed_rhs       Pointer to the s4 weights, two per byte, low nibble first.
+ *                                  Format: [rhs_rows, rhs_cols] without padding between the rows: a row starts in
+ *                                  the middle of a byte when rhs_cols is odd
+ * @param[in]      bias             Pointer to the bias vector. Format: [rhs_rows]. Can be NULL
+ * @param[out]     dst              Pointer to the output matrix. Format: [lhs_rows, rhs_rows]
+ * @param[in]      dst_multipliers  Output multipliers. Format: [rhs_rows], or one value when per_channel is 0
+ * @param[in]      dst_shifts       Output shifts. Format: [rhs_rows], or one value when per_channel is 0
+ * @param[in]      per_channel      1 for per-channel requantization, 0 for per-tensor
+ * @param[in]      lhs_rows         Number of lhs rows
+ * @param[in]      rhs_rows         Number of rhs rows
+ * @param[in]      rhs_cols         Number of columns of both matrices
+ * @param[in]      lhs_offset       Offset added to the lhs elements. Range: [-127, 128]
+ * @param[in]      dst_offset       Offset added to the outputs
+ * @param[in]      activation_min   Minimum value to clamp the output to. Range: int8
+ * @param[in]      activation_max   Maximum value to clamp the output to. Range: int8
+ *
+ * @return         The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details The weights are unpacked once for two lhs rows. On DSP cores, a word of eight weights is split in
+ *          four halfword pairs holding 16 times the weights, so that unpacking costs two masks and four SXTB16.
+ *
+ */
+arm_status arm_nn_mat_mult_nt_t_s4(const q7_t *lhs,
+                                   const q7_t *packed_rhs,
+                                   const q31_t *bias,
+                                   q7_t *dst,
+                                   const int32_t *dst_multipliers,
+                                   const int32_t *dst_shifts,
+                                   const int32_t per_channel,
+                                   const int32_t lhs_rows,
+                                   const int32_t rhs_rows,
+                                   const int32_t rhs_cols,
+                                   const int32_t lhs_offset,
+                                   const int32_t dst_offset,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max);
+
+/**
+ * @brief Record a layer call in the profiling ring. Does nothing unless arm_nn_profile_init() was given a
+ *        buffer. Called through ARM_NN_PROFILE_END().
+ *
+ * @param[in]      kernel          Kernel that ran
+ * @param[in]      elapsed         Time spent in the call, in the unit of arm_nn_profile_timestamp()
+ * @param[in]      scratch_size    Scratch buffer size in bytes required by the kernel
+ * @param[in]      input_dims      Input tensor dimensions
+ * @param[in]      filter_dims     Filter dimensions
+ * @param[in]      output_dims     Output tensor dimensions
+ * @param[in]      status          Status returned by the kernel
+ *
+ * @details The multiply-accumulates of the call are computed from the dimensions, with the conventions of
+ *          the layer function of the kernel.
+ *
+ */
+void arm_nn_profile_add(const arm_nn_profile_kernel kernel,
+                        const uint32_t elapsed,
+                        const int32_t scratch_size,
+                        const cmsis_nn_dims *input_dims,
+                        const cmsis_nn_dims *filter_dims,
+                        const cmsis_nn_dims *output_dims,
+                        const arm_status status);
+
+/**
+ * @brief Gate pre-activations of a recurrent layer: s16 input and hidden vectors by the stacked s8 gate
+ *        weights, in one pass over the weights
+ *
+ * @param[in]      input           Input vector, zero value included. Format: [input_size]
+ * @param[in]      hidden          Hidden state vector, zero value included. Format: [hidden_size]
+ * @param[in]      gates           Gate weights, biases and per gate requantization
+ * @param[in]      num_gates       Number of gates
+ * @param[in]      input_size      Input vector length
+ * @param[in]      hidden_size     Hidden state vector length, i.e. rows of each gate
+ * @param[out]     input_gates     Gate pre-activations. Format: [num_gates * hidden_size]
+ * @param[out]     recurrent_gates Optional. If NULL, input_gates receives the saturated sum of the input and
+ *                                 recurrent parts. Otherwise input_gates receives the input part and
+ *                                 recurrent_gates the recurrent part. Format: [num_gates * hidden_size]
+ *
+ * @details The dot products are accumulated on 64 bits and requantized with arm_nn_requantize_s64().
+ *
+ */
+void arm_nn_rnn_gates_s16(const q15_t *input,
+                          const q15_t *hidden,
+                          const cmsis_nn_rnn_gates *gates,
+                          const int32_t num_gates,
+                          const int32_t input_size,
+                          const int32_t hidden_size,
+                          q15_t *input_gates,
+                          q15_t *recurrent_gates);
+
 /**
  * @brief Depthwise convolution of transposed rhs matrix with 4 lhs matrices. To be used in padded cases where
  *        the padding is -lhs_offset(Range: int8). Dimensions are the same for lhs and rhs.
@@ -828,6 +1031,15 @@ void arm_nn_softmax_common_s8(const int8_t *input,
                               const bool int16_output,
                               void *output);
 
+/**
+ * @brief Size of the scratch buffer needed by one layer of a graph
+ * @param[in]  layer  Layer of the graph
+ * @return     Buffer size in bytes, as given by the {API}_get_buffer_size() function of the layer operator.
+ *             0 if the operator does not need a buffer.
+ *
+ */
+int32_t arm_nn_graph_scratch_size(const cmsis_nn_graph_layer *layer);
+
 /**
  * @brief macro for adding rounding offset
  */
@@ -1108,6 +1320,171 @@ __STATIC_FORCEINLINE int32x4_t arm_requantize_mve_32x4(const int32x4_t val,
 }
 #endif
 
+#if defined(ARM_MATH_NEON)
+/**
+ * @brief           Multiply 16 pairs of s8 values and accumulate them into 4 int32 lanes.
+ * @param[in]       acc       Accumulator. Each lane receives the sum of 4 products.
+ * @param[in]       a         First operand
+ * @param[in]       b         Second operand
+ * @return          Updated accumulator. The sum of its lanes is the dot product of a and b plus the
+ *                  sum of the lanes of acc.
+ *
+ * @details         Uses SDOT when the dot product extension is available (Armv8.2-A and later).
+ *
+ */
+__STATIC_FORCEINLINE int32x4_t arm_nn_dot_neon_s8x16(int32x4_t acc, const int8x16_t a, const int8x16_t b)
+{
+#if defined(__ARM_FEATURE_DOTPROD)
+    return vdotq_s32(acc, a, b);
+#else
+    /* Two products of s8 values may not fit in int16: widen after each product */
+    acc = vpadalq_s16(acc, vmull_s8(vget_low_s8(a), vget_low_s8(b)));
+    return vpadalq_s16(acc, vmull_s8(vget_high_s8(a), vget_high_s8(b)));
+#endif
+}
+
+/**
+ * @brief           Accumulate the sum of 16 s8 values into 4 int32 lanes.
+ * @param[in]       acc       Accumulator
+ * @param[in]       a         Values to sum
+ * @return          Updated accumulator
+ *
+ */
+__STATIC_FORCEINLINE int32x4_t arm_nn_sum_neon_s8x16(int32x4_t acc, const int8x16_t a)
+{
+#if defined(__ARM_FEATURE_DOTPROD)
+    return vdotq_s32(acc, a, vdupq_n_s8(1));
+#else
+    return vpadalq_s16(acc, vpaddlq_s8(a));
+#endif
+}
+
+/**
+ * @brief           Sum of the lanes of a vector.
+ * @param[in]       val       Vector to reduce
+ * @return          Sum of the 4 lanes
+ *
+ */
+__STATIC_FORCEINLINE int32_t arm_nn_reduce_neon_s32(const int32x4_t val)
+{
+#if defined(__aarch64__)
+    return vaddvq_s32(val);
+#else
+    const int32x2_t sum = vadd_s32(vget_low_s32(val), vget_high_s32(val));
+    return vget_lane_s32(vpadd_s32(sum, sum), 0);
+#endif
+}
+
+/**
+ * @brief           Sums of the lanes of 4 vectors.
+ * @param[in]       val0      First vector to reduce
+ * @param[in]       val1      Second vector to reduce
+ * @param[in]       val2      Third vector to reduce
+ * @param[in]       val3      Fourth vector to reduce
+ * @return          Vector whose lane i is the sum of the lanes of val<i>
+ *
+ */
+__STATIC_FORCEINLINE int32x4_t arm_nn_reduce4_neon_s32(const int32x4_t val0,
+                                                       const int32x4_t val1,
+                                                       const int32x4_t val2,
+                                                       const int32x4_t val3)
+{
+#if defined(__aarch64__)
+    return vpaddq_s32(vpaddq_s32(val0, val1), vpaddq_s32(val2, val3));
+#else
+    const int32x2_t sum01 = vpadd_s32(vadd_s32(vget_low_s32(val0), vget_high_s32(val0)),
+                                      vadd_s32(vget_low_s32(val1), vget_high_s32(val1)));
+    const int32x2_t sum23 = vpadd_s32(vadd_s32(vget_low_s32(val2), vget_high_s32(val2)),
+                                      vadd_s32(vget_low_s32(val3), vget_high_s32(val3)));
+    return vcombine_s32(sum01, sum23);
+#endif
+}
+
+/**
+ * @brief           Vector rounding divide by power of two.
+ * @param[in]       dividend - Dividend vector
+ * @param[in]       shift    - Per lane negated exponent, Divisor = power(2, -shift)
+ *                             Range: [-31, 0]
+ * @return          Rounded result of division. Midpoint is rounded away from zero.
+ *
+ */
+__STATIC_FORCEINLINE int32x4_t arm_divide_by_power_of_two_neon_32x4(const int32x4_t dividend, const int32x4_t shift)
+{
+    const int32x4_t fixup = vshrq_n_s32(vandq_s32(dividend, shift), 31);
+    const int32x4_t fixed_up_dividend = vqaddq_s32(dividend, fixup);
+    return vrshlq_s32(fixed_up_dividend, shift);
+}
+
+/**
+ * @brief           Requantize a given vector with per lane multiplier and shift.
+ * @param[in]       val         Vector to be requantized
+ * @param[in]       multiplier  multiplier
+ * @param[in]       shift       shift
+ *
+ * @return          Returns (val * multiplier)/(2 ^ shift), bit exact with arm_nn_requantize()
+ *
+ */
+__STATIC_FORCEINLINE int32x4_t arm_requantize_neon_32x4(const int32x4_t val,
+                                                        const int32x4_t multiplier,
+                                                        const int32x4_t shift)
+{
+#ifdef CMSIS_NN_USE_SINGLE_ROUNDING
+    const int32x4_t right_shift = vminq_s32(vdupq_n_s32(-1), shift);
+    const int32x4_t left_shift = vqsubq_s32(shift, right_shift);
+
+    int32x4_t result = vqdmulhq_s32(vshlq_s32(val, left_shift), multiplier);
+    result = vrshlq_s32(result, right_shift);
+
+    return result;
+#else
+    const int32x4_t zz = vdupq_n_s32(0);
+    const int32x4_t left_shift = vmaxq_s32(shift, zz);
+    const int32x4_t right_shift = vminq_s32(shift, zz);
+
+    return arm_divide_by_power_of_two_neon_32x4(vqrdmulhq_s32(vshlq_s32(val, left_shift), multiplier), right_shift);
+#endif
+}
+
+/**
+ * @brief           Requantize a given vector.
+ * @param[in]       val         Vector to be requantized
+ * @param[in]       multiplier  multiplier
+ * @param[in]       shift       shift
+ *
+ * @return          Returns (val * multiplier)/(2 ^ shift), bit exact with arm_nn_requantize()
+ *
+ */
+__STATIC_FORCEINLINE int32x4_t arm_requantize_neon(const int32x4_t val, const q31_t multiplier, const q31_t shift)
+{
+    return arm_requantize_neon_32x4(val, vdupq_n_s32(multiplier), vdupq_n_s32(shift));
+}
+
+/**
+ * @brief           Add the output offset, clamp and store 4 s8 values.
+ * @param[out]      dst             Destination, 4 consecutive values are written
+ * @param[in]       val             Requantized values
+ * @param[in]       dst_offset      Offset added to the values
+ * @param[in]       activation_min  Minimum value to clamp the output to
+ * @param[in]       activation_max  Maximum value to clamp the output to
+ *
+ */
+__STATIC_FORCEINLINE void arm_nn_store_neon_s8x4(q7_t *dst,
+                                                 int32x4_t val,
+                                                 const int32_t dst_offset,
+                                                 const int32_t activation_min,
+                                                 const int32_t activation_max)
+{
+    val = vaddq_s32(val, vdupq_n_s32(dst_offset));
+    val = vmaxq_s32(val, vdupq_n_s32(activation_min));
+    val = vminq_s32(val, vdupq_n_s32(activation_max));
+
+    dst[0] = (q7_t)vgetq_lane_s32(val, 0);
+    dst[1] = (q7_t)vgetq_lane_s32(val, 1);
+    dst[2] = (q7_t)vgetq_lane_s32(val, 2);
+    dst[3] = (q7_t)vgetq_lane_s32(val, 3);
+}
+#endif
+
 // @note The following functions are used only for softmax layer, scaled bits = 5 assumed
 
 __STATIC_FORCEINLINE int32_t arm_nn_exp_on_negative_values(int32_t val)
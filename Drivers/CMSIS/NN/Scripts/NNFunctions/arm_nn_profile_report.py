@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2010-2022 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Per-layer profile of a CMSIS-NN inference.
+
+The dump is a raw little-endian image of the buffer given to
+arm_nn_profile_init(), for instance:
+
+  host:  fwrite(buf, arm_nn_profile_get_buffer_size(n), 1, f);
+  gdb:   dump binary memory prof.bin buf (buf + size)
+
+The report has one line per layer call, then one line per kernel with the
+MAC utilization. With --peak-macs (MACs per time unit of the core) and
+--peak-bytes (bytes per time unit of the memory holding the tensors and the
+weights), each kernel is placed on the roofline: its arithmetic intensity
+(MACs per byte of input, weights and output) gives the attainable rate,
+min(peak-macs, intensity * peak-bytes), and the efficiency is the achieved
+rate over the attainable one.
+
+--json writes the same data for diffing across library versions, and
+--compare prints the time of each layer relative to such a file. The bytes
+column counts each tensor once: comparing a graph before and after
+arm_nn_graph_fuse_s8() shows the traffic and time saved by the fused
+residual blocks.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+ARM_NN_PROFILE_MAGIC = 0x464E4E50
+HEADER = struct.Struct("<IIII")
+RECORD = struct.Struct("<iiIi4i4i4iQ")
+
+# arm_nn_profile_kernel: name, element size of the input and output in bytes, kind
+KERNELS = [
+    ("arm_convolve_s8", 1, "conv"),
+    ("arm_convolve_1x1_s8_fast", 1, "conv"),
+    ("arm_convolve_1_x_n_s8", 1, "conv"),
+    ("arm_convolve_s16", 2, "conv"),
+    ("arm_convolve_fast_s16", 2, "conv"),
+    ("arm_depthwise_conv_s8", 1, "depthwise"),
+    ("arm_depthwise_conv_s8_opt", 1, "depthwise"),
+    ("arm_depthwise_conv_3x3_s8", 1, "depthwise"),
+    ("arm_fully_connected_s8", 1, "fc"),
+    ("arm_fully_connected_s16", 2, "fc"),
+    ("arm_convolve_1x1_add_s8", 1, "conv_add"),
+    ("arm_elementwise_add_s8", 1, "add"),
+    ("arm_convolve_3x3_s8", 1, "conv"),
+]
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit("%s: truncated dump" % path)
+    magic, size, head, record_size = HEADER.unpack_from(data, 0)
+    if magic != ARM_NN_PROFILE_MAGIC:
+        sys.exit("%s: bad magic 0x%08X" % (path, magic))
+    if record_size != RECORD.size:
+        sys.exit("%s: record size %d, expected %d" % (path, record_size, RECORD.size))
+    if len(data) < HEADER.size + size * RECORD.size:
+        sys.exit("%s: truncated dump" % path)
+    count = min(head, size)
+    layers = []
+    for i in range(count):
+        index = (head - count + i) % size
+        r = RECORD.unpack_from(data, HEADER.size + index * RECORD.size)
+        layers.append({"kernel": r[0], "status": r[1], "time": r[2], "scratch": r[3],
+                       "input": list(r[4:8]), "filter": list(r[8:12]), "output": list(r[12:16]),
+                       "macs": r[16], "calls": 1})
+    return layers, head - count
+
+
+def kernel_info(kernel):
+    if 0 <= kernel < len(KERNELS):
+        return KERNELS[kernel]
+    return ("kernel%d" % kernel, 1, "conv")
+
+
+def traffic(layer):
+    """Bytes of input, weights and output of a layer call."""
+    _, esize, kind = kernel_info(layer["kernel"])
+    i, f, o = layer["input"], layer["filter"], layer["output"]
+    outputs = o[0] * o[1] * o[2] * o[3]
+    if kind == "add":
+        return 3 * outputs * esize
+    if kind == "fc":
+        return i[0] * f[0] * esize + f[0] * o[3] + outputs * esize
+    if kind == "depthwise":
+        weights = f[1] * f[2] * o[3]
+    else:
+        weights = f[0] * f[1] * f[2] * f[3]
+    if kind == "conv_add":
+        # the residual is read as well
+        outputs *= 2
+    return i[0] * i[1] * i[2] * i[3] * esize + weights + outputs * esize
+
+
+def fold(layers, num_layers):
+    """Average the calls of repeated inferences of num_layers layers."""
+    folded = []
+    for n, layer in enumerate(layers):
+        if n < num_layers:
+            folded.append(dict(layer))
+            continue
+        f = folded[n % num_layers]
+        if f["kernel"] != layer["kernel"] or f["output"] != layer["output"]:
+            sys.exit("call %d does not repeat layer %d: check --layers" % (n, n % num_layers))
+        f["time"] += layer["time"]
+        f["calls"] += 1
+    for f in folded:
+        f["time"] = f["time"] / f["calls"]
+    return folded
+
+
+def roofline(macs, time, nbytes, args):
+    rate = macs / time if time else 0.0
+    entry = {"macs_per_unit": rate, "intensity": macs / nbytes if nbytes else 0.0}
+    if args.peak_macs:
+        attainable = args.peak_macs
+        entry["bound"] = "compute"
+        if args.peak_bytes and entry["intensity"] * args.peak_bytes < attainable:
+            attainable = entry["intensity"] * args.peak_bytes
+            entry["bound"] = "memory"
+        entry["utilization"] = rate / args.peak_macs
+        entry["efficiency"] = rate / attainable if attainable else 0.0
+    return entry
+
+
+def shape(d):
+    return "x".join(str(v) for v in d)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="raw image of the arm_nn_profile_init() buffer")
+    parser.add_argument("--unit", default="cycles",
+                        help="unit of the timestamps (cycles on Cortex-M, ns on a host)")
+    parser.add_argument("--layers", type=int, default=0,
+                        help="number of layers of the model, to average repeated inferences")
+    parser.add_argument("--peak-macs", type=float, default=0.0,
+                        help="peak MACs per time unit, e.g. 2 for SMLAD on Cortex-M4/M7")
+    parser.add_argument("--peak-bytes", type=float, default=0.0,
+                        help="peak memory bandwidth in bytes per time unit")
+    parser.add_argument("--json", help="write the profile to this file")
+    parser.add_argument("--compare", help="profile written by --json to compare with")
+    args = parser.parse_args()
+
+    layers, lost = load(args.dump)
+    if args.layers > 0:
+        layers = fold(layers, args.layers)
+
+    total_time = sum(l["time"] for l in layers) or 1
+    for l in layers:
+        l["name"] = kernel_info(l["kernel"])[0]
+        l["bytes"] = traffic(l)
+        l.update(roofline(l["macs"], l["time"], l["bytes"], args))
+
+    print("%5s %-26s %-16s %-16s %-16s %8s %12s %6s %12s %10s %9s" % (
+        "layer", "kernel", "input", "filter", "output", "scratch", "time", "time%", "MACs",
+        "bytes", "MAC/unit"))
+    for n, l in enumerate(layers):
+        print("%5d %-26s %-16s %-16s %-16s %8d %12.0f %5.1f%% %12d %10d %9.3f%s" % (
+            n, l["name"], shape(l["input"]), shape(l["filter"]), shape(l["output"]), l["scratch"],
+            l["time"], 100.0 * l["time"] / total_time, l["macs"], l["bytes"], l["macs_per_unit"],
+            "" if l["status"] == 0 else "  status %d" % l["status"]))
+
+    kernels = {}
+    for l in layers:
+        k = kernels.setdefault(l["name"], {"layers": 0, "time": 0, "macs": 0, "bytes": 0})
+        k["layers"] += 1
+        k["time"] += l["time"]
+        k["macs"] += l["macs"]
+        k["bytes"] += l["bytes"]
+    total = {"layers": len(layers), "time": sum(l["time"] for l in layers),
+             "macs": sum(l["macs"] for l in layers), "bytes": sum(l["bytes"] for l in layers)}
+    for k in list(kernels.values()) + [total]:
+        k.update(roofline(k["macs"], k["time"], k["bytes"], args))
+
+    print("\n%-26s %6s %12s %6s %12s %9s %9s" % ("kernel", "layers", "time", "time%", "MACs",
+                                                "MAC/unit", "MAC/byte") +
+          (" %7s %7s %8s" % ("util", "eff", "bound") if args.peak_macs else ""))
+    rows = sorted(kernels.items(), key=lambda kv: kv[1]["time"], reverse=True) + [("total", total)]
+    for name, k in rows:
+        line = "%-26s %6d %12.0f %5.1f%% %12d %9.3f %9.2f" % (
+            name, k["layers"], k["time"], 100.0 * k["time"] / total_time, k["macs"],
+            k["macs_per_unit"], k["intensity"])
+        if args.peak_macs:
+            line += " %6.1f%% %6.1f%% %8s" % (100.0 * k["utilization"], 100.0 * k["efficiency"],
+                                              k["bound"])
+        print(line)
+
+    print("\ntime unit: %s" % args.unit)
+    if lost:
+        print("%d older calls overwritten by the ring" % lost)
+
+    if args.compare:
+        with open(args.compare, "r") as f:
+            old = json.load(f)["layers"]
+        print("\n%5s %-26s %12s %12s %8s" % ("layer", "kernel", "old time", "time", "ratio"))
+        if len(old) != len(layers):
+            print("(layers matched by position: totals only are comparable)")
+        for n, (o, l) in enumerate(zip(old, layers)):
+            print("%5d %-26s %12.0f %12.0f %8.3f%s" % (
+                n, l["name"], o["time"], l["time"], l["time"] / o["time"] if o["time"] else 0.0,
+                "" if o["name"] == l["name"] else "  (was %s)" % o["name"]))
+        old_time = sum(o["time"] for o in old)
+        print("%5s %-26s %12.0f %12.0f %8.3f" % ("", "total", old_time, total["time"],
+                                                 total["time"] / old_time if old_time else 0.0))
+        old_bytes = sum(o["bytes"] for o in old)
+        print("%5s %-26s %12d %12d %8.3f" % ("", "total bytes", old_bytes, total["bytes"],
+                                               total["bytes"] / old_bytes if old_bytes else 0.0))
+        if len(old) != len(layers):
+            print("layer count differs: %d before, %d now" % (len(old), len(layers)))
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"unit": args.unit, "peak_macs": args.peak_macs, "peak_bytes": args.peak_bytes,
+                       "layers": layers, "kernels": kernels, "total": total}, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -109,6 +109,57 @@ def convert_q7_q15_weights(weights):
         counter = counter + 4
     return new_weights
 
+def convert_to_packed_s8_weights(weights, bias, input_offset):
+    """Pack s8 weights for arm_fully_connected_packed_s8().
+
+    weights      : [rows, cols] s8 weights, one row per output channel
+    bias         : [rows] s32 bias, or None
+    input_offset : input offset of the layer, i.e. minus the input zero point
+
+    The rows are padded with zeros to a multiple of 4. Each block of 4 rows is
+    stored as 4 little endian s32 (bias + input_offset * sum of the row), then
+    for each group of 4 columns the 4 columns of each row, then the left over
+    columns of each row.
+    """
+    weights = np.asarray(weights, dtype=np.int64)
+    weights = np.reshape(weights, (weights.shape[0], -1))
+    [num_of_rows, num_of_cols] = weights.shape
+    padded_rows = -(-num_of_rows // 4) * 4
+    full_cols = num_of_cols - num_of_cols % 4
+
+    padded = np.zeros((padded_rows, num_of_cols), dtype=np.int64)
+    padded[:num_of_rows] = weights
+    folded_bias = np.zeros(padded_rows, dtype=np.int64)
+    if bias is not None:
+      folded_bias[:num_of_rows] = bias
+    folded_bias += input_offset * np.sum(padded, axis=1)
+    if np.any(folded_bias > np.iinfo(np.int32).max) or np.any(folded_bias < np.iinfo(np.int32).min):
+      raise ValueError("folded bias does not fit in 32 bits")
+
+    blocks = []
+    for row_base in range(0, padded_rows, 4):
+      rows = padded[row_base:row_base + 4]
+      blocks.append(folded_bias[row_base:row_base + 4].astype('<i4').view(np.int8))
+      blocks.append(rows[:, :full_cols].reshape(4, -1, 4).transpose(1, 0, 2).reshape(-1).astype(np.int8))
+      blocks.append(rows[:, full_cols:].reshape(-1).astype(np.int8))
+    return np.concatenate(blocks)
+
+def convert_to_packed_s4_weights(weights):
+    """Pack s4 weights for arm_fully_connected_s4(), arm_convolve_s4() and arm_depthwise_conv_s4().
+
+    weights : s8 weights in [-8, 7], in the layout of the s8 kernel of the layer
+
+    Weight i is stored in the low nibble of byte i // 2 when i is even, in the
+    high nibble when i is odd. The rows are not padded: an odd total is
+    completed with a zero nibble.
+    """
+    weights = np.asarray(weights, dtype=np.int64).reshape(-1)
+    if np.any(weights < -8) or np.any(weights > 7):
+      raise ValueError("weights out of the s4 range [-8, 7]")
+    nibbles = np.zeros(-(-weights.size // 2) * 2, dtype=np.uint8)
+    nibbles[:weights.size] = weights & 0xF
+    return (nibbles[0::2] | (nibbles[1::2] << 4)).view(np.int8)
+
 # input dimensions
 vec_dim = 127
 row_dim = 127
@@ -142,5 +193,15 @@ outfile.write("#define IP4_WEIGHT_Q15 {")
 new_weight.tofile(outfile,sep=",",format="%d")
 outfile.write("}\n\n")
 
+new_weight = convert_to_packed_s8_weights(weight, None, 0)
+outfile.write("#define IP_PACKED_S8_WEIGHT {")
+new_weight.tofile(outfile,sep=",",format="%d")
+outfile.write("}\n\n")
+
+new_weight = convert_to_packed_s4_weights(weight >> 4)
+outfile.write("#define IP_PACKED_S4_WEIGHT {")
+new_weight.tofile(outfile,sep=",",format="%d")
+outfile.write("}\n\n")
+
 
 outfile.close()
@@ -21,8 +21,8 @@
  * Title:        arm_elementwise_add_s8
  * Description:  Elementwise add
  *
- * $Date:        3 Februari 2022
- * $Revision:    V.2.6.0
+ * $Date:        18. October 2026
+ * $Revision:    V.2.7.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -66,6 +66,7 @@ arm_status arm_elementwise_add_s8(const int8_t *input_1_vect,
                                   const int32_t out_activation_max,
                                   const int32_t block_size)
 {
+    ARM_NN_PROFILE_START();
 #if defined(ARM_MATH_MVEI)
     int32_t count = block_size;
 
@@ -226,6 +227,12 @@ arm_status arm_elementwise_add_s8(const int8_t *input_1_vect,
 
 #endif /* ARM_MATH_MVEI */
 
+#if defined(ARM_NN_PROFILE)
+    const cmsis_nn_dims profile_dims = {1, 1, 1, block_size};
+    const cmsis_nn_dims profile_no_filter = {0, 0, 0, 0};
+#endif
+    ARM_NN_PROFILE_END(ARM_NN_PROFILE_ADD_S8, 0, &profile_dims, &profile_no_filter, &profile_dims, ARM_MATH_SUCCESS);
+
     return (ARM_MATH_SUCCESS);
 }
 
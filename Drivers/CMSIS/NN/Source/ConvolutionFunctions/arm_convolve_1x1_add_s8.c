@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_1x1_add_s8.c
+ * Description:  s8 1x1 convolution with a fused residual addition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M Processors
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 1x1 convolution with a fused residual addition
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_convolve_1x1_add_s8(const cmsis_nn_context *ctx,
+                                   const cmsis_nn_conv_params *conv_params,
+                                   const cmsis_nn_per_channel_quant_params *quant_params,
+                                   const cmsis_nn_add_params *add_params,
+                                   const cmsis_nn_dims *input_dims,
+                                   const q7_t *input_data,
+                                   const cmsis_nn_dims *filter_dims,
+                                   const q7_t *filter_data,
+                                   const cmsis_nn_dims *bias_dims,
+                                   const int32_t *bias_data,
+                                   const q7_t *residual_data,
+                                   const cmsis_nn_dims *output_dims,
+                                   q7_t *output_data)
+{
+    if (filter_dims->w != 1 || filter_dims->h != 1 || conv_params->padding.w != 0 || conv_params->padding.h != 0 ||
+        conv_params->stride.w != 1 || conv_params->stride.h != 1)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    (void)ctx;
+    (void)bias_dims;
+
+    return arm_nn_mat_mult_nt_t_add_s8(input_data,
+                                       filter_data,
+                                       bias_data,
+                                       residual_data,
+                                       output_data,
+                                       quant_params->multiplier,
+                                       quant_params->shift,
+                                       input_dims->n * input_dims->h * input_dims->w,
+                                       output_dims->c,
+                                       input_dims->c,
+                                       conv_params->input_offset,
+                                       conv_params->output_offset,
+                                       conv_params->activation.min,
+                                       conv_params->activation.max,
+                                       add_params);
+}
+
+/**
+ * @} end of NNConv group
+ */
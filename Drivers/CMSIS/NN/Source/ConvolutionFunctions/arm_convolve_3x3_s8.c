@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_3x3_s8.c
+ * Description:  s8 3x3 convolution with a row buffer instead of im2col
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+#define KERNEL_SIZE (3)
+
+static q7_t requantize_s8(const int32_t acc,
+                          const int32_t multiplier,
+                          const int32_t shift,
+                          const int32_t out_offset,
+                          const int32_t activation_min,
+                          const int32_t activation_max)
+{
+    int32_t out = arm_nn_requantize(acc, multiplier, shift) + out_offset;
+    out = MAX(out, activation_min);
+    out = MIN(out, activation_max);
+
+    return (q7_t)out;
+}
+
+/* Accumulate the dot products of two filter rows with two extended input rows, as in
+   arm_nn_mat_mult_kernel_s8_s16(). acc_0 holds the two output pixels of the channel of ker_0, acc_1 the
+   ones of ker_1. */
+static void dot_2x2_s8_s16(int32_t length,
+                           const q7_t *ker_0,
+                           const q7_t *ker_1,
+                           const q15_t *in_0,
+                           const q15_t *in_1,
+                           int32_t *acc_0,
+                           int32_t *acc_1)
+{
+    int32_t ch_0_out_0 = acc_0[0];
+    int32_t ch_0_out_1 = acc_0[1];
+    int32_t ch_1_out_0 = acc_1[0];
+    int32_t ch_1_out_1 = acc_1[1];
+
+#if defined(ARM_MATH_DSP)
+    for (; length >= 4; length -= 4)
+    {
+        q31_t a01, a02, a11, a12;
+        q31_t b0 = arm_nn_read_q15x2_ia(&in_0);
+        q31_t b1 = arm_nn_read_q15x2_ia(&in_1);
+
+        ker_0 = read_and_pad(ker_0, &a01, &a02);
+        ker_1 = read_and_pad(ker_1, &a11, &a12);
+
+        ch_0_out_0 = __SMLAD(a01, b0, ch_0_out_0);
+        ch_0_out_1 = __SMLAD(a01, b1, ch_0_out_1);
+        ch_1_out_0 = __SMLAD(a11, b0, ch_1_out_0);
+        ch_1_out_1 = __SMLAD(a11, b1, ch_1_out_1);
+
+        b0 = arm_nn_read_q15x2_ia(&in_0);
+        b1 = arm_nn_read_q15x2_ia(&in_1);
+
+        ch_0_out_0 = __SMLAD(a02, b0, ch_0_out_0);
+        ch_0_out_1 = __SMLAD(a02, b1, ch_0_out_1);
+        ch_1_out_0 = __SMLAD(a12, b0, ch_1_out_0);
+        ch_1_out_1 = __SMLAD(a12, b1, ch_1_out_1);
+    }
+#endif
+
+    for (; length > 0; length--)
+    {
+        const q7_t a0 = *ker_0++;
+        const q7_t a1 = *ker_1++;
+        const q15_t b0 = *in_0++;
+        const q15_t b1 = *in_1++;
+
+        ch_0_out_0 += a0 * b0;
+        ch_0_out_1 += a0 * b1;
+        ch_1_out_0 += a1 * b0;
+        ch_1_out_1 += a1 * b1;
+    }
+
+    acc_0[0] = ch_0_out_0;
+    acc_0[1] = ch_0_out_1;
+    acc_1[0] = ch_1_out_0;
+    acc_1[1] = ch_1_out_1;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 3x3 convolution with a row buffer
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_convolve_3x3_s8(const cmsis_nn_context *ctx,
+                               const cmsis_nn_conv_params *conv_params,
+                               const cmsis_nn_per_channel_quant_params *quant_params,
+                               const cmsis_nn_dims *input_dims,
+                               const q7_t *input_data,
+                               const cmsis_nn_dims *filter_dims,
+                               const q7_t *filter_data,
+                               const cmsis_nn_dims *bias_dims,
+                               const int32_t *bias_data,
+                               const cmsis_nn_dims *output_dims,
+                               q7_t *output_data)
+{
+    if (filter_dims->w != KERNEL_SIZE || filter_dims->h != KERNEL_SIZE || conv_params->dilation.w != 1 ||
+        conv_params->dilation.h != 1)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    if (ctx->buf == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    (void)bias_dims;
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+    const int32_t pad_x = conv_params->padding.w;
+    const int32_t pad_y = conv_params->padding.h;
+    const int32_t stride_x = conv_params->stride.w;
+    const int32_t stride_y = conv_params->stride.h;
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+    const int32_t filter_size = KERNEL_SIZE * KERNEL_SIZE * input_ch;
+
+    /* Accumulators of two output pixels, then the rows of 3 taps of the two pixels, extended with the input
+       offset */
+    int32_t *acc = (int32_t *)ctx->buf;
+    q15_t *row_0 = (q15_t *)(acc + 2 * output_ch);
+    q15_t *row_1 = row_0 + KERNEL_SIZE * input_ch;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        const q7_t *input = input_data + i_batch * input_x * input_y * input_ch;
+
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            const int32_t base_y = i_out_y * stride_y - pad_y;
+            const int32_t ker_y_start = MAX(0, -base_y);
+            const int32_t ker_y_end = MIN(KERNEL_SIZE, input_y - base_y);
+            int32_t i_out_x = 0;
+
+            while (i_out_x < output_x)
+            {
+                const int32_t base_x = i_out_x * stride_x - pad_x;
+                const int32_t ker_x_start = MAX(0, -base_x);
+                const int32_t ker_x_end = MIN(KERNEL_SIZE, input_x - base_x);
+                /* Padded taps add zero: only the taps inside the input are extended. Two output pixels sharing
+                   the same taps are computed together. */
+                const int32_t num_x =
+                    (i_out_x + 1 < output_x && MAX(0, -(base_x + stride_x)) == ker_x_start &&
+                     MIN(KERNEL_SIZE, input_x - base_x - stride_x) == ker_x_end)
+                    ? 2
+                    : 1;
+                const int32_t tap_length = MAX(0, ker_x_end - ker_x_start) * input_ch;
+                const q7_t *in_0 = input + (base_x + ker_x_start) * input_ch;
+                const q7_t *in_1 = in_0 + (num_x - 1) * stride_x * input_ch;
+                const q15_t *col_1 = (num_x == 2) ? row_1 : row_0;
+                q7_t *out_0 = output_data + (i_out_y * output_x + i_out_x) * output_ch;
+                q7_t *out_1 = out_0 + (num_x - 1) * output_ch;
+
+                for (int32_t i_out_ch = 0; i_out_ch < output_ch; i_out_ch++)
+                {
+                    acc[2 * i_out_ch] = acc[2 * i_out_ch + 1] = bias_data ? bias_data[i_out_ch] : 0;
+                }
+
+                /* Each row is extended once and used by all the output channels */
+                for (int32_t i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                {
+                    const int32_t in_row = (base_y + i_ker_y) * input_x * input_ch;
+                    const q7_t *ker = filter_data + (i_ker_y * KERNEL_SIZE + ker_x_start) * input_ch;
+                    int32_t i_out_ch = 0;
+
+                    arm_q7_to_q15_with_offset(in_0 + in_row, row_0, tap_length, (q15_t)input_offset);
+                    if (num_x == 2)
+                    {
+                        arm_q7_to_q15_with_offset(in_1 + in_row, row_1, tap_length, (q15_t)input_offset);
+                    }
+
+                    for (; i_out_ch <= output_ch - 2; i_out_ch += 2)
+                    {
+                        dot_2x2_s8_s16(tap_length,
+                                       ker + i_out_ch * filter_size,
+                                       ker + (i_out_ch + 1) * filter_size,
+                                       row_0,
+                                       col_1,
+                                       &acc[2 * i_out_ch],
+                                       &acc[2 * i_out_ch + 2]);
+                    }
+                    if (i_out_ch < output_ch)
+                    {
+                        /* Odd channel count: the last channel is computed twice, the copy is dropped */
+                        int32_t unused[2] = {0, 0};
+
+                        dot_2x2_s8_s16(tap_length,
+                                       ker + i_out_ch * filter_size,
+                                       ker + i_out_ch * filter_size,
+                                       row_0,
+                                       col_1,
+                                       &acc[2 * i_out_ch],
+                                       unused);
+                    }
+                }
+
+                for (int32_t i_out_ch = 0; i_out_ch < output_ch; i_out_ch++)
+                {
+                    out_0[i_out_ch] = requantize_s8(acc[2 * i_out_ch],
+                                                    output_mult[i_out_ch],
+                                                    output_shift[i_out_ch],
+                                                    out_offset,
+                                                    out_activation_min,
+                                                    out_activation_max);
+                    out_1[i_out_ch] = requantize_s8(acc[2 * i_out_ch + 1],
+                                                    output_mult[i_out_ch],
+                                                    output_shift[i_out_ch],
+                                                    out_offset,
+                                                    out_activation_min,
+                                                    out_activation_max);
+                }
+
+                i_out_x += num_x;
+            }
+        }
+
+        output_data += output_x * output_y * output_ch;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_convolve_3x3_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims)
+{
+    return 2 * filter_dims->n * (int32_t)sizeof(int32_t) + 2 * KERNEL_SIZE * input_dims->c * (int32_t)sizeof(q15_t);
+}
+
+/**
+ * @} end of NNConv group
+ */
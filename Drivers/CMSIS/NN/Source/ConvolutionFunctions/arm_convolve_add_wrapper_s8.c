@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_add_wrapper_s8.c
+ * Description:  s8 convolution followed by a residual addition, fused when possible
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
+ *
+ * Target Processor:  Cortex-M Processors
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * Convolution layer followed by a residual addition
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_convolve_add_wrapper_s8(const cmsis_nn_context *ctx,
+                                       const cmsis_nn_conv_params *conv_params,
+                                       const cmsis_nn_per_channel_quant_params *quant_params,
+                                       const cmsis_nn_add_params *add_params,
+                                       const cmsis_nn_dims *input_dims,
+                                       const q7_t *input_data,
+                                       const cmsis_nn_dims *filter_dims,
+                                       const q7_t *filter_data,
+                                       const cmsis_nn_dims *bias_dims,
+                                       const int32_t *bias_data,
+                                       const q7_t *residual_data,
+                                       const cmsis_nn_dims *output_dims,
+                                       q7_t *output_data)
+{
+    arm_status status;
+
+    if (arm_convolve_add_s8_is_fused(conv_params, filter_dims))
+    {
+        ARM_NN_PROFILE_START();
+        status = arm_convolve_1x1_add_s8(ctx,
+                                         conv_params,
+                                         quant_params,
+                                         add_params,
+                                         input_dims,
+                                         input_data,
+                                         filter_dims,
+                                         filter_data,
+                                         bias_dims,
+                                         bias_data,
+                                         residual_data,
+                                         output_dims,
+                                         output_data);
+        ARM_NN_PROFILE_END(ARM_NN_PROFILE_CONV_1X1_ADD_S8, 0, input_dims, filter_dims, output_dims, status);
+        return status;
+    }
+
+    /* Unfused sequence: the convolution result goes through output_data, then is added in place */
+    status = arm_convolve_wrapper_s8(ctx,
+                                     conv_params,
+                                     quant_params,
+                                     input_dims,
+                                     input_data,
+                                     filter_dims,
+                                     filter_data,
+                                     bias_dims,
+                                     bias_data,
+                                     output_dims,
+                                     output_data);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    return arm_elementwise_add_s8(output_data,
+                                  residual_data,
+                                  add_params->input_1_offset,
+                                  add_params->input_1_mult,
+                                  add_params->input_1_shift,
+                                  add_params->input_2_offset,
+                                  add_params->input_2_mult,
+                                  add_params->input_2_shift,
+                                  add_params->left_shift,
+                                  output_data,
+                                  add_params->output_offset,
+                                  add_params->output_mult,
+                                  add_params->output_shift,
+                                  add_params->activation.min,
+                                  add_params->activation.max,
+                                  output_dims->n * output_dims->h * output_dims->w * output_dims->c);
+}
+
+int32_t arm_convolve_add_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params *conv_params,
+                                                    const cmsis_nn_dims *input_dims,
+                                                    const cmsis_nn_dims *filter_dims,
+                                                    const cmsis_nn_dims *output_dims)
+{
+    if (arm_convolve_add_s8_is_fused(conv_params, filter_dims))
+    {
+        return 0;
+    }
+
+    return arm_convolve_wrapper_s8_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
+}
+
+int32_t arm_convolve_add_s8_is_fused(const cmsis_nn_conv_params *conv_params, const cmsis_nn_dims *filter_dims)
+{
+#if defined(ARM_NN_CONV_ADD_FUSED) && !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_NEON)
+    return (filter_dims->w == 1) && (filter_dims->h == 1) && (conv_params->padding.w == 0) &&
+        (conv_params->padding.h == 0) && (conv_params->stride.w == 1) && (conv_params->stride.h == 1);
+#else
+    /* The fused kernel is not faster than arm_convolve_wrapper_s8() then arm_elementwise_add_s8() */
+    (void)conv_params;
+    (void)filter_dims;
+    return 0;
+#endif
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_parallel_s8.c
+ * Description:  s8 convolution layer with the output rows split across workers
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M and Cortex-A cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+typedef struct
+{
+    const cmsis_nn_context *ctx;
+    const cmsis_nn_conv_params *conv_params;
+    const cmsis_nn_per_channel_quant_params *quant_params;
+    const cmsis_nn_dims *input_dims;
+    const q7_t *input_data;
+    const cmsis_nn_dims *filter_dims;
+    const q7_t *filter_data;
+    const cmsis_nn_dims *bias_dims;
+    const int32_t *bias_data;
+    const cmsis_nn_dims *output_dims;
+    q7_t *output_data;
+    int32_t rows_per_task;
+    arm_status status[CMSIS_NN_MAX_TASKS];
+} conv_task_args;
+
+/* Convolution of the output rows of one task, from the input rows they need */
+static void conv_task(void *args, int32_t task)
+{
+    conv_task_args *a = (conv_task_args *)args;
+    const cmsis_nn_conv_params *conv_params = a->conv_params;
+    const int32_t out_y_start = task * a->rows_per_task;
+    const int32_t out_y_end = MIN(out_y_start + a->rows_per_task, a->output_dims->h);
+    int32_t in_y_start = out_y_start * conv_params->stride.h - conv_params->padding.h;
+    const int32_t in_y_end = MIN((out_y_end - 1) * conv_params->stride.h - conv_params->padding.h +
+                                     (a->filter_dims->h - 1) * conv_params->dilation.h + 1,
+                                 a->input_dims->h);
+    cmsis_nn_conv_params task_params = *conv_params;
+    cmsis_nn_dims input_dims = *a->input_dims;
+    cmsis_nn_dims output_dims = *a->output_dims;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    /* Padding rows above the input remain padding, the rows below are clipped by the input height */
+    task_params.padding.h = MAX(-in_y_start, 0);
+    in_y_start = MAX(in_y_start, 0);
+    input_dims.n = 1;
+    input_dims.h = MAX(in_y_end - in_y_start, 0);
+    output_dims.n = 1;
+    output_dims.h = out_y_end - out_y_start;
+
+    for (int32_t batch = 0; batch < a->input_dims->n && status == ARM_MATH_SUCCESS; batch++)
+    {
+        const q7_t *input =
+            a->input_data + (batch * a->input_dims->h + in_y_start) * a->input_dims->w * a->input_dims->c;
+        q7_t *output =
+            a->output_data + (batch * a->output_dims->h + out_y_start) * a->output_dims->w * a->output_dims->c;
+
+        status = arm_convolve_wrapper_s8(&a->ctx[task],
+                                         &task_params,
+                                         a->quant_params,
+                                         &input_dims,
+                                         input,
+                                         a->filter_dims,
+                                         a->filter_data,
+                                         a->bias_dims,
+                                         a->bias_data,
+                                         &output_dims,
+                                         output);
+    }
+
+    a->status[task] = status;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 convolution layer split across several workers.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_convolve_parallel_s8(const cmsis_nn_parallel_context *parallel_ctx,
+                                    const cmsis_nn_conv_params *conv_params,
+                                    const cmsis_nn_per_channel_quant_params *quant_params,
+                                    const cmsis_nn_dims *input_dims,
+                                    const q7_t *input_data,
+                                    const cmsis_nn_dims *filter_dims,
+                                    const q7_t *filter_data,
+                                    const cmsis_nn_dims *bias_dims,
+                                    const int32_t *bias_data,
+                                    const cmsis_nn_dims *output_dims,
+                                    q7_t *output_data)
+{
+    conv_task_args args;
+    int32_t num_tasks = MIN(MIN(parallel_ctx->num_workers, CMSIS_NN_MAX_TASKS), output_dims->h);
+
+    if (num_tasks < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    args.ctx = parallel_ctx->ctx;
+    args.conv_params = conv_params;
+    args.quant_params = quant_params;
+    args.input_dims = input_dims;
+    args.input_data = input_data;
+    args.filter_dims = filter_dims;
+    args.filter_data = filter_data;
+    args.bias_dims = bias_dims;
+    args.bias_data = bias_data;
+    args.output_dims = output_dims;
+    args.output_data = output_data;
+    args.rows_per_task = (output_dims->h + num_tasks - 1) / num_tasks;
+    num_tasks = (output_dims->h + args.rows_per_task - 1) / args.rows_per_task;
+
+    parallel_ctx->parallel_for(parallel_ctx->scheduler, conv_task, &args, num_tasks);
+
+    for (int32_t i = 0; i < num_tasks; i++)
+    {
+        if (args.status[i] != ARM_MATH_SUCCESS)
+        {
+            return args.status[i];
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_convolve_parallel_s8_get_buffer_size(const cmsis_nn_conv_params *conv_params,
+                                                 const cmsis_nn_dims *input_dims,
+                                                 const cmsis_nn_dims *filter_dims,
+                                                 const cmsis_nn_dims *output_dims)
+{
+    /* A task may convolve a single batch with less padding: any kernel of the wrapper can be selected */
+    cmsis_nn_dims batch_input_dims = *input_dims;
+    int32_t size = arm_convolve_s8_get_buffer_size(input_dims, filter_dims);
+
+    batch_input_dims.n = 1;
+    size = MAX(size, arm_convolve_1_x_n_s8_get_buffer_size(input_dims, filter_dims));
+    size = MAX(size, arm_convolve_wrapper_s8_get_buffer_size(conv_params, &batch_input_dims, filter_dims, output_dims));
+
+    return size;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -21,10 +21,10 @@
  * Title:        arm_convolve_s8.c
  * Description:  s8 version of convolution using symmetric quantization.
  *
- * $Date:        December 14, 2021
- * $Revision:    V.2.1.0
+ * $Date:        October 18, 2026
+ * $Revision:    V.2.2.0
  *
- * Target Processor:  Cortex-M cores
+ * Target Processor:  Cortex-M cores, Cortex-A cores with Neon
  *
  * -------------------------------------------------------------------- */
 
@@ -189,6 +189,84 @@ arm_status arm_convolve_s8(const cmsis_nn_context *ctx,
                                      bias_data,
                                      out);
         }
+#elif defined(ARM_MATH_NEON)
+        /* Generate upto four rows of the s8 im2col matrix for a GEMM computation. Padding is filled with -input_offset
+           so that it contributes 0 */
+        q7_t *im2col_buf = (q7_t *)buffer_a;
+        q7_t *out = output_data;
+        int32_t buffer_fill_cnt = 0;
+        const int32_t num_elem = kernel_x * kernel_y * input_ch;
+        const int32_t dilation_x = conv_params->dilation.w;
+        const int32_t dilation_y = conv_params->dilation.h;
+
+        /* This part implements the im2col function */
+        for (int i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            for (int i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                const int32_t base_idx_x = stride_x * i_out_x - pad_x;
+                const int32_t base_idx_y = stride_y * i_out_y - pad_y;
+
+                for (int32_t i_ker_y = 0; i_ker_y < kernel_y; i_ker_y++)
+                {
+                    for (int32_t i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+                    {
+                        const int32_t k_y = base_idx_y + dilation_y * i_ker_y;
+                        const int32_t k_x = base_idx_x + dilation_x * i_ker_x;
+
+                        if (k_y < 0 || k_y >= input_y || k_x < 0 || k_x >= input_x)
+                        {
+                            memset(im2col_buf, (int8_t)-input_offset, sizeof(q7_t) * input_ch);
+                        }
+                        else
+                        {
+                            arm_memcpy_q7(im2col_buf, input_data + (k_y * input_x + k_x) * input_ch, input_ch);
+                        }
+                        im2col_buf += input_ch;
+                    }
+                }
+
+                buffer_fill_cnt++;
+
+                /* Computation is filed for every 4 rows */
+                if (buffer_fill_cnt == 4)
+                {
+                    arm_nn_mat_mult_nt_t_s8((q7_t *)buffer_a,
+                                            filter_data,
+                                            bias_data,
+                                            out,
+                                            output_mult,
+                                            output_shift,
+                                            buffer_fill_cnt,
+                                            output_ch,
+                                            num_elem,
+                                            input_offset,
+                                            out_offset,
+                                            out_activation_min,
+                                            out_activation_max);
+                    out += buffer_fill_cnt * output_ch;
+                    buffer_fill_cnt = 0;
+                    im2col_buf = (q7_t *)buffer_a;
+                }
+            }
+        }
+        /* Handle left over rows */
+        if (buffer_fill_cnt != 0)
+        {
+            arm_nn_mat_mult_nt_t_s8((q7_t *)buffer_a,
+                                    filter_data,
+                                    bias_data,
+                                    out,
+                                    output_mult,
+                                    output_shift,
+                                    buffer_fill_cnt,
+                                    output_ch,
+                                    num_elem,
+                                    input_offset,
+                                    out_offset,
+                                    out_activation_min,
+                                    out_activation_max);
+        }
 #else // #if defined(ARM_MATH_MVEI)
         const uint16_t dilation_x = conv_params->dilation.w;
         const uint16_t dilation_y = conv_params->dilation.h;
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_stream_s8.c
+ * Description:  s8 convolution layer with the filter streamed in double buffered tiles
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M and Cortex-A cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+#define ALIGN_4(x) (((x) + 3) & ~3)
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 convolution layer with the filter read through a weight stream.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_convolve_stream_s8(const cmsis_nn_context *ctx,
+                                  const cmsis_nn_weight_stream *stream,
+                                  const cmsis_nn_conv_params *conv_params,
+                                  const cmsis_nn_per_channel_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const cmsis_nn_dims *bias_dims,
+                                  const int32_t *bias_data,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data)
+{
+    const int32_t filter_row = filter_dims->h * filter_dims->w * input_dims->c;
+    const int32_t input_size = input_dims->h * input_dims->w * input_dims->c;
+    const int32_t output_pixels = output_dims->h * output_dims->w;
+    const int32_t output_ch = output_dims->c;
+    const int32_t tile_ch = stream->tile_ch;
+
+    if (ctx->buf == NULL || tile_ch < 1 || output_ch < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t num_tiles = (output_ch + tile_ch - 1) / tile_ch;
+    const int32_t tile_size = ALIGN_4(tile_ch * filter_row);
+    /* With more than one tile, the channels of a tile are computed apart then interleaved in the output */
+    const int32_t tile_output_size = (num_tiles > 1) ? ALIGN_4(output_pixels * tile_ch) : 0;
+    q7_t *tile_buf[2] = {(q7_t *)ctx->buf, (q7_t *)ctx->buf + tile_size};
+    q7_t *tile_output = tile_buf[1] + tile_size;
+    const cmsis_nn_context kernel_ctx = {tile_output + tile_output_size,
+                                         ctx->size - 2 * tile_size - tile_output_size};
+    cmsis_nn_dims tile_input_dims = *input_dims;
+    cmsis_nn_dims tile_filter_dims = *filter_dims;
+    cmsis_nn_dims tile_output_dims = *output_dims;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    tile_input_dims.n = 1;
+    tile_output_dims.n = 1;
+
+    stream->fetch(stream->stream, 0, tile_buf[0], MIN(tile_ch, output_ch) * filter_row);
+
+    for (int32_t tile = 0; tile < num_tiles; tile++)
+    {
+        const int32_t ch_start = tile * tile_ch;
+        const int32_t ch_count = MIN(tile_ch, output_ch - ch_start);
+        const cmsis_nn_per_channel_quant_params tile_quant_params = {quant_params->multiplier + ch_start,
+                                                                     quant_params->shift + ch_start};
+
+        stream->wait(stream->stream, tile);
+
+        /* The next tile is copied to the buffer of the previous one while this one is computed */
+        if (tile + 1 < num_tiles)
+        {
+            stream->fetch(stream->stream,
+                          tile + 1,
+                          tile_buf[(tile + 1) & 1],
+                          MIN(tile_ch, output_ch - ch_start - tile_ch) * filter_row);
+        }
+
+        tile_filter_dims.n = ch_count;
+        tile_output_dims.c = ch_count;
+
+        /* All the batches are computed while the tile is loaded */
+        for (int32_t batch = 0; batch < input_dims->n && status == ARM_MATH_SUCCESS; batch++)
+        {
+            q7_t *output = output_data + batch * output_pixels * output_ch;
+
+            status = arm_convolve_s8(&kernel_ctx,
+                                     conv_params,
+                                     &tile_quant_params,
+                                     &tile_input_dims,
+                                     input_data + batch * input_size,
+                                     &tile_filter_dims,
+                                     tile_buf[tile & 1],
+                                     bias_dims,
+                                     (bias_data == NULL) ? NULL : bias_data + ch_start,
+                                     &tile_output_dims,
+                                     (num_tiles > 1) ? tile_output : output);
+
+            if (num_tiles > 1)
+            {
+                for (int32_t i = 0; i < output_pixels; i++)
+                {
+                    arm_memcpy_q7(output + i * output_ch + ch_start, tile_output + i * ch_count, ch_count);
+                }
+            }
+        }
+
+        if (status != ARM_MATH_SUCCESS)
+        {
+            /* No copy may be left running into the buffer once the function has returned */
+            if (tile + 1 < num_tiles)
+            {
+                stream->wait(stream->stream, tile + 1);
+            }
+            break;
+        }
+    }
+
+    return status;
+}
+
+int32_t arm_convolve_stream_s8_get_buffer_size(const cmsis_nn_weight_stream *stream,
+                                               const cmsis_nn_dims *input_dims,
+                                               const cmsis_nn_dims *filter_dims,
+                                               const cmsis_nn_dims *output_dims)
+{
+    const int32_t tile_ch = stream->tile_ch;
+    int32_t size = 2 * ALIGN_4(tile_ch * filter_dims->h * filter_dims->w * input_dims->c);
+
+    if (output_dims->c > tile_ch)
+    {
+        size += ALIGN_4(output_dims->h * output_dims->w * tile_ch);
+    }
+
+    return size + arm_convolve_s8_get_buffer_size(input_dims, filter_dims);
+}
+
+/**
+ * @} end of NNConv group
+ */
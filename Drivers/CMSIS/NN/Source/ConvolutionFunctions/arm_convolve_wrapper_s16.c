@@ -22,14 +22,15 @@
  * Description:  s16 convolution layer wrapper function with the main purpose to call the optimal kernel available in
  * cmsis-nn to perform the convolution.
  *
- * $Date:        13 January 2022
- * $Revision:    V.1.2.0
+ * $Date:        18. October 2026
+ * $Revision:    V.1.3.0
  *
  * Target Processor:  Cortex-M cores
  *
  * -------------------------------------------------------------------- */
 
 #include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
 
 /**
  *  @ingroup groupNN
@@ -59,49 +60,52 @@ arm_status arm_convolve_wrapper_s16(const cmsis_nn_context *ctx,
                                     const cmsis_nn_dims *output_dims,
                                     q15_t *output_data)
 {
+    ARM_NN_PROFILE_START();
+    arm_status status;
+
 #if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
     if (filter_dims->w * filter_dims->h * input_dims->c < 512 &&
         (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
     {
-        return arm_convolve_fast_s16(ctx,
-                                     conv_params,
-                                     quant_params,
-                                     input_dims,
-                                     input_data,
-                                     filter_dims,
-                                     filter_data,
-                                     bias_dims,
-                                     bias_data,
-                                     output_dims,
-                                     output_data);
-    }
-    else
-    {
-        return arm_convolve_s16(ctx,
-                                conv_params,
-                                quant_params,
-                                input_dims,
-                                input_data,
-                                filter_dims,
-                                filter_data,
-                                bias_dims,
-                                bias_data,
-                                output_dims,
-                                output_data);
+        status = arm_convolve_fast_s16(ctx,
+                                       conv_params,
+                                       quant_params,
+                                       input_dims,
+                                       input_data,
+                                       filter_dims,
+                                       filter_data,
+                                       bias_dims,
+                                       bias_data,
+                                       output_dims,
+                                       output_data);
+        ARM_NN_PROFILE_END(ARM_NN_PROFILE_CONV_FAST_S16,
+                           arm_convolve_fast_s16_get_buffer_size(input_dims, filter_dims),
+                           input_dims,
+                           filter_dims,
+                           output_dims,
+                           status);
+        return status;
     }
-#else
-    return arm_convolve_s16(ctx,
-                            conv_params,
-                            quant_params,
-                            input_dims,
-                            input_data,
-                            filter_dims,
-                            filter_data,
-                            bias_dims,
-                            bias_data,
-                            output_dims,
-                            output_data);
 #endif
+    status = arm_convolve_s16(ctx,
+                              conv_params,
+                              quant_params,
+                              input_dims,
+                              input_data,
+                              filter_dims,
+                              filter_data,
+                              bias_dims,
+                              bias_data,
+                              output_dims,
+                              output_data);
+    ARM_NN_PROFILE_END(ARM_NN_PROFILE_CONV_S16,
+                       arm_convolve_s16_get_buffer_size(input_dims, filter_dims),
+                       input_dims,
+                       filter_dims,
+                       output_dims,
+                       status);
+
+    return status;
 }
 
 int32_t arm_convolve_wrapper_s16_get_buffer_size(const cmsis_nn_conv_params *conv_params,
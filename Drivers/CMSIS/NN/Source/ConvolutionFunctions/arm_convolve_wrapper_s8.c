@@ -22,14 +22,15 @@
  * Description:  s8 convolution layer wrapper function with the main purpose to call the optimal kernel available in
  * cmsis-nn to perform the convolution.
  *
- * $Date:        02. December 2021
- * $Revision:    V.1.1.0
+ * $Date:        18. October 2026
+ * $Revision:    V.1.3.0
  *
  * Target Processor:  Cortex-M cores
  *
  * -------------------------------------------------------------------- */
 
 #include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
 
 /**
  *  @ingroup groupNN
@@ -59,26 +60,36 @@ arm_status arm_convolve_wrapper_s8(const cmsis_nn_context *ctx,
                                    const cmsis_nn_dims *output_dims,
                                    q7_t *output_data)
 {
+    ARM_NN_PROFILE_START();
+    arm_status status;
+
     if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (input_dims->c % 4 == 0) &&
         (conv_params->stride.w == 1) && (conv_params->stride.h == 1) && (filter_dims->w == 1) &&
         (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
     {
-        return arm_convolve_1x1_s8_fast(ctx,
-                                        conv_params,
-                                        quant_params,
-                                        input_dims,
-                                        input_data,
-                                        filter_dims,
-                                        filter_data,
-                                        bias_dims,
-                                        bias_data,
-                                        output_dims,
-                                        output_data);
+        status = arm_convolve_1x1_s8_fast(ctx,
+                                          conv_params,
+                                          quant_params,
+                                          input_dims,
+                                          input_data,
+                                          filter_dims,
+                                          filter_data,
+                                          bias_dims,
+                                          bias_data,
+                                          output_dims,
+                                          output_data);
+        ARM_NN_PROFILE_END(ARM_NN_PROFILE_CONV_1X1_S8_FAST,
+                           arm_convolve_1x1_s8_fast_get_buffer_size(input_dims),
+                           input_dims,
+                           filter_dims,
+                           output_dims,
+                           status);
     }
-    else if ((output_dims->h == 1) && (input_dims->h == 1) && (filter_dims->h == 1) && (output_dims->w % 4 == 0) &&
-             (input_dims->n == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+#if defined(ARM_NN_CONV_DIRECT_3X3) && !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_NEON)
+    else if ((filter_dims->w == 3) && (filter_dims->h == 3) && (conv_params->stride.w == 1) &&
+             (conv_params->stride.h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
     {
-        return arm_convolve_1_x_n_s8(ctx,
+        status = arm_convolve_3x3_s8(ctx,
                                      conv_params,
                                      quant_params,
                                      input_dims,
@@ -89,21 +100,57 @@ arm_status arm_convolve_wrapper_s8(const cmsis_nn_context *ctx,
                                      bias_data,
                                      output_dims,
                                      output_data);
+        ARM_NN_PROFILE_END(ARM_NN_PROFILE_CONV_3X3_S8,
+                           arm_convolve_3x3_s8_get_buffer_size(input_dims, filter_dims),
+                           input_dims,
+                           filter_dims,
+                           output_dims,
+                           status);
+    }
+#endif
+    else if ((output_dims->h == 1) && (input_dims->h == 1) && (filter_dims->h == 1) && (output_dims->w % 4 == 0) &&
+             (input_dims->n == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    {
+        status = arm_convolve_1_x_n_s8(ctx,
+                                       conv_params,
+                                       quant_params,
+                                       input_dims,
+                                       input_data,
+                                       filter_dims,
+                                       filter_data,
+                                       bias_dims,
+                                       bias_data,
+                                       output_dims,
+                                       output_data);
+        ARM_NN_PROFILE_END(ARM_NN_PROFILE_CONV_1_X_N_S8,
+                           arm_convolve_1_x_n_s8_get_buffer_size(input_dims, filter_dims),
+                           input_dims,
+                           filter_dims,
+                           output_dims,
+                           status);
     }
     else
     {
-        return arm_convolve_s8(ctx,
-                               conv_params,
-                               quant_params,
-                               input_dims,
-                               input_data,
-                               filter_dims,
-                               filter_data,
-                               bias_dims,
-                               bias_data,
-                               output_dims,
-                               output_data);
+        status = arm_convolve_s8(ctx,
+                                 conv_params,
+                                 quant_params,
+                                 input_dims,
+                                 input_data,
+                                 filter_dims,
+                                 filter_data,
+                                 bias_dims,
+                                 bias_data,
+                                 output_dims,
+                                 output_data);
+        ARM_NN_PROFILE_END(ARM_NN_PROFILE_CONV_S8,
+                           arm_convolve_s8_get_buffer_size(input_dims, filter_dims),
+                           input_dims,
+                           filter_dims,
+                           output_dims,
+                           status);
     }
+
+    return status;
 }
 
 int32_t arm_convolve_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params *conv_params,
@@ -117,6 +164,13 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params *conv
     {
         return arm_convolve_1x1_s8_fast_get_buffer_size(input_dims);
     }
+#if defined(ARM_NN_CONV_DIRECT_3X3) && !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_NEON)
+    else if ((filter_dims->w == 3) && (filter_dims->h == 3) && (conv_params->stride.w == 1) &&
+             (conv_params->stride.h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
+    {
+        return arm_convolve_3x3_s8_get_buffer_size(input_dims, filter_dims);
+    }
+#endif
     else if ((output_dims->h == 1) && (input_dims->h == 1) && (filter_dims->h == 1) && (output_dims->w % 4 == 0) &&
              (input_dims->n == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
     {
@@ -22,8 +22,8 @@
  * Description:  Optimized s8 depthwise convolution function for channel
  *               multiplier of 1 and 3x3 kernel size.
  *
- * $Date:        09. October 2020
- * $Revision:    V.2.0.1
+ * $Date:        18. October 2026
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -80,6 +80,8 @@ arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
     const int32_t input_offset = dw_conv_params->input_offset;
     const int32_t output_activation_min = dw_conv_params->activation.min;
     const int32_t output_activation_max = dw_conv_params->activation.max;
+    /* Callers written for one image may leave N at 0 */
+    const int32_t batches = MAX(1, input_dims->n);
 
     /* Check input constraints input_ch == output_ch */
     if (input_ch != output_ch)
@@ -92,113 +94,123 @@ arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
         return ARM_MATH_ARGUMENT_ERROR;
     }
 
-    for (int32_t in_h = -pad_y, out_h = 0, out_idx = 0; out_h < output_y; in_h += stride_y, ++out_h)
+    for (int32_t i_batch = 0; i_batch < batches; i_batch++)
     {
-        for (int32_t in_w = -pad_x, out_w = 0, ker_h_start = MAX(0, -in_h); out_w < output_x; in_w += stride_x, ++out_w)
-        {
-            int32_t in_ch = 0;
-            int32_t ker_w_start = MAX(0, -in_w);
+        const int8_t *input_image = input + i_batch * input_y * input_x * input_ch;
+        int8_t *output_image = output + i_batch * output_y * output_x * output_ch;
 
-            for (; in_ch <= (input_ch - 4); in_ch += 4)
+        for (int32_t in_h = -pad_y, out_h = 0, out_idx = 0; out_h < output_y; in_h += stride_y, ++out_h)
+        {
+            for (int32_t in_w = -pad_x, out_w = 0, ker_h_start = MAX(0, -in_h); out_w < output_x;
+                 in_w += stride_x, ++out_w)
             {
-                int32_t out_buff0 = bias[in_ch + 0];
-                int32_t out_buff1 = bias[in_ch + 1];
-                int32_t out_buff2 = bias[in_ch + 2];
-                int32_t out_buff3 = bias[in_ch + 3];
-
-                const int8_t *input_ptr = input + (in_h + ker_h_start) * (input_ch * input_x) + in_w * input_ch + in_ch;
-                const int8_t *kernel_ptr = kernel + ker_h_start * (input_ch * 3) + in_ch;
+                int32_t in_ch = 0;
+                int32_t ker_w_start = MAX(0, -in_w);
 
-                for (int32_t ker_h = ker_h_start; ker_h < MIN(3, input_y - in_h); ++ker_h)
+                for (; in_ch <= (input_ch - 4); in_ch += 4)
                 {
-                    int32_t in_val = 0;
-                    int32_t ker_val = 0;
+                    int32_t out_buff0 = bias ? bias[in_ch + 0] : 0;
+                    int32_t out_buff1 = bias ? bias[in_ch + 1] : 0;
+                    int32_t out_buff2 = bias ? bias[in_ch + 2] : 0;
+                    int32_t out_buff3 = bias ? bias[in_ch + 3] : 0;
 
-                    if (ker_w_start == 0)
-                    {
-                        in_val = arm_nn_read_q7x4(input_ptr);
-                        ker_val = arm_nn_read_q7x4(kernel_ptr);
+                    const int8_t *input_ptr =
+                        input_image + (in_h + ker_h_start) * (input_ch * input_x) + in_w * input_ch + in_ch;
+                    const int8_t *kernel_ptr = kernel + ker_h_start * (input_ch * 3) + in_ch;
 
-                        out_buff0 += ((int8_t)in_val + input_offset) * (int8_t)ker_val;
-                        out_buff1 += ((int8_t)(in_val >> 8) + input_offset) * (int8_t)(ker_val >> 8);
-                        out_buff2 += ((int8_t)(in_val >> 16) + input_offset) * (int8_t)(ker_val >> 16);
-                        out_buff3 += ((int8_t)(in_val >> 24) + input_offset) * (int8_t)(ker_val >> 24);
-                    }
+                    for (int32_t ker_h = ker_h_start; ker_h < MIN(3, input_y - in_h); ++ker_h)
+                    {
+                        int32_t in_val = 0;
+                        int32_t ker_val = 0;
 
-                    in_val = arm_nn_read_q7x4(input_ptr + input_ch);
-                    ker_val = arm_nn_read_q7x4(kernel_ptr + input_ch);
+                        if (ker_w_start == 0)
+                        {
+                            in_val = arm_nn_read_q7x4(input_ptr);
+                            ker_val = arm_nn_read_q7x4(kernel_ptr);
 
-                    out_buff0 += ((int8_t)in_val + input_offset) * (int8_t)ker_val;
-                    out_buff1 += ((int8_t)(in_val >> 8) + input_offset) * (int8_t)(ker_val >> 8);
-                    out_buff2 += ((int8_t)(in_val >> 16) + input_offset) * (int8_t)(ker_val >> 16);
-                    out_buff3 += ((int8_t)(in_val >> 24) + input_offset) * (int8_t)(ker_val >> 24);
+                            out_buff0 += ((int8_t)in_val + input_offset) * (int8_t)ker_val;
+                            out_buff1 += ((int8_t)(in_val >> 8) + input_offset) * (int8_t)(ker_val >> 8);
+                            out_buff2 += ((int8_t)(in_val >> 16) + input_offset) * (int8_t)(ker_val >> 16);
+                            out_buff3 += ((int8_t)(in_val >> 24) + input_offset) * (int8_t)(ker_val >> 24);
+                        }
 
-                    if ((input_x - in_w) >= 3)
-                    {
-                        in_val = arm_nn_read_q7x4(input_ptr + (input_ch << 1));
-                        ker_val = arm_nn_read_q7x4(kernel_ptr + (input_ch << 1));
+                        in_val = arm_nn_read_q7x4(input_ptr + input_ch);
+                        ker_val = arm_nn_read_q7x4(kernel_ptr + input_ch);
 
                         out_buff0 += ((int8_t)in_val + input_offset) * (int8_t)ker_val;
                         out_buff1 += ((int8_t)(in_val >> 8) + input_offset) * (int8_t)(ker_val >> 8);
                         out_buff2 += ((int8_t)(in_val >> 16) + input_offset) * (int8_t)(ker_val >> 16);
                         out_buff3 += ((int8_t)(in_val >> 24) + input_offset) * (int8_t)(ker_val >> 24);
-                    }
 
-                    input_ptr += (input_ch * input_x);
-                    kernel_ptr += (input_ch * 3);
-                }
+                        if ((input_x - in_w) >= 3)
+                        {
+                            in_val = arm_nn_read_q7x4(input_ptr + (input_ch << 1));
+                            ker_val = arm_nn_read_q7x4(kernel_ptr + (input_ch << 1));
 
-                out_buff0 = arm_nn_requantize(out_buff0, output_mult[in_ch + 0], output_shift[in_ch + 0]);
-                out_buff1 = arm_nn_requantize(out_buff1, output_mult[in_ch + 1], output_shift[in_ch + 1]);
-                out_buff2 = arm_nn_requantize(out_buff2, output_mult[in_ch + 2], output_shift[in_ch + 2]);
-                out_buff3 = arm_nn_requantize(out_buff3, output_mult[in_ch + 3], output_shift[in_ch + 3]);
-
-                out_buff0 += output_offset;
-                out_buff1 += output_offset;
-                out_buff2 += output_offset;
-                out_buff3 += output_offset;
-
-                out_buff0 = MIN(MAX(out_buff0, output_activation_min), output_activation_max);
-                out_buff1 = MIN(MAX(out_buff1, output_activation_min), output_activation_max);
-                out_buff2 = MIN(MAX(out_buff2, output_activation_min), output_activation_max);
-                out_buff3 = MIN(MAX(out_buff3, output_activation_min), output_activation_max);
-
-                output[out_idx++] = (int8_t)out_buff0;
-                output[out_idx++] = (int8_t)out_buff1;
-                output[out_idx++] = (int8_t)out_buff2;
-                output[out_idx++] = (int8_t)out_buff3;
-            }
+                            out_buff0 += ((int8_t)in_val + input_offset) * (int8_t)ker_val;
+                            out_buff1 += ((int8_t)(in_val >> 8) + input_offset) * (int8_t)(ker_val >> 8);
+                            out_buff2 += ((int8_t)(in_val >> 16) + input_offset) * (int8_t)(ker_val >> 16);
+                            out_buff3 += ((int8_t)(in_val >> 24) + input_offset) * (int8_t)(ker_val >> 24);
+                        }
 
-            // Leftover
-            for (; in_ch < input_ch; ++in_ch)
-            {
-                int32_t out_buff = bias[in_ch];
+                        input_ptr += (input_ch * input_x);
+                        kernel_ptr += (input_ch * 3);
+                    }
 
-                const int8_t *input_ptr = input + (in_h + ker_h_start) * (input_ch * input_x) + in_w * input_ch + in_ch;
-                const int8_t *kernel_ptr = kernel + ker_h_start * (input_ch * 3) + in_ch;
+                    out_buff0 = arm_nn_requantize(out_buff0, output_mult[in_ch + 0], output_shift[in_ch + 0]);
+                    out_buff1 = arm_nn_requantize(out_buff1, output_mult[in_ch + 1], output_shift[in_ch + 1]);
+                    out_buff2 = arm_nn_requantize(out_buff2, output_mult[in_ch + 2], output_shift[in_ch + 2]);
+                    out_buff3 = arm_nn_requantize(out_buff3, output_mult[in_ch + 3], output_shift[in_ch + 3]);
+
+                    out_buff0 += output_offset;
+                    out_buff1 += output_offset;
+                    out_buff2 += output_offset;
+                    out_buff3 += output_offset;
+
+                    out_buff0 = MIN(MAX(out_buff0, output_activation_min), output_activation_max);
+                    out_buff1 = MIN(MAX(out_buff1, output_activation_min), output_activation_max);
+                    out_buff2 = MIN(MAX(out_buff2, output_activation_min), output_activation_max);
+                    out_buff3 = MIN(MAX(out_buff3, output_activation_min), output_activation_max);
+
+                    output_image[out_idx++] = (int8_t)out_buff0;
+                    output_image[out_idx++] = (int8_t)out_buff1;
+                    output_image[out_idx++] = (int8_t)out_buff2;
+                    output_image[out_idx++] = (int8_t)out_buff3;
+                }
 
-                for (int32_t ker_h = ker_h_start; ker_h < MIN(3, input_y - in_h); ++ker_h)
+                // Leftover
+                for (; in_ch < input_ch; ++in_ch)
                 {
-                    if (ker_w_start == 0)
-                    {
-                        out_buff += (*(input_ptr) + input_offset) * *(kernel_ptr);
-                    }
+                    int32_t out_buff = bias ? bias[in_ch] : 0;
 
-                    out_buff += (*(input_ptr + input_ch) + input_offset) * *(kernel_ptr + input_ch);
+                    const int8_t *input_ptr =
+                        input_image + (in_h + ker_h_start) * (input_ch * input_x) + in_w * input_ch + in_ch;
+                    const int8_t *kernel_ptr = kernel + ker_h_start * (input_ch * 3) + in_ch;
 
-                    if ((input_x - in_w) >= 3)
+                    for (int32_t ker_h = ker_h_start; ker_h < MIN(3, input_y - in_h); ++ker_h)
                     {
-                        out_buff += (*(input_ptr + (input_ch << 1)) + input_offset) * *(kernel_ptr + (input_ch << 1));
+                        if (ker_w_start == 0)
+                        {
+                            out_buff += (*(input_ptr) + input_offset) * *(kernel_ptr);
+                        }
+
+                        out_buff += (*(input_ptr + input_ch) + input_offset) * *(kernel_ptr + input_ch);
+
+                        if ((input_x - in_w) >= 3)
+                        {
+                            out_buff +=
+                                (*(input_ptr + (input_ch << 1)) + input_offset) * *(kernel_ptr + (input_ch << 1));
+                        }
+
+                        input_ptr += (input_ch * input_x);
+                        kernel_ptr += (input_ch * 3);
                     }
 
-                    input_ptr += (input_ch * input_x);
-                    kernel_ptr += (input_ch * 3);
+                    out_buff = arm_nn_requantize(out_buff, output_mult[in_ch], output_shift[in_ch]);
+                    out_buff += output_offset;
+                    out_buff = MIN(MAX(out_buff, output_activation_min), output_activation_max);
+                    output_image[out_idx++] = (int8_t)out_buff;
                 }
-
-                out_buff = arm_nn_requantize(out_buff, output_mult[in_ch], output_shift[in_ch]);
-                out_buff += output_offset;
-                out_buff = MIN(MAX(out_buff, output_activation_min), output_activation_max);
-                output[out_idx++] = (int8_t)out_buff;
             }
         }
     }
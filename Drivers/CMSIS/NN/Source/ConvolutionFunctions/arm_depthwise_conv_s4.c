@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_s4.c
+ * Description:  s8 version of depthwise convolution with packed s4 weights.
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M CPUs
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/* Weight of the given index in packed s4 weights, low nibble first */
+static inline int32_t s4_weight(const q7_t *kernel, const int32_t index)
+{
+    const q7_t packed = kernel[index >> 1];
+
+    return (index & 1) ? (packed >> 4) : ((q7_t)((uint8_t)packed << 4) >> 4);
+}
+
+static q7_t requantize_s8(int32_t acc,
+                          const int32_t multiplier,
+                          const int32_t shift,
+                          const int32_t output_offset,
+                          const int32_t activation_min,
+                          const int32_t activation_max)
+{
+    acc = arm_nn_requantize(acc, multiplier, shift);
+    acc += output_offset;
+    acc = MAX(acc, activation_min);
+    acc = MIN(acc, activation_max);
+
+    return (q7_t)acc;
+}
+
+/*
+ *  s8 depthwise convolution function with packed s4 weights.
+ *
+ *  Refer header file for details.
+ *
+ */
+arm_status arm_depthwise_conv_s4(const cmsis_nn_context *ctx,
+                                 const cmsis_nn_dw_conv_params *dw_conv_params,
+                                 const cmsis_nn_per_channel_quant_params *quant_params,
+                                 const cmsis_nn_dims *input_dims,
+                                 const q7_t *input,
+                                 const cmsis_nn_dims *filter_dims,
+                                 const q7_t *kernel,
+                                 const cmsis_nn_dims *bias_dims,
+                                 const int32_t *bias,
+                                 const cmsis_nn_dims *output_dims,
+                                 q7_t *output)
+{
+    (void)bias_dims;
+    (void)ctx;
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+    const int32_t ch_mult = dw_conv_params->ch_mult;
+
+    const int32_t pad_x = dw_conv_params->padding.w;
+    const int32_t pad_y = dw_conv_params->padding.h;
+    const int32_t stride_x = dw_conv_params->stride.w;
+    const int32_t stride_y = dw_conv_params->stride.h;
+    const int32_t dilation_x = dw_conv_params->dilation.w;
+    const int32_t dilation_y = dw_conv_params->dilation.h;
+
+    const int32_t input_offset = dw_conv_params->input_offset;
+    const int32_t output_offset = dw_conv_params->output_offset;
+    const int32_t act_min = dw_conv_params->activation.min;
+    const int32_t act_max = dw_conv_params->activation.max;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            const int32_t base_idx_y = (i_out_y * stride_y) - pad_y;
+            const int32_t ker_y_start = MAX(0, (-base_idx_y + dilation_y - 1) / dilation_y);
+            const int32_t ker_y_end = MIN(kernel_y, (input_y - base_idx_y + dilation_y - 1) / dilation_y);
+
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                const int32_t base_idx_x = (i_out_x * stride_x) - pad_x;
+                const int32_t ker_x_start = MAX(0, (-base_idx_x + dilation_x - 1) / dilation_x);
+                const int32_t ker_x_end = MIN(kernel_x, (input_x - base_idx_x + dilation_x - 1) / dilation_x);
+                int32_t i_out_ch = 0;
+
+                /* Two output channels at a time: with an even number of channels, both weights are in one byte */
+                for (; i_out_ch <= output_ch - 2; i_out_ch += 2)
+                {
+                    const int32_t i_in_ch_0 = i_out_ch / ch_mult;
+                    const int32_t i_in_ch_1 = (i_out_ch + 1) / ch_mult;
+                    int32_t acc_0 = 0;
+                    int32_t acc_1 = 0;
+
+                    if (bias)
+                    {
+                        acc_0 = bias[i_out_ch];
+                        acc_1 = bias[i_out_ch + 1];
+                    }
+
+                    for (int32_t i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                    {
+                        const int32_t idx_y = base_idx_y + dilation_y * i_ker_y;
+                        for (int32_t i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++)
+                        {
+                            const int32_t idx_x = base_idx_x + dilation_x * i_ker_x;
+                            const q7_t *in = input + (idx_y * input_x + idx_x) * input_ch;
+                            const int32_t ker_idx = (i_ker_y * kernel_x + i_ker_x) * output_ch + i_out_ch;
+
+                            acc_0 += (in[i_in_ch_0] + input_offset) * s4_weight(kernel, ker_idx);
+                            acc_1 += (in[i_in_ch_1] + input_offset) * s4_weight(kernel, ker_idx + 1);
+                        }
+                    }
+
+                    *output++ = requantize_s8(
+                        acc_0, output_mult[i_out_ch], output_shift[i_out_ch], output_offset, act_min, act_max);
+                    *output++ = requantize_s8(
+                        acc_1, output_mult[i_out_ch + 1], output_shift[i_out_ch + 1], output_offset, act_min, act_max);
+                }
+
+                if (i_out_ch < output_ch)
+                {
+                    const int32_t i_in_ch = i_out_ch / ch_mult;
+                    int32_t acc = bias ? bias[i_out_ch] : 0;
+
+                    for (int32_t i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                    {
+                        const int32_t idx_y = base_idx_y + dilation_y * i_ker_y;
+                        for (int32_t i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++)
+                        {
+                            const int32_t idx_x = base_idx_x + dilation_x * i_ker_x;
+                            const int32_t ker_idx = (i_ker_y * kernel_x + i_ker_x) * output_ch + i_out_ch;
+
+                            acc += (input[(idx_y * input_x + idx_x) * input_ch + i_in_ch] + input_offset) *
+                                s4_weight(kernel, ker_idx);
+                        }
+                    }
+
+                    *output++ = requantize_s8(
+                        acc, output_mult[i_out_ch], output_shift[i_out_ch], output_offset, act_min, act_max);
+                }
+            }
+        }
+
+        /* Advance to the next batch */
+        input += (input_x * input_y * input_ch);
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
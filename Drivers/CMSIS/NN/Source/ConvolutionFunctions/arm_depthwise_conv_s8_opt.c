@@ -22,16 +22,260 @@
  * Description:  Optimized s8 depthwise separable convolution function for
  *               channel multiplier of 1.
  *
- * $Date:        January 26, 2021
- * $Revision:    V.2.0.3
+ * $Date:        October 18, 2026
+ * $Revision:    V.2.2.0
  *
- * Target Processor:  Cortex-M CPUs
+ * Target Processor:  Cortex-M CPUs, Cortex-A CPUs with Neon
  *
  * -------------------------------------------------------------------- */
 
 #include "arm_nnfunctions.h"
 #include "arm_nnsupportfunctions.h"
 
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_NEON)
+/* Dimensions and quantization of the DSP path */
+typedef struct
+{
+    int32_t input_x;
+    int32_t input_y;
+    int32_t input_ch;
+    int32_t kernel_x;
+    int32_t kernel_y;
+    int32_t pad_x;
+    int32_t pad_y;
+    int32_t stride_x;
+    int32_t stride_y;
+    int32_t output_x;
+    int32_t output_y;
+    int32_t input_offset;
+    int32_t output_offset;
+    int32_t output_activation_min;
+    int32_t output_activation_max;
+} dw_dsp_params;
+
+/* Columns of the window of one output, widened to q15 with the input offset. Padding is 0. */
+static void dw_im2col_q15(
+    const dw_dsp_params *p, const q7_t *input, q15_t *col_buffer, const int32_t base_idx_x, const int32_t base_idx_y)
+{
+    const int32_t input_ch = p->input_ch;
+    const int32_t kernel_x = p->kernel_x;
+
+    /* Out of bounds is only considered for the y axis as it provides a contiguous zero'ing opportunity than
+       along the x axis */
+    const int ker_y_start = MAX(0, -base_idx_y);
+    /* Condition for kernel end dimension: (base_idx_y + ker_y_end) < input_y */
+    const int ker_y_end = MIN(p->kernel_y, p->input_y - base_idx_y);
+
+    int32_t index = 0;
+    if (ker_y_start != 0)
+    {
+        memset(&col_buffer[index], 0, (kernel_x * input_ch) * ker_y_start * sizeof(q15_t));
+        index += (kernel_x * input_ch) * ker_y_start;
+    }
+
+    for (int i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+    {
+        const int32_t idx_y = base_idx_y + i_ker_y;
+
+        for (int i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+        {
+            const int32_t idx_x = base_idx_x + i_ker_x;
+            if (idx_x < 0 || idx_x >= p->input_x)
+            {
+                memset(&col_buffer[index], 0, input_ch * sizeof(q15_t));
+            }
+            else
+            {
+                arm_q7_to_q15_with_offset(
+                    input + (idx_y * p->input_x + idx_x) * input_ch, &col_buffer[index], input_ch, p->input_offset);
+            }
+            index += input_ch;
+        }
+    }
+
+    const int diff = p->kernel_y - ker_y_end;
+    if (diff != 0)
+    {
+        memset(&col_buffer[index], 0, (kernel_x * input_ch) * diff * sizeof(q15_t));
+    }
+}
+
+static q7_t dw_requantize(const dw_dsp_params *p, int32_t sum, const int32_t mult, const int32_t shift)
+{
+    sum = arm_nn_requantize(sum, mult, shift);
+    sum += p->output_offset;
+    sum = MAX(sum, p->output_activation_min);
+    sum = MIN(sum, p->output_activation_max);
+
+    return (q7_t)sum;
+}
+
+/*
+ * Depthwise convolution of one image, or of two images when input_2 is not NULL. The four channels of a
+ * group are unpacked once for both images, whose columns are next to each other in col_buffer.
+ */
+static void dw_conv_dsp_s8(const dw_dsp_params *p,
+                           const q7_t *input,
+                           const q7_t *input_2,
+                           const q7_t *kernel,
+                           const int32_t *bias,
+                           const int32_t *output_mult,
+                           const int32_t *output_shift,
+                           q15_t *col_buffer,
+                           q7_t *output,
+                           q7_t *output_2)
+{
+    const int32_t input_ch = p->input_ch;
+    const int32_t kernel_size = p->kernel_x * p->kernel_y;
+    q15_t *const col_buffer_2 = col_buffer + kernel_size * input_ch;
+
+    for (int i_out_y = 0; i_out_y < p->output_y; i_out_y++)
+    {
+        const int16_t base_idx_y = (i_out_y * p->stride_y) - p->pad_y;
+        for (int i_out_x = 0; i_out_x < p->output_x; i_out_x++)
+        {
+            const int16_t base_idx_x = (i_out_x * p->stride_x) - p->pad_x;
+            int32_t row_shift = 0;
+
+            dw_im2col_q15(p, input, col_buffer, base_idx_x, base_idx_y);
+            if (input_2 != NULL)
+            {
+                dw_im2col_q15(p, input_2, col_buffer_2, base_idx_x, base_idx_y);
+            }
+
+            for (int32_t row_count = input_ch / 4; row_count > 0; row_count--)
+            {
+                q31_t sum = 0;
+                q31_t sum_2 = 0;
+                q31_t sum_3 = 0;
+                q31_t sum_4 = 0;
+
+                if (bias)
+                {
+                    sum = bias[row_shift];
+                    sum_2 = bias[row_shift + 1];
+                    sum_3 = bias[row_shift + 2];
+                    sum_4 = bias[row_shift + 3];
+                }
+
+                q31_t sum_b = sum;
+                q31_t sum_b_2 = sum_2;
+                q31_t sum_b_3 = sum_3;
+                q31_t sum_b_4 = sum_4;
+
+                uint16_t col_count = kernel_size / 2;
+                const q15_t *col_pos = col_buffer + row_shift;
+                const q15_t *col_pos_2 = col_buffer_2 + row_shift;
+                const q7_t *row_pos = kernel + row_shift;
+
+                while (col_count)
+                {
+                    /* General idea is to read 4 + 4 (input, kernel) pair and re-arrange them in the right order to
+                    use in a SMLAD instruction . One run of this loop produces 4 partial outputs with 8 MACs. */
+                    q31_t ip_a1, ip_a2, ip_b1, ip_b2, op_a, op_b;
+                    /* Read 4 weights */
+                    ip_b1 = arm_nn_read_q7x4(row_pos);
+                    ip_a1 = arm_nn_read_q7x4(row_pos + input_ch);
+
+                    ip_a2 = __SXTB16(ip_b1);
+                    ip_b1 = __SXTB16(__ROR(ip_b1, 8));
+
+                    ip_b2 = __SXTB16(ip_a1);
+                    ip_a1 = __SXTB16(__ROR(ip_a1, 8));
+
+                    /* Weights of the two kernel positions for each of the 4 channels */
+                    const q31_t ker_0 = __PKHBT(ip_b2, ip_a2, 16);
+                    const q31_t ker_1 = __PKHBT(ip_b1, ip_a1, 16);
+                    const q31_t ker_2 = __PKHTB(ip_a2, ip_b2, 16);
+                    const q31_t ker_3 = __PKHTB(ip_a1, ip_b1, 16);
+
+                    op_a = arm_nn_read_q15x2(col_pos);
+                    op_b = arm_nn_read_q15x2(col_pos + input_ch);
+                    sum = __SMLAD(__PKHBT(op_b, op_a, 16), ker_0, sum);
+                    sum_2 = __SMLAD(__PKHTB(op_b, op_a, 16), ker_1, sum_2);
+
+                    op_a = arm_nn_read_q15x2(col_pos + 2);
+                    op_b = arm_nn_read_q15x2(col_pos + input_ch + 2);
+                    sum_3 = __SMLAD(__PKHBT(op_b, op_a, 16), ker_2, sum_3);
+                    sum_4 = __SMLAD(__PKHTB(op_b, op_a, 16), ker_3, sum_4);
+
+                    if (input_2 != NULL)
+                    {
+                        op_a = arm_nn_read_q15x2(col_pos_2);
+                        op_b = arm_nn_read_q15x2(col_pos_2 + input_ch);
+                        sum_b = __SMLAD(__PKHBT(op_b, op_a, 16), ker_0, sum_b);
+                        sum_b_2 = __SMLAD(__PKHTB(op_b, op_a, 16), ker_1, sum_b_2);
+
+                        op_a = arm_nn_read_q15x2(col_pos_2 + 2);
+                        op_b = arm_nn_read_q15x2(col_pos_2 + input_ch + 2);
+                        sum_b_3 = __SMLAD(__PKHBT(op_b, op_a, 16), ker_2, sum_b_3);
+                        sum_b_4 = __SMLAD(__PKHTB(op_b, op_a, 16), ker_3, sum_b_4);
+                    }
+
+                    row_pos += input_ch << 1;
+                    col_pos += input_ch << 1;
+                    col_pos_2 += input_ch << 1;
+                    col_count--;
+                }
+
+                if (kernel_size & 0x1)
+                {
+                    sum += row_pos[0] * col_pos[0];
+                    sum_2 += row_pos[1] * col_pos[1];
+                    sum_3 += row_pos[2] * col_pos[2];
+                    sum_4 += row_pos[3] * col_pos[3];
+                    if (input_2 != NULL)
+                    {
+                        sum_b += row_pos[0] * col_pos_2[0];
+                        sum_b_2 += row_pos[1] * col_pos_2[1];
+                        sum_b_3 += row_pos[2] * col_pos_2[2];
+                        sum_b_4 += row_pos[3] * col_pos_2[3];
+                    }
+                }
+
+                *output++ = dw_requantize(p, sum, output_mult[row_shift], output_shift[row_shift]);
+                *output++ = dw_requantize(p, sum_2, output_mult[row_shift + 1], output_shift[row_shift + 1]);
+                *output++ = dw_requantize(p, sum_3, output_mult[row_shift + 2], output_shift[row_shift + 2]);
+                *output++ = dw_requantize(p, sum_4, output_mult[row_shift + 3], output_shift[row_shift + 3]);
+                if (input_2 != NULL)
+                {
+                    *output_2++ = dw_requantize(p, sum_b, output_mult[row_shift], output_shift[row_shift]);
+                    *output_2++ = dw_requantize(p, sum_b_2, output_mult[row_shift + 1], output_shift[row_shift + 1]);
+                    *output_2++ = dw_requantize(p, sum_b_3, output_mult[row_shift + 2], output_shift[row_shift + 2]);
+                    *output_2++ = dw_requantize(p, sum_b_4, output_mult[row_shift + 3], output_shift[row_shift + 3]);
+                }
+
+                row_shift += 4;
+            }
+
+            for (; row_shift < input_ch; row_shift++)
+            {
+                const q15_t *col_pos = col_buffer + row_shift;
+                const q15_t *col_pos_2 = col_buffer_2 + row_shift;
+                const q7_t *row_pos = kernel + row_shift;
+                q31_t sum = bias ? bias[row_shift] : 0;
+                q31_t sum_b = sum;
+
+                for (int i = 0; i < kernel_size; i++)
+                {
+                    sum += row_pos[i * input_ch] * col_pos[i * input_ch];
+                }
+                *output++ = dw_requantize(p, sum, output_mult[row_shift], output_shift[row_shift]);
+
+                if (input_2 != NULL)
+                {
+                    for (int i = 0; i < kernel_size; i++)
+                    {
+                        sum_b += row_pos[i * input_ch] * col_pos_2[i * input_ch];
+                    }
+                    *output_2++ = dw_requantize(p, sum_b, output_mult[row_shift], output_shift[row_shift]);
+                }
+            }
+        }
+    }
+}
+#endif
+
 /**
  *  @ingroup groupNN
  */
@@ -74,7 +318,7 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
     {
         return ARM_MATH_ARGUMENT_ERROR;
     }
-#ifdef ARM_MATH_DSP
+#if defined(ARM_MATH_DSP) || defined(ARM_MATH_NEON)
     const int32_t input_x = input_dims->w;
     const int32_t input_y = input_dims->h;
     const int32_t kernel_x = filter_dims->w;
@@ -102,64 +346,72 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
     int buffer_count = 0;
     const int32_t kernel_size = kernel_x * kernel_y;
 
-    /* This part implements the im2col function */
-    for (int i_out_y = 0, base_idx_y = -pad_y; i_out_y < output_y; base_idx_y += stride_y, i_out_y++)
+    /* This part implements the im2col function. The columns of consecutive images are processed together, so
+       the weights are loaded once for the groups of columns which span two images. */
+    for (int i_batch = 0; i_batch < input_dims->n; i_batch++)
     {
-        for (int i_out_x = 0, base_idx_x = -pad_x; i_out_x < output_x; base_idx_x += stride_x, i_out_x++)
+        const q7_t *input_image = input + i_batch * input_x * input_y * input_ch;
+
+        for (int i_out_y = 0, base_idx_y = -pad_y; i_out_y < output_y; base_idx_y += stride_y, i_out_y++)
         {
-            for (int i_ker_y = base_idx_y; i_ker_y < base_idx_y + kernel_y; i_ker_y++)
+            for (int i_out_x = 0, base_idx_x = -pad_x; i_out_x < output_x; base_idx_x += stride_x, i_out_x++)
             {
-                for (int i_ker_x = base_idx_x; i_ker_x < base_idx_x + kernel_x; i_ker_x++)
+                for (int i_ker_y = base_idx_y; i_ker_y < base_idx_y + kernel_y; i_ker_y++)
                 {
-                    if (i_ker_y < 0 || i_ker_y >= input_y || i_ker_x < 0 || i_ker_x >= input_x)
-                    {
-                        arm_memset_q7(lhs_buffer, (int8_t)-input_offset, (uint32_t)input_ch);
-                        padded = 1;
-                    }
-                    else
+                    for (int i_ker_x = base_idx_x; i_ker_x < base_idx_x + kernel_x; i_ker_x++)
                     {
-                        arm_memcpy_q7(lhs_buffer, input + (i_ker_y * input_x + i_ker_x) * input_ch, (uint32_t)input_ch);
+                        if (i_ker_y < 0 || i_ker_y >= input_y || i_ker_x < 0 || i_ker_x >= input_x)
+                        {
+                            arm_memset_q7(lhs_buffer, (int8_t)-input_offset, (uint32_t)input_ch);
+                            padded = 1;
+                        }
+                        else
+                        {
+                            arm_memcpy_q7(lhs_buffer,
+                                          input_image + (i_ker_y * input_x + i_ker_x) * input_ch,
+                                          (uint32_t)input_ch);
+                        }
+                        lhs_buffer += input_ch;
                     }
-                    lhs_buffer += input_ch;
                 }
-            }
-            buffer_count++;
+                buffer_count++;
 
-            if (buffer_count == 4)
-            {
-                lhs_buffer = (q7_t *)buffer_a;
-                if (padded == 0)
+                if (buffer_count == 4)
                 {
-                    out = arm_nn_depthwise_conv_nt_t_s8(lhs_buffer,
-                                                        kernel,
-                                                        input_offset,
-                                                        input_ch,
-                                                        output_shift,
-                                                        output_mult,
-                                                        output_offset,
-                                                        output_activation_min,
-                                                        output_activation_max,
-                                                        kernel_size,
-                                                        bias,
-                                                        out);
-                }
-                else
-                {
-                    out = arm_nn_depthwise_conv_nt_t_padded_s8(lhs_buffer,
-                                                               kernel,
-                                                               input_offset,
-                                                               input_ch,
-                                                               output_shift,
-                                                               output_mult,
-                                                               output_offset,
-                                                               output_activation_min,
-                                                               output_activation_max,
-                                                               kernel_size,
-                                                               bias,
-                                                               out);
-                    padded = 0;
+                    lhs_buffer = (q7_t *)buffer_a;
+                    if (padded == 0)
+                    {
+                        out = arm_nn_depthwise_conv_nt_t_s8(lhs_buffer,
+                                                            kernel,
+                                                            input_offset,
+                                                            input_ch,
+                                                            output_shift,
+                                                            output_mult,
+                                                            output_offset,
+                                                            output_activation_min,
+                                                            output_activation_max,
+                                                            kernel_size,
+                                                            bias,
+                                                            out);
+                    }
+                    else
+                    {
+                        out = arm_nn_depthwise_conv_nt_t_padded_s8(lhs_buffer,
+                                                                   kernel,
+                                                                   input_offset,
+                                                                   input_ch,
+                                                                   output_shift,
+                                                                   output_mult,
+                                                                   output_offset,
+                                                                   output_activation_min,
+                                                                   output_activation_max,
+                                                                   kernel_size,
+                                                                   bias,
+                                                                   out);
+                        padded = 0;
+                    }
+                    buffer_count = 0;
                 }
-                buffer_count = 0;
             }
         }
     }
@@ -176,7 +428,7 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
         {
             const int8_t *col_0 = lhs_buffer + (kernel_size * input_ch * i_buf) + offset;
             const int8_t *row_0 = kernel + offset;
-            int32x4_t out_0 = vldrwq_s32(&bias[offset]);
+            int32x4_t out_0 = bias ? vldrwq_s32(&bias[offset]) : vdupq_n_s32(0);
 
             for (int i_ker = 0; i_ker < kernel_size; i_ker++)
             {
@@ -210,190 +462,145 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
         }
     }
 
-#else // ARM_MATH_DSP
+#elif defined(ARM_MATH_NEON)
     (void)bias_dims;
-    /* Run the following code in cores using DSP extension */
-    q15_t *const col_buffer_start = buffer_a;
-    q15_t *col_buffer = col_buffer_start;
-    const int32_t *const bias_start_pos = bias;
-    const q31_t *const out_mult_start_pos = output_mult;
-    const q31_t *const out_shift_start_pos = output_shift;
-    uint16_t row_count;
-    uint16_t row_shift;
-
-    for (int i_out_y = 0; i_out_y < output_y; i_out_y++)
-    {
-        const int16_t base_idx_y = (i_out_y * stride_y) - pad_y;
-        for (int i_out_x = 0; i_out_x < output_x; i_out_x++)
-        {
-            const int16_t base_idx_x = (i_out_x * stride_x) - pad_x;
-
-            /* Out of bounds is only considered for the y axis as it provides a contiguous zero'ing opportunity than
-               along the x axis */
-            const int ker_y_start = MAX(0, -base_idx_y);
-            /* Condition for kernel end dimension: (base_idx_y + ker_y_end) < input_y */
-            const int ker_y_end = MIN(kernel_y, input_y - base_idx_y);
+    /* Generate four columns from the input tensor. Padding is filled with -input_offset so that it contributes 0 */
+    q7_t *lhs_buffer = (q7_t *)buffer_a;
+    q7_t *out = output;
+    int buffer_count = 0;
+    const int32_t kernel_size = kernel_x * kernel_y;
 
-            int32_t index = 0;
-            if (ker_y_start != 0)
-            {
-                memset(&col_buffer[index], 0, (kernel_x * input_ch) * ker_y_start * sizeof(q15_t));
-                index += (kernel_x * input_ch) * ker_y_start;
-            }
+    /* This part implements the im2col function. The columns of consecutive images are processed together, so
+       the weights are loaded once for the groups of columns which span two images. */
+    for (int i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        const q7_t *input_image = input + i_batch * input_x * input_y * input_ch;
 
-            for (int i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+        for (int i_out_y = 0, base_idx_y = -pad_y; i_out_y < output_y; base_idx_y += stride_y, i_out_y++)
+        {
+            for (int i_out_x = 0, base_idx_x = -pad_x; i_out_x < output_x; base_idx_x += stride_x, i_out_x++)
             {
-                const int32_t idx_y = base_idx_y + i_ker_y;
-
-                for (int i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+                for (int i_ker_y = base_idx_y; i_ker_y < base_idx_y + kernel_y; i_ker_y++)
                 {
-                    const int32_t idx_x = base_idx_x + i_ker_x;
-                    if (idx_x < 0 || idx_x >= input_x)
+                    for (int i_ker_x = base_idx_x; i_ker_x < base_idx_x + kernel_x; i_ker_x++)
                     {
-                        memset(&col_buffer[index], 0, input_ch * sizeof(q15_t));
+                        if (i_ker_y < 0 || i_ker_y >= input_y || i_ker_x < 0 || i_ker_x >= input_x)
+                        {
+                            arm_memset_q7(lhs_buffer, (int8_t)-input_offset, (uint32_t)input_ch);
+                        }
+                        else
+                        {
+                            arm_memcpy_q7(lhs_buffer,
+                                          input_image + (i_ker_y * input_x + i_ker_x) * input_ch,
+                                          (uint32_t)input_ch);
+                        }
+                        lhs_buffer += input_ch;
                     }
-                    else
-                    {
-                        arm_q7_to_q15_with_offset((q7_t *)input + (idx_y * input_x + idx_x) * input_ch,
-                                                  &col_buffer[index],
-                                                  input_ch,
-                                                  input_offset);
-                    }
-                    index += input_ch;
                 }
-            }
-
-            const int diff = kernel_y - ker_y_end;
-            if (diff != 0)
-            {
-                memset(&col_buffer[index], 0, (kernel_x * input_ch) * diff * sizeof(q15_t));
-            }
+                buffer_count++;
 
-            row_count = output_ch / 4;
-            row_shift = 0;
-            bias = bias_start_pos;
-            output_mult = out_mult_start_pos;
-            output_shift = out_shift_start_pos;
-
-            while (row_count)
-            {
-                q31_t sum = *bias++;
-                q31_t sum_2 = *bias++;
-                q31_t sum_3 = *bias++;
-                q31_t sum_4 = *bias++;
-
-                uint16_t col_count = (kernel_x * kernel_y) / 2;
-                q15_t *col_pos = col_buffer_start + row_shift;
-                const q7_t *row_pos = kernel + row_shift;
-                row_shift += 4;
-
-                while (col_count)
+                if (buffer_count == 4)
                 {
-                    /* General idea is to read 4 + 4 (input, kernel) pair and re-arrange them in the right order to
-                    use in a SMLAD instruction . One run of this loop produces 4 partial outputs with 8 MACs. */
-                    /* Note: variable names can be improved here to align with rows and columns. */
-                    q31_t ip_a1, ip_a2, ip_b1, ip_b2, op_a, op_b, op_c;
-                    /* Read 4 weights */
-                    ip_b1 = arm_nn_read_q7x4(row_pos);
-                    ip_a1 = arm_nn_read_q7x4(row_pos + input_ch);
-                    op_a = arm_nn_read_q15x2(col_pos);
-                    op_b = arm_nn_read_q15x2(col_pos + input_ch);
-
-                    ip_a2 = __SXTB16(ip_b1);
-                    ip_b1 = __SXTB16(__ROR(ip_b1, 8));
-
-                    ip_b2 = __SXTB16(ip_a1);
-                    ip_a1 = __SXTB16(__ROR(ip_a1, 8));
-
-                    op_c = __PKHBT(op_b, op_a, 16);
-                    op_a = __PKHTB(op_b, op_a, 16);
-                    op_b = __PKHBT(ip_b2, ip_a2, 16);
-                    sum = __SMLAD(op_c, op_b, sum);
-
-                    op_b = __PKHBT(ip_b1, ip_a1, 16);
-                    sum_2 = __SMLAD(op_a, op_b, sum_2);
-
-                    op_a = arm_nn_read_q15x2(col_pos + 2);
-                    op_b = arm_nn_read_q15x2(col_pos + input_ch + 2);
-
-                    op_c = __PKHBT(op_b, op_a, 16);
-                    op_a = __PKHTB(op_b, op_a, 16);
-                    op_b = __PKHTB(ip_a2, ip_b2, 16);
-                    sum_3 = __SMLAD(op_c, op_b, sum_3);
-
-                    op_b = __PKHTB(ip_a1, ip_b1, 16);
-                    sum_4 = __SMLAD(op_a, op_b, sum_4);
-
-                    row_pos += input_ch << 1;
-                    col_pos += input_ch << 1;
-                    col_count--;
+                    lhs_buffer = (q7_t *)buffer_a;
+                    out = arm_nn_depthwise_conv_nt_t_s8(lhs_buffer,
+                                                        kernel,
+                                                        input_offset,
+                                                        input_ch,
+                                                        output_shift,
+                                                        output_mult,
+                                                        output_offset,
+                                                        output_activation_min,
+                                                        output_activation_max,
+                                                        kernel_size,
+                                                        bias,
+                                                        out);
+                    buffer_count = 0;
                 }
+            }
+        }
+    }
 
-                col_count = (kernel_x * kernel_y) & 0x1;
-                while (col_count)
-                {
-                    sum += row_pos[0] * col_pos[0];
-                    sum_2 += row_pos[1] * col_pos[1];
-                    sum_3 += row_pos[2] * col_pos[2];
-                    sum_4 += row_pos[3] * col_pos[3];
-
-                    row_pos += input_ch;
-                    col_pos += input_ch;
+    /* Handle left over buffers */
+    lhs_buffer = (q7_t *)buffer_a;
 
-                    col_count--;
-                }
-                sum = arm_nn_requantize(sum, *output_mult++, *output_shift++);
-                sum += output_offset;
-                sum = MAX(sum, output_activation_min);
-                sum = MIN(sum, output_activation_max);
-                *output++ = (q7_t)sum;
-
-                sum_2 = arm_nn_requantize(sum_2, *output_mult++, *output_shift++);
-                sum_2 += output_offset;
-                sum_2 = MAX(sum_2, output_activation_min);
-                sum_2 = MIN(sum_2, output_activation_max);
-                *output++ = (q7_t)sum_2;
-                sum_3 = arm_nn_requantize(sum_3, *output_mult++, *output_shift++);
-                sum_3 += output_offset;
-                sum_3 = MAX(sum_3, output_activation_min);
-                sum_3 = MIN(sum_3, output_activation_max);
-                *output++ = (q7_t)sum_3;
-
-                sum_4 = arm_nn_requantize(sum_4, *output_mult++, *output_shift++);
-                sum_4 += output_offset;
-                sum_4 = MAX(sum_4, output_activation_min);
-                sum_4 = MIN(sum_4, output_activation_max);
-                *output++ = (q7_t)sum_4;
-
-                row_count--;
+    for (int i_buf = 0; i_buf < buffer_count; i_buf++)
+    {
+        for (int i_ch = 0; i_ch < input_ch; i_ch++)
+        {
+            const int8_t *col_0 = lhs_buffer + (kernel_size * input_ch * i_buf) + i_ch;
+            const int8_t *row_0 = kernel + i_ch;
+            int32_t sum = 0;
+            if (bias)
+            {
+                sum = bias[i_ch];
             }
 
-            row_count = output_ch & 0x3;
-            while (row_count)
+            for (int i_ker = 0; i_ker < kernel_size; i_ker++)
             {
-                q15_t *col_pos = col_buffer_start + row_shift;
-                const q7_t *row_pos = kernel + row_shift;
-                q31_t sum = *bias++;
-                const uint16_t col_count = (kernel_x * kernel_y);
-                row_shift += 1;
+                sum += (*col_0 + input_offset) * *row_0;
 
-                for (int i = 0; i < col_count; i++)
-                {
-                    sum += row_pos[i * input_ch] * col_pos[i * input_ch];
-                }
-                sum = arm_nn_requantize(sum, *output_mult++, *output_shift++);
-                sum += output_offset;
-                sum = MAX(sum, output_activation_min);
-                sum = MIN(sum, output_activation_max);
-                *output++ = (q7_t)sum;
-
-                row_count--;
+                col_0 += input_ch;
+                row_0 += input_ch;
             }
 
-            // clear counter and pointers
-            col_buffer = col_buffer_start;
+            sum = arm_nn_requantize(sum, output_mult[i_ch], output_shift[i_ch]);
+            sum += output_offset;
+            sum = MAX(sum, output_activation_min);
+            sum = MIN(sum, output_activation_max);
+            *out++ = (q7_t)sum;
         }
     }
+
+#else // ARM_MATH_DSP
+    (void)bias_dims;
+    /* Run the following code in cores using DSP extension */
+    const int32_t batches = input_dims->n;
+    const int32_t input_size = input_x * input_y * input_ch;
+    const int32_t output_size = output_x * output_y * output_ch;
+    const dw_dsp_params params = {input_x,
+                                  input_y,
+                                  input_ch,
+                                  kernel_x,
+                                  kernel_y,
+                                  pad_x,
+                                  pad_y,
+                                  stride_x,
+                                  stride_y,
+                                  output_x,
+                                  output_y,
+                                  input_offset,
+                                  output_offset,
+                                  output_activation_min,
+                                  output_activation_max};
+    int32_t i_batch = 0;
+
+    /* Two images share each weight load: the scratch buffer holds the columns of both */
+    for (; i_batch <= batches - 2; i_batch += 2)
+    {
+        dw_conv_dsp_s8(&params,
+                       input + i_batch * input_size,
+                       input + (i_batch + 1) * input_size,
+                       kernel,
+                       bias,
+                       output_mult,
+                       output_shift,
+                       buffer_a,
+                       output + i_batch * output_size,
+                       output + (i_batch + 1) * output_size);
+    }
+    if (i_batch < batches)
+    {
+        dw_conv_dsp_s8(&params,
+                       input + i_batch * input_size,
+                       NULL,
+                       kernel,
+                       bias,
+                       output_mult,
+                       output_shift,
+                       buffer_a,
+                       output + i_batch * output_size,
+                       NULL);
+    }
 #endif
 #else
     /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
@@ -408,7 +615,7 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
                                  bias,
                                  output_dims,
                                  output);
-#endif /* ARM_MATH_MVEI | ARM_MATH_DSP */
+#endif /* ARM_MATH_MVEI | ARM_MATH_NEON | ARM_MATH_DSP */
 
     /* Return to application */
     return ARM_MATH_SUCCESS;
@@ -416,11 +623,13 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
 
 int32_t arm_depthwise_conv_s8_opt_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims)
 {
-#if defined(ARM_MATH_MVEI)
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_NEON)
     /* The + 4 accounts for out of bounds read of the lhs buffers in the *_nt_t_* functions.  */
     return (2 * input_dims->c * filter_dims->w * filter_dims->h) * (int32_t)sizeof(int16_t) + 4;
 #elif defined(ARM_MATH_DSP)
-    return (input_dims->c * filter_dims->w * filter_dims->h) * sizeof(int16_t);
+    /* Columns of two images with a batch */
+    const int32_t images = (input_dims->n > 1) ? 2 : 1;
+    return images * (input_dims->c * filter_dims->w * filter_dims->h) * (int32_t)sizeof(int16_t);
 #else
     (void)input_dims;
     (void)filter_dims;
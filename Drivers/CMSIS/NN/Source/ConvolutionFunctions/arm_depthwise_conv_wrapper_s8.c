@@ -22,14 +22,15 @@
  * Description:  Wrapper API to select appropriate depthwise conv API based
  *               on dimensions.
  *
- * $Date:        20. Dec 2021
- * $Revision:    V.1.4.0
+ * $Date:        18. Oct 2026
+ * $Revision:    V.1.7.0
  *
  * Target Processor:  Cortex-M CPUs
  *
  * -------------------------------------------------------------------- */
 
 #include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
 
 /**
  *  @ingroup groupNN
@@ -58,11 +59,11 @@ arm_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
                                          const cmsis_nn_dims *output_dims,
                                          q7_t *output)
 {
+    ARM_NN_PROFILE_START();
     arm_status status = ARM_MATH_SUCCESS;
-    if (1 == dw_conv_params->ch_mult && input_dims->n == 1 && dw_conv_params->dilation.w == 1 &&
-        dw_conv_params->dilation.h == 1)
+    if (1 == dw_conv_params->ch_mult && dw_conv_params->dilation.w == 1 && dw_conv_params->dilation.h == 1)
     {
-#if !defined(ARM_MATH_MVEI)
+#if !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_NEON)
         if ((filter_dims->w == 3) && (filter_dims->h == 3) && (dw_conv_params->padding.h <= 1) &&
             (dw_conv_params->padding.w <= 1))
         {
@@ -77,6 +78,12 @@ arm_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
                                                bias,
                                                output_dims,
                                                output);
+            ARM_NN_PROFILE_END(ARM_NN_PROFILE_DW_CONV_3X3_S8,
+                               0,
+                               input_dims,
+                               filter_dims,
+                               output_dims,
+                               status);
         }
         else
 #endif
@@ -92,6 +99,12 @@ arm_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
                                                bias,
                                                output_dims,
                                                output);
+            ARM_NN_PROFILE_END(ARM_NN_PROFILE_DW_CONV_S8_OPT,
+                               arm_depthwise_conv_s8_opt_get_buffer_size(input_dims, filter_dims),
+                               input_dims,
+                               filter_dims,
+                               output_dims,
+                               status);
         }
     }
     else
@@ -107,6 +120,12 @@ arm_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
                                        bias,
                                        output_dims,
                                        output);
+        ARM_NN_PROFILE_END(ARM_NN_PROFILE_DW_CONV_S8,
+                           0,
+                           input_dims,
+                           filter_dims,
+                           output_dims,
+                           status);
     }
 
     /* Return to application */
@@ -121,8 +140,7 @@ int32_t arm_depthwise_conv_wrapper_s8_get_buffer_size(const cmsis_nn_dw_conv_par
     (void)dw_conv_params;
     int32_t size = 0;
 
-    if (input_dims->c == output_dims->c && input_dims->n == 1 && dw_conv_params->dilation.w == 1 &&
-        dw_conv_params->dilation.h == 1)
+    if (input_dims->c == output_dims->c && dw_conv_params->dilation.w == 1 && dw_conv_params->dilation.h == 1)
     {
         size = arm_depthwise_conv_s8_opt_get_buffer_size(input_dims, filter_dims);
     }
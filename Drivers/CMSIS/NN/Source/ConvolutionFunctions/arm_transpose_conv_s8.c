@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_transpose_conv_s8.c
+ * Description:  s8 version of transpose convolution using symmetric quantization.
+ *
+ * $Date:        October 18, 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores, Cortex-A cores with Neon
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/* Number of output pixels computed by one call to the matrix multiplication kernel */
+#define TRANSPOSE_CONV_COLS (4)
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * Basic s8 transpose convolution function.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_transpose_conv_s8(const cmsis_nn_context *ctx,
+                                 const cmsis_nn_conv_params *conv_params,
+                                 const cmsis_nn_per_channel_quant_params *quant_params,
+                                 const cmsis_nn_dims *input_dims,
+                                 const q7_t *input_data,
+                                 const cmsis_nn_dims *filter_dims,
+                                 const q7_t *filter_data,
+                                 const cmsis_nn_dims *bias_dims,
+                                 const int32_t *bias_data,
+                                 const cmsis_nn_dims *output_dims,
+                                 q7_t *output_data)
+{
+    (void)bias_dims;
+
+    if (ctx->buf == NULL && arm_transpose_conv_s8_get_buffer_size(input_dims, filter_dims) > 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    if (conv_params->dilation.w != 1 || conv_params->dilation.h != 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    q7_t *col_buffer = (q7_t *)ctx->buf;
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+
+    const int32_t pad_x = conv_params->padding.w;
+    const int32_t pad_y = conv_params->padding.h;
+    const int32_t stride_x = conv_params->stride.w;
+    const int32_t stride_y = conv_params->stride.h;
+
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+    int32_t *output_mult = quant_params->multiplier;
+    int32_t *output_shift = quant_params->shift;
+
+    const int32_t col_size = kernel_x * kernel_y * input_ch;
+    /* Taps without input pixel contribute zero once the input offset is added */
+    const q7_t pad_val = (q7_t)(-input_offset);
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        q7_t *col = col_buffer;
+        int32_t cols = 0;
+
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                /* Gather the taps of the output pixel */
+                for (int32_t i_ker_y = 0; i_ker_y < kernel_y; i_ker_y++)
+                {
+                    const int32_t delta_y = i_out_y + pad_y - i_ker_y;
+                    const int32_t k_y = delta_y / stride_y;
+
+                    if (delta_y < 0 || k_y * stride_y != delta_y || k_y >= input_y)
+                    {
+                        arm_memset_q7(col, pad_val, kernel_x * input_ch);
+                        col += kernel_x * input_ch;
+                        continue;
+                    }
+
+                    for (int32_t i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+                    {
+                        const int32_t delta_x = i_out_x + pad_x - i_ker_x;
+                        const int32_t k_x = delta_x / stride_x;
+
+                        if (delta_x < 0 || k_x * stride_x != delta_x || k_x >= input_x)
+                        {
+                            arm_memset_q7(col, pad_val, input_ch);
+                        }
+                        else
+                        {
+                            arm_memcpy_q7(col, input_data + (k_y * input_x + k_x) * input_ch, input_ch);
+                        }
+                        col += input_ch;
+                    }
+                }
+
+                cols++;
+                if (cols == TRANSPOSE_CONV_COLS)
+                {
+                    arm_nn_mat_mult_nt_t_s8(col_buffer,
+                                            filter_data,
+                                            bias_data,
+                                            output_data,
+                                            output_mult,
+                                            output_shift,
+                                            cols,
+                                            output_ch,
+                                            col_size,
+                                            input_offset,
+                                            out_offset,
+                                            out_activation_min,
+                                            out_activation_max);
+                    output_data += cols * output_ch;
+                    col = col_buffer;
+                    cols = 0;
+                }
+            }
+        }
+
+        /* Handle left over output pixels */
+        if (cols > 0)
+        {
+            arm_nn_mat_mult_nt_t_s8(col_buffer,
+                                    filter_data,
+                                    bias_data,
+                                    output_data,
+                                    output_mult,
+                                    output_shift,
+                                    cols,
+                                    output_ch,
+                                    col_size,
+                                    input_offset,
+                                    out_offset,
+                                    out_activation_min,
+                                    out_activation_max);
+            output_data += cols * output_ch;
+        }
+
+        /* Advance to the next batch */
+        input_data += (input_x * input_y * input_ch);
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_transpose_conv_s8_get_buffer_size(const cmsis_nn_dims *input_dims, const cmsis_nn_dims *filter_dims)
+{
+    return TRANSPOSE_CONV_COLS * input_dims->c * filter_dims->w * filter_dims->h * (int32_t)sizeof(q7_t);
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_batch_matmul_s16.c
+ * Description:  s16 batch matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+static void bmm_row_s16(const q15_t *lhs,
+                        const q15_t *rhs,
+                        q15_t *dst,
+                        const int32_t depth,
+                        const int32_t cols,
+                        const q31_t reduced_multiplier,
+                        const int32_t shift,
+                        const int32_t act_min,
+                        const int32_t act_max)
+{
+    int32_t i_col = 0;
+
+#if defined(ARM_MATH_DSP)
+    /* Two columns at a time, two products per instruction */
+    for (; i_col <= cols - 2; i_col += 2)
+    {
+        const q15_t *lhs_ptr = lhs;
+        const q15_t *rhs_0 = rhs + i_col * depth;
+        const q15_t *rhs_1 = rhs_0 + depth;
+        q63_t acc_0 = 0;
+        q63_t acc_1 = 0;
+        int32_t i_depth = 0;
+
+        for (; i_depth <= depth - 2; i_depth += 2)
+        {
+            const q31_t lhs_val = arm_nn_read_q15x2_ia(&lhs_ptr);
+            acc_0 = __SMLALD(lhs_val, arm_nn_read_q15x2_ia(&rhs_0), acc_0);
+            acc_1 = __SMLALD(lhs_val, arm_nn_read_q15x2_ia(&rhs_1), acc_1);
+        }
+        if (i_depth < depth)
+        {
+            acc_0 += *lhs_ptr * *rhs_0;
+            acc_1 += *lhs_ptr * *rhs_1;
+        }
+
+        q31_t tmp = arm_nn_requantize_s64(acc_0, reduced_multiplier, shift);
+        tmp = MAX(tmp, act_min);
+        tmp = MIN(tmp, act_max);
+        *dst++ = (q15_t)tmp;
+
+        tmp = arm_nn_requantize_s64(acc_1, reduced_multiplier, shift);
+        tmp = MAX(tmp, act_min);
+        tmp = MIN(tmp, act_max);
+        *dst++ = (q15_t)tmp;
+    }
+#endif
+
+    for (; i_col < cols; i_col++)
+    {
+        const q15_t *rhs_ptr = rhs + i_col * depth;
+        q63_t acc = 0;
+
+        for (int32_t i_depth = 0; i_depth < depth; i_depth++)
+        {
+            acc += lhs[i_depth] * rhs_ptr[i_depth];
+        }
+
+        q31_t tmp = arm_nn_requantize_s64(acc, reduced_multiplier, shift);
+        tmp = MAX(tmp, act_min);
+        tmp = MIN(tmp, act_max);
+        *dst++ = (q15_t)tmp;
+    }
+}
+
+/*
+ * s16 batch matrix multiplication
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_batch_matmul_s16(const cmsis_nn_context *ctx,
+                                const cmsis_nn_bmm_params *bmm_params,
+                                const cmsis_nn_per_tensor_quant_params *quant_params,
+                                const cmsis_nn_dims *input_lhs_dims,
+                                const q15_t *input_lhs,
+                                const cmsis_nn_dims *input_rhs_dims,
+                                const q15_t *input_rhs,
+                                const cmsis_nn_dims *output_dims,
+                                q15_t *output)
+{
+    const int32_t rows = output_dims->w;
+    const int32_t cols = output_dims->c;
+    const int32_t depth = bmm_params->adj_x ? input_lhs_dims->w : input_lhs_dims->c;
+
+    if ((bmm_params->adj_x ? input_lhs_dims->c : input_lhs_dims->w) != rows ||
+        (bmm_params->adj_y ? input_rhs_dims->w : input_rhs_dims->c) != cols ||
+        (bmm_params->adj_y ? input_rhs_dims->c : input_rhs_dims->w) != depth)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    if ((input_lhs_dims->n != 1 && input_lhs_dims->n != output_dims->n) ||
+        (input_lhs_dims->h != 1 && input_lhs_dims->h != output_dims->h) ||
+        (input_rhs_dims->n != 1 && input_rhs_dims->n != output_dims->n) ||
+        (input_rhs_dims->h != 1 && input_rhs_dims->h != output_dims->h))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    if (ctx->buf == NULL && arm_batch_matmul_s16_get_buffer_size(bmm_params, input_lhs_dims, input_rhs_dims) > 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const q31_t reduced_multiplier = REDUCE_MULTIPLIER(quant_params->multiplier);
+    const int32_t act_min = bmm_params->fc_params.activation.min;
+    const int32_t act_max = bmm_params->fc_params.activation.max;
+    const int32_t matrix_size = rows * depth;
+    const int32_t rhs_matrix_size = depth * cols;
+
+    /* Buffer layout: transposed rhs matrix, lhs row */
+    q15_t *rhs_t = (q15_t *)ctx->buf;
+    q15_t *lhs_row = rhs_t + (bmm_params->adj_y ? 0 : rhs_matrix_size);
+    const q15_t *transposed = NULL;
+
+    for (int32_t i_n = 0; i_n < output_dims->n; i_n++)
+    {
+        for (int32_t i_h = 0; i_h < output_dims->h; i_h++)
+        {
+            const int32_t lhs_batch = (input_lhs_dims->n == 1 ? 0 : i_n) * input_lhs_dims->h +
+                (input_lhs_dims->h == 1 ? 0 : i_h);
+            const int32_t rhs_batch = (input_rhs_dims->n == 1 ? 0 : i_n) * input_rhs_dims->h +
+                (input_rhs_dims->h == 1 ? 0 : i_h);
+            const q15_t *lhs = input_lhs + lhs_batch * matrix_size;
+            const q15_t *rhs = input_rhs + rhs_batch * rhs_matrix_size;
+
+            /* The rhs matrix is read as (cols x depth). A broadcast matrix is transposed once. */
+            if (!bmm_params->adj_y)
+            {
+                if (rhs != transposed)
+                {
+                    for (int32_t i_col = 0; i_col < cols; i_col++)
+                    {
+                        for (int32_t i_depth = 0; i_depth < depth; i_depth++)
+                        {
+                            rhs_t[i_col * depth + i_depth] = rhs[i_depth * cols + i_col];
+                        }
+                    }
+                    transposed = rhs;
+                }
+                rhs = rhs_t;
+            }
+
+            for (int32_t i_row = 0; i_row < rows; i_row++)
+            {
+                const q15_t *row = lhs + i_row * depth;
+
+                if (bmm_params->adj_x)
+                {
+                    for (int32_t i_depth = 0; i_depth < depth; i_depth++)
+                    {
+                        lhs_row[i_depth] = lhs[i_depth * rows + i_row];
+                    }
+                    row = lhs_row;
+                }
+
+                bmm_row_s16(row, rhs, output, depth, cols, reduced_multiplier, quant_params->shift, act_min, act_max);
+                output += cols;
+            }
+        }
+    }
+
+    return (ARM_MATH_SUCCESS);
+}
+
+int32_t arm_batch_matmul_s16_get_buffer_size(const cmsis_nn_bmm_params *bmm_params,
+                                             const cmsis_nn_dims *input_lhs_dims,
+                                             const cmsis_nn_dims *input_rhs_dims)
+{
+    int32_t size = 0;
+
+    if (!bmm_params->adj_y)
+    {
+        size += input_rhs_dims->w * input_rhs_dims->c;
+    }
+    if (bmm_params->adj_x)
+    {
+        size += input_lhs_dims->w;
+    }
+
+    return size * (int32_t)sizeof(q15_t);
+}
+
+/**
+ * @} end of FC group
+ */
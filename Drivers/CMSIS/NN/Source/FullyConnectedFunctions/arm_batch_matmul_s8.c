@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_batch_matmul_s8.c
+ * Description:  s8 batch matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores, Cortex-A cores with Neon
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * s8 batch matrix multiplication
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_batch_matmul_s8(const cmsis_nn_context *ctx,
+                               const cmsis_nn_bmm_params *bmm_params,
+                               const cmsis_nn_per_tensor_quant_params *quant_params,
+                               const cmsis_nn_dims *input_lhs_dims,
+                               const q7_t *input_lhs,
+                               const cmsis_nn_dims *input_rhs_dims,
+                               const q7_t *input_rhs,
+                               const cmsis_nn_dims *output_dims,
+                               q7_t *output)
+{
+    const int32_t rows = output_dims->w;
+    const int32_t cols = output_dims->c;
+    const int32_t depth = bmm_params->adj_x ? input_lhs_dims->w : input_lhs_dims->c;
+
+    if ((bmm_params->adj_x ? input_lhs_dims->c : input_lhs_dims->w) != rows ||
+        (bmm_params->adj_y ? input_rhs_dims->w : input_rhs_dims->c) != cols ||
+        (bmm_params->adj_y ? input_rhs_dims->c : input_rhs_dims->w) != depth)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    if ((input_lhs_dims->n != 1 && input_lhs_dims->n != output_dims->n) ||
+        (input_lhs_dims->h != 1 && input_lhs_dims->h != output_dims->h) ||
+        (input_rhs_dims->n != 1 && input_rhs_dims->n != output_dims->n) ||
+        (input_rhs_dims->h != 1 && input_rhs_dims->h != output_dims->h))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    if (ctx->buf == NULL && arm_batch_matmul_s8_get_buffer_size(bmm_params, input_lhs_dims, input_rhs_dims) > 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t lhs_offset = bmm_params->fc_params.input_offset;
+    const int32_t rhs_offset = bmm_params->fc_params.filter_offset;
+    const int32_t dst_offset = bmm_params->fc_params.output_offset;
+    const int32_t act_min = bmm_params->fc_params.activation.min;
+    const int32_t act_max = bmm_params->fc_params.activation.max;
+    const int32_t matrix_size = rows * depth;
+    const int32_t rhs_matrix_size = depth * cols;
+
+    /* Buffer layout: per column bias, transposed rhs matrix, lhs row */
+    int32_t *bias = (int32_t *)ctx->buf;
+    q7_t *rhs_t = (q7_t *)ctx->buf + (rhs_offset != 0 ? cols * (int32_t)sizeof(int32_t) : 0);
+    q7_t *lhs_row = rhs_t + (bmm_params->adj_y ? 0 : rhs_matrix_size);
+    const q7_t *transposed = NULL;
+
+    for (int32_t i_n = 0; i_n < output_dims->n; i_n++)
+    {
+        for (int32_t i_h = 0; i_h < output_dims->h; i_h++)
+        {
+            const int32_t lhs_batch = (input_lhs_dims->n == 1 ? 0 : i_n) * input_lhs_dims->h +
+                (input_lhs_dims->h == 1 ? 0 : i_h);
+            const int32_t rhs_batch = (input_rhs_dims->n == 1 ? 0 : i_n) * input_rhs_dims->h +
+                (input_rhs_dims->h == 1 ? 0 : i_h);
+            const q7_t *lhs = input_lhs + lhs_batch * matrix_size;
+            const q7_t *rhs = input_rhs + rhs_batch * rhs_matrix_size;
+
+            /* The kernel reads the rhs matrix as (cols x depth). A broadcast matrix is transposed once. */
+            if (!bmm_params->adj_y)
+            {
+                if (rhs != transposed)
+                {
+                    for (int32_t i_col = 0; i_col < cols; i_col++)
+                    {
+                        for (int32_t i_depth = 0; i_depth < depth; i_depth++)
+                        {
+                            rhs_t[i_col * depth + i_depth] = rhs[i_depth * cols + i_col];
+                        }
+                    }
+                    transposed = rhs;
+                }
+                rhs = rhs_t;
+            }
+
+            for (int32_t i_row = 0; i_row < rows; i_row++)
+            {
+                const q7_t *row = lhs + i_row * depth;
+                const int32_t *row_bias = NULL;
+
+                if (bmm_params->adj_x)
+                {
+                    for (int32_t i_depth = 0; i_depth < depth; i_depth++)
+                    {
+                        lhs_row[i_depth] = lhs[i_depth * rows + i_row];
+                    }
+                    row = lhs_row;
+                }
+
+                /* sum((lhs + lhs_offset) * (rhs + rhs_offset)) = sum((lhs + lhs_offset) * rhs) +
+                   rhs_offset * sum(lhs + lhs_offset), the second term is passed as bias */
+                if (rhs_offset != 0)
+                {
+                    int32_t sum = lhs_offset * depth;
+                    for (int32_t i_depth = 0; i_depth < depth; i_depth++)
+                    {
+                        sum += row[i_depth];
+                    }
+                    sum *= rhs_offset;
+                    for (int32_t i_col = 0; i_col < cols; i_col++)
+                    {
+                        bias[i_col] = sum;
+                    }
+                    row_bias = bias;
+                }
+
+                arm_nn_vec_mat_mult_t_s8(row,
+                                         rhs,
+                                         row_bias,
+                                         output,
+                                         lhs_offset,
+                                         0,
+                                         dst_offset,
+                                         quant_params->multiplier,
+                                         quant_params->shift,
+                                         depth,
+                                         cols,
+                                         act_min,
+                                         act_max,
+                                         1);
+                output += cols;
+            }
+        }
+    }
+
+    return (ARM_MATH_SUCCESS);
+}
+
+int32_t arm_batch_matmul_s8_get_buffer_size(const cmsis_nn_bmm_params *bmm_params,
+                                            const cmsis_nn_dims *input_lhs_dims,
+                                            const cmsis_nn_dims *input_rhs_dims)
+{
+    int32_t size = 0;
+
+    if (bmm_params->fc_params.filter_offset != 0)
+    {
+        size += (bmm_params->adj_y ? input_rhs_dims->w : input_rhs_dims->c) * (int32_t)sizeof(int32_t);
+    }
+    if (!bmm_params->adj_y)
+    {
+        size += input_rhs_dims->w * input_rhs_dims->c;
+    }
+    if (bmm_params->adj_x)
+    {
+        size += input_lhs_dims->w;
+    }
+
+    return size;
+}
+
+/**
+ * @} end of FC group
+ */
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_packed_s8
+ * Description:  Fully connected function compatible with TF Lite, with pre-packed weights.
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M and Cortex-A cores with Neon
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * S8 fully-connected layer function with pre-packed weights
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_fully_connected_packed_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_fc_params *fc_params,
+                                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const q7_t *packed_kernel,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output)
+{
+    (void)ctx;
+
+    /* All the batches in one call: the weights are read once */
+    return arm_nn_mat_mult_packed_s8(input,
+                                     packed_kernel,
+                                     output,
+                                     &quant_params->multiplier,
+                                     &quant_params->shift,
+                                     0,
+                                     input_dims->n,
+                                     output_dims->c,
+                                     filter_dims->n,
+                                     fc_params->output_offset,
+                                     fc_params->activation.min,
+                                     fc_params->activation.max);
+}
+
+/**
+ * @} end of FC group
+ */
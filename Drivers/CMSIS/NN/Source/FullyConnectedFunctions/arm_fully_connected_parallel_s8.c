@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_parallel_s8.c
+ * Description:  Fully connected function with the output channels split across workers
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M and Cortex-A cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+typedef struct
+{
+    const cmsis_nn_context *ctx;
+    const cmsis_nn_fc_params *fc_params;
+    const cmsis_nn_per_tensor_quant_params *quant_params;
+    const cmsis_nn_dims *input_dims;
+    const q7_t *input_data;
+    const cmsis_nn_dims *filter_dims;
+    const q7_t *filter_data;
+    const cmsis_nn_dims *bias_dims;
+    const int32_t *bias_data;
+    const cmsis_nn_dims *output_dims;
+    q7_t *output_data;
+    int32_t ch_per_task;
+    arm_status status[CMSIS_NN_MAX_TASKS];
+} fc_task_args;
+
+/* Output channels of one task: the matching rows of the filter, one batch at a time */
+static void fc_task(void *args, int32_t task)
+{
+    fc_task_args *a = (fc_task_args *)args;
+    const int32_t ch_start = task * a->ch_per_task;
+    const int32_t ch_count = MIN(a->ch_per_task, a->output_dims->c - ch_start);
+    const int32_t accum_depth = a->filter_dims->n;
+    const int32_t *bias = (a->bias_data == NULL) ? NULL : a->bias_data + ch_start;
+    cmsis_nn_dims input_dims = *a->input_dims;
+    cmsis_nn_dims filter_dims = *a->filter_dims;
+    cmsis_nn_dims output_dims = *a->output_dims;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    input_dims.n = 1;
+    filter_dims.c = ch_count;
+    output_dims.n = 1;
+    output_dims.c = ch_count;
+
+    for (int32_t batch = 0; batch < a->input_dims->n && status == ARM_MATH_SUCCESS; batch++)
+    {
+        status = arm_fully_connected_s8(&a->ctx[task],
+                                        a->fc_params,
+                                        a->quant_params,
+                                        &input_dims,
+                                        a->input_data + batch * accum_depth,
+                                        &filter_dims,
+                                        a->filter_data + ch_start * accum_depth,
+                                        a->bias_dims,
+                                        bias,
+                                        &output_dims,
+                                        a->output_data + batch * a->output_dims->c + ch_start);
+    }
+
+    a->status[task] = status;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * S8 fully connected layer split across several workers.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_fully_connected_parallel_s8(const cmsis_nn_parallel_context *parallel_ctx,
+                                           const cmsis_nn_fc_params *fc_params,
+                                           const cmsis_nn_per_tensor_quant_params *quant_params,
+                                           const cmsis_nn_dims *input_dims,
+                                           const q7_t *input_data,
+                                           const cmsis_nn_dims *filter_dims,
+                                           const q7_t *filter_data,
+                                           const cmsis_nn_dims *bias_dims,
+                                           const int32_t *bias_data,
+                                           const cmsis_nn_dims *output_dims,
+                                           q7_t *output_data)
+{
+    fc_task_args args;
+    int32_t num_tasks = MIN(parallel_ctx->num_workers, CMSIS_NN_MAX_TASKS);
+
+    if (num_tasks < 1 || output_dims->c < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    args.ctx = parallel_ctx->ctx;
+    args.fc_params = fc_params;
+    args.quant_params = quant_params;
+    args.input_dims = input_dims;
+    args.input_data = input_data;
+    args.filter_dims = filter_dims;
+    args.filter_data = filter_data;
+    args.bias_dims = bias_dims;
+    args.bias_data = bias_data;
+    args.output_dims = output_dims;
+    args.output_data = output_data;
+
+    /* Multiples of 4 channels keep the kernels on their 4-row path */
+    args.ch_per_task = (output_dims->c + num_tasks - 1) / num_tasks;
+    args.ch_per_task = (args.ch_per_task + 3) & ~3;
+    num_tasks = (output_dims->c + args.ch_per_task - 1) / args.ch_per_task;
+
+    parallel_ctx->parallel_for(parallel_ctx->scheduler, fc_task, &args, num_tasks);
+
+    for (int32_t i = 0; i < num_tasks; i++)
+    {
+        if (args.status[i] != ARM_MATH_SUCCESS)
+        {
+            return args.status[i];
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of FC group
+ */
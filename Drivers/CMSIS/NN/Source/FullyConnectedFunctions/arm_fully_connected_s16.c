@@ -21,8 +21,8 @@
  * Title:        arm_fully_connected_s16
  * Description:  Fully connected function compatible with TF Lite.
  *
- * $Date:        3. August 2021
- * $Revision:    V.1.0.0
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
  *
  * Target Processor:  Cortex-M and Cortex-A cores
  *
@@ -58,6 +58,7 @@ arm_status arm_fully_connected_s16(const cmsis_nn_context *ctx,
                                    const cmsis_nn_dims *output_dims,
                                    q15_t *output)
 {
+    ARM_NN_PROFILE_START();
     (void)bias_dims;
     (void)ctx;
     (void)fc_params->filter_offset;
@@ -83,6 +84,8 @@ arm_status arm_fully_connected_s16(const cmsis_nn_context *ctx,
         batch_cnt--;
     }
 
+    ARM_NN_PROFILE_END(ARM_NN_PROFILE_FC_S16, 0, input_dims, filter_dims, output_dims, ARM_MATH_SUCCESS);
+
     return (ARM_MATH_SUCCESS);
 }
 
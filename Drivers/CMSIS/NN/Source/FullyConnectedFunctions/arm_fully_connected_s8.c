@@ -21,8 +21,8 @@
  * Title:        arm_fully_connected_s8
  * Description:  Fully connected function compatible with TF Lite.
  *
- * $Date:        8 April 2022
- * $Revision:    V.3.1.0
+ * $Date:        18. October 2026
+ * $Revision:    V.3.2.0
  *
  * Target Processor:  Cortex-M and Cortex-A cores
  *
@@ -59,6 +59,7 @@ arm_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
                                   const cmsis_nn_dims *output_dims,
                                   q7_t *output)
 {
+    ARM_NN_PROFILE_START();
     (void)bias_dims;
     (void)ctx;
     (void)fc_params->filter_offset;
@@ -85,6 +86,9 @@ arm_status arm_fully_connected_s8(const cmsis_nn_context *ctx,
         output += output_dims->c;
         batch_cnt--;
     }
+
+    ARM_NN_PROFILE_END(ARM_NN_PROFILE_FC_S8, 0, input_dims, filter_dims, output_dims, ARM_MATH_SUCCESS);
+
     return (ARM_MATH_SUCCESS);
 }
 
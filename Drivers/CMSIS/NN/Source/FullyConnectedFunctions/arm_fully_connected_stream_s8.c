@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_stream_s8.c
+ * Description:  Fully connected function with the filter streamed in double buffered tiles
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M and Cortex-A cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+#define ALIGN_4(x) (((x) + 3) & ~3)
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * S8 fully connected layer with the filter read through a weight stream.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_fully_connected_stream_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_weight_stream *stream,
+                                         const cmsis_nn_fc_params *fc_params,
+                                         const cmsis_nn_per_tensor_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input_data,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const cmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output_data)
+{
+    const int32_t accum_depth = filter_dims->n;
+    const int32_t output_ch = output_dims->c;
+    const int32_t tile_ch = stream->tile_ch;
+
+    if (ctx->buf == NULL || tile_ch < 1 || output_ch < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t num_tiles = (output_ch + tile_ch - 1) / tile_ch;
+    const int32_t tile_size = ALIGN_4(tile_ch * accum_depth);
+    q7_t *tile_buf[2] = {(q7_t *)ctx->buf, (q7_t *)ctx->buf + tile_size};
+    const cmsis_nn_context kernel_ctx = {tile_buf[1] + tile_size, ctx->size - 2 * tile_size};
+    cmsis_nn_dims tile_input_dims = *input_dims;
+    cmsis_nn_dims tile_filter_dims = *filter_dims;
+    cmsis_nn_dims tile_output_dims = *output_dims;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    tile_input_dims.n = 1;
+    tile_output_dims.n = 1;
+
+    stream->fetch(stream->stream, 0, tile_buf[0], MIN(tile_ch, output_ch) * accum_depth);
+
+    for (int32_t tile = 0; tile < num_tiles; tile++)
+    {
+        const int32_t ch_start = tile * tile_ch;
+        const int32_t ch_count = MIN(tile_ch, output_ch - ch_start);
+
+        stream->wait(stream->stream, tile);
+
+        /* The next tile is copied to the buffer of the previous one while this one is computed */
+        if (tile + 1 < num_tiles)
+        {
+            stream->fetch(stream->stream,
+                          tile + 1,
+                          tile_buf[(tile + 1) & 1],
+                          MIN(tile_ch, output_ch - ch_start - tile_ch) * accum_depth);
+        }
+
+        tile_filter_dims.c = ch_count;
+        tile_output_dims.c = ch_count;
+
+        /* All the batches are computed while the tile is loaded */
+        for (int32_t batch = 0; batch < input_dims->n && status == ARM_MATH_SUCCESS; batch++)
+        {
+            status = arm_fully_connected_s8(&kernel_ctx,
+                                            fc_params,
+                                            quant_params,
+                                            &tile_input_dims,
+                                            input_data + batch * accum_depth,
+                                            &tile_filter_dims,
+                                            tile_buf[tile & 1],
+                                            bias_dims,
+                                            (bias_data == NULL) ? NULL : bias_data + ch_start,
+                                            &tile_output_dims,
+                                            output_data + batch * output_ch + ch_start);
+        }
+
+        if (status != ARM_MATH_SUCCESS)
+        {
+            /* No copy may be left running into the buffer once the function has returned */
+            if (tile + 1 < num_tiles)
+            {
+                stream->wait(stream->stream, tile + 1);
+            }
+            break;
+        }
+    }
+
+    return status;
+}
+
+int32_t arm_fully_connected_stream_s8_get_buffer_size(const cmsis_nn_weight_stream *stream,
+                                                      const cmsis_nn_dims *filter_dims)
+{
+    return 2 * ALIGN_4(stream->tile_ch * filter_dims->n) + arm_fully_connected_s8_get_buffer_size(filter_dims);
+}
+
+/**
+ * @} end of FC group
+ */
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_fuse_s8.c
+ * Description:  Fusion of convolutions with the residual additions that follow them
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/* Number of layers reading a tensor, and whether it is the graph output */
+static int32_t num_readers(const cmsis_nn_graph *graph, const int32_t tensor)
+{
+    int32_t count = (tensor == graph->output) ? 1 : 0;
+
+    for (int32_t i = 0; i < graph->num_layers; i++)
+    {
+        const cmsis_nn_graph_layer *layer = &graph->layers[i];
+        count += (layer->input == tensor) ? 1 : 0;
+        if (layer->op == ARM_NN_GRAPH_OP_ADD_S8 || layer->op == ARM_NN_GRAPH_OP_CONV_ADD_S8)
+        {
+            count += (layer->input_2 == tensor) ? 1 : 0;
+        }
+    }
+
+    return count;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Graph
+ * @{
+ */
+
+/*
+ * Fuse convolutions with the residual additions that follow them.
+ *
+ * Refer header file for details.
+ *
+ */
+int32_t arm_nn_graph_fuse_s8(const cmsis_nn_graph *graph, cmsis_nn_graph_layer *layers)
+{
+    int32_t num_layers = 0;
+
+    for (int32_t i = 0; i < graph->num_layers; i++)
+    {
+        const cmsis_nn_graph_layer *conv = &graph->layers[i];
+        const cmsis_nn_graph_layer *add = (i + 1 < graph->num_layers) ? &graph->layers[i + 1] : NULL;
+        const cmsis_nn_conv_params conv_params = {conv->input_offset,
+                                                  conv->output_offset,
+                                                  conv->stride,
+                                                  conv->padding,
+                                                  conv->dilation,
+                                                  conv->activation};
+        cmsis_nn_graph_layer *fused = &layers[num_layers++];
+
+        *fused = *conv;
+
+        /* The convolution result must only be read by the addition, which must not read it twice */
+        if (conv->op != ARM_NN_GRAPH_OP_CONV_S8 || add == NULL || add->op != ARM_NN_GRAPH_OP_ADD_S8 ||
+            (add->input != conv->output && add->input_2 != conv->output) || add->input == add->input_2 ||
+            num_readers(graph, conv->output) != 1 || !arm_convolve_add_s8_is_fused(&conv_params, &conv->filter_dims))
+        {
+            continue;
+        }
+
+        fused->op = ARM_NN_GRAPH_OP_CONV_ADD_S8;
+        fused->output = add->output;
+        fused->conv_output_offset = conv->output_offset;
+        fused->conv_activation = conv->activation;
+        fused->output_offset = add->output_offset;
+        fused->activation = add->activation;
+        fused->multiplier = add->multiplier;
+        fused->shift = add->shift;
+        fused->left_shift = add->left_shift;
+
+        /* The addition is symmetric: the residual is whichever input is not the convolution result */
+        if (add->input == conv->output)
+        {
+            fused->input_2 = add->input_2;
+            fused->input_2_offset = add->input_2_offset;
+            fused->input_multiplier = add->input_multiplier;
+            fused->input_shift = add->input_shift;
+            fused->input_2_multiplier = add->input_2_multiplier;
+            fused->input_2_shift = add->input_2_shift;
+        }
+        else
+        {
+            fused->input_2 = add->input;
+            fused->input_2_offset = add->input_offset;
+            fused->input_multiplier = add->input_2_multiplier;
+            fused->input_shift = add->input_2_shift;
+            fused->input_2_multiplier = add->input_multiplier;
+            fused->input_2_shift = add->input_shift;
+        }
+
+        i++;
+    }
+
+    return num_layers;
+}
+
+/**
+ * @} end of Graph group
+ */
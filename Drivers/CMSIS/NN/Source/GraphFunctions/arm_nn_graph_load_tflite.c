@@ -0,0 +1,836 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_load_tflite.c
+ * Description:  Graph of s8 layers read in place from a TensorFlow Lite flatbuffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+#include <math.h>
+#include <string.h>
+
+/* Field numbers of the tables of the TensorFlow Lite schema (schema.fbs) used here */
+#define TFL_MODEL_OPERATOR_CODES (1)
+#define TFL_MODEL_SUBGRAPHS (2)
+#define TFL_MODEL_BUFFERS (4)
+#define TFL_OPERATOR_CODE_DEPRECATED_BUILTIN_CODE (0)
+#define TFL_OPERATOR_CODE_BUILTIN_CODE (3)
+#define TFL_SUBGRAPH_TENSORS (0)
+#define TFL_SUBGRAPH_INPUTS (1)
+#define TFL_SUBGRAPH_OUTPUTS (2)
+#define TFL_SUBGRAPH_OPERATORS (3)
+#define TFL_TENSOR_SHAPE (0)
+#define TFL_TENSOR_TYPE (1)
+#define TFL_TENSOR_BUFFER (2)
+#define TFL_TENSOR_QUANTIZATION (4)
+#define TFL_QUANTIZATION_SCALE (2)
+#define TFL_QUANTIZATION_ZERO_POINT (3)
+#define TFL_BUFFER_DATA (0)
+#define TFL_OPERATOR_OPCODE_INDEX (0)
+#define TFL_OPERATOR_INPUTS (1)
+#define TFL_OPERATOR_OUTPUTS (2)
+#define TFL_OPERATOR_BUILTIN_OPTIONS (4)
+
+/* BuiltinOperator values */
+#define TFL_OP_ADD (0)
+#define TFL_OP_AVERAGE_POOL_2D (1)
+#define TFL_OP_CONV_2D (3)
+#define TFL_OP_DEPTHWISE_CONV_2D (4)
+#define TFL_OP_FULLY_CONNECTED (9)
+#define TFL_OP_MAX_POOL_2D (17)
+#define TFL_OP_RESHAPE (22)
+#define TFL_OP_SOFTMAX (25)
+
+/* TensorType values */
+#define TFL_TYPE_INT32 (2)
+#define TFL_TYPE_INT8 (9)
+
+/* ActivationFunctionType values */
+#define TFL_ACT_RELU (1)
+#define TFL_ACT_RELU_N1_TO_1 (2)
+#define TFL_ACT_RELU6 (3)
+
+/* Padding values */
+#define TFL_PADDING_SAME (0)
+#define TFL_PADDING_VALID (1)
+
+/* Bounds-checked reader of the flatbuffer. Positions are byte offsets from the start of the model. */
+typedef struct
+{
+    const uint8_t *base;
+    int32_t size;
+    int32_t error;
+} tfl_reader;
+
+/* A tensor of the subgraph */
+typedef struct
+{
+    int32_t type;
+    int32_t rank;
+    int32_t shape[4]; /* Right aligned, leading dimensions set to 1 */
+    int32_t elements;
+    int32_t data; /* Position of the constant data, 0 for an activation tensor */
+    int32_t data_size;
+    int32_t scales; /* Position of the scale vector */
+    int32_t num_scales;
+    float scale;
+    int32_t zero_point;
+} tfl_tensor;
+
+static uint32_t fb_read(tfl_reader *r, const int32_t pos, const int32_t bytes)
+{
+    uint32_t value = 0;
+
+    if (pos < 0 || pos > r->size - bytes)
+    {
+        r->error = 1;
+        return 0;
+    }
+    for (int32_t i = bytes - 1; i >= 0; i--)
+    {
+        value = (value << 8) | r->base[pos + i];
+    }
+
+    return value;
+}
+
+/* Follow the uoffset stored at pos */
+static int32_t fb_deref(tfl_reader *r, const int32_t pos)
+{
+    const uint32_t offset = fb_read(r, pos, 4);
+
+    if (r->error || offset == 0 || offset >= (uint32_t)(r->size - pos))
+    {
+        r->error = 1;
+        return 0;
+    }
+
+    return pos + (int32_t)offset;
+}
+
+/* Position of a field of a table, 0 when the field is absent */
+static int32_t fb_field(tfl_reader *r, const int32_t table, const int32_t field)
+{
+    const int64_t vtable = (int64_t)table - (int32_t)fb_read(r, table, 4);
+    int32_t vtable_size;
+    int32_t offset;
+
+    if (table <= 0 || r->error || vtable < 0 || vtable > r->size)
+    {
+        r->error = 1;
+        return 0;
+    }
+    vtable_size = (int32_t)fb_read(r, (int32_t)vtable, 2);
+    if (4 + 2 * field + 2 > vtable_size)
+    {
+        return 0;
+    }
+    offset = (int32_t)fb_read(r, (int32_t)vtable + 4 + 2 * field, 2);
+
+    return offset ? table + offset : 0;
+}
+
+static int32_t fb_scalar(tfl_reader *r, const int32_t table, const int32_t field, const int32_t bytes, const int32_t def)
+{
+    const int32_t pos = fb_field(r, table, field);
+    uint32_t value;
+
+    if (pos == 0)
+    {
+        return def;
+    }
+    value = fb_read(r, pos, bytes);
+
+    /* Sign extension of the byte and int fields */
+    return (bytes == 1) ? (int8_t)value : (int32_t)value;
+}
+
+static int32_t fb_table(tfl_reader *r, const int32_t table, const int32_t field)
+{
+    const int32_t pos = fb_field(r, table, field);
+
+    return pos ? fb_deref(r, pos) : 0;
+}
+
+/* Position of the first element of a vector field, 0 when the field is absent */
+static int32_t fb_vector(tfl_reader *r, const int32_t table, const int32_t field, const int32_t elem_size, int32_t *length)
+{
+    const int32_t pos = fb_field(r, table, field);
+    int32_t vector;
+    uint32_t count;
+
+    *length = 0;
+    if (pos == 0)
+    {
+        return 0;
+    }
+    vector = fb_deref(r, pos);
+    count = fb_read(r, vector, 4);
+    if (r->error || count > (uint32_t)(r->size - vector - 4) / (uint32_t)elem_size)
+    {
+        r->error = 1;
+        return 0;
+    }
+    *length = (int32_t)count;
+
+    return vector + 4;
+}
+
+static int32_t fb_vector_int(tfl_reader *r, const int32_t vector, const int32_t length, const int32_t index)
+{
+    if (index < 0 || index >= length)
+    {
+        r->error = 1;
+        return 0;
+    }
+
+    return (int32_t)fb_read(r, vector + 4 * index, 4);
+}
+
+static int32_t fb_vector_table(tfl_reader *r, const int32_t vector, const int32_t length, const int32_t index)
+{
+    if (index < 0 || index >= length)
+    {
+        r->error = 1;
+        return 0;
+    }
+
+    return fb_deref(r, vector + 4 * index);
+}
+
+static float fb_float(tfl_reader *r, const int32_t pos)
+{
+    const uint32_t bits = fb_read(r, pos, 4);
+    float value;
+
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+static void tfl_tensor_get(tfl_reader *r, const int32_t model, const int32_t subgraph, const int32_t index, tfl_tensor *t)
+{
+    int32_t num_tensors;
+    int32_t num_buffers;
+    const int32_t tensors = fb_vector(r, subgraph, TFL_SUBGRAPH_TENSORS, 4, &num_tensors);
+    const int32_t buffers = fb_vector(r, model, TFL_MODEL_BUFFERS, 4, &num_buffers);
+    const int32_t tensor = fb_vector_table(r, tensors, num_tensors, index);
+    const int32_t shape = fb_vector(r, tensor, TFL_TENSOR_SHAPE, 4, &t->rank);
+    const int32_t buffer_index = fb_scalar(r, tensor, TFL_TENSOR_BUFFER, 4, 0);
+    const int32_t quant = fb_table(r, tensor, TFL_TENSOR_QUANTIZATION);
+    int32_t num_zero_points = 0;
+    int32_t zero_points = 0;
+
+    t->type = fb_scalar(r, tensor, TFL_TENSOR_TYPE, 1, 0);
+    t->elements = 1;
+    t->data = 0;
+    t->data_size = 0;
+    for (int32_t i = 0; i < 4; i++)
+    {
+        t->shape[i] = 1;
+    }
+    if (t->rank > 4)
+    {
+        r->error = 1;
+        return;
+    }
+    for (int32_t i = 0; i < t->rank; i++)
+    {
+        const int32_t dim = fb_vector_int(r, shape, t->rank, i);
+        if (dim <= 0 || dim > INT32_MAX / t->elements)
+        {
+            r->error = 1;
+            return;
+        }
+        t->shape[4 - t->rank + i] = dim;
+        t->elements *= dim;
+    }
+
+    /* Buffer 0 is the empty buffer of the activation tensors */
+    if (buffer_index > 0)
+    {
+        const int32_t buffer = fb_vector_table(r, buffers, num_buffers, buffer_index);
+        t->data = fb_vector(r, buffer, TFL_BUFFER_DATA, 1, &t->data_size);
+    }
+
+    t->scales = 0;
+    t->num_scales = 0;
+    t->scale = 0.0f;
+    t->zero_point = 0;
+    if (quant)
+    {
+        t->scales = fb_vector(r, quant, TFL_QUANTIZATION_SCALE, 4, &t->num_scales);
+        zero_points = fb_vector(r, quant, TFL_QUANTIZATION_ZERO_POINT, 8, &num_zero_points);
+        if (t->num_scales > 0)
+        {
+            t->scale = fb_float(r, t->scales);
+        }
+        if (num_zero_points > 0)
+        {
+            /* int64 in the schema, in the int8 range for the tensors used here */
+            t->zero_point = (int32_t)fb_read(r, zero_points, 4);
+        }
+    }
+}
+
+/* Quantized int8 tensor, or int32 bias when type is TFL_TYPE_INT32 */
+static void tfl_check_quantized(tfl_reader *r, const tfl_tensor *t, const int32_t type)
+{
+    if (t->type != type || t->num_scales < 1 || !(t->scale > 0.0f) || !isfinite(t->scale) ||
+        t->zero_point < NN_Q7_MIN || t->zero_point > NN_Q7_MAX)
+    {
+        r->error = 1;
+    }
+}
+
+/* QuantizeMultiplier() of TensorFlow Lite. Multipliers too large for a right shift are not supported. */
+static void tfl_quantize_multiplier(tfl_reader *r, const double real_multiplier, int32_t *multiplier, int32_t *shift)
+{
+    int exponent = 0;
+    int64_t q_fixed;
+
+    *multiplier = 0;
+    *shift = 0;
+    if (!(real_multiplier >= 0.0) || !isfinite(real_multiplier))
+    {
+        r->error = 1;
+        return;
+    }
+    if (real_multiplier == 0.0)
+    {
+        return;
+    }
+    q_fixed = (int64_t)round(frexp(real_multiplier, &exponent) * (double)(1LL << 31));
+    if (q_fixed == (1LL << 31))
+    {
+        q_fixed /= 2;
+        exponent++;
+    }
+    if (exponent < -31)
+    {
+        exponent = 0;
+        q_fixed = 0;
+    }
+    if (exponent > 31)
+    {
+        r->error = 1;
+        return;
+    }
+    *multiplier = (int32_t)q_fixed;
+    *shift = exponent;
+}
+
+/* Quantized value of f in the output tensor, clamped before the conversion: the activation range saturates */
+static int32_t tfl_quantize(const float f, const tfl_tensor *t)
+{
+    const float q = roundf(f / t->scale);
+
+    return t->zero_point + (int32_t)MAX(MIN(q, 512.0f), -512.0f);
+}
+
+/* CalculateActivationRangeQuantized() of TensorFlow Lite for an int8 output */
+static cmsis_nn_activation tfl_activation(tfl_reader *r, const int32_t activation, const tfl_tensor *output)
+{
+    cmsis_nn_activation range = {NN_Q7_MIN, NN_Q7_MAX};
+
+    if (activation == TFL_ACT_RELU || activation == TFL_ACT_RELU6)
+    {
+        range.min = MAX(NN_Q7_MIN, tfl_quantize(0.0f, output));
+    }
+    if (activation == TFL_ACT_RELU6)
+    {
+        range.max = MIN(NN_Q7_MAX, tfl_quantize(6.0f, output));
+    }
+    if (activation == TFL_ACT_RELU_N1_TO_1)
+    {
+        range.min = MAX(NN_Q7_MIN, tfl_quantize(-1.0f, output));
+        range.max = MIN(NN_Q7_MAX, tfl_quantize(1.0f, output));
+    }
+    if (activation < 0 || activation > TFL_ACT_RELU6)
+    {
+        /* Fused activation not supported */
+        r->error = 1;
+    }
+
+    return range;
+}
+
+/*
+ * Padding of a window along one dimension, as ComputePaddingHeightWidth() of TensorFlow Lite.
+ * Sets the error flag if the parameters are not valid or do not give output_size.
+ */
+static int32_t tfl_padding(tfl_reader *r,
+                           const int32_t padding,
+                           const int32_t stride,
+                           const int32_t dilation,
+                           const int32_t input_size,
+                           const int32_t filter_size,
+                           const int32_t output_size)
+{
+    int64_t effective_filter_size;
+    int64_t expected_output_size;
+    int64_t total;
+
+    if ((padding != TFL_PADDING_SAME && padding != TFL_PADDING_VALID) || stride <= 0 || dilation <= 0 ||
+        filter_size <= 0)
+    {
+        r->error = 1;
+        return 0;
+    }
+    effective_filter_size = (int64_t)(filter_size - 1) * dilation + 1;
+    expected_output_size = (padding == TFL_PADDING_SAME)
+        ? ((int64_t)input_size + stride - 1) / stride
+        : ((int64_t)input_size + stride - effective_filter_size) / stride;
+    total = (expected_output_size - 1) * stride + effective_filter_size - input_size;
+    if (expected_output_size != output_size || effective_filter_size > INT32_MAX)
+    {
+        r->error = 1;
+        return 0;
+    }
+
+    return (int32_t)(MAX(total, 0) / 2);
+}
+
+static cmsis_nn_dims tfl_dims(const tfl_tensor *t)
+{
+    const cmsis_nn_dims dims = {t->shape[0], t->shape[1], t->shape[2], t->shape[3]};
+
+    return dims;
+}
+
+/* Byte offset of constant data in the model. Checks its type, size and alignment. */
+static int32_t tfl_constant(tfl_reader *r, const tfl_tensor *t, const int32_t type, const int32_t elements)
+{
+    const int32_t elem_size = (type == TFL_TYPE_INT32) ? 4 : 1;
+
+    if (t->type != type || t->data == 0 || t->elements < elements ||
+        (int64_t)t->data_size < (int64_t)t->elements * elem_size ||
+        ((uintptr_t)(r->base + t->data) & (uintptr_t)(elem_size - 1)) != 0)
+    {
+        r->error = 1;
+        return -1;
+    }
+
+    return t->data;
+}
+
+/* Input tensor of an operator: the graph input or the output of an earlier operator */
+static void tfl_check_defined(tfl_reader *r, const int32_t *tensor_sizes, const int32_t tensor)
+{
+    if (tensor_sizes != NULL && tensor_sizes[tensor] <= 0)
+    {
+        r->error = 1;
+    }
+}
+
+/*
+ * Read the model. With buf NULL, only computes the buffer size.
+ * Returns the buffer size in bytes, or -1 if the model is malformed or not supported.
+ */
+static int32_t tfl_parse(tfl_reader *r, int8_t *buf, cmsis_nn_graph *graph)
+{
+    const int32_t model = fb_deref(r, 0);
+    int32_t num_opcodes;
+    int32_t num_subgraphs;
+    int32_t num_tensors;
+    int32_t num_operators;
+    int32_t num_inputs;
+    int32_t num_outputs;
+    const int32_t opcodes = fb_vector(r, model, TFL_MODEL_OPERATOR_CODES, 4, &num_opcodes);
+    const int32_t subgraphs = fb_vector(r, model, TFL_MODEL_SUBGRAPHS, 4, &num_subgraphs);
+    const int32_t subgraph = fb_vector_table(r, subgraphs, num_subgraphs, 0);
+    const int32_t operators = fb_vector(r, subgraph, TFL_SUBGRAPH_OPERATORS, 4, &num_operators);
+    const int32_t inputs = fb_vector(r, subgraph, TFL_SUBGRAPH_INPUTS, 4, &num_inputs);
+    const int32_t outputs = fb_vector(r, subgraph, TFL_SUBGRAPH_OUTPUTS, 4, &num_outputs);
+    cmsis_nn_graph_layer *layers = (cmsis_nn_graph_layer *)buf;
+    int32_t *tensor_sizes = NULL;
+    int32_t *quant = NULL;
+    int64_t quant_size = 0;
+    int64_t size;
+    int32_t graph_input;
+    int32_t graph_output;
+
+    (void)fb_vector(r, subgraph, TFL_SUBGRAPH_TENSORS, 4, &num_tensors);
+    graph_input = fb_vector_int(r, inputs, num_inputs, 0);
+    graph_output = fb_vector_int(r, outputs, num_outputs, 0);
+    if (r->error || num_inputs != 1 || num_outputs != 1 || num_operators == 0 || graph_input < 0 ||
+        graph_input >= num_tensors || graph_output < 0 || graph_output >= num_tensors)
+    {
+        return -1;
+    }
+
+    if (buf != NULL)
+    {
+        tensor_sizes = (int32_t *)(buf + num_operators * (int32_t)sizeof(cmsis_nn_graph_layer));
+        quant = tensor_sizes + num_tensors;
+
+        /* Sizes of the activation tensors, negative until the tensor is written. Constant tensors are read in
+           place from the model. */
+        for (int32_t i = 0; i < num_tensors && !r->error; i++)
+        {
+            tfl_tensor t;
+            tfl_tensor_get(r, model, subgraph, i, &t);
+            tensor_sizes[i] = (t.data == 0 && t.type == TFL_TYPE_INT8) ? -t.elements : 0;
+        }
+        tensor_sizes[graph_input] = -tensor_sizes[graph_input];
+    }
+
+    for (int32_t i = 0; i < num_operators && !r->error; i++)
+    {
+        const int32_t op = fb_vector_table(r, operators, num_operators, i);
+        const int32_t opcode =
+            fb_vector_table(r, opcodes, num_opcodes, fb_scalar(r, op, TFL_OPERATOR_OPCODE_INDEX, 4, 0));
+        const int32_t code = MAX(fb_scalar(r, opcode, TFL_OPERATOR_CODE_DEPRECATED_BUILTIN_CODE, 1, 0),
+                                 fb_scalar(r, opcode, TFL_OPERATOR_CODE_BUILTIN_CODE, 4, 0));
+        const int32_t options = fb_table(r, op, TFL_OPERATOR_BUILTIN_OPTIONS);
+        int32_t num_op_inputs;
+        int32_t num_op_outputs;
+        const int32_t op_inputs = fb_vector(r, op, TFL_OPERATOR_INPUTS, 4, &num_op_inputs);
+        const int32_t op_outputs = fb_vector(r, op, TFL_OPERATOR_OUTPUTS, 4, &num_op_outputs);
+        const int32_t input_index = fb_vector_int(r, op_inputs, num_op_inputs, 0);
+        const int32_t output_index = fb_vector_int(r, op_outputs, num_op_outputs, 0);
+        cmsis_nn_graph_layer layer;
+        tfl_tensor input;
+        tfl_tensor output;
+        tfl_tensor filter;
+        tfl_tensor bias;
+
+        if (r->error)
+        {
+            break;
+        }
+        tfl_tensor_get(r, model, subgraph, input_index, &input);
+        tfl_tensor_get(r, model, subgraph, output_index, &output);
+        tfl_check_quantized(r, &input, TFL_TYPE_INT8);
+        tfl_check_quantized(r, &output, TFL_TYPE_INT8);
+        if (r->error || input.data != 0 || output.data != 0)
+        {
+            r->error = 1;
+            break;
+        }
+        tfl_check_defined(r, tensor_sizes, input_index);
+
+        memset(&layer, 0, sizeof(layer));
+        layer.input = input_index;
+        layer.input_2 = -1;
+        layer.output = output_index;
+        layer.input_dims = tfl_dims(&input);
+        layer.output_dims = tfl_dims(&output);
+        layer.stride.w = layer.stride.h = 1;
+        layer.dilation.w = layer.dilation.h = 1;
+        layer.ch_mult = 1;
+        layer.input_offset = -input.zero_point;
+        layer.output_offset = output.zero_point;
+        layer.activation.min = NN_Q7_MIN;
+        layer.activation.max = NN_Q7_MAX;
+        layer.weights = -1;
+        layer.bias = -1;
+
+        switch (code)
+        {
+        case TFL_OP_CONV_2D:
+        case TFL_OP_DEPTHWISE_CONV_2D: {
+            const int32_t depthwise = (code == TFL_OP_DEPTHWISE_CONV_2D);
+            /* Conv2DOptions: padding, stride_w, stride_h, activation, dilation_w, dilation_h.
+               DepthwiseConv2DOptions has depth_multiplier before the activation. */
+            const int32_t padding = fb_scalar(r, options, 0, 1, 0);
+            const int32_t activation = fb_scalar(r, options, depthwise ? 4 : 3, 1, 0);
+            const int32_t input_ch = input.shape[3];
+            const int32_t output_ch = output.shape[3];
+
+            tfl_tensor_get(r, model, subgraph, fb_vector_int(r, op_inputs, num_op_inputs, 1), &filter);
+            tfl_check_quantized(r, &filter, TFL_TYPE_INT8);
+            if (r->error || input.rank != 4 || output.rank != 4 || filter.rank != 4 || filter.zero_point != 0 ||
+                input.shape[0] != output.shape[0] || (filter.num_scales != 1 && filter.num_scales != output_ch) ||
+                (depthwise ? (filter.shape[0] != 1 || filter.shape[3] != output_ch || output_ch % input_ch != 0)
+                           : (filter.shape[0] != output_ch || filter.shape[3] != input_ch)))
+            {
+                r->error = 1;
+                break;
+            }
+
+            layer.op = depthwise ? ARM_NN_GRAPH_OP_DEPTHWISE_CONV_S8 : ARM_NN_GRAPH_OP_CONV_S8;
+            layer.filter_dims = tfl_dims(&filter);
+            layer.stride.w = fb_scalar(r, options, 1, 4, 1);
+            layer.stride.h = fb_scalar(r, options, 2, 4, 1);
+            layer.dilation.w = fb_scalar(r, options, depthwise ? 5 : 4, 4, 1);
+            layer.dilation.h = fb_scalar(r, options, depthwise ? 6 : 5, 4, 1);
+            layer.padding.w = tfl_padding(
+                r, padding, layer.stride.w, layer.dilation.w, input.shape[2], filter.shape[2], output.shape[2]);
+            layer.padding.h = tfl_padding(
+                r, padding, layer.stride.h, layer.dilation.h, input.shape[1], filter.shape[1], output.shape[1]);
+            layer.ch_mult = depthwise ? output_ch / input_ch : 1;
+            layer.activation = tfl_activation(r, activation, &output);
+            layer.weights = tfl_constant(r, &filter, TFL_TYPE_INT8, filter.elements);
+            if (num_op_inputs > 2 && fb_vector_int(r, op_inputs, num_op_inputs, 2) >= 0)
+            {
+                tfl_tensor_get(r, model, subgraph, fb_vector_int(r, op_inputs, num_op_inputs, 2), &bias);
+                layer.bias = tfl_constant(r, &bias, TFL_TYPE_INT32, output_ch);
+            }
+
+            /* Per-channel multipliers, then shifts */
+            layer.multipliers = (int32_t)quant_size * (int32_t)sizeof(int32_t);
+            layer.shifts = layer.multipliers + output_ch * (int32_t)sizeof(int32_t);
+            for (int32_t ch = 0; ch < output_ch && buf != NULL; ch++)
+            {
+                const float filter_scale = fb_float(r, filter.scales + 4 * (filter.num_scales > 1 ? ch : 0));
+                const double effective_scale = (double)input.scale * (double)filter_scale / (double)output.scale;
+                tfl_quantize_multiplier(
+                    r, effective_scale, &quant[quant_size + ch], &quant[quant_size + output_ch + ch]);
+            }
+            quant_size += 2 * (int64_t)output_ch;
+            if (quant_size > INT32_MAX / 4)
+            {
+                r->error = 1;
+            }
+            break;
+        }
+        case TFL_OP_FULLY_CONNECTED: {
+            /* FullyConnectedOptions: activation, weights_format */
+            const int32_t activation = fb_scalar(r, options, 0, 1, 0);
+            const int32_t weights_format = fb_scalar(r, options, 1, 1, 0);
+            int32_t accum_depth;
+            int32_t output_ch;
+
+            tfl_tensor_get(r, model, subgraph, fb_vector_int(r, op_inputs, num_op_inputs, 1), &filter);
+            tfl_check_quantized(r, &filter, TFL_TYPE_INT8);
+            accum_depth = filter.shape[3];
+            output_ch = filter.shape[2];
+            if (r->error || weights_format != 0 || filter.rank != 2 || filter.zero_point != 0 ||
+                input.elements % accum_depth != 0 || output.elements != (input.elements / accum_depth) * output_ch)
+            {
+                r->error = 1;
+                break;
+            }
+
+            layer.op = ARM_NN_GRAPH_OP_FULLY_CONNECTED_S8;
+            layer.input_dims.n = input.elements / accum_depth;
+            layer.input_dims.h = layer.input_dims.w = 1;
+            layer.input_dims.c = accum_depth;
+            layer.filter_dims.n = accum_depth;
+            layer.filter_dims.h = layer.filter_dims.w = 1;
+            layer.filter_dims.c = output_ch;
+            layer.output_dims.n = layer.input_dims.n;
+            layer.output_dims.h = layer.output_dims.w = 1;
+            layer.output_dims.c = output_ch;
+            layer.activation = tfl_activation(r, activation, &output);
+            layer.weights = tfl_constant(r, &filter, TFL_TYPE_INT8, filter.elements);
+            if (num_op_inputs > 2 && fb_vector_int(r, op_inputs, num_op_inputs, 2) >= 0)
+            {
+                tfl_tensor_get(r, model, subgraph, fb_vector_int(r, op_inputs, num_op_inputs, 2), &bias);
+                layer.bias = tfl_constant(r, &bias, TFL_TYPE_INT32, output_ch);
+            }
+            /* GetQuantizedConvolutionMultipler(): the scale product is a float */
+            tfl_quantize_multiplier(
+                r, (double)(input.scale * filter.scale) / (double)output.scale, &layer.multiplier, &layer.shift);
+            break;
+        }
+        case TFL_OP_AVERAGE_POOL_2D:
+        case TFL_OP_MAX_POOL_2D: {
+            /* Pool2DOptions: padding, stride_w, stride_h, filter_width, filter_height, activation */
+            const int32_t padding = fb_scalar(r, options, 0, 1, 0);
+
+            /* The pooling functions do not requantize */
+            if (input.rank != 4 || output.rank != 4 || input.shape[0] != output.shape[0] ||
+                input.shape[3] != output.shape[3] || input.scale != output.scale ||
+                input.zero_point != output.zero_point)
+            {
+                r->error = 1;
+                break;
+            }
+            layer.op = (code == TFL_OP_AVERAGE_POOL_2D) ? ARM_NN_GRAPH_OP_AVGPOOL_S8 : ARM_NN_GRAPH_OP_MAX_POOL_S8;
+            layer.stride.w = fb_scalar(r, options, 1, 4, 1);
+            layer.stride.h = fb_scalar(r, options, 2, 4, 1);
+            layer.filter_dims.n = layer.filter_dims.c = 1;
+            layer.filter_dims.w = fb_scalar(r, options, 3, 4, 1);
+            layer.filter_dims.h = fb_scalar(r, options, 4, 4, 1);
+            layer.padding.w =
+                tfl_padding(r, padding, layer.stride.w, 1, input.shape[2], layer.filter_dims.w, output.shape[2]);
+            layer.padding.h =
+                tfl_padding(r, padding, layer.stride.h, 1, input.shape[1], layer.filter_dims.h, output.shape[1]);
+            layer.activation = tfl_activation(r, fb_scalar(r, options, 5, 1, 0), &output);
+            break;
+        }
+        case TFL_OP_SOFTMAX: {
+            /* SoftmaxOptions: beta. PreprocessSoftmaxScaling() and CalculateInputRadius() with 5 integer bits. */
+            const int32_t beta_pos = fb_field(r, options, 0);
+            const double beta = beta_pos ? (double)fb_float(r, beta_pos) : 0.0;
+            const double real_multiplier =
+                MIN(beta * (double)input.scale * (double)(1 << (31 - 5)), (double)(1LL << 31) - 1.0);
+
+            /* arm_softmax_s8() writes the int8 output with scale 1/256 and zero point -128 */
+            if (input.elements != output.elements || output.zero_point != NN_Q7_MIN ||
+                output.scale != 1.0f / 256.0f)
+            {
+                r->error = 1;
+                break;
+            }
+            layer.op = ARM_NN_GRAPH_OP_SOFTMAX_S8;
+            tfl_quantize_multiplier(r, real_multiplier, &layer.multiplier, &layer.shift);
+            if (r->error || layer.shift < 0)
+            {
+                r->error = 1;
+                break;
+            }
+            layer.diff_min = -(int32_t)floor(1.0 * ((1 << 5) - 1) * (double)(1LL << (31 - 5)) /
+                                             (double)(1LL << layer.shift));
+            break;
+        }
+        case TFL_OP_ADD: {
+            /* AddOptions: activation. CalculateOpDataAdd() for int8. */
+            tfl_tensor input_2;
+            const int32_t input_2_index = fb_vector_int(r, op_inputs, num_op_inputs, 1);
+            double twice_max_input_scale;
+
+            tfl_tensor_get(r, model, subgraph, input_2_index, &input_2);
+            tfl_check_quantized(r, &input_2, TFL_TYPE_INT8);
+            if (r->error || input_2.data != 0 || input.elements != output.elements ||
+                input_2.elements != output.elements)
+            {
+                r->error = 1;
+                break;
+            }
+            tfl_check_defined(r, tensor_sizes, input_2_index);
+            layer.op = ARM_NN_GRAPH_OP_ADD_S8;
+            layer.input_2 = input_2_index;
+            layer.input_2_offset = -input_2.zero_point;
+            layer.left_shift = 20;
+            twice_max_input_scale = 2 * (double)MAX(input.scale, input_2.scale);
+            tfl_quantize_multiplier(
+                r, (double)input.scale / twice_max_input_scale, &layer.input_multiplier, &layer.input_shift);
+            tfl_quantize_multiplier(
+                r, (double)input_2.scale / twice_max_input_scale, &layer.input_2_multiplier, &layer.input_2_shift);
+            tfl_quantize_multiplier(r,
+                                    twice_max_input_scale / ((1 << layer.left_shift) * (double)output.scale),
+                                    &layer.multiplier,
+                                    &layer.shift);
+            layer.activation = tfl_activation(r, fb_scalar(r, options, 0, 1, 0), &output);
+            break;
+        }
+        case TFL_OP_RESHAPE:
+            if (input.elements != output.elements)
+            {
+                r->error = 1;
+            }
+            layer.op = ARM_NN_GRAPH_OP_RESHAPE_S8;
+            break;
+        default:
+            /* Operator not supported */
+            r->error = 1;
+            break;
+        }
+
+        if (buf != NULL && !r->error)
+        {
+            /* Each tensor is written once, and not over the graph input */
+            if (tensor_sizes[output_index] >= 0)
+            {
+                r->error = 1;
+            }
+            tensor_sizes[output_index] = -tensor_sizes[output_index];
+            layers[i] = layer;
+        }
+    }
+
+    size = (int64_t)num_operators * (int64_t)sizeof(cmsis_nn_graph_layer) +
+        ((int64_t)num_tensors + quant_size) * (int64_t)sizeof(int32_t);
+    if (r->error || size > INT32_MAX)
+    {
+        return -1;
+    }
+
+    if (buf != NULL)
+    {
+        if (tensor_sizes[graph_output] <= 0)
+        {
+            return -1;
+        }
+        /* Tensors which are never written are not used */
+        for (int32_t i = 0; i < num_tensors; i++)
+        {
+            tensor_sizes[i] = MAX(tensor_sizes[i], 0);
+        }
+
+        graph->layers = layers;
+        graph->num_layers = num_operators;
+        graph->tensor_sizes = tensor_sizes;
+        graph->num_tensors = num_tensors;
+        graph->input = graph_input;
+        graph->output = graph_output;
+        graph->params = (const int8_t *)r->base;
+        graph->quant_params = (const int8_t *)quant;
+    }
+
+    return (int32_t)size;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Graph
+ * @{
+ */
+
+/*
+ * Graph of s8 layers read in place from a TensorFlow Lite flatbuffer.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_graph_load_tflite(const cmsis_nn_context *ctx,
+                                    const uint8_t *model,
+                                    const int32_t model_size,
+                                    cmsis_nn_graph *graph)
+{
+    tfl_reader reader = {model, model_size, 0};
+    const int32_t size = arm_nn_graph_load_tflite_get_buffer_size(model, model_size);
+
+    if (size < 0 || ctx == NULL || ctx->buf == NULL || ctx->size < size || ((uintptr_t)ctx->buf & 3U) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    return (tfl_parse(&reader, (int8_t *)ctx->buf, graph) < 0) ? ARM_MATH_ARGUMENT_ERROR : ARM_MATH_SUCCESS;
+}
+
+int32_t arm_nn_graph_load_tflite_get_buffer_size(const uint8_t *model, const int32_t model_size)
+{
+    tfl_reader reader = {model, model_size, 0};
+
+    if (model == NULL || model_size < 8 || memcmp(model + 4, "TFL3", 4) != 0)
+    {
+        return -1;
+    }
+
+    return tfl_parse(&reader, NULL, NULL);
+}
+
+/**
+ * @} end of Graph group
+ */
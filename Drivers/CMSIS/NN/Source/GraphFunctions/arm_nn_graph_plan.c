@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_plan.c
+ * Description:  Arena planning of a graph of s8 layers
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+#define ALIGN_4(x) (((x) + 3) & ~3)
+
+static int32_t is_tensor(const cmsis_nn_graph *graph, const int32_t tensor)
+{
+    return tensor >= 0 && tensor < graph->num_tensors;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Graph
+ * @{
+ */
+
+/*
+ * Arena planning of a graph.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_graph_plan(const cmsis_nn_context *ctx, const cmsis_nn_graph *graph, cmsis_nn_graph_plan *plan)
+{
+    /* Buffers are numbered as the plan offsets: the tensors first, then the scratch buffer of each layer */
+    const int32_t num_buffers = graph->num_tensors + graph->num_layers;
+    int32_t *offsets = plan->offsets;
+    int32_t *sizes = (int32_t *)ctx->buf;
+    int32_t *first = sizes + num_buffers;
+    int32_t *last = first + num_buffers;
+    int32_t max_scratch = 0;
+
+    if (!is_tensor(graph, graph->input) || !is_tensor(graph, graph->output))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    for (int32_t i = 0; i < graph->num_layers; i++)
+    {
+        const cmsis_nn_graph_layer *layer = &graph->layers[i];
+
+        if (layer->op < 0 || layer->op >= ARM_NN_GRAPH_OP_COUNT || !is_tensor(graph, layer->input) ||
+            !is_tensor(graph, layer->output) ||
+            ((layer->op == ARM_NN_GRAPH_OP_ADD_S8 || layer->op == ARM_NN_GRAPH_OP_CONV_ADD_S8) &&
+             !is_tensor(graph, layer->input_2)))
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    /* Lifetimes: the graph input is alive before the first layer, the graph output after the last one */
+    for (int32_t i = 0; i < graph->num_tensors; i++)
+    {
+        sizes[i] = ALIGN_4(graph->tensor_sizes[i]);
+        first[i] = (i == graph->input) ? -1 : graph->num_layers;
+        last[i] = (i == graph->output) ? graph->num_layers : -1;
+    }
+    for (int32_t i = 0; i < graph->num_layers; i++)
+    {
+        const cmsis_nn_graph_layer *layer = &graph->layers[i];
+        const int32_t scratch = graph->num_tensors + i;
+
+        first[layer->output] = MIN(first[layer->output], i);
+        last[layer->output] = MAX(last[layer->output], i);
+        last[layer->input] = MAX(last[layer->input], i);
+        if (layer->op == ARM_NN_GRAPH_OP_ADD_S8 || layer->op == ARM_NN_GRAPH_OP_CONV_ADD_S8)
+        {
+            last[layer->input_2] = MAX(last[layer->input_2], i);
+        }
+
+        sizes[scratch] = ALIGN_4(arm_nn_graph_scratch_size(layer));
+        first[scratch] = i;
+        last[scratch] = i;
+        max_scratch = MAX(max_scratch, sizes[scratch]);
+    }
+
+    plan->arena_size = 0;
+    plan->naive_size = max_scratch;
+    for (int32_t i = 0; i < num_buffers; i++)
+    {
+        offsets[i] = -1;
+        if (i < graph->num_tensors && first[i] <= last[i])
+        {
+            plan->naive_size += sizes[i];
+        }
+    }
+
+    for (int32_t count = 0; count < num_buffers; count++)
+    {
+        int32_t buffer = -1;
+        int32_t size = -1;
+
+        /* Largest buffer not placed yet */
+        for (int32_t i = 0; i < num_buffers; i++)
+        {
+            if (offsets[i] < 0 && sizes[i] > size)
+            {
+                buffer = i;
+                size = sizes[i];
+            }
+        }
+
+        if (size == 0 || first[buffer] > last[buffer])
+        {
+            offsets[buffer] = 0;
+            continue;
+        }
+
+        /* Candidate offsets are 0 and the ends of the placed buffers alive at the same time.
+           Keep the one leaving the smallest gap before the next of these buffers. */
+        int32_t best_offset = -1;
+        int32_t best_gap = 0;
+        for (int32_t c = -1; c < num_buffers; c++)
+        {
+            int32_t candidate = 0;
+            int32_t gap = INT32_MAX;
+
+            if (c >= 0)
+            {
+                if (offsets[c] < 0 || first[c] > last[c] || last[c] < first[buffer] || first[c] > last[buffer])
+                {
+                    continue;
+                }
+                candidate = offsets[c] + sizes[c];
+            }
+
+            for (int32_t p = 0; p < num_buffers && gap >= 0; p++)
+            {
+                if (offsets[p] < 0 || sizes[p] == 0 || first[p] > last[p] || last[p] < first[buffer] ||
+                    first[p] > last[buffer])
+                {
+                    continue;
+                }
+                if (offsets[p] < candidate + size && candidate < offsets[p] + sizes[p])
+                {
+                    gap = -1;
+                }
+                else if (offsets[p] >= candidate + size)
+                {
+                    gap = MIN(gap, offsets[p] - candidate - size);
+                }
+            }
+
+            if (gap >= 0 && (best_offset < 0 || gap < best_gap || (gap == best_gap && candidate < best_offset)))
+            {
+                best_offset = candidate;
+                best_gap = gap;
+            }
+        }
+
+        offsets[buffer] = best_offset;
+        plan->arena_size = MAX(plan->arena_size, best_offset + size);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_nn_graph_plan_get_buffer_size(const cmsis_nn_graph *graph)
+{
+    return 3 * (graph->num_tensors + graph->num_layers) * (int32_t)sizeof(int32_t);
+}
+
+/**
+ * @} end of Graph group
+ */
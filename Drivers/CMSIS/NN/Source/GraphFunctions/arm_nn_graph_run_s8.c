@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_run_s8.c
+ * Description:  Run a graph of s8 layers from a planned arena
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Graph
+ * @{
+ */
+
+/*
+ * Run a graph of s8 layers.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_graph_run_s8(const cmsis_nn_graph *graph, const cmsis_nn_graph_plan *plan, int8_t *arena)
+{
+    arm_status status = ARM_MATH_SUCCESS;
+    const int8_t *quant_params = graph->quant_params ? graph->quant_params : graph->params;
+
+    for (int32_t i = 0; i < graph->num_layers && status == ARM_MATH_SUCCESS; i++)
+    {
+        const cmsis_nn_graph_layer *layer = &graph->layers[i];
+        const int8_t *input = arena + plan->offsets[layer->input];
+        int8_t *output = arena + plan->offsets[layer->output];
+        const int8_t *weights = (layer->weights < 0) ? NULL : graph->params + layer->weights;
+        const int32_t *bias = (layer->bias < 0) ? NULL : (const int32_t *)(graph->params + layer->bias);
+        const cmsis_nn_dims bias_dims = {1, 1, 1, layer->output_dims.c};
+        cmsis_nn_context ctx;
+        cmsis_nn_per_channel_quant_params channel_quant;
+
+        ctx.size = arm_nn_graph_scratch_size(layer);
+        ctx.buf = (ctx.size > 0) ? arena + plan->offsets[graph->num_tensors + i] : NULL;
+        channel_quant.multiplier = (int32_t *)(quant_params + layer->multipliers);
+        channel_quant.shift = (int32_t *)(quant_params + layer->shifts);
+
+        switch (layer->op)
+        {
+        case ARM_NN_GRAPH_OP_CONV_S8: {
+            const cmsis_nn_conv_params conv_params = {layer->input_offset,
+                                                      layer->output_offset,
+                                                      layer->stride,
+                                                      layer->padding,
+                                                      layer->dilation,
+                                                      layer->activation};
+            status = arm_convolve_wrapper_s8(&ctx,
+                                             &conv_params,
+                                             &channel_quant,
+                                             &layer->input_dims,
+                                             input,
+                                             &layer->filter_dims,
+                                             weights,
+                                             &bias_dims,
+                                             bias,
+                                             &layer->output_dims,
+                                             output);
+            break;
+        }
+        case ARM_NN_GRAPH_OP_DEPTHWISE_CONV_S8: {
+            const cmsis_nn_dw_conv_params dw_conv_params = {layer->input_offset,
+                                                            layer->output_offset,
+                                                            layer->ch_mult,
+                                                            layer->stride,
+                                                            layer->padding,
+                                                            layer->dilation,
+                                                            layer->activation};
+            status = arm_depthwise_conv_wrapper_s8(&ctx,
+                                                   &dw_conv_params,
+                                                   &channel_quant,
+                                                   &layer->input_dims,
+                                                   input,
+                                                   &layer->filter_dims,
+                                                   weights,
+                                                   &bias_dims,
+                                                   bias,
+                                                   &layer->output_dims,
+                                                   output);
+            break;
+        }
+        case ARM_NN_GRAPH_OP_FULLY_CONNECTED_S8: {
+            const cmsis_nn_fc_params fc_params = {
+                layer->input_offset, 0, layer->output_offset, layer->activation};
+            const cmsis_nn_per_tensor_quant_params tensor_quant = {layer->multiplier, layer->shift};
+            status = arm_fully_connected_s8(&ctx,
+                                            &fc_params,
+                                            &tensor_quant,
+                                            &layer->input_dims,
+                                            input,
+                                            &layer->filter_dims,
+                                            weights,
+                                            &bias_dims,
+                                            bias,
+                                            &layer->output_dims,
+                                            output);
+            break;
+        }
+        case ARM_NN_GRAPH_OP_AVGPOOL_S8:
+        case ARM_NN_GRAPH_OP_MAX_POOL_S8: {
+            const cmsis_nn_pool_params pool_params = {layer->stride, layer->padding, layer->activation};
+            if (layer->op == ARM_NN_GRAPH_OP_AVGPOOL_S8)
+            {
+                status = arm_avgpool_s8(
+                    &ctx, &pool_params, &layer->input_dims, input, &layer->filter_dims, &layer->output_dims, output);
+            }
+            else
+            {
+                status = arm_max_pool_s8(
+                    &ctx, &pool_params, &layer->input_dims, input, &layer->filter_dims, &layer->output_dims, output);
+            }
+            break;
+        }
+        case ARM_NN_GRAPH_OP_SOFTMAX_S8:
+            arm_softmax_s8(input,
+                           layer->input_dims.n * layer->input_dims.h * layer->input_dims.w,
+                           layer->input_dims.c,
+                           layer->multiplier,
+                           layer->shift,
+                           layer->diff_min,
+                           output);
+            break;
+        case ARM_NN_GRAPH_OP_ADD_S8:
+            status = arm_elementwise_add_s8(input,
+                                            arena + plan->offsets[layer->input_2],
+                                            layer->input_offset,
+                                            layer->input_multiplier,
+                                            layer->input_shift,
+                                            layer->input_2_offset,
+                                            layer->input_2_multiplier,
+                                            layer->input_2_shift,
+                                            layer->left_shift,
+                                            output,
+                                            layer->output_offset,
+                                            layer->multiplier,
+                                            layer->shift,
+                                            layer->activation.min,
+                                            layer->activation.max,
+                                            graph->tensor_sizes[layer->output]);
+            break;
+        case ARM_NN_GRAPH_OP_CONV_ADD_S8: {
+            const cmsis_nn_conv_params conv_params = {layer->input_offset,
+                                                      layer->conv_output_offset,
+                                                      layer->stride,
+                                                      layer->padding,
+                                                      layer->dilation,
+                                                      layer->conv_activation};
+            const cmsis_nn_add_params add_params = {-layer->conv_output_offset,
+                                                    layer->input_multiplier,
+                                                    layer->input_shift,
+                                                    layer->input_2_offset,
+                                                    layer->input_2_multiplier,
+                                                    layer->input_2_shift,
+                                                    layer->left_shift,
+                                                    layer->output_offset,
+                                                    layer->multiplier,
+                                                    layer->shift,
+                                                    layer->activation};
+            status = arm_convolve_add_wrapper_s8(&ctx,
+                                                 &conv_params,
+                                                 &channel_quant,
+                                                 &add_params,
+                                                 &layer->input_dims,
+                                                 input,
+                                                 &layer->filter_dims,
+                                                 weights,
+                                                 &bias_dims,
+                                                 bias,
+                                                 arena + plan->offsets[layer->input_2],
+                                                 &layer->output_dims,
+                                                 output);
+            break;
+        }
+        case ARM_NN_GRAPH_OP_RESHAPE_S8:
+            arm_reshape_s8(input, output, (uint32_t)graph->tensor_sizes[layer->output]);
+            break;
+        default:
+            status = ARM_MATH_ARGUMENT_ERROR;
+            break;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @} end of Graph group
+ */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_scratch_size.c
+ * Description:  Scratch buffer size of a graph layer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * Scratch buffer size of a graph layer
+ *
+ * Refer header file for details.
+ *
+ */
+int32_t arm_nn_graph_scratch_size(const cmsis_nn_graph_layer *layer)
+{
+    int32_t size = 0;
+
+    switch (layer->op)
+    {
+    case ARM_NN_GRAPH_OP_CONV_S8: {
+        const cmsis_nn_conv_params conv_params = {layer->input_offset,
+                                                  layer->output_offset,
+                                                  layer->stride,
+                                                  layer->padding,
+                                                  layer->dilation,
+                                                  layer->activation};
+        size = arm_convolve_wrapper_s8_get_buffer_size(
+            &conv_params, &layer->input_dims, &layer->filter_dims, &layer->output_dims);
+        break;
+    }
+    case ARM_NN_GRAPH_OP_CONV_ADD_S8: {
+        const cmsis_nn_conv_params conv_params = {layer->input_offset,
+                                                  layer->conv_output_offset,
+                                                  layer->stride,
+                                                  layer->padding,
+                                                  layer->dilation,
+                                                  layer->conv_activation};
+        size = arm_convolve_add_wrapper_s8_get_buffer_size(
+            &conv_params, &layer->input_dims, &layer->filter_dims, &layer->output_dims);
+        break;
+    }
+    case ARM_NN_GRAPH_OP_DEPTHWISE_CONV_S8: {
+        const cmsis_nn_dw_conv_params dw_conv_params = {layer->input_offset,
+                                                        layer->output_offset,
+                                                        layer->ch_mult,
+                                                        layer->stride,
+                                                        layer->padding,
+                                                        layer->dilation,
+                                                        layer->activation};
+        size = arm_depthwise_conv_wrapper_s8_get_buffer_size(
+            &dw_conv_params, &layer->input_dims, &layer->filter_dims, &layer->output_dims);
+        break;
+    }
+    case ARM_NN_GRAPH_OP_FULLY_CONNECTED_S8:
+        size = arm_fully_connected_s8_get_buffer_size(&layer->filter_dims);
+        break;
+    case ARM_NN_GRAPH_OP_AVGPOOL_S8:
+        size = arm_avgpool_s8_get_buffer_size(layer->output_dims.w, layer->input_dims.c);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
@@ -21,10 +21,10 @@
  * Title:        arm_nn_depthwise_conv_nt_t_s8.c
  * Description:  Depthwise convolution on matrices with no padding.
  *
- * $Date:        09. October 2020
- * $Revision:    V.1.0.2
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
  *
- * Target Processor:  Cortex-M processors with MVE extension.
+ * Target Processor:  Cortex-M processors with MVE extension, Cortex-A cores with Neon.
  * -------------------------------------------------------------------- */
 
 #include "arm_nnsupportfunctions.h"
@@ -148,6 +148,122 @@ q7_t *arm_nn_depthwise_conv_nt_t_s8(const q7_t *lhs,
     }
 
     return out + (3 * num_ch);
+#elif defined(ARM_MATH_NEON)
+    const int32_t col_size = row_x_col * num_ch;
+    int32_t ch = 0;
+
+    for (; ch <= (num_ch - 8); ch += 8)
+    {
+        int32x4_t out_0_lo = vdupq_n_s32(0);
+        int32x4_t out_0_hi = vdupq_n_s32(0);
+        int32x4_t out_1_lo = vdupq_n_s32(0);
+        int32x4_t out_1_hi = vdupq_n_s32(0);
+        int32x4_t out_2_lo = vdupq_n_s32(0);
+        int32x4_t out_2_hi = vdupq_n_s32(0);
+        int32x4_t out_3_lo = vdupq_n_s32(0);
+        int32x4_t out_3_hi = vdupq_n_s32(0);
+        int32x4_t ker_sum_lo = vdupq_n_s32(0);
+        int32x4_t ker_sum_hi = vdupq_n_s32(0);
+
+        const int8_t *rhs_0 = rhs + ch;
+        const int8_t *lhs_0 = lhs + ch;
+        const int8_t *lhs_1 = lhs + col_size + ch;
+        const int8_t *lhs_2 = lhs + 2 * col_size + ch;
+        const int8_t *lhs_3 = lhs + 3 * col_size + ch;
+
+        for (int i_row_x_col = 0; i_row_x_col < row_x_col; i_row_x_col++)
+        {
+            const int16x8_t ker_0 = vmovl_s8(vld1_s8(rhs_0));
+            ker_sum_lo = vaddw_s16(ker_sum_lo, vget_low_s16(ker_0));
+            ker_sum_hi = vaddw_s16(ker_sum_hi, vget_high_s16(ker_0));
+
+            int16x8_t ip = vmovl_s8(vld1_s8(lhs_0));
+            out_0_lo = vmlal_s16(out_0_lo, vget_low_s16(ip), vget_low_s16(ker_0));
+            out_0_hi = vmlal_s16(out_0_hi, vget_high_s16(ip), vget_high_s16(ker_0));
+
+            ip = vmovl_s8(vld1_s8(lhs_1));
+            out_1_lo = vmlal_s16(out_1_lo, vget_low_s16(ip), vget_low_s16(ker_0));
+            out_1_hi = vmlal_s16(out_1_hi, vget_high_s16(ip), vget_high_s16(ker_0));
+
+            ip = vmovl_s8(vld1_s8(lhs_2));
+            out_2_lo = vmlal_s16(out_2_lo, vget_low_s16(ip), vget_low_s16(ker_0));
+            out_2_hi = vmlal_s16(out_2_hi, vget_high_s16(ip), vget_high_s16(ker_0));
+
+            ip = vmovl_s8(vld1_s8(lhs_3));
+            out_3_lo = vmlal_s16(out_3_lo, vget_low_s16(ip), vget_low_s16(ker_0));
+            out_3_hi = vmlal_s16(out_3_hi, vget_high_s16(ip), vget_high_s16(ker_0));
+
+            lhs_0 += num_ch;
+            lhs_1 += num_ch;
+            lhs_2 += num_ch;
+            lhs_3 += num_ch;
+
+            rhs_0 += num_ch;
+        }
+
+        ker_sum_lo = vmulq_n_s32(ker_sum_lo, input_offset);
+        ker_sum_hi = vmulq_n_s32(ker_sum_hi, input_offset);
+        if (output_bias)
+        {
+            ker_sum_lo = vaddq_s32(ker_sum_lo, vld1q_s32(&output_bias[ch]));
+            ker_sum_hi = vaddq_s32(ker_sum_hi, vld1q_s32(&output_bias[ch + 4]));
+        }
+
+        const int32x4_t mult_lo = vld1q_s32(&out_mult[ch]);
+        const int32x4_t mult_hi = vld1q_s32(&out_mult[ch + 4]);
+        const int32x4_t shift_lo = vld1q_s32(&out_shift[ch]);
+        const int32x4_t shift_hi = vld1q_s32(&out_shift[ch + 4]);
+
+        out_0_lo = arm_requantize_neon_32x4(vaddq_s32(out_0_lo, ker_sum_lo), mult_lo, shift_lo);
+        out_0_hi = arm_requantize_neon_32x4(vaddq_s32(out_0_hi, ker_sum_hi), mult_hi, shift_hi);
+        arm_nn_store_neon_s8x4(out + ch, out_0_lo, out_offset, activation_min, activation_max);
+        arm_nn_store_neon_s8x4(out + ch + 4, out_0_hi, out_offset, activation_min, activation_max);
+
+        out_1_lo = arm_requantize_neon_32x4(vaddq_s32(out_1_lo, ker_sum_lo), mult_lo, shift_lo);
+        out_1_hi = arm_requantize_neon_32x4(vaddq_s32(out_1_hi, ker_sum_hi), mult_hi, shift_hi);
+        arm_nn_store_neon_s8x4(out + num_ch + ch, out_1_lo, out_offset, activation_min, activation_max);
+        arm_nn_store_neon_s8x4(out + num_ch + ch + 4, out_1_hi, out_offset, activation_min, activation_max);
+
+        out_2_lo = arm_requantize_neon_32x4(vaddq_s32(out_2_lo, ker_sum_lo), mult_lo, shift_lo);
+        out_2_hi = arm_requantize_neon_32x4(vaddq_s32(out_2_hi, ker_sum_hi), mult_hi, shift_hi);
+        arm_nn_store_neon_s8x4(out + 2 * num_ch + ch, out_2_lo, out_offset, activation_min, activation_max);
+        arm_nn_store_neon_s8x4(out + 2 * num_ch + ch + 4, out_2_hi, out_offset, activation_min, activation_max);
+
+        out_3_lo = arm_requantize_neon_32x4(vaddq_s32(out_3_lo, ker_sum_lo), mult_lo, shift_lo);
+        out_3_hi = arm_requantize_neon_32x4(vaddq_s32(out_3_hi, ker_sum_hi), mult_hi, shift_hi);
+        arm_nn_store_neon_s8x4(out + 3 * num_ch + ch, out_3_lo, out_offset, activation_min, activation_max);
+        arm_nn_store_neon_s8x4(out + 3 * num_ch + ch + 4, out_3_hi, out_offset, activation_min, activation_max);
+    }
+
+    /* Left-over channels */
+    for (; ch < num_ch; ch++)
+    {
+        for (int i_col = 0; i_col < 4; i_col++)
+        {
+            const int8_t *lhs_0 = lhs + i_col * col_size + ch;
+            const int8_t *rhs_0 = rhs + ch;
+            int32_t acc = 0;
+            if (output_bias)
+            {
+                acc = output_bias[ch];
+            }
+
+            for (int i_row_x_col = 0; i_row_x_col < row_x_col; i_row_x_col++)
+            {
+                acc += (*lhs_0 + input_offset) * *rhs_0;
+                lhs_0 += num_ch;
+                rhs_0 += num_ch;
+            }
+
+            acc = arm_nn_requantize(acc, out_mult[ch], out_shift[ch]);
+            acc += out_offset;
+            acc = MAX(acc, activation_min);
+            acc = MIN(acc, activation_max);
+            out[i_col * num_ch + ch] = (q7_t)acc;
+        }
+    }
+
+    return out + (4 * num_ch);
 #else
     (void)lhs;
     (void)rhs;
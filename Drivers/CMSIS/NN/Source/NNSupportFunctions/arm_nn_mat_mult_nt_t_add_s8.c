@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_nt_t_add_s8
+ * Description:  Matrix multiplication with a residual addition in the requantization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/* Dot products of two lhs rows with two rhs rows, added to res[2 * lhs + rhs]. The lhs offset is in res
+   already. */
+static void dot_2x2(const q7_t *lhs_0,
+                    const q7_t *lhs_1,
+                    const q7_t *rhs_0,
+                    const q7_t *rhs_1,
+                    int32_t cols,
+                    int32_t *res)
+{
+    int32_t acc_00 = res[0];
+    int32_t acc_01 = res[1];
+    int32_t acc_10 = res[2];
+    int32_t acc_11 = res[3];
+
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    for (; cols >= 4; cols -= 4)
+    {
+        const int32_t r0 = arm_nn_read_q7x4_ia(&rhs_0);
+        const int32_t r1 = arm_nn_read_q7x4_ia(&rhs_1);
+        const int32_t l0 = arm_nn_read_q7x4_ia(&lhs_0);
+        const int32_t l1 = arm_nn_read_q7x4_ia(&lhs_1);
+        const int32_t r0_a = __SXTB16(r0);
+        const int32_t r0_b = __SXTB16_RORn((uint32_t)r0, 8);
+        const int32_t r1_a = __SXTB16(r1);
+        const int32_t r1_b = __SXTB16_RORn((uint32_t)r1, 8);
+        int32_t l_a = __SXTB16(l0);
+        int32_t l_b = __SXTB16_RORn((uint32_t)l0, 8);
+
+        acc_00 = __SMLAD(l_a, r0_a, acc_00);
+        acc_00 = __SMLAD(l_b, r0_b, acc_00);
+        acc_01 = __SMLAD(l_a, r1_a, acc_01);
+        acc_01 = __SMLAD(l_b, r1_b, acc_01);
+
+        l_a = __SXTB16(l1);
+        l_b = __SXTB16_RORn((uint32_t)l1, 8);
+
+        acc_10 = __SMLAD(l_a, r0_a, acc_10);
+        acc_10 = __SMLAD(l_b, r0_b, acc_10);
+        acc_11 = __SMLAD(l_a, r1_a, acc_11);
+        acc_11 = __SMLAD(l_b, r1_b, acc_11);
+    }
+#endif
+
+    for (; cols > 0; cols--)
+    {
+        const q7_t l0 = *lhs_0++;
+        const q7_t l1 = *lhs_1++;
+        const q7_t r0 = *rhs_0++;
+        const q7_t r1 = *rhs_1++;
+
+        acc_00 += l0 * r0;
+        acc_01 += l0 * r1;
+        acc_10 += l1 * r0;
+        acc_11 += l1 * r1;
+    }
+
+    res[0] = acc_00;
+    res[1] = acc_01;
+    res[2] = acc_10;
+    res[3] = acc_11;
+}
+
+/* Dot product of one lhs row with one rhs row, added to acc. The lhs offset is in acc already. */
+static int32_t dot_1x1(const q7_t *lhs, const q7_t *rhs, int32_t cols, int32_t acc)
+{
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    for (; cols >= 4; cols -= 4)
+    {
+        const int32_t r = arm_nn_read_q7x4_ia(&rhs);
+        const int32_t l = arm_nn_read_q7x4_ia(&lhs);
+
+        acc = __SMLAD(__SXTB16(l), __SXTB16(r), acc);
+        acc = __SMLAD(__SXTB16_RORn((uint32_t)l, 8), __SXTB16_RORn((uint32_t)r, 8), acc);
+    }
+#endif
+
+    for (; cols > 0; cols--)
+    {
+        acc += *lhs++ * *rhs++;
+    }
+
+    return acc;
+}
+
+/* Bias of one rhs row with the lhs offset folded in, as in arm_nn_mat_mult_nt_t_s8() */
+static int32_t offset_bias(const q7_t *rhs, const int32_t cols, const int32_t lhs_offset, const int32_t bias)
+{
+    int32_t sum = 0;
+
+    for (int32_t i = 0; i < cols; i++)
+    {
+        sum += rhs[i];
+    }
+
+    return bias + lhs_offset * sum;
+}
+
+/* Requantization of the matrix product, then the arithmetic of arm_elementwise_add_s8() with the residual.
+   add points to a local copy of the parameters, so that the stores to dst do not force them to be reloaded. */
+__STATIC_FORCEINLINE q7_t add_requantize(int32_t acc,
+                                         const q7_t residual,
+                                         const int32_t multiplier,
+                                         const int32_t shift,
+                                         const int32_t dst_offset,
+                                         const int32_t activation_min,
+                                         const int32_t activation_max,
+                                         const cmsis_nn_add_params *add)
+{
+    int32_t input_1;
+    int32_t input_2;
+
+    acc = arm_nn_requantize(acc, multiplier, shift);
+    acc += dst_offset;
+    acc = MAX(acc, activation_min);
+    acc = MIN(acc, activation_max);
+
+    input_1 = (acc + add->input_1_offset) << add->left_shift;
+    input_2 = (residual + add->input_2_offset) << add->left_shift;
+    input_1 = arm_nn_requantize(input_1, add->input_1_mult, add->input_1_shift);
+    input_2 = arm_nn_requantize(input_2, add->input_2_mult, add->input_2_shift);
+
+    acc = arm_nn_requantize(input_1 + input_2, add->output_mult, add->output_shift);
+    acc += add->output_offset;
+    acc = MAX(acc, add->activation.min);
+    acc = MIN(acc, add->activation.max);
+
+    return (q7_t)acc;
+}
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * Matrix multiplication with a residual addition in the requantization.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_mat_mult_nt_t_add_s8(const q7_t *lhs,
+                                       const q7_t *rhs,
+                                       const q31_t *bias,
+                                       const q7_t *residual,
+                                       q7_t *dst,
+                                       const int32_t *dst_multipliers,
+                                       const int32_t *dst_shifts,
+                                       const int32_t lhs_rows,
+                                       const int32_t rhs_rows,
+                                       const int32_t rhs_cols,
+                                       const int32_t lhs_offset,
+                                       const int32_t dst_offset,
+                                       const int32_t activation_min,
+                                       const int32_t activation_max,
+                                       const cmsis_nn_add_params *add_params)
+{
+    const cmsis_nn_add_params add = *add_params;
+    int32_t rhs_row = 0;
+
+    for (; rhs_row <= rhs_rows - 2; rhs_row += 2)
+    {
+        const q7_t *rhs_0 = rhs + rhs_row * rhs_cols;
+        const q7_t *rhs_1 = rhs_0 + rhs_cols;
+        const int32_t bias_0 = offset_bias(rhs_0, rhs_cols, lhs_offset, bias ? bias[rhs_row] : 0);
+        const int32_t bias_1 = offset_bias(rhs_1, rhs_cols, lhs_offset, bias ? bias[rhs_row + 1] : 0);
+        const int32_t mult_0 = dst_multipliers[rhs_row];
+        const int32_t mult_1 = dst_multipliers[rhs_row + 1];
+        const int32_t shift_0 = dst_shifts[rhs_row];
+        const int32_t shift_1 = dst_shifts[rhs_row + 1];
+        int32_t lhs_row = 0;
+
+        for (; lhs_row <= lhs_rows - 2; lhs_row += 2)
+        {
+            const q7_t *lhs_0 = lhs + lhs_row * rhs_cols;
+            const int32_t out_0 = lhs_row * rhs_rows + rhs_row;
+            const int32_t out_1 = out_0 + rhs_rows;
+            int32_t res[4] = {bias_0, bias_1, bias_0, bias_1};
+
+            dot_2x2(lhs_0, lhs_0 + rhs_cols, rhs_0, rhs_1, rhs_cols, res);
+
+            dst[out_0] = add_requantize(
+                res[0], residual[out_0], mult_0, shift_0, dst_offset, activation_min, activation_max, &add);
+            dst[out_0 + 1] = add_requantize(
+                res[1], residual[out_0 + 1], mult_1, shift_1, dst_offset, activation_min, activation_max, &add);
+            dst[out_1] = add_requantize(
+                res[2], residual[out_1], mult_0, shift_0, dst_offset, activation_min, activation_max, &add);
+            dst[out_1 + 1] = add_requantize(
+                res[3], residual[out_1 + 1], mult_1, shift_1, dst_offset, activation_min, activation_max, &add);
+        }
+
+        if (lhs_row < lhs_rows)
+        {
+            const q7_t *lhs_0 = lhs + lhs_row * rhs_cols;
+            const int32_t out_0 = lhs_row * rhs_rows + rhs_row;
+
+            dst[out_0] = add_requantize(dot_1x1(lhs_0, rhs_0, rhs_cols, bias_0),
+                                        residual[out_0],
+                                        mult_0,
+                                        shift_0,
+                                        dst_offset,
+                                        activation_min,
+                                        activation_max,
+                                        &add);
+            dst[out_0 + 1] = add_requantize(dot_1x1(lhs_0, rhs_1, rhs_cols, bias_1),
+                                            residual[out_0 + 1],
+                                            mult_1,
+                                            shift_1,
+                                            dst_offset,
+                                            activation_min,
+                                            activation_max,
+                                            &add);
+        }
+    }
+
+    if (rhs_row < rhs_rows)
+    {
+        const q7_t *rhs_0 = rhs + rhs_row * rhs_cols;
+        const int32_t bias_0 = offset_bias(rhs_0, rhs_cols, lhs_offset, bias ? bias[rhs_row] : 0);
+
+        for (int32_t lhs_row = 0; lhs_row < lhs_rows; lhs_row++)
+        {
+            const int32_t out = lhs_row * rhs_rows + rhs_row;
+
+            dst[out] = add_requantize(dot_1x1(lhs + lhs_row * rhs_cols, rhs_0, rhs_cols, bias_0),
+                                      residual[out],
+                                      dst_multipliers[rhs_row],
+                                      dst_shifts[rhs_row],
+                                      dst_offset,
+                                      activation_min,
+                                      activation_max,
+                                      &add);
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_nt_t_s4
+ * Description:  Matrix multiplication of s8 rows by packed s4 weights
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/* Weight of even index in a byte of packed s4 weights */
+#define S4_LOW(b) ((q7_t)((uint8_t)(b) << 4) >> 4)
+/* Weight of odd index in a byte of packed s4 weights */
+#define S4_HIGH(b) ((q7_t)(b) >> 4)
+
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+/*
+ * Eight weights, read as one word, are split in four pairs of halfwords holding
+ * 16 times the weights: (w0, w4), (w2, w6), (w1, w5) and (w3, w7). Masking the
+ * nibbles in place is cheaper than shifting them down, and the scale is removed
+ * from the accumulator at the end. 16 * s4 is in the s8 range, so the
+ * accumulator grows as with s8 weights.
+ */
+#define S4_UNPACK_X8(w, w04, w26, w15, w37)                                                                            \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        const uint32_t even = ((uint32_t)(w) << 4) & 0xF0F0F0F0U;                                                      \
+        const uint32_t odd = (uint32_t)(w) & 0xF0F0F0F0U;                                                             \
+        w04 = __SXTB16(even);                                                                                          \
+        w26 = __SXTB16_RORn(even, 8);                                                                                  \
+        w15 = __SXTB16(odd);                                                                                           \
+        w37 = __SXTB16_RORn(odd, 8);                                                                                   \
+    } while (0)
+
+/* Eight inputs, plus the offset, in the pair order of S4_UNPACK_X8 */
+#define S4_LHS_X8(ptr, offset, x04, x26, x15, x37)                                                                     \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        const int32_t a = arm_nn_read_q7x4_ia(&(ptr));                                                                 \
+        const int32_t b = arm_nn_read_q7x4_ia(&(ptr));                                                                 \
+        const int32_t a_02 = __SXTAB16((offset), a);                                                                   \
+        const int32_t a_13 = __SXTAB16_RORn((offset), (uint32_t)a, 8);                                                 \
+        const int32_t b_46 = __SXTAB16((offset), b);                                                                   \
+        const int32_t b_57 = __SXTAB16_RORn((offset), (uint32_t)b, 8);                                                 \
+        x04 = __PKHBT(a_02, b_46, 16);                                                                                 \
+        x26 = __PKHTB(b_46, a_02, 16);                                                                                 \
+        x15 = __PKHBT(a_13, b_57, 16);                                                                                 \
+        x37 = __PKHTB(b_57, a_13, 16);                                                                                 \
+    } while (0)
+#endif
+
+/* Dot product of one lhs row with the row of weights starting at weight index first */
+static int32_t s4_dot_x1(const q7_t *lhs, const q7_t *packed_rhs, int32_t first, int32_t cols, const int32_t lhs_offset)
+{
+    const q7_t *rhs = packed_rhs + (first >> 1);
+    int32_t acc = 0;
+
+    if (first & 1)
+    {
+        acc += (*lhs++ + lhs_offset) * S4_HIGH(*rhs++);
+        cols--;
+    }
+
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    const uint32_t offset_s16x2 = __PKHBT(lhs_offset, lhs_offset, 16);
+    int32_t acc_x16 = 0;
+
+    for (; cols >= 8; cols -= 8)
+    {
+        int32_t w04, w26, w15, w37;
+        int32_t x04, x26, x15, x37;
+        const int32_t w = arm_nn_read_q7x4_ia(&rhs);
+
+        S4_UNPACK_X8(w, w04, w26, w15, w37);
+        S4_LHS_X8(lhs, offset_s16x2, x04, x26, x15, x37);
+        acc_x16 = __SMLAD(w04, x04, acc_x16);
+        acc_x16 = __SMLAD(w26, x26, acc_x16);
+        acc_x16 = __SMLAD(w15, x15, acc_x16);
+        acc_x16 = __SMLAD(w37, x37, acc_x16);
+    }
+    acc += acc_x16 >> 4;
+#endif
+
+    for (; cols >= 2; cols -= 2)
+    {
+        const q7_t w = *rhs++;
+        acc += (lhs[0] + lhs_offset) * S4_LOW(w);
+        acc += (lhs[1] + lhs_offset) * S4_HIGH(w);
+        lhs += 2;
+    }
+    if (cols)
+    {
+        acc += (*lhs + lhs_offset) * S4_LOW(*rhs);
+    }
+
+    return acc;
+}
+
+/* Dot products of two lhs rows with the row of weights starting at weight index first */
+static void s4_dot_x2(const q7_t *lhs_0,
+                      const q7_t *lhs_1,
+                      const q7_t *packed_rhs,
+                      int32_t first,
+                      int32_t cols,
+                      const int32_t lhs_offset,
+                      int32_t *res_0,
+                      int32_t *res_1)
+{
+    const q7_t *rhs = packed_rhs + (first >> 1);
+    int32_t acc_0 = 0;
+    int32_t acc_1 = 0;
+
+    if (first & 1)
+    {
+        const int32_t w = S4_HIGH(*rhs++);
+        acc_0 += (*lhs_0++ + lhs_offset) * w;
+        acc_1 += (*lhs_1++ + lhs_offset) * w;
+        cols--;
+    }
+
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    const uint32_t offset_s16x2 = __PKHBT(lhs_offset, lhs_offset, 16);
+    int32_t acc_x16_0 = 0;
+    int32_t acc_x16_1 = 0;
+
+    for (; cols >= 8; cols -= 8)
+    {
+        int32_t w04, w26, w15, w37;
+        int32_t x04, x26, x15, x37;
+        const int32_t w = arm_nn_read_q7x4_ia(&rhs);
+
+        S4_UNPACK_X8(w, w04, w26, w15, w37);
+
+        S4_LHS_X8(lhs_0, offset_s16x2, x04, x26, x15, x37);
+        acc_x16_0 = __SMLAD(w04, x04, acc_x16_0);
+        acc_x16_0 = __SMLAD(w26, x26, acc_x16_0);
+        acc_x16_0 = __SMLAD(w15, x15, acc_x16_0);
+        acc_x16_0 = __SMLAD(w37, x37, acc_x16_0);
+
+        S4_LHS_X8(lhs_1, offset_s16x2, x04, x26, x15, x37);
+        acc_x16_1 = __SMLAD(w04, x04, acc_x16_1);
+        acc_x16_1 = __SMLAD(w26, x26, acc_x16_1);
+        acc_x16_1 = __SMLAD(w15, x15, acc_x16_1);
+        acc_x16_1 = __SMLAD(w37, x37, acc_x16_1);
+    }
+    acc_0 += acc_x16_0 >> 4;
+    acc_1 += acc_x16_1 >> 4;
+#endif
+
+    for (; cols >= 2; cols -= 2)
+    {
+        const q7_t w = *rhs++;
+        const int32_t w_lo = S4_LOW(w);
+        const int32_t w_hi = S4_HIGH(w);
+        acc_0 += (lhs_0[0] + lhs_offset) * w_lo + (lhs_0[1] + lhs_offset) * w_hi;
+        acc_1 += (lhs_1[0] + lhs_offset) * w_lo + (lhs_1[1] + lhs_offset) * w_hi;
+        lhs_0 += 2;
+        lhs_1 += 2;
+    }
+    if (cols)
+    {
+        const int32_t w_lo = S4_LOW(*rhs);
+        acc_0 += (*lhs_0 + lhs_offset) * w_lo;
+        acc_1 += (*lhs_1 + lhs_offset) * w_lo;
+    }
+
+    *res_0 = acc_0;
+    *res_1 = acc_1;
+}
+
+static q7_t s4_requantize(int32_t acc,
+                          const int32_t multiplier,
+                          const int32_t shift,
+                          const int32_t dst_offset,
+                          const int32_t activation_min,
+                          const int32_t activation_max)
+{
+    acc = arm_nn_requantize(acc, multiplier, shift);
+    acc += dst_offset;
+    acc = MAX(acc, activation_min);
+    acc = MIN(acc, activation_max);
+
+    return (q7_t)acc;
+}
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * s8 rows by packed s4 weights matrix multiplication.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_mat_mult_nt_t_s4(const q7_t *lhs,
+                                   const q7_t *packed_rhs,
+                                   const q31_t *bias,
+                                   q7_t *dst,
+                                   const int32_t *dst_multipliers,
+                                   const int32_t *dst_shifts,
+                                   const int32_t per_channel,
+                                   const int32_t lhs_rows,
+                                   const int32_t rhs_rows,
+                                   const int32_t rhs_cols,
+                                   const int32_t lhs_offset,
+                                   const int32_t dst_offset,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max)
+{
+    for (int32_t rhs_row = 0; rhs_row < rhs_rows; rhs_row++)
+    {
+        const int32_t first = rhs_row * rhs_cols;
+        const int32_t multiplier = per_channel ? dst_multipliers[rhs_row] : dst_multipliers[0];
+        const int32_t shift = per_channel ? dst_shifts[rhs_row] : dst_shifts[0];
+        const int32_t row_bias = bias ? bias[rhs_row] : 0;
+        const q7_t *lhs_ptr = lhs;
+        q7_t *dst_ptr = dst + rhs_row;
+        int32_t lhs_row = 0;
+
+        /* The weights are unpacked once for two lhs rows */
+        for (; lhs_row <= lhs_rows - 2; lhs_row += 2)
+        {
+            int32_t acc_0;
+            int32_t acc_1;
+
+            s4_dot_x2(lhs_ptr, lhs_ptr + rhs_cols, packed_rhs, first, rhs_cols, lhs_offset, &acc_0, &acc_1);
+            dst_ptr[0] =
+                s4_requantize(acc_0 + row_bias, multiplier, shift, dst_offset, activation_min, activation_max);
+            dst_ptr[rhs_rows] =
+                s4_requantize(acc_1 + row_bias, multiplier, shift, dst_offset, activation_min, activation_max);
+            lhs_ptr += 2 * rhs_cols;
+            dst_ptr += 2 * rhs_rows;
+        }
+
+        if (lhs_row < lhs_rows)
+        {
+            const int32_t acc = s4_dot_x1(lhs_ptr, packed_rhs, first, rhs_cols, lhs_offset);
+            *dst_ptr = s4_requantize(acc + row_bias, multiplier, shift, dst_offset, activation_min, activation_max);
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
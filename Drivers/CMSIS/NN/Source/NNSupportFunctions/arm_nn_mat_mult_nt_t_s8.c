@@ -21,15 +21,175 @@
  * Title:        arm_nn_mat_mult_s8_nt_t_s8
  * Description:  Matrix multiplication support function with the right-hand-side (rhs) matrix transposed
  *
- * $Date:        09. October 2020
- * $Revision:    V.1.0.3
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
  *
- * Target Processor:  Cortex-M
+ * Target Processor:  Cortex-M and Cortex-A cores with Neon
  *
  * -------------------------------------------------------------------- */
 
 #include "arm_nnsupportfunctions.h"
 
+#if defined(ARM_MATH_NEON)
+/* Dot products of 2 lhs rows with 4 consecutive rhs rows */
+static void arm_nn_dot_2x4_neon(const q7_t *lhs,
+                                const q7_t *rhs,
+                                const int32_t rhs_cols,
+                                int32x4_t *res_0,
+                                int32x4_t *res_1)
+{
+    const q7_t *lhs_1 = lhs + rhs_cols;
+    const q7_t *rhs_1 = rhs + rhs_cols;
+    const q7_t *rhs_2 = rhs + 2 * rhs_cols;
+    const q7_t *rhs_3 = rhs + 3 * rhs_cols;
+
+    int32x4_t acc_00 = vdupq_n_s32(0);
+    int32x4_t acc_01 = vdupq_n_s32(0);
+    int32x4_t acc_02 = vdupq_n_s32(0);
+    int32x4_t acc_03 = vdupq_n_s32(0);
+    int32x4_t acc_10 = vdupq_n_s32(0);
+    int32x4_t acc_11 = vdupq_n_s32(0);
+    int32x4_t acc_12 = vdupq_n_s32(0);
+    int32x4_t acc_13 = vdupq_n_s32(0);
+
+    int32_t col = 0;
+    for (; col <= (rhs_cols - 16); col += 16)
+    {
+        const int8x16_t lhs_vec_0 = vld1q_s8(lhs + col);
+        const int8x16_t lhs_vec_1 = vld1q_s8(lhs_1 + col);
+
+        int8x16_t rhs_vec = vld1q_s8(rhs + col);
+        acc_00 = arm_nn_dot_neon_s8x16(acc_00, lhs_vec_0, rhs_vec);
+        acc_10 = arm_nn_dot_neon_s8x16(acc_10, lhs_vec_1, rhs_vec);
+
+        rhs_vec = vld1q_s8(rhs_1 + col);
+        acc_01 = arm_nn_dot_neon_s8x16(acc_01, lhs_vec_0, rhs_vec);
+        acc_11 = arm_nn_dot_neon_s8x16(acc_11, lhs_vec_1, rhs_vec);
+
+        rhs_vec = vld1q_s8(rhs_2 + col);
+        acc_02 = arm_nn_dot_neon_s8x16(acc_02, lhs_vec_0, rhs_vec);
+        acc_12 = arm_nn_dot_neon_s8x16(acc_12, lhs_vec_1, rhs_vec);
+
+        rhs_vec = vld1q_s8(rhs_3 + col);
+        acc_03 = arm_nn_dot_neon_s8x16(acc_03, lhs_vec_0, rhs_vec);
+        acc_13 = arm_nn_dot_neon_s8x16(acc_13, lhs_vec_1, rhs_vec);
+    }
+
+    int32_t tail_0[4] = {0, 0, 0, 0};
+    int32_t tail_1[4] = {0, 0, 0, 0};
+    for (; col < rhs_cols; ++col)
+    {
+        const int32_t lhs_value_0 = lhs[col];
+        const int32_t lhs_value_1 = lhs_1[col];
+
+        tail_0[0] += lhs_value_0 * rhs[col];
+        tail_0[1] += lhs_value_0 * rhs_1[col];
+        tail_0[2] += lhs_value_0 * rhs_2[col];
+        tail_0[3] += lhs_value_0 * rhs_3[col];
+        tail_1[0] += lhs_value_1 * rhs[col];
+        tail_1[1] += lhs_value_1 * rhs_1[col];
+        tail_1[2] += lhs_value_1 * rhs_2[col];
+        tail_1[3] += lhs_value_1 * rhs_3[col];
+    }
+
+    *res_0 = vaddq_s32(arm_nn_reduce4_neon_s32(acc_00, acc_01, acc_02, acc_03), vld1q_s32(tail_0));
+    *res_1 = vaddq_s32(arm_nn_reduce4_neon_s32(acc_10, acc_11, acc_12, acc_13), vld1q_s32(tail_1));
+}
+
+/* Dot products of 1 lhs row with 4 consecutive rhs rows */
+static int32x4_t arm_nn_dot_1x4_neon(const q7_t *lhs, const q7_t *rhs, const int32_t rhs_cols)
+{
+    const q7_t *rhs_1 = rhs + rhs_cols;
+    const q7_t *rhs_2 = rhs + 2 * rhs_cols;
+    const q7_t *rhs_3 = rhs + 3 * rhs_cols;
+
+    int32x4_t acc_0 = vdupq_n_s32(0);
+    int32x4_t acc_1 = vdupq_n_s32(0);
+    int32x4_t acc_2 = vdupq_n_s32(0);
+    int32x4_t acc_3 = vdupq_n_s32(0);
+
+    int32_t col = 0;
+    for (; col <= (rhs_cols - 16); col += 16)
+    {
+        const int8x16_t lhs_vec = vld1q_s8(lhs + col);
+
+        acc_0 = arm_nn_dot_neon_s8x16(acc_0, lhs_vec, vld1q_s8(rhs + col));
+        acc_1 = arm_nn_dot_neon_s8x16(acc_1, lhs_vec, vld1q_s8(rhs_1 + col));
+        acc_2 = arm_nn_dot_neon_s8x16(acc_2, lhs_vec, vld1q_s8(rhs_2 + col));
+        acc_3 = arm_nn_dot_neon_s8x16(acc_3, lhs_vec, vld1q_s8(rhs_3 + col));
+    }
+
+    int32_t tail[4] = {0, 0, 0, 0};
+    for (; col < rhs_cols; ++col)
+    {
+        const int32_t lhs_value = lhs[col];
+
+        tail[0] += lhs_value * rhs[col];
+        tail[1] += lhs_value * rhs_1[col];
+        tail[2] += lhs_value * rhs_2[col];
+        tail[3] += lhs_value * rhs_3[col];
+    }
+
+    return vaddq_s32(arm_nn_reduce4_neon_s32(acc_0, acc_1, acc_2, acc_3), vld1q_s32(tail));
+}
+
+/* Sums of 4 consecutive rhs rows */
+static int32x4_t arm_nn_row_sum_4_neon(const q7_t *rhs, const int32_t rhs_cols)
+{
+    int32x4_t sum_0 = vdupq_n_s32(0);
+    int32x4_t sum_1 = vdupq_n_s32(0);
+    int32x4_t sum_2 = vdupq_n_s32(0);
+    int32x4_t sum_3 = vdupq_n_s32(0);
+
+    int32_t col = 0;
+    for (; col <= (rhs_cols - 16); col += 16)
+    {
+        sum_0 = arm_nn_sum_neon_s8x16(sum_0, vld1q_s8(rhs + col));
+        sum_1 = arm_nn_sum_neon_s8x16(sum_1, vld1q_s8(rhs + rhs_cols + col));
+        sum_2 = arm_nn_sum_neon_s8x16(sum_2, vld1q_s8(rhs + 2 * rhs_cols + col));
+        sum_3 = arm_nn_sum_neon_s8x16(sum_3, vld1q_s8(rhs + 3 * rhs_cols + col));
+    }
+
+    int32_t tail[4] = {0, 0, 0, 0};
+    for (; col < rhs_cols; ++col)
+    {
+        tail[0] += rhs[col];
+        tail[1] += rhs[rhs_cols + col];
+        tail[2] += rhs[2 * rhs_cols + col];
+        tail[3] += rhs[3 * rhs_cols + col];
+    }
+
+    return vaddq_s32(arm_nn_reduce4_neon_s32(sum_0, sum_1, sum_2, sum_3), vld1q_s32(tail));
+}
+
+/* Dot product of 1 lhs row with 1 rhs row, and sum of the rhs row */
+static int32_t arm_nn_dot_1x1_neon(const q7_t *lhs, const q7_t *rhs, const int32_t rhs_cols, int32_t *rhs_sum)
+{
+    int32x4_t acc = vdupq_n_s32(0);
+    int32x4_t sum = vdupq_n_s32(0);
+
+    int32_t col = 0;
+    for (; col <= (rhs_cols - 16); col += 16)
+    {
+        const int8x16_t rhs_vec = vld1q_s8(rhs + col);
+
+        acc = arm_nn_dot_neon_s8x16(acc, vld1q_s8(lhs + col), rhs_vec);
+        sum = arm_nn_sum_neon_s8x16(sum, rhs_vec);
+    }
+
+    int32_t res = arm_nn_reduce_neon_s32(acc);
+    int32_t res_sum = arm_nn_reduce_neon_s32(sum);
+    for (; col < rhs_cols; ++col)
+    {
+        res += lhs[col] * rhs[col];
+        res_sum += rhs[col];
+    }
+
+    *rhs_sum = res_sum;
+    return res;
+}
+#endif
+
 /**
  * @ingroup groupSupport
  */
@@ -59,7 +219,92 @@ arm_status arm_nn_mat_mult_nt_t_s8(const q7_t *lhs,
                                    const int32_t activation_min,
                                    const int32_t activation_max)
 {
-#if defined(ARM_MATH_DSP)
+#if defined(ARM_MATH_NEON)
+    int32_t rhs_rows_idx = 0;
+
+    for (; rhs_rows_idx <= (rhs_rows - 4); rhs_rows_idx += 4)
+    {
+        const q7_t *lhs_ptr = &lhs[0];
+        q7_t *dst_ptr = &dst[rhs_rows_idx];
+
+        int32x4_t lhs_offset_contribution = vmulq_n_s32(arm_nn_row_sum_4_neon(rhs, rhs_cols), lhs_offset);
+        if (bias)
+        {
+            lhs_offset_contribution = vaddq_s32(lhs_offset_contribution, vld1q_s32(&bias[rhs_rows_idx]));
+        }
+
+        const int32x4_t mult = vld1q_s32(&dst_multipliers[rhs_rows_idx]);
+        const int32x4_t shift = vld1q_s32(&dst_shifts[rhs_rows_idx]);
+
+        int32_t lhs_rows_idx = lhs_rows >> 1;
+
+        while (lhs_rows_idx)
+        {
+            int32x4_t res0;
+            int32x4_t res1;
+
+            arm_nn_dot_2x4_neon(lhs_ptr, rhs, rhs_cols, &res0, &res1);
+
+            res0 = arm_requantize_neon_32x4(vaddq_s32(res0, lhs_offset_contribution), mult, shift);
+            res1 = arm_requantize_neon_32x4(vaddq_s32(res1, lhs_offset_contribution), mult, shift);
+
+            arm_nn_store_neon_s8x4(dst_ptr, res0, dst_offset, activation_min, activation_max);
+            dst_ptr += rhs_rows;
+            arm_nn_store_neon_s8x4(dst_ptr, res1, dst_offset, activation_min, activation_max);
+            dst_ptr += rhs_rows;
+
+            lhs_ptr += 2 * rhs_cols;
+
+            lhs_rows_idx--;
+        }
+
+        // Left-over rows
+        if (lhs_rows % 2)
+        {
+            int32x4_t res0 = arm_nn_dot_1x4_neon(lhs_ptr, rhs, rhs_cols);
+
+            res0 = arm_requantize_neon_32x4(vaddq_s32(res0, lhs_offset_contribution), mult, shift);
+            arm_nn_store_neon_s8x4(dst_ptr, res0, dst_offset, activation_min, activation_max);
+        }
+
+        rhs += 4 * rhs_cols;
+    }
+
+    // Left-over rhs rows
+    for (; rhs_rows_idx < rhs_rows; rhs_rows_idx++)
+    {
+        const q7_t *lhs_ptr = &lhs[0];
+        q7_t *dst_ptr = &dst[rhs_rows_idx];
+
+        for (int32_t lhs_rows_idx = 0; lhs_rows_idx < lhs_rows; ++lhs_rows_idx)
+        {
+            int32_t rhs_sum;
+            q31_t res00 = arm_nn_dot_1x1_neon(lhs_ptr, rhs, rhs_cols, &rhs_sum);
+
+            res00 += rhs_sum * lhs_offset;
+            if (bias)
+            {
+                res00 += bias[rhs_rows_idx];
+            }
+
+            // Quantize down
+            res00 = arm_nn_requantize(res00, dst_multipliers[rhs_rows_idx], dst_shifts[rhs_rows_idx]);
+
+            // Add offset
+            res00 += dst_offset;
+
+            // Clamp the result
+            res00 = MAX(res00, activation_min);
+            res00 = MIN(res00, activation_max);
+
+            dst_ptr[0] = (q7_t)res00;
+            dst_ptr += rhs_rows;
+            lhs_ptr += rhs_cols;
+        }
+
+        rhs += rhs_cols;
+    }
+#elif defined(ARM_MATH_DSP)
     const int32_t off0 = rhs_cols - 4;
 
     for (int32_t rhs_rows_idx = 0; rhs_rows_idx <= (rhs_rows - 2); rhs_rows_idx += 2)
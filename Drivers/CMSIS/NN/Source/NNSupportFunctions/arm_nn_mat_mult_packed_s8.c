@@ -0,0 +1,384 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_packed_s8
+ * Description:  s8 matrix multiplication with pre-packed weights
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.1.0
+ *
+ * Target Processor:  Cortex-M and Cortex-A cores with Neon
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/* Dot products of the ARM_NN_PACKED_ROWS rows of a block with one lhs row, on top of the bias */
+static void packed_dot_1x(const q7_t *lhs,
+                          const q7_t *rhs,
+                          const int32_t col_loop_cnt,
+                          const int32_t col_left,
+                          const int32_t *bias,
+                          int32_t *acc)
+{
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+    int32x4_t acc_v;
+#if defined(__ARM_FEATURE_DOTPROD)
+    acc_v = vld1q_s32(bias);
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        /* Lane r accumulates the four products of row r */
+        const int8x16_t lhs_v = vreinterpretq_s8_s32(vdupq_n_s32(arm_nn_read_q7x4(lhs)));
+        acc_v = vdotq_s32(acc_v, vld1q_s8(rhs), lhs_v);
+        lhs += 4;
+        rhs += 16;
+    }
+#else
+    int32x4_t acc_01 = vdupq_n_s32(0);
+    int32x4_t acc_23 = vdupq_n_s32(0);
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        const int8x8_t lhs_v = vreinterpret_s8_s32(vdup_n_s32(arm_nn_read_q7x4(lhs)));
+        const int8x16_t rhs_v = vld1q_s8(rhs);
+        acc_01 = vpadalq_s16(acc_01, vmull_s8(vget_low_s8(rhs_v), lhs_v));
+        acc_23 = vpadalq_s16(acc_23, vmull_s8(vget_high_s8(rhs_v), lhs_v));
+        lhs += 4;
+        rhs += 16;
+    }
+    /* Lanes 2r and 2r + 1 hold the partial sums of row r */
+    acc_v = vaddq_s32(vld1q_s32(bias),
+                      vcombine_s32(vpadd_s32(vget_low_s32(acc_01), vget_high_s32(acc_01)),
+                                   vpadd_s32(vget_low_s32(acc_23), vget_high_s32(acc_23))));
+#endif
+    vst1q_s32(acc, acc_v);
+#elif defined(ARM_MATH_DSP)
+    int32_t acc_0 = bias[0];
+    int32_t acc_1 = bias[1];
+    int32_t acc_2 = bias[2];
+    int32_t acc_3 = bias[3];
+
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        /* The four values of a row are in lhs order: no reordering is needed */
+        const int32_t lhs_val = arm_nn_read_q7x4(lhs);
+        const int32_t lhs_02 = __SXTB16(lhs_val);
+        const int32_t lhs_13 = __SXTB16_RORn((uint32_t)lhs_val, 8);
+        int32_t rhs_val;
+
+        rhs_val = arm_nn_read_q7x4(rhs);
+        acc_0 = __SMLAD(__SXTB16(rhs_val), lhs_02, acc_0);
+        acc_0 = __SMLAD(__SXTB16_RORn((uint32_t)rhs_val, 8), lhs_13, acc_0);
+        rhs_val = arm_nn_read_q7x4(rhs + 4);
+        acc_1 = __SMLAD(__SXTB16(rhs_val), lhs_02, acc_1);
+        acc_1 = __SMLAD(__SXTB16_RORn((uint32_t)rhs_val, 8), lhs_13, acc_1);
+        rhs_val = arm_nn_read_q7x4(rhs + 8);
+        acc_2 = __SMLAD(__SXTB16(rhs_val), lhs_02, acc_2);
+        acc_2 = __SMLAD(__SXTB16_RORn((uint32_t)rhs_val, 8), lhs_13, acc_2);
+        rhs_val = arm_nn_read_q7x4(rhs + 12);
+        acc_3 = __SMLAD(__SXTB16(rhs_val), lhs_02, acc_3);
+        acc_3 = __SMLAD(__SXTB16_RORn((uint32_t)rhs_val, 8), lhs_13, acc_3);
+        lhs += 4;
+        rhs += 16;
+    }
+    acc[0] = acc_0;
+    acc[1] = acc_1;
+    acc[2] = acc_2;
+    acc[3] = acc_3;
+#else
+    for (int32_t r = 0; r < ARM_NN_PACKED_ROWS; r++)
+    {
+        acc[r] = bias[r];
+    }
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        for (int32_t r = 0; r < ARM_NN_PACKED_ROWS; r++)
+        {
+            acc[r] += lhs[0] * rhs[4 * r] + lhs[1] * rhs[4 * r + 1] + lhs[2] * rhs[4 * r + 2] + lhs[3] * rhs[4 * r + 3];
+        }
+        lhs += 4;
+        rhs += 16;
+    }
+#endif
+
+    /* Left over columns, row after row */
+    for (int32_t r = 0; r < ARM_NN_PACKED_ROWS; r++)
+    {
+        for (int32_t i = 0; i < col_left; i++)
+        {
+            acc[r] += lhs[i] * rhs[r * col_left + i];
+        }
+    }
+}
+
+/* As packed_dot_1x(), for two lhs rows: each word of the block is loaded and extended once for both */
+static void packed_dot_2x(const q7_t *lhs_0,
+                          const q7_t *lhs_1,
+                          const q7_t *rhs,
+                          const int32_t col_loop_cnt,
+                          const int32_t col_left,
+                          const int32_t *bias,
+                          int32_t *acc_0,
+                          int32_t *acc_1)
+{
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+#if defined(__ARM_FEATURE_DOTPROD)
+    int32x4_t acc_0_v = vld1q_s32(bias);
+    int32x4_t acc_1_v = acc_0_v;
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        const int8x16_t rhs_v = vld1q_s8(rhs);
+        acc_0_v = vdotq_s32(acc_0_v, rhs_v, vreinterpretq_s8_s32(vdupq_n_s32(arm_nn_read_q7x4(lhs_0))));
+        acc_1_v = vdotq_s32(acc_1_v, rhs_v, vreinterpretq_s8_s32(vdupq_n_s32(arm_nn_read_q7x4(lhs_1))));
+        lhs_0 += 4;
+        lhs_1 += 4;
+        rhs += 16;
+    }
+#else
+    int32x4_t acc_0_01 = vdupq_n_s32(0);
+    int32x4_t acc_0_23 = vdupq_n_s32(0);
+    int32x4_t acc_1_01 = vdupq_n_s32(0);
+    int32x4_t acc_1_23 = vdupq_n_s32(0);
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        const int8x8_t lhs_0_v = vreinterpret_s8_s32(vdup_n_s32(arm_nn_read_q7x4(lhs_0)));
+        const int8x8_t lhs_1_v = vreinterpret_s8_s32(vdup_n_s32(arm_nn_read_q7x4(lhs_1)));
+        const int8x16_t rhs_v = vld1q_s8(rhs);
+        acc_0_01 = vpadalq_s16(acc_0_01, vmull_s8(vget_low_s8(rhs_v), lhs_0_v));
+        acc_0_23 = vpadalq_s16(acc_0_23, vmull_s8(vget_high_s8(rhs_v), lhs_0_v));
+        acc_1_01 = vpadalq_s16(acc_1_01, vmull_s8(vget_low_s8(rhs_v), lhs_1_v));
+        acc_1_23 = vpadalq_s16(acc_1_23, vmull_s8(vget_high_s8(rhs_v), lhs_1_v));
+        lhs_0 += 4;
+        lhs_1 += 4;
+        rhs += 16;
+    }
+    const int32x4_t bias_v = vld1q_s32(bias);
+    const int32x4_t acc_0_v = vaddq_s32(bias_v,
+                                        vcombine_s32(vpadd_s32(vget_low_s32(acc_0_01), vget_high_s32(acc_0_01)),
+                                                     vpadd_s32(vget_low_s32(acc_0_23), vget_high_s32(acc_0_23))));
+    const int32x4_t acc_1_v = vaddq_s32(bias_v,
+                                        vcombine_s32(vpadd_s32(vget_low_s32(acc_1_01), vget_high_s32(acc_1_01)),
+                                                     vpadd_s32(vget_low_s32(acc_1_23), vget_high_s32(acc_1_23))));
+#endif
+    vst1q_s32(acc_0, acc_0_v);
+    vst1q_s32(acc_1, acc_1_v);
+#elif defined(ARM_MATH_DSP)
+    int32_t acc_00 = bias[0];
+    int32_t acc_01 = bias[1];
+    int32_t acc_02 = bias[2];
+    int32_t acc_03 = bias[3];
+    int32_t acc_10 = bias[0];
+    int32_t acc_11 = bias[1];
+    int32_t acc_12 = bias[2];
+    int32_t acc_13 = bias[3];
+
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        const int32_t lhs_0_val = arm_nn_read_q7x4(lhs_0);
+        const int32_t lhs_0_02 = __SXTB16(lhs_0_val);
+        const int32_t lhs_0_13 = __SXTB16_RORn((uint32_t)lhs_0_val, 8);
+        const int32_t lhs_1_val = arm_nn_read_q7x4(lhs_1);
+        const int32_t lhs_1_02 = __SXTB16(lhs_1_val);
+        const int32_t lhs_1_13 = __SXTB16_RORn((uint32_t)lhs_1_val, 8);
+        int32_t rhs_val;
+        int32_t rhs_02;
+        int32_t rhs_13;
+
+        rhs_val = arm_nn_read_q7x4(rhs);
+        rhs_02 = __SXTB16(rhs_val);
+        rhs_13 = __SXTB16_RORn((uint32_t)rhs_val, 8);
+        acc_00 = __SMLAD(rhs_02, lhs_0_02, acc_00);
+        acc_00 = __SMLAD(rhs_13, lhs_0_13, acc_00);
+        acc_10 = __SMLAD(rhs_02, lhs_1_02, acc_10);
+        acc_10 = __SMLAD(rhs_13, lhs_1_13, acc_10);
+
+        rhs_val = arm_nn_read_q7x4(rhs + 4);
+        rhs_02 = __SXTB16(rhs_val);
+        rhs_13 = __SXTB16_RORn((uint32_t)rhs_val, 8);
+        acc_01 = __SMLAD(rhs_02, lhs_0_02, acc_01);
+        acc_01 = __SMLAD(rhs_13, lhs_0_13, acc_01);
+        acc_11 = __SMLAD(rhs_02, lhs_1_02, acc_11);
+        acc_11 = __SMLAD(rhs_13, lhs_1_13, acc_11);
+
+        rhs_val = arm_nn_read_q7x4(rhs + 8);
+        rhs_02 = __SXTB16(rhs_val);
+        rhs_13 = __SXTB16_RORn((uint32_t)rhs_val, 8);
+        acc_02 = __SMLAD(rhs_02, lhs_0_02, acc_02);
+        acc_02 = __SMLAD(rhs_13, lhs_0_13, acc_02);
+        acc_12 = __SMLAD(rhs_02, lhs_1_02, acc_12);
+        acc_12 = __SMLAD(rhs_13, lhs_1_13, acc_12);
+
+        rhs_val = arm_nn_read_q7x4(rhs + 12);
+        rhs_02 = __SXTB16(rhs_val);
+        rhs_13 = __SXTB16_RORn((uint32_t)rhs_val, 8);
+        acc_03 = __SMLAD(rhs_02, lhs_0_02, acc_03);
+        acc_03 = __SMLAD(rhs_13, lhs_0_13, acc_03);
+        acc_13 = __SMLAD(rhs_02, lhs_1_02, acc_13);
+        acc_13 = __SMLAD(rhs_13, lhs_1_13, acc_13);
+
+        lhs_0 += 4;
+        lhs_1 += 4;
+        rhs += 16;
+    }
+    acc_0[0] = acc_00;
+    acc_0[1] = acc_01;
+    acc_0[2] = acc_02;
+    acc_0[3] = acc_03;
+    acc_1[0] = acc_10;
+    acc_1[1] = acc_11;
+    acc_1[2] = acc_12;
+    acc_1[3] = acc_13;
+#else
+    for (int32_t r = 0; r < ARM_NN_PACKED_ROWS; r++)
+    {
+        acc_0[r] = bias[r];
+        acc_1[r] = bias[r];
+    }
+    for (int32_t i = 0; i < col_loop_cnt; i++)
+    {
+        for (int32_t r = 0; r < ARM_NN_PACKED_ROWS; r++)
+        {
+            const q7_t *rhs_row = rhs + 4 * r;
+
+            acc_0[r] += lhs_0[0] * rhs_row[0] + lhs_0[1] * rhs_row[1] + lhs_0[2] * rhs_row[2] + lhs_0[3] * rhs_row[3];
+            acc_1[r] += lhs_1[0] * rhs_row[0] + lhs_1[1] * rhs_row[1] + lhs_1[2] * rhs_row[2] + lhs_1[3] * rhs_row[3];
+        }
+        lhs_0 += 4;
+        lhs_1 += 4;
+        rhs += 16;
+    }
+#endif
+
+    for (int32_t r = 0; r < ARM_NN_PACKED_ROWS; r++)
+    {
+        for (int32_t i = 0; i < col_left; i++)
+        {
+            acc_0[r] += lhs_0[i] * rhs[r * col_left + i];
+            acc_1[r] += lhs_1[i] * rhs[r * col_left + i];
+        }
+    }
+}
+
+/* Requantizes the rows of a block that are not padding */
+static void packed_store(const int32_t *acc,
+                         q7_t *dst,
+                         const int32_t rows,
+                         const int32_t *mult,
+                         const int32_t *shift,
+                         const int32_t dst_offset,
+                         const int32_t activation_min,
+                         const int32_t activation_max)
+{
+    for (int32_t r = 0; r < rows; r++)
+    {
+        int32_t res = arm_nn_requantize(acc[r], mult[r], shift[r]);
+        res += dst_offset;
+        res = MAX(res, activation_min);
+        res = MIN(res, activation_max);
+        dst[r] = (q7_t)res;
+    }
+}
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * s8 matrix multiplication with the rhs matrix in the packed format
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_mat_mult_packed_s8(const q7_t *lhs,
+                                     const q7_t *packed_rhs,
+                                     q7_t *dst,
+                                     const int32_t *dst_multipliers,
+                                     const int32_t *dst_shifts,
+                                     const int32_t per_channel,
+                                     const int32_t lhs_rows,
+                                     const int32_t rhs_rows,
+                                     const int32_t rhs_cols,
+                                     const int32_t dst_offset,
+                                     const int32_t activation_min,
+                                     const int32_t activation_max)
+{
+    const int32_t col_loop_cnt = rhs_cols / 4;
+    const int32_t col_left = rhs_cols & 3;
+    const int32_t block_size = ARM_NN_PACKED_ROWS * ((int32_t)sizeof(int32_t) + rhs_cols);
+    int32_t mult[ARM_NN_PACKED_ROWS];
+    int32_t shift[ARM_NN_PACKED_ROWS];
+
+    for (int32_t i = 0; i < ARM_NN_PACKED_ROWS; i++)
+    {
+        mult[i] = dst_multipliers[0];
+        shift[i] = dst_shifts[0];
+    }
+
+    for (int32_t i_row = 0; i_row < rhs_rows; i_row += ARM_NN_PACKED_ROWS)
+    {
+        const q7_t *block = packed_rhs + (i_row / ARM_NN_PACKED_ROWS) * block_size;
+        const q7_t *block_cols = block + ARM_NN_PACKED_ROWS * (int32_t)sizeof(int32_t);
+        const int32_t rows = MIN(ARM_NN_PACKED_ROWS, rhs_rows - i_row);
+        int32_t bias[ARM_NN_PACKED_ROWS];
+        int32_t acc_0[ARM_NN_PACKED_ROWS];
+        int32_t acc_1[ARM_NN_PACKED_ROWS];
+        const q7_t *lhs_ptr = lhs;
+        q7_t *dst_ptr = dst + i_row;
+
+        for (int32_t i = 0; i < ARM_NN_PACKED_ROWS; i++)
+        {
+            bias[i] = arm_nn_read_q7x4(block + i * (int32_t)sizeof(int32_t));
+        }
+        if (per_channel)
+        {
+            for (int32_t i = 0; i < rows; i++)
+            {
+                mult[i] = dst_multipliers[i_row + i];
+                shift[i] = dst_shifts[i_row + i];
+            }
+        }
+
+        /* Two lhs rows per pass over the block */
+        for (int32_t i_lhs = 0; i_lhs < lhs_rows / 2; i_lhs++)
+        {
+            packed_dot_2x(lhs_ptr, lhs_ptr + rhs_cols, block_cols, col_loop_cnt, col_left, bias, acc_0, acc_1);
+            packed_store(acc_0, dst_ptr, rows, mult, shift, dst_offset, activation_min, activation_max);
+            packed_store(acc_1, dst_ptr + rhs_rows, rows, mult, shift, dst_offset, activation_min, activation_max);
+            lhs_ptr += 2 * rhs_cols;
+            dst_ptr += 2 * rhs_rows;
+        }
+
+        if (lhs_rows & 1)
+        {
+            packed_dot_1x(lhs_ptr, block_cols, col_loop_cnt, col_left, bias, acc_0);
+            packed_store(acc_0, dst_ptr, rows, mult, shift, dst_offset, activation_min, activation_max);
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
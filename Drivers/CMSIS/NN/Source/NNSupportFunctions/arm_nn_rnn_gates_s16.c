@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2022 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_rnn_gates_s16
+ * Description:  Gate pre-activations of the LSTM and GRU layers, s16
+ *               vectors by stacked s8 gate weights.
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/* The int32 accumulator of at most 512 s16 by s8 products does not overflow */
+#define RNN_MAX_COL_COUNT (512)
+
+static q63_t rnn_dot_s16_s8(const q15_t *lhs, const q7_t *rhs, int32_t length)
+{
+    q63_t result = 0;
+
+    while (length > 0)
+    {
+        const int32_t col_count = MIN(length, RNN_MAX_COL_COUNT);
+        int32_t acc = 0;
+        int32_t i = col_count;
+
+#if defined(ARM_MATH_DSP)
+        for (; i >= 4; i -= 4)
+        {
+            int32_t ker_0, ker_1;
+            const int32_t vec_part_0 = arm_nn_read_q15x2_ia(&lhs);
+            const int32_t vec_part_1 = arm_nn_read_q15x2_ia(&lhs);
+
+            rhs = read_and_pad(rhs, &ker_0, &ker_1);
+
+            acc = __SMLAD(ker_0, vec_part_0, acc);
+            acc = __SMLAD(ker_1, vec_part_1, acc);
+        }
+#endif
+        for (; i > 0; i--)
+        {
+            acc += *lhs++ * *rhs++;
+        }
+
+        result += acc;
+        length -= col_count;
+    }
+
+    return result;
+}
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * Gate pre-activations of a recurrent layer
+ *
+ * Refer header file for details.
+ *
+ */
+void arm_nn_rnn_gates_s16(const q15_t *input,
+                          const q15_t *hidden,
+                          const cmsis_nn_rnn_gates *gates,
+                          const int32_t num_gates,
+                          const int32_t input_size,
+                          const int32_t hidden_size,
+                          q15_t *input_gates,
+                          q15_t *recurrent_gates)
+{
+    const q7_t *input_weights = gates->input_weights;
+    const q7_t *recurrent_weights = gates->recurrent_weights;
+    int32_t row = 0;
+
+    for (int32_t i_gate = 0; i_gate < num_gates; i_gate++)
+    {
+        const q31_t input_mult = REDUCE_MULTIPLIER(gates->input_multipliers[i_gate]);
+        const q31_t input_shift = gates->input_shifts[i_gate];
+        const q31_t recurrent_mult = REDUCE_MULTIPLIER(gates->recurrent_multipliers[i_gate]);
+        const q31_t recurrent_shift = gates->recurrent_shifts[i_gate];
+
+        for (int32_t i_row = 0; i_row < hidden_size; i_row++, row++)
+        {
+            q63_t input_acc = rnn_dot_s16_s8(input, input_weights, input_size);
+            q63_t recurrent_acc = rnn_dot_s16_s8(hidden, recurrent_weights, hidden_size);
+            input_weights += input_size;
+            recurrent_weights += hidden_size;
+
+            if (gates->bias)
+            {
+                input_acc += gates->bias[row];
+            }
+            if (gates->recurrent_bias)
+            {
+                recurrent_acc += gates->recurrent_bias[row];
+            }
+
+            const q31_t input_part = __SSAT(arm_nn_requantize_s64(input_acc, input_mult, input_shift), 16);
+            const q31_t recurrent_part =
+                __SSAT(arm_nn_requantize_s64(recurrent_acc, recurrent_mult, recurrent_shift), 16);
+
+            if (recurrent_gates)
+            {
+                input_gates[row] = (q15_t)input_part;
+                recurrent_gates[row] = (q15_t)recurrent_part;
+            }
+            else
+            {
+                input_gates[row] = (q15_t)__SSAT(input_part + recurrent_part, 16);
+            }
+        }
+    }
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
@@ -21,10 +21,10 @@
  * Title:        arm_nn_vec_mat_mult_t_s8
  * Description:  s8 vector by matrix (transposed) multiplication
  *
- * $Date:        28 April 2022
- * $Revision:    V.3.0.1
+ * $Date:        18 October 2026
+ * $Revision:    V.3.1.0
  *
- * Target Processor:  Cortex-M
+ * Target Processor:  Cortex-M and Cortex-A cores with Neon
  *
  * -------------------------------------------------------------------- */
 
@@ -61,7 +61,127 @@ arm_status arm_nn_vec_mat_mult_t_s8(const q7_t *lhs,
                                     const int32_t address_offset)
 {
     (void)rhs_offset;
-#if defined(ARM_MATH_MVEI)
+#if defined(ARM_MATH_NEON)
+    const int32_t row_loop_cnt = rhs_rows / 4;
+
+    for (int32_t i_row_loop_cnt = 0; i_row_loop_cnt < row_loop_cnt; i_row_loop_cnt++)
+    {
+        const int8_t *rhs_0 = rhs;
+        const int8_t *rhs_1 = rhs + rhs_cols;
+        const int8_t *rhs_2 = rhs + 2 * rhs_cols;
+        const int8_t *rhs_3 = rhs + 3 * rhs_cols;
+        rhs += 4 * rhs_cols;
+
+        int32x4_t acc_0 = vdupq_n_s32(0);
+        int32x4_t acc_1 = vdupq_n_s32(0);
+        int32x4_t acc_2 = vdupq_n_s32(0);
+        int32x4_t acc_3 = vdupq_n_s32(0);
+        int32x4_t rhs_sum_0 = vdupq_n_s32(0);
+        int32x4_t rhs_sum_1 = vdupq_n_s32(0);
+        int32x4_t rhs_sum_2 = vdupq_n_s32(0);
+        int32x4_t rhs_sum_3 = vdupq_n_s32(0);
+
+        int32_t col = 0;
+        for (; col <= (rhs_cols - 16); col += 16)
+        {
+            const int8x16_t input = vld1q_s8(lhs + col);
+
+            int8x16_t ker = vld1q_s8(rhs_0 + col);
+            rhs_sum_0 = arm_nn_sum_neon_s8x16(rhs_sum_0, ker);
+            acc_0 = arm_nn_dot_neon_s8x16(acc_0, ker, input);
+
+            ker = vld1q_s8(rhs_1 + col);
+            rhs_sum_1 = arm_nn_sum_neon_s8x16(rhs_sum_1, ker);
+            acc_1 = arm_nn_dot_neon_s8x16(acc_1, ker, input);
+
+            ker = vld1q_s8(rhs_2 + col);
+            rhs_sum_2 = arm_nn_sum_neon_s8x16(rhs_sum_2, ker);
+            acc_2 = arm_nn_dot_neon_s8x16(acc_2, ker, input);
+
+            ker = vld1q_s8(rhs_3 + col);
+            rhs_sum_3 = arm_nn_sum_neon_s8x16(rhs_sum_3, ker);
+            acc_3 = arm_nn_dot_neon_s8x16(acc_3, ker, input);
+        }
+
+        int32_t tail_acc[4] = {0, 0, 0, 0};
+        int32_t tail_sum[4] = {0, 0, 0, 0};
+        for (; col < rhs_cols; col++)
+        {
+            const int32_t input = lhs[col];
+
+            tail_acc[0] += input * rhs_0[col];
+            tail_acc[1] += input * rhs_1[col];
+            tail_acc[2] += input * rhs_2[col];
+            tail_acc[3] += input * rhs_3[col];
+            tail_sum[0] += rhs_0[col];
+            tail_sum[1] += rhs_1[col];
+            tail_sum[2] += rhs_2[col];
+            tail_sum[3] += rhs_3[col];
+        }
+
+        int32x4_t acc = vaddq_s32(arm_nn_reduce4_neon_s32(acc_0, acc_1, acc_2, acc_3), vld1q_s32(tail_acc));
+        const int32x4_t rhs_sum =
+            vaddq_s32(arm_nn_reduce4_neon_s32(rhs_sum_0, rhs_sum_1, rhs_sum_2, rhs_sum_3), vld1q_s32(tail_sum));
+
+        acc = vmlaq_n_s32(acc, rhs_sum, lhs_offset);
+        if (bias)
+        {
+            acc = vaddq_s32(acc, vld1q_s32(bias));
+            bias += 4;
+        }
+
+        acc = arm_requantize_neon(acc, dst_multiplier, dst_shift);
+        acc = vaddq_s32(acc, vdupq_n_s32(dst_offset));
+        acc = vmaxq_s32(acc, vdupq_n_s32(activation_min));
+        acc = vminq_s32(acc, vdupq_n_s32(activation_max));
+
+        dst[0] = (int8_t)vgetq_lane_s32(acc, 0);
+        dst[address_offset] = (int8_t)vgetq_lane_s32(acc, 1);
+        dst[2 * address_offset] = (int8_t)vgetq_lane_s32(acc, 2);
+        dst[3 * address_offset] = (int8_t)vgetq_lane_s32(acc, 3);
+        dst += 4 * address_offset;
+    }
+
+    const int32_t loop_cnt = rhs_rows % 4;
+    for (int32_t i_row_loop_cnt = 0; i_row_loop_cnt < loop_cnt; i_row_loop_cnt++)
+    {
+        int32x4_t acc_0 = vdupq_n_s32(0);
+        int32x4_t rhs_sum_0 = vdupq_n_s32(0);
+
+        int32_t col = 0;
+        for (; col <= (rhs_cols - 16); col += 16)
+        {
+            const int8x16_t ker = vld1q_s8(rhs + col);
+
+            rhs_sum_0 = arm_nn_sum_neon_s8x16(rhs_sum_0, ker);
+            acc_0 = arm_nn_dot_neon_s8x16(acc_0, ker, vld1q_s8(lhs + col));
+        }
+
+        int32_t acc = arm_nn_reduce_neon_s32(acc_0);
+        int32_t rhs_sum = arm_nn_reduce_neon_s32(rhs_sum_0);
+        for (; col < rhs_cols; col++)
+        {
+            acc += lhs[col] * rhs[col];
+            rhs_sum += rhs[col];
+        }
+        rhs += rhs_cols;
+
+        if (bias)
+        {
+            acc += *bias;
+            bias++;
+        }
+        acc += rhs_sum * lhs_offset;
+        acc = arm_nn_requantize(acc, dst_multiplier, dst_shift);
+        acc += dst_offset;
+
+        // Clamp the result
+        acc = MAX(acc, activation_min);
+        *dst = MIN(acc, activation_max);
+        dst += address_offset;
+    }
+
+#elif defined(ARM_MATH_MVEI)
     const int32_t row_loop_cnt = rhs_rows / 3;
     const uint32x4_t address_offset_array = {0, address_offset, address_offset * 2, address_offset * 3};
 
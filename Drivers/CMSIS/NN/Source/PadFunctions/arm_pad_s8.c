@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_pad_s8.c
+ * Description:  Pad a s8 tensor with a constant value
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pad
+ * @{
+ */
+
+/*
+ * Basic s8 pad function.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_pad_s8(const int8_t *input,
+                      int8_t *output,
+                      const int8_t pad_value,
+                      const cmsis_nn_dims *input_size,
+                      const cmsis_nn_dims *pre_pad,
+                      const cmsis_nn_dims *post_pad)
+{
+    if (pre_pad->n < 0 || pre_pad->h < 0 || pre_pad->w < 0 || pre_pad->c < 0 || post_pad->n < 0 ||
+        post_pad->h < 0 || post_pad->w < 0 || post_pad->c < 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t input_w = input_size->w;
+    const int32_t input_c = input_size->c;
+    const int32_t output_c = pre_pad->c + input_c + post_pad->c;
+    const int32_t output_w = pre_pad->w + input_w + post_pad->w;
+    const int32_t output_h = pre_pad->h + input_size->h + post_pad->h;
+    const int32_t row_size = output_w * output_c;
+    const int32_t batch_size = output_h * row_size;
+
+    arm_memset_q7(output, pad_value, pre_pad->n * batch_size);
+    output += pre_pad->n * batch_size;
+
+    for (int32_t i_n = 0; i_n < input_size->n; i_n++)
+    {
+        arm_memset_q7(output, pad_value, pre_pad->h * row_size);
+        output += pre_pad->h * row_size;
+
+        for (int32_t i_h = 0; i_h < input_size->h; i_h++)
+        {
+            arm_memset_q7(output, pad_value, pre_pad->w * output_c);
+            output += pre_pad->w * output_c;
+
+            if (output_c == input_c)
+            {
+                /* The channels are not padded: the input row is contiguous in the output */
+                arm_memcpy_q7(output, input, input_w * input_c);
+                output += input_w * input_c;
+                input += input_w * input_c;
+            }
+            else
+            {
+                for (int32_t i_w = 0; i_w < input_w; i_w++)
+                {
+                    arm_memset_q7(output, pad_value, pre_pad->c);
+                    output += pre_pad->c;
+                    arm_memcpy_q7(output, input, input_c);
+                    output += input_c;
+                    input += input_c;
+                    arm_memset_q7(output, pad_value, post_pad->c);
+                    output += post_pad->c;
+                }
+            }
+
+            arm_memset_q7(output, pad_value, post_pad->w * output_c);
+            output += post_pad->w * output_c;
+        }
+
+        arm_memset_q7(output, pad_value, post_pad->h * row_size);
+        output += post_pad->h * row_size;
+    }
+
+    arm_memset_q7(output, pad_value, post_pad->n * batch_size);
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Pad group
+ */
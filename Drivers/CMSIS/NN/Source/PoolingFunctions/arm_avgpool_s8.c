@@ -21,8 +21,8 @@
  * Title:        arm_avgpool_s8.c
  * Description:  Pooling function implementations
  *
- * $Date:        01. March 2021
- * $Revision:    V.2.0.4
+ * $Date:        18. October 2026
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -69,22 +69,16 @@ static void scale_q31_to_q7_and_clamp(const q31_t *buffer,
  * @{
  */
 
-/*
- * s8 average pooling function
- *
- * Refer to header file for details.
- *
- */
-
 #if defined(ARM_MATH_MVEI)
 
-arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
-                          const cmsis_nn_pool_params *pool_params,
-                          const cmsis_nn_dims *input_dims,
-                          const q7_t *src,
-                          const cmsis_nn_dims *filter_dims,
-                          const cmsis_nn_dims *output_dims,
-                          q7_t *dst)
+/* Average pooling of one image */
+static arm_status avgpool_s8_image(const cmsis_nn_context *ctx,
+                                   const cmsis_nn_pool_params *pool_params,
+                                   const cmsis_nn_dims *input_dims,
+                                   const q7_t *src,
+                                   const cmsis_nn_dims *filter_dims,
+                                   const cmsis_nn_dims *output_dims,
+                                   q7_t *dst)
 {
     (void)ctx;
     const int32_t input_y = input_dims->h;
@@ -254,13 +248,14 @@ arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
 }
 
 #else
-arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
-                          const cmsis_nn_pool_params *pool_params,
-                          const cmsis_nn_dims *input_dims,
-                          const q7_t *src,
-                          const cmsis_nn_dims *filter_dims,
-                          const cmsis_nn_dims *output_dims,
-                          q7_t *dst)
+/* Average pooling of one image */
+static arm_status avgpool_s8_image(const cmsis_nn_context *ctx,
+                                   const cmsis_nn_pool_params *pool_params,
+                                   const cmsis_nn_dims *input_dims,
+                                   const q7_t *src,
+                                   const cmsis_nn_dims *filter_dims,
+                                   const cmsis_nn_dims *output_dims,
+                                   q7_t *dst)
 {
     const int32_t input_y = input_dims->h;
     const int32_t input_x = input_dims->w;
@@ -385,6 +380,40 @@ arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
 
 #endif /* ARM_MATH_MVEI */
 
+/*
+ * s8 average pooling function
+ *
+ * Refer to header file for details.
+ *
+ */
+arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
+                          const cmsis_nn_pool_params *pool_params,
+                          const cmsis_nn_dims *input_dims,
+                          const q7_t *src,
+                          const cmsis_nn_dims *filter_dims,
+                          const cmsis_nn_dims *output_dims,
+                          q7_t *dst)
+{
+    /* Callers written for one image may leave N at 0 */
+    const int32_t batches = MAX(1, input_dims->n);
+    const int32_t input_size = input_dims->h * input_dims->w * input_dims->c;
+    const int32_t output_size = output_dims->h * output_dims->w * output_dims->c;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for (int32_t i_batch = 0; i_batch < batches && status == ARM_MATH_SUCCESS; i_batch++)
+    {
+        status = avgpool_s8_image(ctx,
+                                  pool_params,
+                                  input_dims,
+                                  src + i_batch * input_size,
+                                  filter_dims,
+                                  output_dims,
+                                  dst + i_batch * output_size);
+    }
+
+    return status;
+}
+
 int32_t arm_avgpool_s8_get_buffer_size(const int output_x, const int ch_src)
 {
     (void)output_x;
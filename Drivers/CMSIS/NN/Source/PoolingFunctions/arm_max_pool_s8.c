@@ -21,8 +21,8 @@
  * Title:        arm_max_pool_s8.c
  * Description:  Pooling function implementations
  *
- * $Date:        20. July 2021
- * $Revision:    V.2.0.3
+ * $Date:        18. October 2026
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -180,46 +180,55 @@ arm_status arm_max_pool_s8(const cmsis_nn_context *ctx,
     const int32_t act_min = pool_params->activation.min;
     const int32_t act_max = pool_params->activation.max;
     const int32_t channel_in = input_dims->c;
+    /* Callers written for one image may leave N at 0 */
+    const int32_t batches = MAX(1, input_dims->n);
     (void)ctx;
     q7_t *dst_base = dst;
 
-    for (int i_y = 0, base_idx_y = -pad_y; i_y < output_y; base_idx_y += stride_y, i_y++)
+    /* The images of a batch follow each other in the input and in the output */
+    for (int32_t i_batch = 0; i_batch < batches; i_batch++)
     {
-        for (int i_x = 0, base_idx_x = -pad_x; i_x < output_x; base_idx_x += stride_x, i_x++)
+        const q7_t *src_image = src + i_batch * input_y * input_x * channel_in;
+
+        for (int i_y = 0, base_idx_y = -pad_y; i_y < output_y; base_idx_y += stride_y, i_y++)
         {
-            /* Condition for kernel start dimension: (base_idx_<x,y> + kernel_<x,y>_start) >= 0 */
-            const int32_t ker_y_start = MAX(0, -base_idx_y);
-            const int32_t ker_x_start = MAX(0, -base_idx_x);
+            for (int i_x = 0, base_idx_x = -pad_x; i_x < output_x; base_idx_x += stride_x, i_x++)
+            {
+                /* Condition for kernel start dimension: (base_idx_<x,y> + kernel_<x,y>_start) >= 0 */
+                const int32_t ker_y_start = MAX(0, -base_idx_y);
+                const int32_t ker_x_start = MAX(0, -base_idx_x);
 
-            /* Condition for kernel end dimension: (base_idx_<x,y> + kernel_<x,y>_end) < dim_src_<width,height> */
-            const int32_t kernel_y_end = MIN(kernel_y, input_y - base_idx_y);
-            const int32_t kernel_x_end = MIN(kernel_x, input_x - base_idx_x);
+                /* Condition for kernel end dimension: (base_idx_<x,y> + kernel_<x,y>_end) < dim_src_<width,height> */
+                const int32_t kernel_y_end = MIN(kernel_y, input_y - base_idx_y);
+                const int32_t kernel_x_end = MIN(kernel_x, input_x - base_idx_x);
 
-            int count = 0;
+                int count = 0;
 
-            for (int k_y = ker_y_start; k_y < kernel_y_end; k_y++)
-            {
-                for (int k_x = ker_x_start; k_x < kernel_x_end; k_x++)
+                for (int k_y = ker_y_start; k_y < kernel_y_end; k_y++)
                 {
-                    const q7_t *start = src + channel_in * (k_x + base_idx_x + (k_y + base_idx_y) * input_x);
-
-                    if (count == 0)
-                    {
-                        arm_memcpy_q7(dst, start, channel_in);
-                        count++;
-                    }
-                    else
+                    for (int k_x = ker_x_start; k_x < kernel_x_end; k_x++)
                     {
-                        compare_and_replace_if_larger_q7(dst, start, channel_in);
+                        const q7_t *start =
+                            src_image + channel_in * (k_x + base_idx_x + (k_y + base_idx_y) * input_x);
+
+                        if (count == 0)
+                        {
+                            arm_memcpy_q7(dst, start, channel_in);
+                            count++;
+                        }
+                        else
+                        {
+                            compare_and_replace_if_larger_q7(dst, start, channel_in);
+                        }
                     }
                 }
+                /* 'count' is expected to be non-zero here. */
+                dst += channel_in;
             }
-            /* 'count' is expected to be non-zero here. */
-            dst += channel_in;
         }
     }
 
-    clamp_output(dst_base, output_x * output_y * channel_in, act_min, act_max);
+    clamp_output(dst_base, batches * output_x * output_y * channel_in, act_min, act_max);
 
     return ARM_MATH_SUCCESS;
 }
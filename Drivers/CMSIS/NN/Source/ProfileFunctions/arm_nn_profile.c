@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_profile.c
+ * Description:  Per-layer profiling ring and time base
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M and Cortex-A cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+#if !defined(ARM_NN_PROFILE_TIMESTAMP)
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+/* Architectural DWT / CoreDebug addresses: no device header needed */
+#define ARM_NN_PROFILE_DWT_CTRL (*(volatile uint32_t *)0xE0001000UL)
+#define ARM_NN_PROFILE_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004UL)
+#define ARM_NN_PROFILE_DEMCR (*(volatile uint32_t *)0xE000EDFCUL)
+#define ARM_NN_PROFILE_TIMESTAMP() ARM_NN_PROFILE_DWT_CYCCNT
+#else
+#include <time.h>
+#define ARM_NN_PROFILE_HOST_CLOCK
+#endif
+#endif
+
+/*
+ * Records are reserved with an atomic increment of head, so that the layers of
+ * arm_convolve_parallel_s8() and the like can be recorded from several tasks.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__ARM_ARCH_6M__)
+#define ARM_NN_PROFILE_RESERVE(LOG) __atomic_fetch_add(&(LOG)->head, 1U, __ATOMIC_RELAXED)
+#else
+/* No lock-free increment available: single execution context only */
+#define ARM_NN_PROFILE_RESERVE(LOG) ((LOG)->head++)
+#endif
+
+static cmsis_nn_profile_log *profile_log = NULL;
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNProfile
+ * @{
+ */
+
+/*
+ * Start recording.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_profile_init(const cmsis_nn_context *ctx)
+{
+    if (ctx == NULL || ctx->buf == NULL)
+    {
+        profile_log = NULL;
+        return ARM_MATH_SUCCESS;
+    }
+
+    if (((uintptr_t)ctx->buf & 7U) != 0U || ctx->size < arm_nn_profile_get_buffer_size(1))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+#if defined(ARM_NN_PROFILE_DWT_CYCCNT)
+    ARM_NN_PROFILE_DEMCR |= (1UL << 24); /* TRCENA */
+    ARM_NN_PROFILE_DWT_CYCCNT = 0U;
+    ARM_NN_PROFILE_DWT_CTRL |= 1UL; /* CYCCNTENA */
+#endif
+
+    profile_log = (cmsis_nn_profile_log *)ctx->buf;
+    profile_log->magic = ARM_NN_PROFILE_MAGIC;
+    profile_log->num_records =
+        (uint32_t)(ctx->size - (int32_t)sizeof(cmsis_nn_profile_log)) / sizeof(cmsis_nn_profile_record);
+    profile_log->record_size = sizeof(cmsis_nn_profile_record);
+    profile_log->head = 0U;
+
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_nn_profile_get_buffer_size(const int32_t num_records)
+{
+    return (int32_t)sizeof(cmsis_nn_profile_log) + num_records * (int32_t)sizeof(cmsis_nn_profile_record);
+}
+
+void arm_nn_profile_reset(void)
+{
+    if (profile_log != NULL)
+    {
+        profile_log->head = 0U;
+    }
+}
+
+uint32_t arm_nn_profile_timestamp(void)
+{
+#if defined(ARM_NN_PROFILE_HOST_CLOCK)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return (uint32_t)ARM_NN_PROFILE_TIMESTAMP();
+#endif
+}
+
+/*
+ * Record a layer call.
+ *
+ * Refer header file for details.
+ *
+ */
+void arm_nn_profile_add(const arm_nn_profile_kernel kernel,
+                        const uint32_t elapsed,
+                        const int32_t scratch_size,
+                        const cmsis_nn_dims *input_dims,
+                        const cmsis_nn_dims *filter_dims,
+                        const cmsis_nn_dims *output_dims,
+                        const arm_status status)
+{
+    cmsis_nn_profile_log *log = profile_log;
+    cmsis_nn_profile_record *rec;
+    uint64_t outputs;
+    uint64_t macs;
+
+    if (log == NULL)
+    {
+        return;
+    }
+
+    outputs = (uint64_t)output_dims->n * (uint64_t)output_dims->h * (uint64_t)output_dims->w * (uint64_t)output_dims->c;
+
+    switch (kernel)
+    {
+    case ARM_NN_PROFILE_DW_CONV_S8:
+    case ARM_NN_PROFILE_DW_CONV_S8_OPT:
+    case ARM_NN_PROFILE_DW_CONV_3X3_S8:
+        macs = outputs * (uint64_t)filter_dims->h * (uint64_t)filter_dims->w;
+        break;
+    case ARM_NN_PROFILE_FC_S8:
+    case ARM_NN_PROFILE_FC_S16:
+        /* filter_dims->n is the accumulation depth */
+        macs = (uint64_t)input_dims->n * (uint64_t)output_dims->c * (uint64_t)filter_dims->n;
+        break;
+    default:
+        macs = outputs * (uint64_t)filter_dims->h * (uint64_t)filter_dims->w * (uint64_t)input_dims->c;
+        break;
+    }
+
+    rec = (cmsis_nn_profile_record *)(log + 1) + (ARM_NN_PROFILE_RESERVE(log) % log->num_records);
+    rec->kernel = (int32_t)kernel;
+    rec->status = (int32_t)status;
+    rec->elapsed = elapsed;
+    rec->scratch_size = scratch_size;
+    rec->input_dims = *input_dims;
+    rec->filter_dims = *filter_dims;
+    rec->output_dims = *output_dims;
+    rec->macs = macs;
+}
+
+/**
+ * @} end of NNProfile group
+ */
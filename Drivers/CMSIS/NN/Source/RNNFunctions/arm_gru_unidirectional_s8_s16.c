@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_gru_unidirectional_s8_s16.c
+ * Description:  S8 unidirectional GRU layer function with s16 hidden state
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M processors
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/* Update, reset and candidate gates */
+#define GRU_GATES (3)
+
+/* The gate pre-activations are Q3.12, the input format of the activation tables */
+#define GATE_INT_BITS (3)
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup RNN
+ * @{
+ */
+
+/*
+ * S8 unidirectional GRU layer function with 16 bit hidden state
+ *
+ * Refer to header file for details.
+ *
+ */
+
+arm_status arm_gru_unidirectional_s8_s16(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_gru_params *gru_params,
+                                         const cmsis_nn_rnn_gates *gates,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input_data,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output_data,
+                                         q15_t *hidden_state)
+{
+    const int32_t batches = input_dims->n;
+    const int32_t time_steps = input_dims->h;
+    const int32_t input_size = input_dims->c;
+    const int32_t hidden_size = output_dims->c;
+
+    if (output_dims->n != batches || output_dims->h != time_steps || input_dims->w != 1 || output_dims->w != 1)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    if (ctx->buf == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Buffer layout: input, input part of the gates, recurrent part of the gates */
+    q15_t *input_q15 = (q15_t *)ctx->buf;
+    q15_t *update_gate = input_q15 + input_size;
+    q15_t *reset_gate = update_gate + hidden_size;
+    q15_t *candidate_gate = reset_gate + hidden_size;
+    q15_t *recurrent_gates = candidate_gate + hidden_size;
+    const q15_t *recurrent_candidate = recurrent_gates + 2 * hidden_size;
+
+    for (int32_t i_time = 0; i_time < time_steps; i_time++)
+    {
+        for (int32_t i_batch = 0; i_batch < batches; i_batch++)
+        {
+            const int32_t step = gru_params->time_major ? i_time * batches + i_batch : i_batch * time_steps + i_time;
+            q15_t *hidden = hidden_state + i_batch * hidden_size;
+            q7_t *output = output_data + step * hidden_size;
+
+            arm_q7_to_q15_with_offset(
+                input_data + step * input_size, input_q15, input_size, (q15_t)gru_params->input_offset);
+
+            /* All the gates in one pass over the weights. The recurrent part is kept apart for the candidate. */
+            arm_nn_rnn_gates_s16(
+                input_q15, hidden, gates, GRU_GATES, input_size, hidden_size, update_gate, recurrent_gates);
+
+            /* The update and reset gates are contiguous */
+            for (int32_t i = 0; i < 2 * hidden_size; i++)
+            {
+                update_gate[i] = (q15_t)__SSAT(update_gate[i] + recurrent_gates[i], 16);
+            }
+            arm_nn_activations_direct_q15(update_gate, 2 * hidden_size, GATE_INT_BITS, ARM_SIGMOID);
+
+            /* candidate = tanh(input part + reset * recurrent part) */
+            for (int32_t i = 0; i < hidden_size; i++)
+            {
+                const q31_t gated = ((q31_t)reset_gate[i] * recurrent_candidate[i] + (1 << 14)) >> 15;
+                candidate_gate[i] = (q15_t)__SSAT(candidate_gate[i] + gated, 16);
+            }
+            arm_nn_activations_direct_q15(candidate_gate, hidden_size, GATE_INT_BITS, ARM_TANH);
+
+            /* hidden = candidate + update * (hidden - candidate) */
+            for (int32_t i = 0; i < hidden_size; i++)
+            {
+                const q31_t delta = (q31_t)hidden[i] - candidate_gate[i];
+                const q31_t new_hidden =
+                    __SSAT(candidate_gate[i] + (((q31_t)update_gate[i] * delta + (1 << 14)) >> 15), 16);
+                hidden[i] = (q15_t)new_hidden;
+
+                q31_t out = arm_nn_requantize(new_hidden, gru_params->output_multiplier, gru_params->output_shift);
+                out += gru_params->output_offset;
+                out = MAX(MIN(out, NN_Q7_MAX), NN_Q7_MIN);
+                output[i] = (q7_t)out;
+            }
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_gru_unidirectional_s8_s16_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                      const cmsis_nn_dims *output_dims)
+{
+    return (input_dims->c + 2 * GRU_GATES * output_dims->c) * (int32_t)sizeof(q15_t);
+}
+
+/**
+ * @} end of RNN group
+ */
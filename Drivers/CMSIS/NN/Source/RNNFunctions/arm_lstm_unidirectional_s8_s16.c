@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_lstm_unidirectional_s8_s16.c
+ * Description:  S8 unidirectional LSTM layer function with s16 cell state
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M processors
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/* Input, forget, cell and output gates */
+#define LSTM_GATES (4)
+
+/* The gate pre-activations are Q3.12, the input format of the activation tables */
+#define GATE_INT_BITS (3)
+#define GATE_FRAC_BITS (12)
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup RNN
+ * @{
+ */
+
+/*
+ * S8 unidirectional LSTM layer function with 16 bit cell state
+ *
+ * Refer to header file for details.
+ *
+ */
+
+arm_status arm_lstm_unidirectional_s8_s16(const cmsis_nn_context *ctx,
+                                          const cmsis_nn_lstm_params *lstm_params,
+                                          const cmsis_nn_rnn_gates *gates,
+                                          const cmsis_nn_dims *input_dims,
+                                          const q7_t *input_data,
+                                          const cmsis_nn_dims *output_dims,
+                                          q7_t *output_data,
+                                          q7_t *hidden_state,
+                                          q15_t *cell_state)
+{
+    const int32_t batches = input_dims->n;
+    const int32_t time_steps = input_dims->h;
+    const int32_t input_size = input_dims->c;
+    const int32_t hidden_size = output_dims->c;
+
+    if (output_dims->n != batches || output_dims->h != time_steps || input_dims->w != 1 || output_dims->w != 1)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    if (ctx->buf == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t output_offset = lstm_params->output_offset;
+    const int32_t cell_clip = lstm_params->cell_clip;
+    /* input gate * cell gate is Q0.30, the cell state scale is 2^cell_scale_power */
+    const int32_t update_shift = 30 + lstm_params->cell_scale_power;
+    /* Cell state to the Q3.12 input of tanh */
+    const int32_t cell_to_gate_shift = GATE_FRAC_BITS + lstm_params->cell_scale_power;
+
+    /* Buffer layout: input, hidden state, input gate, forget gate, cell gate, output gate */
+    q15_t *input_q15 = (q15_t *)ctx->buf;
+    q15_t *hidden_q15 = input_q15 + input_size;
+    q15_t *input_gate = hidden_q15 + hidden_size;
+    q15_t *forget_gate = input_gate + hidden_size;
+    q15_t *cell_gate = forget_gate + hidden_size;
+    q15_t *output_gate = cell_gate + hidden_size;
+
+    for (int32_t i_time = 0; i_time < time_steps; i_time++)
+    {
+        for (int32_t i_batch = 0; i_batch < batches; i_batch++)
+        {
+            const int32_t step = lstm_params->time_major ? i_time * batches + i_batch : i_batch * time_steps + i_time;
+            q7_t *hidden = hidden_state + i_batch * hidden_size;
+            q15_t *cell = cell_state + i_batch * hidden_size;
+            q7_t *output = output_data + step * hidden_size;
+
+            arm_q7_to_q15_with_offset(
+                input_data + step * input_size, input_q15, input_size, (q15_t)lstm_params->input_offset);
+            arm_q7_to_q15_with_offset(hidden, hidden_q15, hidden_size, (q15_t)(-output_offset));
+
+            /* All the gates in one pass over the weights */
+            arm_nn_rnn_gates_s16(input_q15, hidden_q15, gates, LSTM_GATES, input_size, hidden_size, input_gate, NULL);
+
+            /* The input and forget gates are contiguous */
+            arm_nn_activations_direct_q15(input_gate, 2 * hidden_size, GATE_INT_BITS, ARM_SIGMOID);
+            arm_nn_activations_direct_q15(cell_gate, hidden_size, GATE_INT_BITS, ARM_TANH);
+            arm_nn_activations_direct_q15(output_gate, hidden_size, GATE_INT_BITS, ARM_SIGMOID);
+
+            /* cell = forget * cell + input * cell gate. The cell gate is then replaced by the tanh input. */
+            for (int32_t i = 0; i < hidden_size; i++)
+            {
+                q31_t new_cell = ((q31_t)forget_gate[i] * cell[i] + (1 << 14)) >> 15;
+                new_cell += ((q31_t)input_gate[i] * cell_gate[i] + (1 << (update_shift - 1))) >> update_shift;
+                new_cell = __SSAT(new_cell, 16);
+                if (cell_clip > 0)
+                {
+                    new_cell = MAX(MIN(new_cell, cell_clip), -cell_clip);
+                }
+                cell[i] = (q15_t)new_cell;
+
+                if (cell_to_gate_shift >= 0)
+                {
+                    cell_gate[i] = (q15_t)__SSAT(new_cell * (1 << cell_to_gate_shift), 16);
+                }
+                else
+                {
+                    cell_gate[i] = (q15_t)((new_cell + (1 << (-cell_to_gate_shift - 1))) >> -cell_to_gate_shift);
+                }
+            }
+            arm_nn_activations_direct_q15(cell_gate, hidden_size, GATE_INT_BITS, ARM_TANH);
+
+            /* hidden = output gate * tanh(cell) */
+            for (int32_t i = 0; i < hidden_size; i++)
+            {
+                q31_t out = arm_nn_requantize(
+                    (q31_t)output_gate[i] * cell_gate[i], lstm_params->hidden_multiplier, lstm_params->hidden_shift);
+                out += output_offset;
+                out = MAX(MIN(out, NN_Q7_MAX), NN_Q7_MIN);
+                hidden[i] = (q7_t)out;
+                output[i] = (q7_t)out;
+            }
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_lstm_unidirectional_s8_s16_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                       const cmsis_nn_dims *output_dims)
+{
+    return (input_dims->c + (LSTM_GATES + 1) * output_dims->c) * (int32_t)sizeof(q15_t);
+}
+
+/**
+ * @} end of RNN group
+ */
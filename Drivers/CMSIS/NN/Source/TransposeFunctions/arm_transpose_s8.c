@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2010-2022 Arm Limited or its affiliates.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_transpose_s8.c
+ * Description:  Permute the dimensions of a s8 tensor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Transpose
+ * @{
+ */
+
+/*
+ * Basic s8 transpose function.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_transpose_s8(const int8_t *input,
+                            int8_t *output,
+                            const cmsis_nn_dims *input_dims,
+                            const cmsis_nn_dims *output_dims,
+                            const cmsis_nn_transpose_params *transpose_params)
+{
+    const int32_t num_dims = transpose_params->num_dims;
+    const int32_t in_size[4] = {input_dims->n, input_dims->h, input_dims->w, input_dims->c};
+    const int32_t out_size[4] = {output_dims->n, output_dims->h, output_dims->w, output_dims->c};
+    const int32_t in_stride[4] = {
+        input_dims->h * input_dims->w * input_dims->c, input_dims->w * input_dims->c, input_dims->c, 1};
+    int32_t perm[4];
+    uint32_t used = 0;
+
+    if (num_dims < 1 || num_dims > 4)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Permutation of the four dimensions, the leading ones stay in place */
+    for (int32_t i = 0; i < 4 - num_dims; i++)
+    {
+        perm[i] = i;
+    }
+    for (int32_t i = 0; i < num_dims; i++)
+    {
+        const uint32_t dim = transpose_params->permutations[i];
+        if (dim >= (uint32_t)num_dims || (used & (1U << dim)) != 0)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+        used |= 1U << dim;
+        perm[4 - num_dims + i] = 4 - num_dims + (int32_t)dim;
+    }
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        if (out_size[i] != in_size[perm[i]])
+        {
+            return ARM_MATH_SIZE_MISMATCH;
+        }
+    }
+
+    /* Trailing dimensions that are not moved are copied as a block */
+    int32_t block = 1;
+    int32_t outer_dims = 4;
+    while (outer_dims > 0 && perm[outer_dims - 1] == outer_dims - 1)
+    {
+        outer_dims--;
+        block *= out_size[outer_dims];
+    }
+
+    if (outer_dims == 0)
+    {
+        arm_memcpy_q7(output, input, block);
+        return ARM_MATH_SUCCESS;
+    }
+
+    /* Three outer loops and an inner one, unused loops run once */
+    int32_t count[4] = {1, 1, 1, 1};
+    int32_t stride[4] = {0, 0, 0, 0};
+    for (int32_t i = 0; i < outer_dims; i++)
+    {
+        count[4 - outer_dims + i] = out_size[i];
+        stride[4 - outer_dims + i] = in_stride[perm[i]];
+    }
+
+    if (block > 1)
+    {
+        for (int32_t i_0 = 0; i_0 < count[0]; i_0++)
+        {
+            for (int32_t i_1 = 0; i_1 < count[1]; i_1++)
+            {
+                for (int32_t i_2 = 0; i_2 < count[2]; i_2++)
+                {
+                    const int8_t *src = input + i_0 * stride[0] + i_1 * stride[1] + i_2 * stride[2];
+                    for (int32_t i_3 = 0; i_3 < count[3]; i_3++)
+                    {
+                        arm_memcpy_q7(output, src, block);
+                        output += block;
+                        src += stride[3];
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        const int32_t stride_3 = stride[3];
+
+        for (int32_t i_0 = 0; i_0 < count[0]; i_0++)
+        {
+            for (int32_t i_1 = 0; i_1 < count[1]; i_1++)
+            {
+                for (int32_t i_2 = 0; i_2 < count[2]; i_2++)
+                {
+                    const int8_t *src = input + i_0 * stride[0] + i_1 * stride[1] + i_2 * stride[2];
+                    int32_t i_3 = count[3];
+
+                    /* Gather four elements and store them at once */
+                    while (i_3 >= 4)
+                    {
+                        arm_nn_write_q7x4_ia(
+                            &output, PACK_Q7x4_32x1(src[0], src[stride_3], src[2 * stride_3], src[3 * stride_3]));
+                        src += 4 * stride_3;
+                        i_3 -= 4;
+                    }
+                    while (i_3 > 0)
+                    {
+                        *output++ = *src;
+                        src += stride_3;
+                        i_3--;
+                    }
+                }
+            }
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Transpose group
+ */
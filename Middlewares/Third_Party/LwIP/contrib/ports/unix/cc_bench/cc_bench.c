@@ -0,0 +1,370 @@
+/*
+ * Congestion control benchmark: goodput and round-trip time of one TCP
+ * connection over simulated links with Reno, CUBIC and Vegas, see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/ip4.h"
+#include "lwip/pbuf.h"
+#include "lwip/tcp.h"
+#include "lwip/sys.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/tcp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_LOCAL_IP     PP_HTONL(LWIP_MAKEU32(10, 0, 0, 1))
+#define BENCH_PORT         80
+#define BENCH_LINK_QUEUE   4096
+/* give up if a transfer takes longer than this (simulated) */
+#define BENCH_MAX_SECONDS  1000UL
+
+struct bench_scenario {
+  const char *name;
+  u32_t bps;
+  u32_t delay;       /* us, each direction */
+  u32_t queue_limit; /* packets waiting for the data link */
+  u32_t loss_ppm;    /* random loss of data segments */
+  u32_t bytes;
+};
+
+/* One direction of the simulated link: packets in order of arrival */
+struct bench_link {
+  struct pbuf *p[BENCH_LINK_QUEUE];
+  u32_t arrival[BENCH_LINK_QUEUE];
+  u32_t head;
+  u32_t num;
+  u32_t limit;
+  u32_t busy_until;
+};
+
+static const struct bench_scenario bench_scenarios[] = {
+  /* geostationary satellite: long RTT, a buffer of one BDP, rare random loss */
+  { "satellite",   10000000UL, 300000UL,  512, 100, 32UL * 1024 * 1024 },
+  /* bufferbloat: short RTT, but more than a second of buffer at the bottleneck */
+  { "bufferbloat", 10000000UL,  20000UL, 1024,   0, 16UL * 1024 * 1024 },
+  /* short RTT, buffer of one BDP */
+  { "lan",         10000000UL,  20000UL,   32,   0, 16UL * 1024 * 1024 }
+};
+
+static const struct tcp_cc_ops *const bench_ccs[] = {
+  &tcp_cc_reno,
+  &tcp_cc_cubic,
+  &tcp_cc_vegas
+};
+
+static struct netif bench_netif;
+/* [0]: data to the receiver, [1]: ACKs to the sender */
+static struct bench_link bench_links[2];
+static const struct bench_scenario *bench_scenario;
+static u32_t bench_now; /* simulated time in us */
+static u32_t bench_now_ms;
+static u32_t bench_now_us;
+static u32_t bench_tmr_due;
+static u32_t bench_rand_state;
+static u8_t bench_data[TCP_MSS];
+static struct tcp_pcb *bench_tx_pcb;
+static struct tcp_pcb *bench_rx_pcb;
+static u32_t bench_written;
+static u32_t bench_received;
+static u32_t bench_sent_bytes;
+static u32_t bench_first_seqno;
+static u32_t bench_next_seqno;
+static double bench_queue_delay;
+static u32_t bench_queued;
+
+/* This function is used for LWIP_RAND by the unix port */
+unsigned int
+lwip_port_rand(void)
+{
+  return (unsigned int)rand();
+}
+
+/* Does not wrap with bench_now, the congestion control modules rely on it */
+u32_t
+sys_now(void)
+{
+  return bench_now_ms;
+}
+
+static void
+bench_fail(const char *what)
+{
+  fprintf(stderr, "%s failed\n", what);
+  exit(EXIT_FAILURE);
+}
+
+static void
+bench_set_time(u32_t now)
+{
+  bench_now_us += now - bench_now;
+  bench_now_ms += bench_now_us / 1000;
+  bench_now_us %= 1000;
+  bench_now = now;
+}
+
+/* Deterministic, so that all modules see the same loss pattern */
+static u32_t
+bench_rand(void)
+{
+  bench_rand_state = bench_rand_state * 1103515245UL + 12345UL;
+  return bench_rand_state >> 8;
+}
+
+/* Put a copy of p on the link, it arrives after waiting for the packets
+   before it, its transmission time and the link delay */
+static void
+bench_link_send(struct bench_link *link, struct pbuf *p)
+{
+  struct pbuf *q;
+  u32_t slot;
+
+  if (link->num == link->limit) {
+    /* tail drop */
+    return;
+  }
+  q = pbuf_clone(PBUF_RAW, PBUF_RAM, p);
+  if (q == NULL) {
+    bench_fail("pbuf_clone");
+  }
+  if (TCP_SEQ_LT(link->busy_until, bench_now)) {
+    link->busy_until = bench_now;
+  }
+  if (link == &bench_links[0]) {
+    bench_queue_delay += link->busy_until - bench_now;
+    bench_queued++;
+  }
+  link->busy_until += (u32_t)p->tot_len * 8 / (bench_scenario->bps / 1000000);
+  slot = (link->head + link->num) % BENCH_LINK_QUEUE;
+  link->p[slot] = q;
+  link->arrival[slot] = link->busy_until + bench_scenario->delay;
+  link->num++;
+}
+
+static struct pbuf *
+bench_link_receive(struct bench_link *link)
+{
+  struct pbuf *p = link->p[link->head];
+
+  link->head = (link->head + 1) % BENCH_LINK_QUEUE;
+  link->num--;
+  return p;
+}
+
+static err_t
+bench_netif_output(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr)
+{
+  struct tcp_hdr tcphdr;
+  u16_t payload;
+
+  LWIP_UNUSED_ARG(netif);
+  LWIP_UNUSED_ARG(ipaddr);
+
+  if (pbuf_copy_partial(p, &tcphdr, TCP_HLEN, IP_HLEN) != TCP_HLEN) {
+    bench_fail("pbuf_copy_partial");
+  }
+  if (tcphdr.src == PP_HTONS(BENCH_PORT)) {
+    bench_link_send(&bench_links[1], p);
+    return ERR_OK;
+  }
+
+  payload = (u16_t)(p->tot_len - IP_HLEN - TCPH_HDRLEN_BYTES(&tcphdr));
+  if (TCPH_FLAGS(&tcphdr) & TCP_SYN) {
+    bench_first_seqno = bench_next_seqno = lwip_ntohl(tcphdr.seqno) + 1;
+  } else if (payload > 0) {
+    u32_t seqno_end = lwip_ntohl(tcphdr.seqno) + payload;
+
+    bench_sent_bytes += payload;
+    if (TCP_SEQ_GT(seqno_end, bench_next_seqno)) {
+      bench_next_seqno = seqno_end;
+    }
+    if ((bench_rand() % 1000000) < bench_scenario->loss_ppm) {
+      return ERR_OK;
+    }
+  }
+  bench_link_send(&bench_links[0], p);
+  return ERR_OK;
+}
+
+static err_t
+bench_netif_init(struct netif *netif)
+{
+  netif->output = bench_netif_output;
+  netif->mtu = 1500;
+  return ERR_OK;
+}
+
+/* Keep the send buffer full until all data is written */
+static void
+bench_fill(struct tcp_pcb *pcb)
+{
+  while ((bench_written < bench_scenario->bytes) && (tcp_sndbuf(pcb) >= TCP_MSS)) {
+    if (tcp_write(pcb, bench_data, TCP_MSS, 0) != ERR_OK) {
+      break;
+    }
+    bench_written += TCP_MSS;
+  }
+  tcp_output(pcb);
+}
+
+static err_t
+bench_sent(void *arg, struct tcp_pcb *pcb, u16_t len)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(len);
+  bench_fill(pcb);
+  return ERR_OK;
+}
+
+static err_t
+bench_connected(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+  tcp_sent(pcb, bench_sent);
+  bench_fill(pcb);
+  return ERR_OK;
+}
+
+static err_t
+bench_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+  if (p != NULL) {
+    bench_received += p->tot_len;
+    tcp_recved(pcb, p->tot_len);
+    pbuf_free(p);
+  }
+  return ERR_OK;
+}
+
+static err_t
+bench_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+  bench_rx_pcb = newpcb;
+  tcp_recv(newpcb, bench_recv);
+  return ERR_OK;
+}
+
+/* Transfer the scenario's data with the given congestion control, returns
+   the goodput in Mbit/s, the average RTT seen by data segments in ms and the
+   share of data bytes sent more than once in % */
+static void
+bench_run(const struct tcp_cc_ops *cc, double *mbps, double *rtt_ms, double *rexmit_percent)
+{
+  ip_addr_t addr;
+  u32_t start = bench_now;
+  u32_t unique;
+  int i;
+
+  bench_rand_state = 1;
+  bench_written = 0;
+  bench_received = 0;
+  bench_sent_bytes = 0;
+  bench_queue_delay = 0;
+  bench_queued = 0;
+  bench_rx_pcb = NULL;
+  bench_links[0].limit = bench_scenario->queue_limit;
+  bench_links[1].limit = BENCH_LINK_QUEUE;
+
+  bench_tx_pcb = tcp_new();
+  if (bench_tx_pcb == NULL) {
+    bench_fail("tcp_new");
+  }
+  tcp_set_cc(bench_tx_pcb, cc);
+  ip_addr_set_ip4_u32_val(addr, BENCH_LOCAL_IP);
+  if (tcp_connect(bench_tx_pcb, &addr, BENCH_PORT, bench_connected) != ERR_OK) {
+    bench_fail("tcp_connect");
+  }
+
+  while (bench_received < bench_scenario->bytes) {
+    struct bench_link *link = NULL;
+
+    /* next event: the earliest packet arrival or the TCP timer */
+    for (i = 0; i < 2; i++) {
+      if ((bench_links[i].num > 0) &&
+          ((link == NULL) || TCP_SEQ_LT(bench_links[i].arrival[bench_links[i].head], link->arrival[link->head]))) {
+        link = &bench_links[i];
+      }
+    }
+    if ((link != NULL) && TCP_SEQ_LEQ(link->arrival[link->head], bench_tmr_due)) {
+      struct pbuf *p;
+
+      bench_set_time(link->arrival[link->head]);
+      p = bench_link_receive(link);
+      bench_netif.input(p, &bench_netif);
+    } else {
+      bench_set_time(bench_tmr_due);
+      bench_tmr_due += TCP_TMR_INTERVAL * 1000;
+      tcp_tmr();
+    }
+    if ((bench_now - start) / 1000000 > BENCH_MAX_SECONDS) {
+      bench_fail("transfer");
+    }
+  }
+
+  *mbps = (double)bench_received * 8 / (bench_now - start);
+  *rtt_ms = (2.0 * bench_scenario->delay + bench_queue_delay / bench_queued) / 1000;
+  unique = bench_next_seqno - bench_first_seqno;
+  *rexmit_percent = (double)(bench_sent_bytes - unique) * 100 / unique;
+
+  tcp_abort(bench_tx_pcb);
+  if (bench_rx_pcb != NULL) {
+    tcp_abort(bench_rx_pcb);
+  }
+  for (i = 0; i < 2; i++) {
+    while (bench_links[i].num > 0) {
+      pbuf_free(bench_link_receive(&bench_links[i]));
+    }
+  }
+}
+
+int
+main(void)
+{
+  struct tcp_pcb *listen_pcb;
+  ip4_addr_t addr, mask, gw;
+  double mbps, rtt_ms, rexmit_percent;
+  size_t i, j;
+
+  lwip_init();
+  ip4_addr_set_u32(&addr, BENCH_LOCAL_IP);
+  IP4_ADDR(&mask, 255, 255, 255, 0);
+  ip4_addr_set_zero(&gw);
+  netif_add(&bench_netif, &addr, &mask, &gw, NULL, bench_netif_init, ip4_input);
+  netif_set_up(&bench_netif);
+  netif_set_link_up(&bench_netif);
+  bench_tmr_due = TCP_TMR_INTERVAL * 1000;
+
+  listen_pcb = tcp_new();
+  if ((listen_pcb == NULL) || (tcp_bind(listen_pcb, IP_ANY_TYPE, BENCH_PORT) != ERR_OK)) {
+    bench_fail("tcp_bind");
+  }
+  listen_pcb = tcp_listen(listen_pcb);
+  if (listen_pcb == NULL) {
+    bench_fail("tcp_listen");
+  }
+  tcp_accept(listen_pcb, bench_accept);
+
+  for (i = 0; i < LWIP_ARRAYSIZE(bench_scenarios); i++) {
+    bench_scenario = &bench_scenarios[i];
+    printf("%s: %lu Mbit/s, %lu ms RTT, %lu packets queue, loss %.2f%%, %lu bytes\n",
+           bench_scenario->name, (unsigned long)(bench_scenario->bps / 1000000),
+           (unsigned long)(2 * bench_scenario->delay / 1000), (unsigned long)bench_scenario->queue_limit,
+           bench_scenario->loss_ppm / 10000.0, (unsigned long)bench_scenario->bytes);
+    printf("cc       goodput Mbit/s   avg RTT ms   retransmitted %%\n");
+    for (j = 0; j < LWIP_ARRAYSIZE(bench_ccs); j++) {
+      bench_run(bench_ccs[j], &mbps, &rtt_ms, &rexmit_percent);
+      printf("%-6s   %14.2f   %10.0f   %15.2f\n", bench_ccs[j]->name, mbps, rtt_ms, rexmit_percent);
+    }
+    printf("\n");
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file
+ *
+ * lwIP options for the PCB demultiplexing benchmark
+ */
+
+/*
+ * Copyright (c) 2001-2004 Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ * Author: Adam Dunkels <adam@sics.se>
+ *
+ */
+#ifndef LWIP_LWIPOPTS_H
+#define LWIP_LWIPOPTS_H
+
+/* Raw API only, the benchmark runs the simulated link and the timers itself */
+#define NO_SYS                     1
+#define LWIP_NETCONN               0
+#define LWIP_SOCKET                0
+#define SYS_LIGHTWEIGHT_PROT       0
+
+#define LWIP_IPV4                  1
+#define LWIP_IPV6                  0
+#define LWIP_TCP                   1
+#define LWIP_UDP                   0
+
+/* Sender and receiver share one netif, so its address must not be looped back */
+#define LWIP_NETIF_LOOPBACK        0
+#define LWIP_HAVE_LOOPIF           0
+
+/* Windows larger than the bandwidth-delay product of the long link plus its
+   queue, so that only congestion control limits the sender */
+#define TCP_MSS                    1460
+#define LWIP_WND_SCALE             1
+#define TCP_RCV_SCALE              6
+#define TCP_WND                    (2048 * TCP_MSS)
+#define TCP_SND_BUF                TCP_WND
+#define TCP_SND_QUEUELEN           (2 * TCP_SND_BUF / TCP_MSS)
+/* tcp_sent() reports at most 64 KByte at once */
+#define TCP_SNDLOWAT               (16 * TCP_MSS)
+#define MEMP_NUM_TCP_SEG           TCP_SND_QUEUELEN
+#define MEMP_NUM_PBUF              TCP_SND_QUEUELEN
+#define MEM_SIZE                   (16 * 1024 * 1024)
+#define PBUF_POOL_SIZE             (TCP_WND / TCP_MSS + 16)
+
+#define TCP_QUEUE_OOSEQ            1
+#define LWIP_TCP_SACK_OUT          1
+#define LWIP_TCP_SACK_IN           1
+
+/* The module is selected per connection with tcp_set_cc() */
+#define LWIP_TCP_CC                1
+
+#define LWIP_STATS                 0
+
+#endif /* LWIP_LWIPOPTS_H */
@@ -0,0 +1,314 @@
+/*
+ * Checksum offload benchmark: UDP receive throughput of several Ethernet netifs
+ * fed by one driver thread each, and the CPU time tcpip_thread spends per
+ * datagram, with and without checksum offload threads, see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/tcpip.h"
+#include "lwip/udp.h"
+#include "lwip/etharp.h"
+#include "lwip/inet_chksum.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/udp.h"
+#include "lwip/sys.h"
+#include "netif/ethernet.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_NETIFS       4
+#define BENCH_FLOWS        16
+#define BENCH_PACKETS      200000
+#define BENCH_PORT         7000
+/* every BENCH_CORRUPT-th datagram has a wrong checksum and must be dropped */
+#define BENCH_CORRUPT      64
+#define BENCH_MAX_FRAME    (SIZEOF_ETH_HDR + IP_HLEN + UDP_HLEN + 1472)
+
+struct bench_driver {
+  struct netif netif;
+  u8_t frames[BENCH_FLOWS][BENCH_MAX_FRAME];
+  u16_t frame_len;
+  sys_sem_t start;
+};
+
+static const u16_t bench_payload_sizes[] = { 64, 512, 1472 };
+
+static struct bench_driver bench_drivers[BENCH_NETIFS];
+static struct udp_pcb *bench_pcb;
+static volatile u32_t bench_received;
+static u32_t bench_expected;
+static sys_sem_t bench_done;
+/* CPU time clock of the tcpip_thread */
+static clockid_t bench_tcpip_clock;
+
+static double
+bench_seconds(clockid_t clock)
+{
+  struct timespec ts;
+
+  clock_gettime(clock, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void
+bench_fail(const char *what)
+{
+  fprintf(stderr, "%s failed\n", what);
+  exit(EXIT_FAILURE);
+}
+
+static void
+bench_tcpip_init_done(void *arg)
+{
+  if (pthread_getcpuclockid(pthread_self(), &bench_tcpip_clock) != 0) {
+    bench_fail("pthread_getcpuclockid");
+  }
+  sys_sem_signal((sys_sem_t *)arg);
+}
+
+static err_t
+bench_linkoutput(struct netif *netif, struct pbuf *p)
+{
+  LWIP_UNUSED_ARG(netif);
+  LWIP_UNUSED_ARG(p);
+  return ERR_OK;
+}
+
+static err_t
+bench_netif_init(struct netif *netif)
+{
+  netif->name[0] = 'b';
+  netif->name[1] = 'n';
+  netif->output = etharp_output;
+  netif->linkoutput = bench_linkoutput;
+  netif->mtu = 1500;
+  netif->hwaddr_len = ETH_HWADDR_LEN;
+  netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET;
+  return ERR_OK;
+}
+
+/* Called in the tcpip_thread for every datagram that made it through */
+static void
+bench_udp_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(pcb);
+  LWIP_UNUSED_ARG(addr);
+  LWIP_UNUSED_ARG(port);
+
+  pbuf_free(p);
+  bench_received++;
+  if (bench_received == bench_expected) {
+    sys_sem_signal(&bench_done);
+  }
+}
+
+/* Build one Ethernet/IPv4/UDP frame per flow with valid checksums */
+static void
+bench_build_frames(struct bench_driver *drv, int index, u16_t payload_len)
+{
+  int flow;
+
+  drv->frame_len = (u16_t)(SIZEOF_ETH_HDR + IP_HLEN + UDP_HLEN + payload_len);
+  for (flow = 0; flow < BENCH_FLOWS; flow++) {
+    u8_t *frame = drv->frames[flow];
+    struct eth_hdr *ethhdr = (struct eth_hdr *)frame;
+    struct ip_hdr *iphdr = (struct ip_hdr *)(frame + SIZEOF_ETH_HDR);
+    struct udp_hdr *udphdr = (struct udp_hdr *)(frame + SIZEOF_ETH_HDR + IP_HLEN);
+    struct pbuf *p;
+    ip4_addr_t src, dest;
+
+    memset(frame, 0, BENCH_MAX_FRAME);
+    SMEMCPY(&ethhdr->dest, drv->netif.hwaddr, ETH_HWADDR_LEN);
+    ethhdr->src.addr[0] = 0x02;
+    ethhdr->src.addr[5] = 0xfe;
+    ethhdr->type = PP_HTONS(ETHTYPE_IP);
+
+    IP4_ADDR(&src, 10, 0, index, 2);
+    ip4_addr_copy(dest, *netif_ip4_addr(&drv->netif));
+    IPH_VHL_SET(iphdr, 4, IP_HLEN / 4);
+    IPH_LEN_SET(iphdr, lwip_htons((u16_t)(IP_HLEN + UDP_HLEN + payload_len)));
+    IPH_TTL_SET(iphdr, 64);
+    IPH_PROTO_SET(iphdr, IP_PROTO_UDP);
+    ip4_addr_copy(iphdr->src, src);
+    ip4_addr_copy(iphdr->dest, dest);
+    IPH_CHKSUM_SET(iphdr, inet_chksum(iphdr, IP_HLEN));
+
+    udphdr->src = lwip_htons((u16_t)(1024 + flow));
+    udphdr->dest = PP_HTONS(BENCH_PORT);
+    udphdr->len = lwip_htons((u16_t)(UDP_HLEN + payload_len));
+    memset(udphdr + 1, 0x5a + flow, payload_len);
+    p = pbuf_alloc(PBUF_RAW, (u16_t)(UDP_HLEN + payload_len), PBUF_REF);
+    if (p == NULL) {
+      bench_fail("pbuf_alloc");
+    }
+    p->payload = udphdr;
+    udphdr->chksum = inet_chksum_pseudo(p, IP_PROTO_UDP, p->tot_len, &src, &dest);
+    pbuf_free(p);
+  }
+}
+
+/* CPU us per datagram for verifying the IPv4 and UDP checksums of one frame in
+   a loop, what a checksum thread takes off the tcpip_thread at most */
+static double
+bench_chksum_us(struct bench_driver *drv)
+{
+  const u32_t loops = 100000;
+  struct ip_hdr *iphdr = (struct ip_hdr *)(drv->frames[0] + SIZEOF_ETH_HDR);
+  struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)(drv->frame_len - SIZEOF_ETH_HDR - IP_HLEN), PBUF_REF);
+  ip4_addr_t src, dest;
+  volatile u16_t sum = 0;
+  double start;
+  u32_t i;
+
+  if (p == NULL) {
+    bench_fail("pbuf_alloc");
+  }
+  p->payload = drv->frames[0] + SIZEOF_ETH_HDR + IP_HLEN;
+  ip4_addr_copy(src, iphdr->src);
+  ip4_addr_copy(dest, iphdr->dest);
+  start = bench_seconds(CLOCK_THREAD_CPUTIME_ID);
+  for (i = 0; i < loops; i++) {
+    sum = (u16_t)(sum + inet_chksum(iphdr, IP_HLEN));
+    sum = (u16_t)(sum + inet_chksum_pseudo(p, IP_PROTO_UDP, p->tot_len, &src, &dest));
+  }
+  pbuf_free(p);
+  return (bench_seconds(CLOCK_THREAD_CPUTIME_ID) - start) * 1e6 / loops;
+}
+
+/* A network driver: passes its share of the datagrams to netif->input() as
+   fast as the stack accepts them */
+static void
+bench_driver_thread(void *arg)
+{
+  struct bench_driver *drv = (struct bench_driver *)arg;
+
+  for (;;) {
+    u32_t i;
+
+    sys_sem_wait(&drv->start);
+    for (i = 0; i < BENCH_PACKETS / BENCH_NETIFS; i++) {
+      struct pbuf *p = pbuf_alloc(PBUF_RAW, drv->frame_len, PBUF_RAM);
+
+      while (p == NULL) {
+        sys_msleep(1);
+        p = pbuf_alloc(PBUF_RAW, drv->frame_len, PBUF_RAM);
+      }
+      MEMCPY(p->payload, drv->frames[i % BENCH_FLOWS], drv->frame_len);
+      if ((i % BENCH_CORRUPT) == BENCH_CORRUPT - 1) {
+        ((u8_t *)p->payload)[drv->frame_len - 1] ^= 0xff;
+      }
+      while (drv->netif.input(p, &drv->netif) != ERR_OK) {
+        /* queue full, the stack is busy: like a driver, try again later */
+        sys_msleep(0);
+      }
+    }
+  }
+}
+
+/* Receive BENCH_PACKETS datagrams, returns kpackets/s, CPU us per packet of the
+   process and of the tcpip_thread */
+static void
+bench_run(u16_t payload_len, double *kpps, double *cpu_us, double *tcpip_us)
+{
+  double start, cpu_start, tcpip_start;
+  u32_t corrupted = 0;
+  int i;
+
+  for (i = 0; i < BENCH_NETIFS; i++) {
+    bench_build_frames(&bench_drivers[i], i, payload_len);
+  }
+  for (i = 0; i < BENCH_PACKETS / BENCH_NETIFS; i++) {
+    if ((i % BENCH_CORRUPT) == BENCH_CORRUPT - 1) {
+      corrupted++;
+    }
+  }
+  LOCK_TCPIP_CORE();
+  bench_received = 0;
+  bench_expected = (BENCH_PACKETS / BENCH_NETIFS - corrupted) * BENCH_NETIFS;
+  UNLOCK_TCPIP_CORE();
+
+  start = bench_seconds(CLOCK_MONOTONIC);
+  cpu_start = bench_seconds(CLOCK_PROCESS_CPUTIME_ID);
+  tcpip_start = bench_seconds(bench_tcpip_clock);
+  for (i = 0; i < BENCH_NETIFS; i++) {
+    sys_sem_signal(&bench_drivers[i].start);
+  }
+  sys_sem_wait(&bench_done);
+  *kpps = BENCH_PACKETS / (bench_seconds(CLOCK_MONOTONIC) - start) / 1000;
+  *cpu_us = (bench_seconds(CLOCK_PROCESS_CPUTIME_ID) - cpu_start) * 1e6 / BENCH_PACKETS;
+  *tcpip_us = (bench_seconds(bench_tcpip_clock) - tcpip_start) * 1e6 / BENCH_PACKETS;
+
+  /* a corrupted datagram would show up late */
+  sys_msleep(100);
+  LOCK_TCPIP_CORE();
+  if (bench_received != bench_expected) {
+    bench_fail("checksum verification");
+  }
+  UNLOCK_TCPIP_CORE();
+}
+
+int
+main(void)
+{
+  sys_sem_t init_sem;
+  double kpps, cpu_us, tcpip_us;
+  size_t i;
+
+  if (sys_sem_new(&init_sem, 0) != ERR_OK) {
+    bench_fail("sys_sem_new");
+  }
+  tcpip_init(bench_tcpip_init_done, &init_sem);
+  sys_sem_wait(&init_sem);
+  sys_sem_free(&init_sem);
+  if (sys_sem_new(&bench_done, 0) != ERR_OK) {
+    bench_fail("sys_sem_new");
+  }
+
+  LOCK_TCPIP_CORE();
+  for (i = 0; i < BENCH_NETIFS; i++) {
+    struct bench_driver *drv = &bench_drivers[i];
+    ip4_addr_t ipaddr, netmask, gw;
+
+    IP4_ADDR(&ipaddr, 10, 0, i, 1);
+    IP4_ADDR(&netmask, 255, 255, 255, 0);
+    ip4_addr_set_zero(&gw);
+    drv->netif.hwaddr[0] = 0x02;
+    drv->netif.hwaddr[5] = (u8_t)(i + 1);
+    if (netif_add(&drv->netif, &ipaddr, &netmask, &gw, NULL, bench_netif_init, tcpip_input) == NULL) {
+      bench_fail("netif_add");
+    }
+    netif_set_up(&drv->netif);
+    netif_set_link_up(&drv->netif);
+  }
+  bench_pcb = udp_new();
+  if ((bench_pcb == NULL) || (udp_bind(bench_pcb, IP4_ADDR_ANY, BENCH_PORT) != ERR_OK)) {
+    bench_fail("udp_bind");
+  }
+  udp_recv(bench_pcb, bench_udp_recv, NULL);
+  UNLOCK_TCPIP_CORE();
+
+  for (i = 0; i < BENCH_NETIFS; i++) {
+    if (sys_sem_new(&bench_drivers[i].start, 0) != ERR_OK) {
+      bench_fail("sys_sem_new");
+    }
+    sys_thread_new("bench_driver", bench_driver_thread, &bench_drivers[i], DEFAULT_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+  }
+
+  /* warm up: touch all memory once */
+  bench_run(bench_payload_sizes[0], &kpps, &cpu_us, &tcpip_us);
+
+  printf("UDP input, %d netifs with %d flows each, %d checksum threads, %d datagrams\n",
+         BENCH_NETIFS, BENCH_FLOWS, TCPIP_CHECKSUM_THREADS, BENCH_PACKETS);
+  printf("payload   kpackets/s   CPU us/packet   tcpip_thread us/packet   checksum us/packet\n");
+  for (i = 0; i < LWIP_ARRAYSIZE(bench_payload_sizes); i++) {
+    bench_run(bench_payload_sizes[i], &kpps, &cpu_us, &tcpip_us);
+    printf("%7d   %10.1f   %13.2f   %22.2f   %18.3f\n", bench_payload_sizes[i], kpps, cpu_us, tcpip_us,
+           bench_chksum_us(&bench_drivers[0]));
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,252 @@
+/*
+ * epoll benchmark: wakeup latency and CPU time per wakeup of a thread waiting
+ * for 10..256 UDP sockets with lwip_select(), lwip_poll() or lwip_epoll_wait(),
+ * see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/tcpip.h"
+#include "lwip/sockets.h"
+#include "lwip/sys.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_MAX_SOCKETS  256
+#define BENCH_WAKEUPS      20000
+#define BENCH_PORT         6000
+
+enum bench_mode {
+  BENCH_SELECT,
+  BENCH_POLL,
+  BENCH_EPOLL
+};
+
+static const int bench_socket_counts[] = { 10, 32, 64, 128, 256 };
+static const char *const bench_mode_names[] = { "select", "poll", "epoll" };
+
+static int bench_sockets[BENCH_MAX_SOCKETS];
+static int bench_num_sockets;
+static enum bench_mode bench_mode;
+static int bench_epoll;
+static u32_t bench_rand_state = 1;
+static volatile double bench_woken;
+static sys_sem_t bench_rx_start;
+static sys_sem_t bench_rx_done;
+
+static double
+bench_seconds(clockid_t clock)
+{
+  struct timespec ts;
+
+  clock_gettime(clock, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void
+bench_fail(const char *what)
+{
+  fprintf(stderr, "%s failed, errno %d\n", what, errno);
+  exit(EXIT_FAILURE);
+}
+
+static void
+bench_tcpip_init_done(void *arg)
+{
+  sys_sem_signal((sys_sem_t *)arg);
+}
+
+/* Deterministic, so that all variants see the same sockets */
+static u32_t
+bench_rand(void)
+{
+  bench_rand_state = bench_rand_state * 1103515245UL + 12345UL;
+  return bench_rand_state >> 8;
+}
+
+/* Wait until one of the sockets is readable, like a server task does */
+static int
+bench_wait(void)
+{
+  int i;
+
+  if (bench_mode == BENCH_SELECT) {
+    fd_set readset;
+    int maxfd = 0;
+
+    FD_ZERO(&readset);
+    for (i = 0; i < bench_num_sockets; i++) {
+      FD_SET(bench_sockets[i], &readset);
+      maxfd = LWIP_MAX(maxfd, bench_sockets[i]);
+    }
+    if (lwip_select(maxfd + 1, &readset, NULL, NULL, NULL) != 1) {
+      bench_fail("lwip_select");
+    }
+    for (i = 0; i < bench_num_sockets; i++) {
+      if (FD_ISSET(bench_sockets[i], &readset)) {
+        return bench_sockets[i];
+      }
+    }
+  } else if (bench_mode == BENCH_POLL) {
+    static struct pollfd fds[BENCH_MAX_SOCKETS];
+
+    for (i = 0; i < bench_num_sockets; i++) {
+      fds[i].fd = bench_sockets[i];
+      fds[i].events = POLLIN;
+    }
+    if (lwip_poll(fds, (nfds_t)bench_num_sockets, -1) != 1) {
+      bench_fail("lwip_poll");
+    }
+    for (i = 0; i < bench_num_sockets; i++) {
+      if (fds[i].revents & POLLIN) {
+        return fds[i].fd;
+      }
+    }
+  } else {
+    struct epoll_event ev;
+
+    if (lwip_epoll_wait(bench_epoll, &ev, 1, -1) != 1) {
+      bench_fail("lwip_epoll_wait");
+    }
+    return ev.data.fd;
+  }
+  bench_fail("no socket ready");
+  return -1;
+}
+
+static void
+bench_rx_thread(void *arg)
+{
+  LWIP_UNUSED_ARG(arg);
+
+  for (;;) {
+    int i;
+
+    sys_sem_wait(&bench_rx_start);
+    for (i = 0; i < BENCH_WAKEUPS; i++) {
+      u8_t buf[4];
+      int s = bench_wait();
+
+      if (lwip_recv(s, buf, sizeof(buf), 0) != 1) {
+        bench_fail("lwip_recv");
+      }
+      bench_woken = bench_seconds(CLOCK_MONOTONIC);
+      sys_sem_signal(&bench_rx_done);
+    }
+  }
+}
+
+/* Wake the waiting thread BENCH_WAKEUPS times with a datagram to a random
+   socket, returns the average latency and CPU time per wakeup in us */
+static void
+bench_run(int tx, enum bench_mode mode, int num, double *latency_us, double *cpu_us)
+{
+  struct sockaddr_in addr;
+  double latency = 0, cpu_start;
+  int i;
+
+  bench_mode = mode;
+  bench_num_sockets = num;
+  if (mode == BENCH_EPOLL) {
+    bench_epoll = lwip_epoll_create(1);
+    if (bench_epoll < 0) {
+      bench_fail("lwip_epoll_create");
+    }
+    for (i = 0; i < num; i++) {
+      struct epoll_event ev;
+      ev.events = EPOLLIN;
+      ev.data.fd = bench_sockets[i];
+      if (lwip_epoll_ctl(bench_epoll, EPOLL_CTL_ADD, bench_sockets[i], &ev) != 0) {
+        bench_fail("lwip_epoll_ctl");
+      }
+    }
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+
+  cpu_start = bench_seconds(CLOCK_PROCESS_CPUTIME_ID);
+  sys_sem_signal(&bench_rx_start);
+  for (i = 0; i < BENCH_WAKEUPS; i++) {
+    u8_t data = 0;
+    double start;
+
+    addr.sin_port = lwip_htons((u16_t)(BENCH_PORT + bench_rand() % (u32_t)num));
+    start = bench_seconds(CLOCK_MONOTONIC);
+    if (lwip_sendto(tx, &data, 1, 0, (struct sockaddr *)&addr, sizeof(addr)) != 1) {
+      bench_fail("lwip_sendto");
+    }
+    sys_sem_wait(&bench_rx_done);
+    latency += bench_woken - start;
+  }
+  *latency_us = latency * 1e6 / BENCH_WAKEUPS;
+  *cpu_us = (bench_seconds(CLOCK_PROCESS_CPUTIME_ID) - cpu_start) * 1e6 / BENCH_WAKEUPS;
+
+  if (mode == BENCH_EPOLL) {
+    lwip_close(bench_epoll);
+  }
+}
+
+int
+main(void)
+{
+  struct sockaddr_in addr;
+  sys_sem_t init_sem;
+  double latency_us, cpu_us;
+  size_t i;
+  int tx;
+
+  if (sys_sem_new(&init_sem, 0) != ERR_OK) {
+    bench_fail("sys_sem_new");
+  }
+  tcpip_init(bench_tcpip_init_done, &init_sem);
+  sys_sem_wait(&init_sem);
+  sys_sem_free(&init_sem);
+  if ((sys_sem_new(&bench_rx_start, 0) != ERR_OK) || (sys_sem_new(&bench_rx_done, 0) != ERR_OK)) {
+    bench_fail("sys_sem_new");
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+  for (i = 0; i < BENCH_MAX_SOCKETS; i++) {
+    bench_sockets[i] = lwip_socket(AF_INET, SOCK_DGRAM, 0);
+    if (bench_sockets[i] < 0) {
+      bench_fail("lwip_socket");
+    }
+    addr.sin_port = lwip_htons((u16_t)(BENCH_PORT + i));
+    if (lwip_bind(bench_sockets[i], (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+      bench_fail("lwip_bind");
+    }
+  }
+  tx = lwip_socket(AF_INET, SOCK_DGRAM, 0);
+  if (tx < 0) {
+    bench_fail("lwip_socket");
+  }
+  sys_thread_new("bench_rx", bench_rx_thread, NULL, DEFAULT_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+
+  /* warm up: touch all memory once */
+  bench_run(tx, BENCH_POLL, BENCH_MAX_SOCKETS, &latency_us, &cpu_us);
+
+  printf("UDP over loopback, %d wakeups, 1 byte datagram to a random socket\n", BENCH_WAKEUPS);
+  printf("sockets   mode     latency us   CPU us/wakeup\n");
+  for (i = 0; i < LWIP_ARRAYSIZE(bench_socket_counts); i++) {
+    int mode;
+
+    for (mode = BENCH_SELECT; mode <= BENCH_EPOLL; mode++) {
+      bench_run(tx, (enum bench_mode)mode, bench_socket_counts[i], &latency_us, &cpu_us);
+      printf("%7d   %-6s   %10.2f   %13.2f\n", bench_socket_counts[i], bench_mode_names[mode], latency_us, cpu_us);
+    }
+  }
+
+  lwip_close(tx);
+  for (i = 0; i < BENCH_MAX_SOCKETS; i++) {
+    lwip_close(bench_sockets[i]);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file
+ *
+ * lwIP options for the recvmmsg/sendmmsg benchmark
+ */
+
+/*
+ * Copyright (c) 2001-2004 Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ * Author: Adam Dunkels <adam@sics.se>
+ *
+ */
+#ifndef LWIP_LWIPOPTS_H
+#define LWIP_LWIPOPTS_H
+
+/* Sockets over the loopback netif, with the tcpip_thread */
+#define NO_SYS                     0
+#define LWIP_NETCONN               1
+#define LWIP_SOCKET                1
+#define LWIP_COMPAT_SOCKETS        0
+#define SYS_LIGHTWEIGHT_PROT       1
+
+#define LWIP_IPV4                  1
+#define LWIP_IPV6                  0
+#define LWIP_TCP                   0
+#define LWIP_UDP                   1
+#define LWIP_NETIF_LOOPBACK        1
+#define LWIP_HAVE_LOOPIF           1
+
+/* Room for the largest batch in flight */
+#define MEMP_NUM_NETBUF            128
+#define MEMP_NUM_TCPIP_MSG_INPKT   128
+#define MEM_SIZE                   65536
+#define TCPIP_MBOX_SIZE            128
+#define DEFAULT_UDP_RECVMBOX_SIZE  128
+#define LWIP_SOCKET_MMSG_BATCH     16
+
+#define LWIP_STATS                 0
+
+/* Check that the core is only used under the core lock or from the tcpip_thread */
+void sys_check_core_locking(void);
+#define LWIP_ASSERT_CORE_LOCKED()  sys_check_core_locking()
+
+/* LWIP_TCPIP_CORE_LOCKING is disabled for mmsg_bench_mbox in CMakeLists.txt */
+
+#endif /* LWIP_LWIPOPTS_H */
@@ -0,0 +1,151 @@
+/*
+ * recvmmsg/sendmmsg benchmark: UDP packets per second through the socket API
+ * and the loopback netif with batches of 1..64 datagrams, see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/tcpip.h"
+#include "lwip/sockets.h"
+#include "lwip/sys.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_PACKETS      200000
+#define BENCH_PACKET_SIZE  64
+#define BENCH_MAX_BATCH    64
+#define BENCH_PORT         5000
+
+static const int bench_batches[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+static u8_t bench_tx_data[BENCH_PACKET_SIZE];
+static u8_t bench_rx_data[BENCH_MAX_BATCH][BENCH_PACKET_SIZE];
+static struct iovec bench_tx_iov;
+static struct iovec bench_rx_iov[BENCH_MAX_BATCH];
+static struct mmsghdr bench_tx_msgs[BENCH_MAX_BATCH];
+static struct mmsghdr bench_rx_msgs[BENCH_MAX_BATCH];
+
+static double
+bench_seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void
+bench_fail(const char *what)
+{
+  fprintf(stderr, "%s failed, errno %d\n", what, errno);
+  exit(EXIT_FAILURE);
+}
+
+static void
+bench_tcpip_init_done(void *arg)
+{
+  sys_sem_signal((sys_sem_t *)arg);
+}
+
+/* One datagram per call with lwip_send() and lwip_recv() */
+static double
+bench_single(int tx, int rx)
+{
+  double start = bench_seconds();
+  int i;
+
+  for (i = 0; i < BENCH_PACKETS; i++) {
+    if (lwip_send(tx, bench_tx_data, sizeof(bench_tx_data), 0) != sizeof(bench_tx_data)) {
+      bench_fail("lwip_send");
+    }
+    if (lwip_recv(rx, bench_rx_data[0], sizeof(bench_rx_data[0]), 0) != sizeof(bench_rx_data[0])) {
+      bench_fail("lwip_recv");
+    }
+  }
+  return BENCH_PACKETS / (bench_seconds() - start);
+}
+
+/* batch datagrams per call with lwip_sendmmsg() and lwip_recvmmsg() */
+static double
+bench_batch(int tx, int rx, int batch)
+{
+  double start = bench_seconds();
+  int i;
+
+  for (i = 0; i < BENCH_PACKETS; i += batch) {
+    int received = 0;
+
+    if (lwip_sendmmsg(tx, bench_tx_msgs, (unsigned int)batch, 0) != batch) {
+      bench_fail("lwip_sendmmsg");
+    }
+    /* the loopback netif delivers in the tcpip_thread, so the batch may
+       arrive in parts */
+    while (received < batch) {
+      int ret = lwip_recvmmsg(rx, &bench_rx_msgs[received], (unsigned int)(batch - received), 0);
+      if (ret <= 0) {
+        bench_fail("lwip_recvmmsg");
+      }
+      received += ret;
+    }
+  }
+  return i / (bench_seconds() - start);
+}
+
+int
+main(void)
+{
+  struct sockaddr_in addr;
+  sys_sem_t init_sem;
+  size_t i;
+  int tx, rx;
+
+  if (sys_sem_new(&init_sem, 0) != ERR_OK) {
+    bench_fail("sys_sem_new");
+  }
+  tcpip_init(bench_tcpip_init_done, &init_sem);
+  sys_sem_wait(&init_sem);
+  sys_sem_free(&init_sem);
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = PP_HTONS(BENCH_PORT);
+  addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+
+  rx = lwip_socket(AF_INET, SOCK_DGRAM, 0);
+  tx = lwip_socket(AF_INET, SOCK_DGRAM, 0);
+  if ((rx < 0) || (tx < 0)) {
+    bench_fail("lwip_socket");
+  }
+  if (lwip_bind(rx, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    bench_fail("lwip_bind");
+  }
+  if (lwip_connect(tx, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    bench_fail("lwip_connect");
+  }
+
+  bench_tx_iov.iov_base = bench_tx_data;
+  bench_tx_iov.iov_len = sizeof(bench_tx_data);
+  for (i = 0; i < BENCH_MAX_BATCH; i++) {
+    bench_tx_msgs[i].msg_hdr.msg_iov = &bench_tx_iov;
+    bench_tx_msgs[i].msg_hdr.msg_iovlen = 1;
+    bench_rx_iov[i].iov_base = bench_rx_data[i];
+    bench_rx_iov[i].iov_len = sizeof(bench_rx_data[i]);
+    bench_rx_msgs[i].msg_hdr.msg_iov = &bench_rx_iov[i];
+    bench_rx_msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  printf("LWIP_TCPIP_CORE_LOCKING %d, LWIP_SOCKET_MMSG_BATCH %d, %d byte datagrams\n",
+         LWIP_TCPIP_CORE_LOCKING, LWIP_SOCKET_MMSG_BATCH, BENCH_PACKET_SIZE);
+  printf("  batch   packets/s\n");
+  printf("   send   %9.0f\n", bench_single(tx, rx));
+  for (i = 0; i < LWIP_ARRAYSIZE(bench_batches); i++) {
+    printf("%7d   %9.0f\n", bench_batches[i], bench_batch(tx, rx, bench_batches[i]));
+  }
+
+  lwip_close(tx);
+  lwip_close(rx);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file
+ *
+ * lwIP options for the PCB demultiplexing benchmark
+ */
+
+/*
+ * Copyright (c) 2001-2004 Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ * Author: Adam Dunkels <adam@sics.se>
+ *
+ */
+#ifndef LWIP_LWIPOPTS_H
+#define LWIP_LWIPOPTS_H
+
+/* Raw API only, the benchmark drives ip4_input() directly */
+#define NO_SYS                     1
+#define LWIP_NETCONN               0
+#define LWIP_SOCKET                0
+#define SYS_LIGHTWEIGHT_PROT       0
+
+#define LWIP_IPV4                  1
+#define LWIP_IPV6                  0
+#define LWIP_TCP                   1
+#define LWIP_UDP                   1
+
+/* Room for the largest PCB count measured */
+#define MEMP_NUM_TCP_PCB           2048
+#define MEMP_NUM_UDP_PCB           2048
+#define MEM_SIZE                   65536
+
+/* Segments are built without checksums */
+#define CHECKSUM_CHECK_IP          0
+#define CHECKSUM_CHECK_TCP         0
+#define CHECKSUM_CHECK_UDP         0
+
+#define LWIP_STATS                 0
+
+/* TCP_PCB_HASH_SIZE and UDP_PCB_HASH_SIZE are set per target in CMakeLists.txt */
+
+#endif /* LWIP_LWIPOPTS_H */
@@ -0,0 +1,237 @@
+/*
+ * PCB demultiplexing benchmark: average cost of tcp_input() and udp_input()
+ * per segment with 10..2000 PCBs, see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/ip4.h"
+#include "lwip/pbuf.h"
+#include "lwip/tcp.h"
+#include "lwip/udp.h"
+#include "lwip/sys.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/tcp.h"
+#include "lwip/prot/udp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_SEGMENTS  200000
+#define BENCH_LOCAL_IP  PP_HTONL(LWIP_MAKEU32(10, 0, 0, 1))
+#define BENCH_TCP_PORT  80
+#define BENCH_UDP_PORT  10000
+
+static const int bench_pcb_counts[] = { 10, 50, 100, 200, 500, 1000, 2000 };
+
+static struct netif bench_netif;
+static struct tcp_pcb *bench_tcp_pcbs[2000];
+static struct udp_pcb *bench_udp_pcbs[2000];
+static u32_t bench_udp_received;
+
+/* This function is used for LWIP_RAND by the unix port */
+unsigned int
+lwip_port_rand(void)
+{
+  return (unsigned int)rand();
+}
+
+u32_t
+sys_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (u32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+static double
+bench_seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static err_t
+bench_netif_output(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr)
+{
+  LWIP_UNUSED_ARG(netif);
+  LWIP_UNUSED_ARG(p);
+  LWIP_UNUSED_ARG(ipaddr);
+  return ERR_OK;
+}
+
+static err_t
+bench_netif_init(struct netif *netif)
+{
+  netif->output = bench_netif_output;
+  netif->mtu = 1500;
+  return ERR_OK;
+}
+
+/* Remote address of connection i: 10.1.x.y */
+static u32_t
+bench_remote_ip(int i)
+{
+  return PP_HTONL(LWIP_MAKEU32(10, 1, (i >> 8) & 0xff, i & 0xff));
+}
+
+/* Feed one IPv4 packet with the given transport header and no payload */
+static void
+bench_input(u32_t src, u8_t proto, const void *hdr, u16_t hdr_len)
+{
+  struct ip_hdr *iphdr;
+  struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)(IP_HLEN + hdr_len), PBUF_RAM);
+
+  if (p == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  iphdr = (struct ip_hdr *)p->payload;
+  memset(iphdr, 0, IP_HLEN);
+  IPH_VHL_SET(iphdr, 4, IP_HLEN / 4);
+  IPH_LEN_SET(iphdr, lwip_htons((u16_t)(IP_HLEN + hdr_len)));
+  IPH_TTL_SET(iphdr, 64);
+  IPH_PROTO_SET(iphdr, proto);
+  iphdr->src.addr = src;
+  iphdr->dest.addr = BENCH_LOCAL_IP;
+  memcpy((u8_t *)p->payload + IP_HLEN, hdr, hdr_len);
+  bench_netif.input(p, &bench_netif);
+}
+
+static double
+bench_tcp(int num)
+{
+  struct tcp_hdr tcphdr;
+  ip_addr_t local_ip;
+  double start;
+  int i;
+
+  ip_addr_set_ip4_u32_val(local_ip, BENCH_LOCAL_IP);
+  for (i = 0; i < num; i++) {
+    struct tcp_pcb *pcb = tcp_new();
+    u32_t iss;
+
+    if (pcb == NULL) {
+      fprintf(stderr, "out of tcp pcbs\n");
+      exit(EXIT_FAILURE);
+    }
+    ip_addr_copy(pcb->local_ip, local_ip);
+    pcb->local_port = BENCH_TCP_PORT;
+    ip_addr_set_ip4_u32_val(pcb->remote_ip, bench_remote_ip(i));
+    pcb->remote_port = (u16_t)(1024 + i);
+    pcb->state = ESTABLISHED;
+    iss = tcp_next_iss(pcb);
+    pcb->snd_wl2 = pcb->snd_nxt = pcb->lastack = pcb->snd_lbb = iss;
+    TCP_REG_ACTIVE(pcb);
+    bench_tcp_pcbs[i] = pcb;
+  }
+
+  /* pure ACKs that acknowledge nothing new and change nothing */
+  memset(&tcphdr, 0, sizeof(tcphdr));
+  tcphdr.dest = PP_HTONS(BENCH_TCP_PORT);
+  TCPH_HDRLEN_FLAGS_SET(&tcphdr, TCP_HLEN / 4, TCP_ACK);
+  tcphdr.wnd = PP_HTONS(TCP_WND);
+
+  start = bench_seconds();
+  for (i = 0; i < BENCH_SEGMENTS; i++) {
+    /* round-robin in an order the move-to-front cache cannot follow */
+    struct tcp_pcb *pcb = bench_tcp_pcbs[(i * 7919) % num];
+
+    tcphdr.src = lwip_htons(pcb->remote_port);
+    tcphdr.seqno = lwip_htonl(pcb->rcv_nxt);
+    tcphdr.ackno = lwip_htonl(pcb->snd_nxt);
+    bench_input(ip4_addr_get_u32(ip_2_ip4(&pcb->remote_ip)), IP_PROTO_TCP, &tcphdr, TCP_HLEN);
+  }
+  start = bench_seconds() - start;
+
+  for (i = 0; i < num; i++) {
+    if (bench_tcp_pcbs[i]->state != ESTABLISHED) {
+      fprintf(stderr, "tcp pcb %d left ESTABLISHED\n", i);
+      exit(EXIT_FAILURE);
+    }
+    tcp_abort(bench_tcp_pcbs[i]);
+  }
+  return start * 1e9 / BENCH_SEGMENTS;
+}
+
+static void
+bench_udp_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(pcb);
+  LWIP_UNUSED_ARG(addr);
+  LWIP_UNUSED_ARG(port);
+  bench_udp_received++;
+  pbuf_free(p);
+}
+
+static double
+bench_udp(int num)
+{
+  struct udp_hdr udphdr;
+  double start;
+  int i;
+
+  for (i = 0; i < num; i++) {
+    struct udp_pcb *pcb = udp_new();
+
+    if ((pcb == NULL) || (udp_bind(pcb, IP4_ADDR_ANY, (u16_t)(BENCH_UDP_PORT + i)) != ERR_OK)) {
+      fprintf(stderr, "out of udp pcbs\n");
+      exit(EXIT_FAILURE);
+    }
+    udp_recv(pcb, bench_udp_recv, NULL);
+    bench_udp_pcbs[i] = pcb;
+  }
+
+  memset(&udphdr, 0, sizeof(udphdr));
+  udphdr.src = PP_HTONS(5000);
+  udphdr.len = PP_HTONS(UDP_HLEN);
+  bench_udp_received = 0;
+
+  start = bench_seconds();
+  for (i = 0; i < BENCH_SEGMENTS; i++) {
+    udphdr.dest = lwip_htons((u16_t)(BENCH_UDP_PORT + (i * 7919) % num));
+    bench_input(bench_remote_ip(1), IP_PROTO_UDP, &udphdr, UDP_HLEN);
+  }
+  start = bench_seconds() - start;
+
+  if (bench_udp_received != BENCH_SEGMENTS) {
+    fprintf(stderr, "udp: %u of %u datagrams delivered\n", (unsigned)bench_udp_received, BENCH_SEGMENTS);
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < num; i++) {
+    udp_remove(bench_udp_pcbs[i]);
+  }
+  return start * 1e9 / BENCH_SEGMENTS;
+}
+
+int
+main(void)
+{
+  ip4_addr_t addr, mask, gw;
+  size_t i;
+
+  lwip_init();
+  ip4_addr_set_u32(&addr, BENCH_LOCAL_IP);
+  IP4_ADDR(&mask, 255, 0, 0, 0);
+  ip4_addr_set_zero(&gw);
+  netif_add(&bench_netif, &addr, &mask, &gw, NULL, bench_netif_init, ip4_input);
+  netif_set_up(&bench_netif);
+  netif_set_link_up(&bench_netif);
+
+  printf("TCP_PCB_HASH_SIZE %d, UDP_PCB_HASH_SIZE %d\n", TCP_PCB_HASH_SIZE, UDP_PCB_HASH_SIZE);
+  printf("  pcbs   tcp ns/segment   udp ns/datagram\n");
+  for (i = 0; i < LWIP_ARRAYSIZE(bench_pcb_counts); i++) {
+    int num = bench_pcb_counts[i];
+    double tcp_ns = bench_tcp(num);
+    double udp_ns = bench_udp(num);
+    printf("%6d   %14.1f   %15.1f\n", num, tcp_ns, udp_ns);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,321 @@
+/*
+ * SACK benchmark: goodput of one TCP connection over a simulated lossy link,
+ * with or without SACK based loss recovery, see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/ip4.h"
+#include "lwip/pbuf.h"
+#include "lwip/tcp.h"
+#include "lwip/sys.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/tcp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_BYTES        (8UL * 1024 * 1024)
+#define BENCH_LOCAL_IP     PP_HTONL(LWIP_MAKEU32(10, 0, 0, 1))
+#define BENCH_PORT         80
+#define BENCH_LINK_BPS     10000000UL
+#define BENCH_LINK_DELAY   20000UL /* us, each direction */
+#define BENCH_LINK_QUEUE   256
+/* give up if a transfer takes longer than this (simulated) */
+#define BENCH_MAX_SECONDS  1000UL
+
+/* One direction of the simulated link: packets in order of arrival */
+struct bench_link {
+  struct pbuf *p[BENCH_LINK_QUEUE];
+  u32_t arrival[BENCH_LINK_QUEUE];
+  u32_t head;
+  u32_t num;
+  u32_t busy_until;
+};
+
+/* loss rates of data segments in 1/10000 */
+static const u32_t bench_loss_rates[] = { 0, 10, 50, 100, 200, 500 };
+
+static struct netif bench_netif;
+/* [0]: data to the receiver, [1]: ACKs to the sender */
+static struct bench_link bench_links[2];
+static u32_t bench_now; /* simulated time in us */
+static u32_t bench_tmr_due;
+static u32_t bench_rand_state;
+static u32_t bench_loss;
+static u8_t bench_data[TCP_MSS];
+static struct tcp_pcb *bench_tx_pcb;
+static struct tcp_pcb *bench_rx_pcb;
+static u32_t bench_written;
+static u32_t bench_received;
+static u32_t bench_sent_bytes;
+static u32_t bench_first_seqno;
+static u32_t bench_next_seqno;
+
+/* This function is used for LWIP_RAND by the unix port */
+unsigned int
+lwip_port_rand(void)
+{
+  return (unsigned int)rand();
+}
+
+u32_t
+sys_now(void)
+{
+  return bench_now / 1000;
+}
+
+static void
+bench_fail(const char *what)
+{
+  fprintf(stderr, "%s failed\n", what);
+  exit(EXIT_FAILURE);
+}
+
+/* Deterministic, so that all variants see the same loss pattern */
+static u32_t
+bench_rand(void)
+{
+  bench_rand_state = bench_rand_state * 1103515245UL + 12345UL;
+  return bench_rand_state >> 8;
+}
+
+/* Put a copy of p on the link, it arrives after its transmission time and
+   the link delay */
+static void
+bench_link_send(struct bench_link *link, struct pbuf *p)
+{
+  struct pbuf *q;
+  u32_t slot;
+
+  if (link->num == BENCH_LINK_QUEUE) {
+    /* tail drop */
+    return;
+  }
+  q = pbuf_clone(PBUF_RAW, PBUF_RAM, p);
+  if (q == NULL) {
+    bench_fail("pbuf_clone");
+  }
+  if (TCP_SEQ_LT(link->busy_until, bench_now)) {
+    link->busy_until = bench_now;
+  }
+  link->busy_until += (u32_t)p->tot_len * 8 / (BENCH_LINK_BPS / 1000000);
+  slot = (link->head + link->num) % BENCH_LINK_QUEUE;
+  link->p[slot] = q;
+  link->arrival[slot] = link->busy_until + BENCH_LINK_DELAY;
+  link->num++;
+}
+
+static struct pbuf *
+bench_link_receive(struct bench_link *link)
+{
+  struct pbuf *p = link->p[link->head];
+
+  link->head = (link->head + 1) % BENCH_LINK_QUEUE;
+  link->num--;
+  return p;
+}
+
+static err_t
+bench_netif_output(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr)
+{
+  struct tcp_hdr tcphdr;
+  u16_t payload;
+
+  LWIP_UNUSED_ARG(netif);
+  LWIP_UNUSED_ARG(ipaddr);
+
+  if (pbuf_copy_partial(p, &tcphdr, TCP_HLEN, IP_HLEN) != TCP_HLEN) {
+    bench_fail("pbuf_copy_partial");
+  }
+  if (tcphdr.src == PP_HTONS(BENCH_PORT)) {
+    bench_link_send(&bench_links[1], p);
+    return ERR_OK;
+  }
+
+  payload = (u16_t)(p->tot_len - IP_HLEN - TCPH_HDRLEN_BYTES(&tcphdr));
+  if (TCPH_FLAGS(&tcphdr) & TCP_SYN) {
+    bench_first_seqno = bench_next_seqno = lwip_ntohl(tcphdr.seqno) + 1;
+  } else if (payload > 0) {
+    u32_t seqno_end = lwip_ntohl(tcphdr.seqno) + payload;
+
+    bench_sent_bytes += payload;
+    if (TCP_SEQ_GT(seqno_end, bench_next_seqno)) {
+      bench_next_seqno = seqno_end;
+    }
+    if ((bench_rand() % 10000) < bench_loss) {
+      return ERR_OK;
+    }
+  }
+  bench_link_send(&bench_links[0], p);
+  return ERR_OK;
+}
+
+static err_t
+bench_netif_init(struct netif *netif)
+{
+  netif->output = bench_netif_output;
+  netif->mtu = 1500;
+  return ERR_OK;
+}
+
+/* Keep the send buffer full until all data is written */
+static void
+bench_fill(struct tcp_pcb *pcb)
+{
+  while ((bench_written < BENCH_BYTES) && (tcp_sndbuf(pcb) >= TCP_MSS)) {
+    if (tcp_write(pcb, bench_data, TCP_MSS, 0) != ERR_OK) {
+      break;
+    }
+    bench_written += TCP_MSS;
+  }
+  tcp_output(pcb);
+}
+
+static err_t
+bench_sent(void *arg, struct tcp_pcb *pcb, u16_t len)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(len);
+  bench_fill(pcb);
+  return ERR_OK;
+}
+
+static err_t
+bench_connected(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+  tcp_sent(pcb, bench_sent);
+  bench_fill(pcb);
+  return ERR_OK;
+}
+
+static err_t
+bench_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+  if (p != NULL) {
+    bench_received += p->tot_len;
+    tcp_recved(pcb, p->tot_len);
+    pbuf_free(p);
+  }
+  return ERR_OK;
+}
+
+static err_t
+bench_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+  bench_rx_pcb = newpcb;
+  tcp_recv(newpcb, bench_recv);
+  return ERR_OK;
+}
+
+/* Transfer BENCH_BYTES with the given loss rate, returns the goodput in
+   Mbit/s and the share of data bytes sent more than once in % */
+static void
+bench_run(u32_t loss, double *mbps, double *rexmit_percent)
+{
+  ip_addr_t addr;
+  u32_t start = bench_now;
+  u32_t unique;
+  int i;
+
+  bench_loss = loss;
+  bench_rand_state = 1;
+  bench_written = 0;
+  bench_received = 0;
+  bench_sent_bytes = 0;
+  bench_rx_pcb = NULL;
+
+  bench_tx_pcb = tcp_new();
+  if (bench_tx_pcb == NULL) {
+    bench_fail("tcp_new");
+  }
+  ip_addr_set_ip4_u32_val(addr, BENCH_LOCAL_IP);
+  if (tcp_connect(bench_tx_pcb, &addr, BENCH_PORT, bench_connected) != ERR_OK) {
+    bench_fail("tcp_connect");
+  }
+
+  while (bench_received < BENCH_BYTES) {
+    struct bench_link *link = NULL;
+
+    /* next event: the earliest packet arrival or the TCP timer */
+    for (i = 0; i < 2; i++) {
+      if ((bench_links[i].num > 0) &&
+          ((link == NULL) || TCP_SEQ_LT(bench_links[i].arrival[bench_links[i].head], link->arrival[link->head]))) {
+        link = &bench_links[i];
+      }
+    }
+    if ((link != NULL) && TCP_SEQ_LEQ(link->arrival[link->head], bench_tmr_due)) {
+      struct pbuf *p;
+
+      bench_now = link->arrival[link->head];
+      p = bench_link_receive(link);
+      bench_netif.input(p, &bench_netif);
+    } else {
+      bench_now = bench_tmr_due;
+      bench_tmr_due += TCP_TMR_INTERVAL * 1000;
+      tcp_tmr();
+    }
+    if ((bench_now - start) / 1000000 > BENCH_MAX_SECONDS) {
+      bench_fail("transfer");
+    }
+  }
+
+  *mbps = (double)bench_received * 8 / (bench_now - start);
+  unique = bench_next_seqno - bench_first_seqno;
+  *rexmit_percent = (double)(bench_sent_bytes - unique) * 100 / unique;
+
+  tcp_abort(bench_tx_pcb);
+  if (bench_rx_pcb != NULL) {
+    tcp_abort(bench_rx_pcb);
+  }
+  for (i = 0; i < 2; i++) {
+    while (bench_links[i].num > 0) {
+      pbuf_free(bench_link_receive(&bench_links[i]));
+    }
+  }
+}
+
+int
+main(void)
+{
+  struct tcp_pcb *listen_pcb;
+  ip4_addr_t addr, mask, gw;
+  double mbps, rexmit_percent;
+  size_t i;
+
+  lwip_init();
+  ip4_addr_set_u32(&addr, BENCH_LOCAL_IP);
+  IP4_ADDR(&mask, 255, 255, 255, 0);
+  ip4_addr_set_zero(&gw);
+  netif_add(&bench_netif, &addr, &mask, &gw, NULL, bench_netif_init, ip4_input);
+  netif_set_up(&bench_netif);
+  netif_set_link_up(&bench_netif);
+  bench_tmr_due = TCP_TMR_INTERVAL * 1000;
+
+  listen_pcb = tcp_new();
+  if ((listen_pcb == NULL) || (tcp_bind(listen_pcb, IP_ANY_TYPE, BENCH_PORT) != ERR_OK)) {
+    bench_fail("tcp_bind");
+  }
+  listen_pcb = tcp_listen(listen_pcb);
+  if (listen_pcb == NULL) {
+    bench_fail("tcp_listen");
+  }
+  tcp_accept(listen_pcb, bench_accept);
+
+  printf("TCP over %lu Mbit/s, %lu ms RTT, LWIP_TCP_SACK_IN %d, %lu bytes\n",
+         BENCH_LINK_BPS / 1000000, 2 * BENCH_LINK_DELAY / 1000, LWIP_TCP_SACK_IN, BENCH_BYTES);
+  printf("loss %%   goodput Mbit/s   retransmitted %%\n");
+  for (i = 0; i < LWIP_ARRAYSIZE(bench_loss_rates); i++) {
+    bench_run(bench_loss_rates[i], &mbps, &rexmit_percent);
+    printf("%6.1f   %14.2f   %15.2f\n", bench_loss_rates[i] / 100.0, mbps, rexmit_percent);
+  }
+  return EXIT_SUCCESS;
+}
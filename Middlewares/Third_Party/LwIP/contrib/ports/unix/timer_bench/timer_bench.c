@@ -0,0 +1,139 @@
+/*
+ * Timer benchmark: average cost of sys_timeout(), sys_untimeout() and
+ * sys_check_timeouts() with 10..10000 pending timeouts, see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/def.h"
+#include "lwip/timeouts.h"
+#include "lwip/sys.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_MAX_TIMERS  10000
+#define BENCH_MAX_DELAY   60000
+#define BENCH_RESTARTS    200000
+
+static const int bench_timer_counts[] = { 10, 100, 1000, 10000 };
+
+static u32_t bench_now;
+static u32_t bench_rand_state = 1;
+static char bench_args[BENCH_MAX_TIMERS];
+static int bench_fired;
+/* checksum over the order and time of all expiries, equal for both variants */
+static u32_t bench_checksum;
+
+/* This function is used for LWIP_RAND by the unix port */
+unsigned int
+lwip_port_rand(void)
+{
+  return (unsigned int)rand();
+}
+
+/* Virtual time: expiry does not depend on how fast the host is */
+u32_t
+sys_now(void)
+{
+  return bench_now;
+}
+
+static double
+bench_seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Deterministic, so that both variants see the same timeouts */
+static u32_t
+bench_rand(void)
+{
+  bench_rand_state = bench_rand_state * 1103515245UL + 12345UL;
+  return bench_rand_state >> 8;
+}
+
+static u32_t
+bench_delay(void)
+{
+  return 1 + bench_rand() % BENCH_MAX_DELAY;
+}
+
+static void
+bench_handler(void *arg)
+{
+  u32_t index = (u32_t)((char *)arg - bench_args);
+
+  bench_checksum = (bench_checksum * 31 + index) * 31 + bench_now;
+  bench_fired++;
+}
+
+static void
+bench_timers(int num, double *timeout_ns, double *untimeout_ns, double *restart_ns, double *check_ns)
+{
+  double start;
+  int i, steps;
+
+  /* add num timeouts */
+  start = bench_seconds();
+  for (i = 0; i < num; i++) {
+    sys_timeout(bench_delay(), bench_handler, &bench_args[i]);
+  }
+  *timeout_ns = (bench_seconds() - start) * 1e9 / num;
+
+  /* restart random ones, like TCP and DHCP do with their timers */
+  start = bench_seconds();
+  for (i = 0; i < BENCH_RESTARTS; i++) {
+    void *arg = &bench_args[bench_rand() % num];
+    sys_untimeout(bench_handler, arg);
+    sys_timeout(bench_delay(), bench_handler, arg);
+  }
+  *restart_ns = (bench_seconds() - start) * 1e9 / BENCH_RESTARTS;
+
+  /* let all of them expire, checking every millisecond */
+  bench_fired = 0;
+  steps = 0;
+  start = bench_seconds();
+  while (bench_fired < num) {
+    bench_now++;
+    sys_check_timeouts();
+    steps++;
+  }
+  *check_ns = (bench_seconds() - start) * 1e9 / steps;
+
+  /* add num timeouts again and remove them in random order */
+  for (i = 0; i < num; i++) {
+    sys_timeout(bench_delay(), bench_handler, &bench_args[i]);
+  }
+  start = bench_seconds();
+  for (i = 0; i < num; i++) {
+    sys_untimeout(bench_handler, &bench_args[(i * 7919) % num]);
+  }
+  *untimeout_ns = (bench_seconds() - start) * 1e9 / num;
+}
+
+int
+main(void)
+{
+  size_t i;
+  double ns[4];
+
+  lwip_init();
+  /* warm up: touch all memory once */
+  bench_timers(BENCH_MAX_TIMERS, &ns[0], &ns[1], &ns[2], &ns[3]);
+
+  printf("LWIP_TIMERS_WHEEL %d\n", LWIP_TIMERS_WHEEL);
+  printf("timers   sys_timeout   sys_untimeout   untimeout+timeout   sys_check_timeouts (ns per call)\n");
+  for (i = 0; i < LWIP_ARRAYSIZE(bench_timer_counts); i++) {
+    int num = bench_timer_counts[i];
+    double timeout_ns, untimeout_ns, restart_ns, check_ns;
+
+    bench_timers(num, &timeout_ns, &untimeout_ns, &restart_ns, &check_ns);
+    printf("%6d   %11.1f   %13.1f   %17.1f   %18.1f\n", num, timeout_ns, untimeout_ns, restart_ns, check_ns);
+  }
+  printf("checksum %08"X32_F"\n", bench_checksum);
+  return EXIT_SUCCESS;
+}
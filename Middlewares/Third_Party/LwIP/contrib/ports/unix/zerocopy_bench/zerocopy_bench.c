@@ -0,0 +1,221 @@
+/*
+ * Zero-copy socket benchmark: TCP throughput and CPU time per byte through the
+ * socket API and the loopback netif, copying or lending pbufs, see README.
+ */
+
+#include "lwip/init.h"
+#include "lwip/tcpip.h"
+#include "lwip/sockets.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_BYTES        (64UL * 1024 * 1024)
+#define BENCH_CHUNK        16384
+/* larger than the caches, like application data that is not hot */
+#define BENCH_BUFFER       (32UL * 1024 * 1024)
+#define BENCH_PORT         5001
+/* enough lent chunks for a full send buffer plus the one being sent */
+#define BENCH_LENT_CHUNKS  ((TCP_SND_BUF + BENCH_CHUNK - 1) / BENCH_CHUNK + 2)
+
+struct bench_lent {
+  struct pbuf_custom pc;
+  volatile int in_use;
+};
+
+static u8_t bench_tx_data[BENCH_BUFFER];
+static u8_t bench_rx_data[BENCH_BUFFER];
+static struct bench_lent bench_lent[BENCH_LENT_CHUNKS];
+static int bench_rx_zerocopy;
+static int bench_rx_socket;
+static sys_sem_t bench_rx_start;
+static sys_sem_t bench_rx_done;
+
+static double
+bench_seconds(clockid_t clock)
+{
+  struct timespec ts;
+
+  clock_gettime(clock, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void
+bench_fail(const char *what)
+{
+  fprintf(stderr, "%s failed, errno %d\n", what, errno);
+  exit(EXIT_FAILURE);
+}
+
+static void
+bench_tcpip_init_done(void *arg)
+{
+  sys_sem_signal((sys_sem_t *)arg);
+}
+
+/* Called (in the tcpip_thread) once all segments referencing a chunk are ACKed */
+static void
+bench_lent_free(struct pbuf *p)
+{
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  SYS_ARCH_PROTECT(lev);
+  ((struct bench_lent *)p)->in_use = 0;
+  SYS_ARCH_UNPROTECT(lev);
+}
+
+/* Lend a chunk of bench_tx_data to the stack: it never changes, so a chunk
+   may be lent again while still referenced */
+static struct pbuf *
+bench_lend(u8_t *data)
+{
+  for (;;) {
+    size_t i;
+
+    for (i = 0; i < BENCH_LENT_CHUNKS; i++) {
+      int in_use;
+      SYS_ARCH_DECL_PROTECT(lev);
+
+      SYS_ARCH_PROTECT(lev);
+      in_use = bench_lent[i].in_use;
+      bench_lent[i].in_use = 1;
+      SYS_ARCH_UNPROTECT(lev);
+      if (!in_use) {
+        bench_lent[i].pc.custom_free_function = bench_lent_free;
+        return pbuf_alloced_custom(PBUF_RAW, BENCH_CHUNK, PBUF_REF, &bench_lent[i].pc,
+                                   data, BENCH_CHUNK);
+      }
+    }
+    /* all of them are still unacknowledged */
+    sys_msleep(1);
+  }
+}
+
+static void
+bench_rx_thread(void *arg)
+{
+  LWIP_UNUSED_ARG(arg);
+
+  for (;;) {
+    unsigned long received = 0;
+
+    sys_sem_wait(&bench_rx_start);
+    while (received < BENCH_BYTES) {
+      ssize_t ret;
+
+      if (bench_rx_zerocopy) {
+        struct pbuf *p;
+        ret = lwip_recv_pbuf(bench_rx_socket, &p, 0, NULL, NULL);
+        if (ret > 0) {
+          pbuf_free(p);
+        }
+      } else {
+        size_t offset = received % BENCH_BUFFER;
+        ret = lwip_recv(bench_rx_socket, &bench_rx_data[offset], LWIP_MIN(BENCH_CHUNK, BENCH_BUFFER - offset), 0);
+      }
+      if (ret <= 0) {
+        bench_fail("receive");
+      }
+      received += (unsigned long)ret;
+    }
+    sys_sem_signal(&bench_rx_done);
+  }
+}
+
+/* Send BENCH_BYTES, returns MByte/s and CPU ns per byte */
+static void
+bench_run(int tx, int tx_zerocopy, int rx_zerocopy, double *mbyte_s, double *cpu_ns)
+{
+  double start = bench_seconds(CLOCK_MONOTONIC);
+  double cpu_start = bench_seconds(CLOCK_PROCESS_CPUTIME_ID);
+  unsigned long sent = 0;
+
+  bench_rx_zerocopy = rx_zerocopy;
+  sys_sem_signal(&bench_rx_start);
+  while (sent < BENCH_BYTES) {
+    u8_t *data = &bench_tx_data[sent % BENCH_BUFFER];
+    ssize_t ret;
+
+    if (tx_zerocopy) {
+      struct pbuf *p = bench_lend(data);
+      ret = lwip_send_pbuf(tx, p, 0);
+      /* the stack keeps its own references */
+      pbuf_free(p);
+    } else {
+      ret = lwip_send(tx, data, BENCH_CHUNK, 0);
+    }
+    if (ret != BENCH_CHUNK) {
+      bench_fail("send");
+    }
+    sent += BENCH_CHUNK;
+  }
+  sys_sem_wait(&bench_rx_done);
+  *mbyte_s = BENCH_BYTES / (bench_seconds(CLOCK_MONOTONIC) - start) / (1024 * 1024);
+  *cpu_ns = (bench_seconds(CLOCK_PROCESS_CPUTIME_ID) - cpu_start) * 1e9 / BENCH_BYTES;
+}
+
+int
+main(void)
+{
+  static const char *const modes[] = { "copy", "zero-copy" };
+  struct sockaddr_in addr;
+  socklen_t addr_len = sizeof(addr);
+  sys_sem_t init_sem;
+  double mbyte_s, cpu_ns;
+  int listener, tx, tx_zerocopy, rx_zerocopy;
+
+  if (sys_sem_new(&init_sem, 0) != ERR_OK) {
+    bench_fail("sys_sem_new");
+  }
+  tcpip_init(bench_tcpip_init_done, &init_sem);
+  sys_sem_wait(&init_sem);
+  sys_sem_free(&init_sem);
+  if ((sys_sem_new(&bench_rx_start, 0) != ERR_OK) || (sys_sem_new(&bench_rx_done, 0) != ERR_OK)) {
+    bench_fail("sys_sem_new");
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = PP_HTONS(BENCH_PORT);
+  addr.sin_addr.s_addr = PP_HTONL(INADDR_LOOPBACK);
+
+  listener = lwip_socket(AF_INET, SOCK_STREAM, 0);
+  tx = lwip_socket(AF_INET, SOCK_STREAM, 0);
+  if ((listener < 0) || (tx < 0)) {
+    bench_fail("lwip_socket");
+  }
+  if ((lwip_bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0) ||
+      (lwip_listen(listener, 1) != 0)) {
+    bench_fail("lwip_listen");
+  }
+  if (lwip_connect(tx, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    bench_fail("lwip_connect");
+  }
+  bench_rx_socket = lwip_accept(listener, (struct sockaddr *)&addr, &addr_len);
+  if (bench_rx_socket < 0) {
+    bench_fail("lwip_accept");
+  }
+  sys_thread_new("bench_rx", bench_rx_thread, NULL, DEFAULT_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+
+  /* warm up: touch all memory once */
+  bench_run(tx, 1, 1, &mbyte_s, &cpu_ns);
+
+  printf("TCP over loopback, %lu MByte in %d byte sends\n", BENCH_BYTES / (1024 * 1024), BENCH_CHUNK);
+  printf("     send        recv     MByte/s   CPU ns/byte\n");
+  for (tx_zerocopy = 0; tx_zerocopy < 2; tx_zerocopy++) {
+    for (rx_zerocopy = 0; rx_zerocopy < 2; rx_zerocopy++) {
+      bench_run(tx, tx_zerocopy, rx_zerocopy, &mbyte_s, &cpu_ns);
+      printf("%9s   %9s   %9.1f   %11.3f\n", modes[tx_zerocopy], modes[rx_zerocopy], mbyte_s, cpu_ns);
+    }
+  }
+
+  lwip_close(tx);
+  lwip_close(bench_rx_socket);
+  lwip_close(listener);
+  return EXIT_SUCCESS;
+}
@@ -956,6 +956,49 @@ netconn_send(struct netconn *conn, struct netbuf *buf)
   return err;
 }
 
+/**
+ * @ingroup netconn_udp
+ * Send several netbufs over a UDP or RAW netconn with one call into the
+ * tcpip_thread. Each netbuf is sent like with netconn_send(); sending stops
+ * at the first netbuf that fails.
+ *
+ * @param conn the UDP or RAW netconn over which to send data
+ * @param bufs array of netbufs containing the data to send
+ * @param count number of netbufs in bufs
+ * @param sent receives the number of netbufs that were sent (may be NULL)
+ * @return ERR_OK if all netbufs were sent, else the error of the first
+ *         netbuf that could not be sent
+ */
+err_t
+netconn_send_multi(struct netconn *conn, struct netbuf **bufs, u16_t count, u16_t *sent)
+{
+  API_MSG_VAR_DECLARE(msg);
+  err_t err;
+
+  if (sent != NULL) {
+    *sent = 0;
+  }
+  LWIP_ERROR("netconn_send_multi: invalid conn",  (conn != NULL), return ERR_ARG;);
+  LWIP_ERROR("netconn_send_multi: invalid bufs",  (bufs != NULL) || (count == 0), return ERR_ARG;);
+  if (count == 0) {
+    return ERR_OK;
+  }
+
+  LWIP_DEBUGF(API_LIB_DEBUG, ("netconn_send_multi: sending %"U16_F" netbufs\n", count));
+
+  API_MSG_VAR_ALLOC(msg);
+  API_MSG_VAR_REF(msg).conn = conn;
+  API_MSG_VAR_REF(msg).msg.bm.bufs = bufs;
+  API_MSG_VAR_REF(msg).msg.bm.count = count;
+  err = netconn_apimsg(lwip_netconn_do_send_multi, &API_MSG_VAR_REF(msg));
+  if (sent != NULL) {
+    *sent = API_MSG_VAR_REF(msg).msg.bm.count;
+  }
+  API_MSG_VAR_FREE(msg);
+
+  return err;
+}
+
 /**
  * @ingroup netconn_tcp
  * Send data over a TCP netconn.
@@ -980,31 +1023,16 @@ netconn_write_partly(struct netconn *conn, const void *dataptr, size_t size,
   return netconn_write_vectors_partly(conn, &vector, 1, apiflags, bytes_written);
 }
 
-/**
- * Send vectorized data atomically over a TCP netconn.
- *
- * @param conn the TCP netconn over which to send data
- * @param vectors array of vectors containing data to send
- * @param vectorcnt number of vectors in the array
- * @param apiflags combination of following flags :
- * - NETCONN_COPY: data will be copied into memory belonging to the stack
- * - NETCONN_MORE: for TCP connection, PSH flag will be set on last segment sent
- * - NETCONN_DONTBLOCK: only write the data if all data can be written at once
- * @param bytes_written pointer to a location that receives the number of written bytes
- * @return ERR_OK if data was sent, any other err_t on error
- */
-err_t
-netconn_write_vectors_partly(struct netconn *conn, struct netvector *vectors, u16_t vectorcnt,
-                             u8_t apiflags, size_t *bytes_written)
+/** Common part of netconn_write_vectors_partly() and netconn_write_pbuf():
+ * size is the sum of the lengths of the vectors or of p->tot_len. */
+static err_t
+netconn_write_msg(struct netconn *conn, const struct netvector *vectors, u16_t vectorcnt,
+                  struct pbuf *p, size_t size, u8_t apiflags, size_t *bytes_written)
 {
   API_MSG_VAR_DECLARE(msg);
   err_t err;
   u8_t dontblock;
-  size_t size;
-  int i;
 
-  LWIP_ERROR("netconn_write: invalid conn",  (conn != NULL), return ERR_ARG;);
-  LWIP_ERROR("netconn_write: invalid conn->type",  (NETCONNTYPE_GROUP(conn->type) == NETCONN_TCP), return ERR_VAL;);
   dontblock = netconn_is_nonblocking(conn) || (apiflags & NETCONN_DONTBLOCK);
 #if LWIP_SO_SNDTIMEO
   if (conn->send_timeout != 0) {
@@ -1017,15 +1045,6 @@ netconn_write_vectors_partly(struct netconn *conn, struct netvector *vectors, u1
     return ERR_VAL;
   }
 
-  /* sum up the total size */
-  size = 0;
-  for (i = 0; i < vectorcnt; i++) {
-    size += vectors[i].len;
-    if (size < vectors[i].len) {
-      /* overflow */
-      return ERR_VAL;
-    }
-  }
   if (size == 0) {
     return ERR_OK;
   } else if (size > SSIZE_MAX) {
@@ -1045,6 +1064,11 @@ netconn_write_vectors_partly(struct netconn *conn, struct netvector *vectors, u1
   API_MSG_VAR_REF(msg).msg.w.vector = vectors;
   API_MSG_VAR_REF(msg).msg.w.vector_cnt = vectorcnt;
   API_MSG_VAR_REF(msg).msg.w.vector_off = 0;
+#if LWIP_ZEROCOPY
+  API_MSG_VAR_REF(msg).msg.w.pbuf = p;
+#else /* LWIP_ZEROCOPY */
+  LWIP_UNUSED_ARG(p);
+#endif /* LWIP_ZEROCOPY */
   API_MSG_VAR_REF(msg).msg.w.apiflags = apiflags;
   API_MSG_VAR_REF(msg).msg.w.len = size;
   API_MSG_VAR_REF(msg).msg.w.offset = 0;
@@ -1077,6 +1101,69 @@ netconn_write_vectors_partly(struct netconn *conn, struct netvector *vectors, u1
   return err;
 }
 
+/**
+ * Send vectorized data atomically over a TCP netconn.
+ *
+ * @param conn the TCP netconn over which to send data
+ * @param vectors array of vectors containing data to send
+ * @param vectorcnt number of vectors in the array
+ * @param apiflags combination of following flags :
+ * - NETCONN_COPY: data will be copied into memory belonging to the stack
+ * - NETCONN_MORE: for TCP connection, PSH flag will be set on last segment sent
+ * - NETCONN_DONTBLOCK: only write the data if all data can be written at once
+ * @param bytes_written pointer to a location that receives the number of written bytes
+ * @return ERR_OK if data was sent, any other err_t on error
+ */
+err_t
+netconn_write_vectors_partly(struct netconn *conn, struct netvector *vectors, u16_t vectorcnt,
+                             u8_t apiflags, size_t *bytes_written)
+{
+  size_t size;
+  int i;
+
+  LWIP_ERROR("netconn_write: invalid conn",  (conn != NULL), return ERR_ARG;);
+  LWIP_ERROR("netconn_write: invalid conn->type",  (NETCONNTYPE_GROUP(conn->type) == NETCONN_TCP), return ERR_VAL;);
+
+  /* sum up the total size */
+  size = 0;
+  for (i = 0; i < vectorcnt; i++) {
+    size += vectors[i].len;
+    if (size < vectors[i].len) {
+      /* overflow */
+      return ERR_VAL;
+    }
+  }
+  return netconn_write_msg(conn, vectors, vectorcnt, NULL, size, apiflags, bytes_written);
+}
+
+#if LWIP_ZEROCOPY
+/**
+ * @ingroup netconn_tcp
+ * Send the data of a pbuf chain over a TCP netconn without copying it.
+ * The queued segments reference the pbufs of the chain (see tcp_write_pbuf())
+ * until the data is ACKed, so the caller may pbuf_free() p as soon as this
+ * returns but must not change the data any more.
+ *
+ * @param conn the TCP netconn over which to send data
+ * @param p pbuf chain containing the data to send
+ * @param apiflags combination of following flags :
+ * - NETCONN_MORE: for TCP connection, PSH flag will be set on last segment sent
+ * - NETCONN_DONTBLOCK: only write the data if all data can be written at once
+ * @param bytes_written pointer to a location that receives the number of written bytes
+ * @return ERR_OK if data was sent, any other err_t on error
+ */
+err_t
+netconn_write_pbuf(struct netconn *conn, struct pbuf *p, u8_t apiflags, size_t *bytes_written)
+{
+  LWIP_ERROR("netconn_write_pbuf: invalid conn",  (conn != NULL), return ERR_ARG;);
+  LWIP_ERROR("netconn_write_pbuf: invalid conn->type",  (NETCONNTYPE_GROUP(conn->type) == NETCONN_TCP), return ERR_VAL;);
+  LWIP_ERROR("netconn_write_pbuf: invalid pbuf",  (p != NULL), return ERR_ARG;);
+
+  return netconn_write_msg(conn, NULL, pbuf_clen(p), p, p->tot_len,
+                           (u8_t)(apiflags & ~NETCONN_COPY), bytes_written);
+}
+#endif /* LWIP_ZEROCOPY */
+
 /**
  * @ingroup netconn_tcp
  * Close or shutdown a TCP netconn (doesn't delete it).
@@ -1526,6 +1526,53 @@ lwip_netconn_do_listen(void *m)
 }
 #endif /* LWIP_TCP */
 
+/* Send one netbuf on the RAW or UDP pcb of a netconn */
+static err_t
+lwip_netconn_send_netbuf(struct netconn *conn, struct netbuf *b)
+{
+  err_t err;
+
+  LWIP_UNUSED_ARG(b); /* for LWIP_RAW == LWIP_UDP == 0 */
+  if (conn->pcb.tcp == NULL) {
+    return ERR_CONN;
+  }
+  switch (NETCONNTYPE_GROUP(conn->type)) {
+#if LWIP_RAW
+    case NETCONN_RAW:
+      if (ip_addr_isany(&b->addr) || IP_IS_ANY_TYPE_VAL(b->addr)) {
+        err = raw_send(conn->pcb.raw, b->p);
+      } else {
+        err = raw_sendto(conn->pcb.raw, b->p, &b->addr);
+      }
+      break;
+#endif
+#if LWIP_UDP
+    case NETCONN_UDP:
+#if LWIP_CHECKSUM_ON_COPY
+      if (ip_addr_isany(&b->addr) || IP_IS_ANY_TYPE_VAL(b->addr)) {
+        err = udp_send_chksum(conn->pcb.udp, b->p,
+                              b->flags & NETBUF_FLAG_CHKSUM, b->toport_chksum);
+      } else {
+        err = udp_sendto_chksum(conn->pcb.udp, b->p,
+                                &b->addr, b->port,
+                                b->flags & NETBUF_FLAG_CHKSUM, b->toport_chksum);
+      }
+#else /* LWIP_CHECKSUM_ON_COPY */
+      if (ip_addr_isany_val(b->addr) || IP_IS_ANY_TYPE_VAL(b->addr)) {
+        err = udp_send(conn->pcb.udp, b->p);
+      } else {
+        err = udp_sendto(conn->pcb.udp, b->p, &b->addr, b->port);
+      }
+#endif /* LWIP_CHECKSUM_ON_COPY */
+      break;
+#endif /* LWIP_UDP */
+    default:
+      err = ERR_CONN;
+      break;
+  }
+  return err;
+}
+
 /**
  * Send some data on a RAW or UDP pcb contained in a netconn
  * Called from netconn_send
@@ -1539,45 +1586,34 @@ lwip_netconn_do_send(void *m)
 
   err_t err = netconn_err(msg->conn);
   if (err == ERR_OK) {
-    if (msg->conn->pcb.tcp != NULL) {
-      switch (NETCONNTYPE_GROUP(msg->conn->type)) {
-#if LWIP_RAW
-        case NETCONN_RAW:
-          if (ip_addr_isany(&msg->msg.b->addr) || IP_IS_ANY_TYPE_VAL(msg->msg.b->addr)) {
-            err = raw_send(msg->conn->pcb.raw, msg->msg.b->p);
-          } else {
-            err = raw_sendto(msg->conn->pcb.raw, msg->msg.b->p, &msg->msg.b->addr);
-          }
-          break;
-#endif
-#if LWIP_UDP
-        case NETCONN_UDP:
-#if LWIP_CHECKSUM_ON_COPY
-          if (ip_addr_isany(&msg->msg.b->addr) || IP_IS_ANY_TYPE_VAL(msg->msg.b->addr)) {
-            err = udp_send_chksum(msg->conn->pcb.udp, msg->msg.b->p,
-                                  msg->msg.b->flags & NETBUF_FLAG_CHKSUM, msg->msg.b->toport_chksum);
-          } else {
-            err = udp_sendto_chksum(msg->conn->pcb.udp, msg->msg.b->p,
-                                    &msg->msg.b->addr, msg->msg.b->port,
-                                    msg->msg.b->flags & NETBUF_FLAG_CHKSUM, msg->msg.b->toport_chksum);
-          }
-#else /* LWIP_CHECKSUM_ON_COPY */
-          if (ip_addr_isany_val(msg->msg.b->addr) || IP_IS_ANY_TYPE_VAL(msg->msg.b->addr)) {
-            err = udp_send(msg->conn->pcb.udp, msg->msg.b->p);
-          } else {
-            err = udp_sendto(msg->conn->pcb.udp, msg->msg.b->p, &msg->msg.b->addr, msg->msg.b->port);
-          }
-#endif /* LWIP_CHECKSUM_ON_COPY */
-          break;
-#endif /* LWIP_UDP */
-        default:
-          err = ERR_CONN;
-          break;
+    err = lwip_netconn_send_netbuf(msg->conn, msg->msg.b);
+  }
+  msg->err = err;
+  TCPIP_APIMSG_ACK(msg);
+}
+
+/**
+ * Send several netbufs over a UDP or RAW pcb, stopping at the first error.
+ * Called from netconn_send_multi
+ *
+ * @param m the api_msg pointing to the connection
+ */
+void
+lwip_netconn_do_send_multi(void *m)
+{
+  struct api_msg *msg = (struct api_msg *)m;
+  u16_t i = 0;
+
+  err_t err = netconn_err(msg->conn);
+  if (err == ERR_OK) {
+    for (; i < msg->msg.bm.count; i++) {
+      err = lwip_netconn_send_netbuf(msg->conn, msg->msg.bm.bufs[i]);
+      if (err != ERR_OK) {
+        break;
       }
-    } else {
-      err = ERR_CONN;
     }
   }
+  msg->msg.bm.count = i;
   msg->err = err;
   TCPIP_APIMSG_ACK(msg);
 }
@@ -1645,6 +1681,8 @@ lwip_netconn_do_writemore(struct netconn *conn  WRITE_DELAYED_PARAM)
 {
   err_t err;
   const void *dataptr;
+  const void *vector_ptr;
+  size_t vector_len;
   u16_t len, available;
   u8_t write_finished = 0;
   size_t diff;
@@ -1678,8 +1716,18 @@ lwip_netconn_do_writemore(struct netconn *conn  WRITE_DELAYED_PARAM)
 #endif /* LWIP_SO_SNDTIMEO */
   {
     do {
-      dataptr = (const u8_t *)conn->current_msg->msg.w.vector->ptr + conn->current_msg->msg.w.vector_off;
-      diff = conn->current_msg->msg.w.vector->len - conn->current_msg->msg.w.vector_off;
+#if LWIP_ZEROCOPY
+      if (conn->current_msg->msg.w.pbuf != NULL) {
+        vector_ptr = conn->current_msg->msg.w.pbuf->payload;
+        vector_len = conn->current_msg->msg.w.pbuf->len;
+      } else
+#endif /* LWIP_ZEROCOPY */
+      {
+        vector_ptr = conn->current_msg->msg.w.vector->ptr;
+        vector_len = conn->current_msg->msg.w.vector->len;
+      }
+      dataptr = (const u8_t *)vector_ptr + conn->current_msg->msg.w.vector_off;
+      diff = vector_len - conn->current_msg->msg.w.vector_off;
       if (diff > 0xffffUL) { /* max_u16_t */
         len = 0xffff;
         apiflags |= TCP_WRITE_FLAG_MORE;
@@ -1701,7 +1749,7 @@ lwip_netconn_do_writemore(struct netconn *conn  WRITE_DELAYED_PARAM)
         }
       }
       LWIP_ASSERT("lwip_netconn_do_writemore: invalid length!",
-                  ((conn->current_msg->msg.w.vector_off + len) <= conn->current_msg->msg.w.vector->len));
+                  ((conn->current_msg->msg.w.vector_off + len) <= vector_len));
       /* we should loop around for more sending in the following cases:
            1) We couldn't finish the current vector because of 16-bit size limitations.
               tcp_write() and tcp_sndbuf() both are limited to 16-bit sizes
@@ -1713,16 +1761,31 @@ lwip_netconn_do_writemore(struct netconn *conn  WRITE_DELAYED_PARAM)
       } else {
         write_more = 0;
       }
-      err = tcp_write(conn->pcb.tcp, dataptr, len, apiflags);
+#if LWIP_ZEROCOPY
+      if (conn->current_msg->msg.w.pbuf != NULL) {
+        err = tcp_write_pbuf(conn->pcb.tcp, conn->current_msg->msg.w.pbuf,
+                             (u16_t)conn->current_msg->msg.w.vector_off, len, apiflags);
+      } else
+#endif /* LWIP_ZEROCOPY */
+      {
+        err = tcp_write(conn->pcb.tcp, dataptr, len, apiflags);
+      }
       if (err == ERR_OK) {
         conn->current_msg->msg.w.offset += len;
         conn->current_msg->msg.w.vector_off += len;
         /* check if current vector is finished */
-        if (conn->current_msg->msg.w.vector_off == conn->current_msg->msg.w.vector->len) {
+        if (conn->current_msg->msg.w.vector_off == vector_len) {
           conn->current_msg->msg.w.vector_cnt--;
           /* if we have additional vectors, move on to them */
           if (conn->current_msg->msg.w.vector_cnt > 0) {
-            conn->current_msg->msg.w.vector++;
+#if LWIP_ZEROCOPY
+            if (conn->current_msg->msg.w.pbuf != NULL) {
+              conn->current_msg->msg.w.pbuf = conn->current_msg->msg.w.pbuf->next;
+            } else
+#endif /* LWIP_ZEROCOPY */
+            {
+              conn->current_msg->msg.w.vector++;
+            }
             conn->current_msg->msg.w.vector_off = 0;
           }
         }
@@ -322,6 +322,13 @@ static volatile int select_cb_ctr;
 static struct lwip_select_cb *select_cb_list;
 #endif /* LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL */
 
+#if LWIP_SOCKET_EPOLL
+/** The global array of epoll instances */
+static struct lwip_epoll epolls[LWIP_SOCKET_EPOLL_NUM];
+/* epoll descriptors follow the socket descriptors */
+#define LWIP_EPOLL_OFFSET (LWIP_SOCKET_OFFSET + NUM_SOCKETS)
+#endif /* LWIP_SOCKET_EPOLL */
+
 /* Forward declaration of some functions */
 #if LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL
 static void event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len);
@@ -330,6 +337,12 @@ static void select_check_waiters(int s, int has_recvevent, int has_sendevent, in
 #else
 #define DEFAULT_SOCKET_EVENTCB NULL
 #endif
+#if LWIP_SOCKET_EPOLL
+static struct lwip_epoll *get_epoll(int epfd);
+static int lwip_epoll_close(struct lwip_epoll *ep);
+static void lwip_epoll_drop_socket(struct lwip_sock *sock);
+static void lwip_epoll_notify(struct lwip_sock *sock);
+#endif /* LWIP_SOCKET_EPOLL */
 #if !LWIP_TCPIP_CORE_LOCKING
 static void lwip_getsockopt_callback(void *arg);
 static void lwip_setsockopt_callback(void *arg);
@@ -569,6 +582,9 @@ alloc_socket(struct netconn *newconn, int accepted)
       sockets[i].sendevent  = (NETCONNTYPE_GROUP(newconn->type) == NETCONN_TCP ? (accepted != 0) : 1);
       sockets[i].errevent   = 0;
 #endif /* LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL */
+#if LWIP_SOCKET_EPOLL
+      LWIP_ASSERT("sockets[i].epoll_items == NULL", sockets[i].epoll_items == NULL);
+#endif /* LWIP_SOCKET_EPOLL */
       return i + LWIP_SOCKET_OFFSET;
     }
     SYS_ARCH_UNPROTECT(lev);
@@ -815,6 +831,13 @@ lwip_close(int s)
 
   LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_close(%d)\n", s));
 
+#if LWIP_SOCKET_EPOLL
+  if (get_epoll(s) != NULL) {
+    /* epoll descriptors are closed like sockets */
+    return lwip_epoll_close(get_epoll(s));
+  }
+#endif /* LWIP_SOCKET_EPOLL */
+
   sock = get_socket(s);
   if (!sock) {
     return -1;
@@ -834,6 +857,10 @@ lwip_close(int s)
   /* drop all possibly joined MLD6 memberships */
   lwip_socket_drop_registered_mld6_memberships(s);
 #endif /* LWIP_IPV6_MLD */
+#if LWIP_SOCKET_EPOLL
+  /* remove it from all epoll instances */
+  lwip_epoll_drop_socket(sock);
+#endif /* LWIP_SOCKET_EPOLL */
 
   err = netconn_prepare_delete(sock->conn);
   if (err != ERR_OK) {
@@ -1315,11 +1342,30 @@ lwip_recv(int s, void *mem, size_t len, int flags)
   return lwip_recvfrom(s, mem, len, flags, NULL, NULL);
 }
 
+/* Helper function to check the IO vectors of a msghdr to receive into.
+ * Returns their total length or -1 if they are invalid.
+ */
+static ssize_t
+lwip_recvmsg_iov_len(const struct msghdr *message)
+{
+  msg_iovlen_t i;
+  ssize_t buflen = 0;
+
+  for (i = 0; i < message->msg_iovlen; i++) {
+    if ((message->msg_iov[i].iov_base == NULL) || ((ssize_t)message->msg_iov[i].iov_len <= 0) ||
+        ((size_t)(ssize_t)message->msg_iov[i].iov_len != message->msg_iov[i].iov_len) ||
+        ((ssize_t)(buflen + (ssize_t)message->msg_iov[i].iov_len) <= 0)) {
+      return -1;
+    }
+    buflen = (ssize_t)(buflen + (ssize_t)message->msg_iov[i].iov_len);
+  }
+  return buflen;
+}
+
 ssize_t
 lwip_recvmsg(int s, struct msghdr *message, int flags)
 {
   struct lwip_sock *sock;
-  msg_iovlen_t i;
   ssize_t buflen;
 
   LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvmsg(%d, message=%p, flags=0x%x)\n", s, (void *)message, flags));
@@ -1338,21 +1384,17 @@ lwip_recvmsg(int s, struct msghdr *message, int flags)
   }
 
   /* check for valid vectors */
-  buflen = 0;
-  for (i = 0; i < message->msg_iovlen; i++) {
-    if ((message->msg_iov[i].iov_base == NULL) || ((ssize_t)message->msg_iov[i].iov_len <= 0) ||
-        ((size_t)(ssize_t)message->msg_iov[i].iov_len != message->msg_iov[i].iov_len) ||
-        ((ssize_t)(buflen + (ssize_t)message->msg_iov[i].iov_len) <= 0)) {
-      set_errno(err_to_errno(ERR_VAL));
-      done_socket(sock);
-      return -1;
-    }
-    buflen = (ssize_t)(buflen + (ssize_t)message->msg_iov[i].iov_len);
+  buflen = lwip_recvmsg_iov_len(message);
+  if (buflen < 0) {
+    set_errno(err_to_errno(ERR_VAL));
+    done_socket(sock);
+    return -1;
   }
 
   if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
 #if LWIP_TCP
     int recv_flags = flags;
+    msg_iovlen_t i;
     message->msg_flags = 0;
     /* recv the data */
     buflen = 0;
@@ -1416,6 +1458,186 @@ lwip_recvmsg(int s, struct msghdr *message, int flags)
 #endif /* LWIP_UDP || LWIP_RAW */
 }
 
+/**
+ * @ingroup socket
+ * Receive up to vlen datagrams with one call, like recvmmsg() on Linux.
+ * Only the first datagram is waited for (unless MSG_DONTWAIT is given),
+ * the call then returns as soon as no more datagrams are queued (as with
+ * MSG_WAITFORONE on Linux).
+ * On stream sockets, this behaves like consecutive calls to lwip_recvmsg().
+ *
+ * @return the number of messages received (their msg_len set to the length of
+ *         the datagram), or -1 with errno set if none was received
+ */
+int
+lwip_recvmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+  struct lwip_sock *sock;
+  unsigned int received = 0;
+#if LWIP_UDP || LWIP_RAW
+  int err = 0;
+#endif /* LWIP_UDP || LWIP_RAW */
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvmmsg(%d, msgvec=%p, vlen=%u, flags=0x%x)\n", s, (void *)msgvec, vlen, flags));
+  LWIP_ERROR("lwip_recvmmsg: invalid msgvec", (msgvec != NULL) || (vlen == 0),
+             set_errno(err_to_errno(ERR_ARG)); return -1;);
+  LWIP_ERROR("lwip_recvmmsg: unsupported flags", (flags & ~MSG_DONTWAIT) == 0,
+             set_errno(EOPNOTSUPP); return -1;);
+
+  sock = get_socket(s);
+  if (!sock) {
+    return -1;
+  }
+
+  if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+    done_socket(sock);
+    for (; received < vlen; received++) {
+      ssize_t ret = lwip_recvmsg(s, &msgvec[received].msg_hdr, flags);
+      if (ret <= 0) {
+        break;
+      }
+      msgvec[received].msg_len = (unsigned int)ret;
+      /* don't wait for more than the first message */
+      flags |= MSG_DONTWAIT;
+    }
+    return ((received > 0) || (vlen == 0)) ? (int)received : -1;
+  }
+  /* else, UDP and RAW NETCONNs */
+#if LWIP_UDP || LWIP_RAW
+  for (; received < vlen; received++) {
+    struct msghdr *message = &msgvec[received].msg_hdr;
+    u16_t datagram_len = 0;
+    ssize_t buflen;
+    err_t recv_err;
+
+    if ((message->msg_iovlen <= 0) || (message->msg_iovlen > IOV_MAX)) {
+      err = EMSGSIZE;
+      break;
+    }
+    buflen = lwip_recvmsg_iov_len(message);
+    if (buflen < 0) {
+      err = err_to_errno(ERR_VAL);
+      break;
+    }
+    recv_err = lwip_recvfrom_udp_raw(sock, flags, message, &datagram_len, s);
+    if (recv_err != ERR_OK) {
+      err = err_to_errno(recv_err);
+      break;
+    }
+    if (datagram_len > buflen) {
+      message->msg_flags |= MSG_TRUNC;
+    }
+    msgvec[received].msg_len = datagram_len;
+    /* the datagrams queued up to now are fetched without waiting */
+    flags |= MSG_DONTWAIT;
+  }
+
+  done_socket(sock);
+  if ((received == 0) && (err != 0)) {
+    set_errno(err);
+    return -1;
+  }
+  set_errno(0);
+  return (int)received;
+#else /* LWIP_UDP || LWIP_RAW */
+  set_errno(err_to_errno(ERR_ARG));
+  done_socket(sock);
+  return -1;
+#endif /* LWIP_UDP || LWIP_RAW */
+}
+
+#if LWIP_ZEROCOPY
+/**
+ * @ingroup socket
+ * Receive without copying: the pbuf chain holding the received data is handed
+ * to the application, which has to pbuf_free() it when done with it.
+ * On datagram sockets, *p is one whole datagram. On stream sockets, *p holds
+ * the data of one received segment (or what is left of it after lwip_recv()).
+ * The receive window is reopened as soon as the data is handed out, so holding
+ * on to many pbufs ties up stack memory (e.g. PBUF_POOL).
+ * Only MSG_DONTWAIT is supported as flag.
+ *
+ * @return the number of bytes in *p, 0 at the end of a stream,
+ *         or -1 with errno set
+ */
+ssize_t
+lwip_recv_pbuf(int s, struct pbuf **p, int flags, struct sockaddr *from, socklen_t *fromlen)
+{
+  struct lwip_sock *sock;
+  u8_t apiflags;
+  err_t err;
+  ssize_t ret;
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recv_pbuf(%d, p=%p, flags=0x%x)\n", s, (void *)p, flags));
+  LWIP_ERROR("lwip_recv_pbuf: invalid p", p != NULL,
+             set_errno(err_to_errno(ERR_ARG)); return -1;);
+  LWIP_ERROR("lwip_recv_pbuf: unsupported flags", (flags & ~MSG_DONTWAIT) == 0,
+             set_errno(EOPNOTSUPP); return -1;);
+  *p = NULL;
+
+  sock = get_socket(s);
+  if (!sock) {
+    return -1;
+  }
+
+  apiflags = (flags & MSG_DONTWAIT) ? NETCONN_DONTBLOCK : 0;
+#if LWIP_TCP
+  if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+    struct pbuf *q = sock->lastdata.pbuf;
+    if (q != NULL) {
+      sock->lastdata.pbuf = NULL;
+    } else {
+      err = netconn_recv_tcp_pbuf_flags(sock->conn, &q, (u8_t)(apiflags | NETCONN_NOAUTORCVD));
+      if (err != ERR_OK) {
+        LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recv_pbuf(%d): error is \"%s\"!\n", s, lwip_strerr(err)));
+        set_errno(err_to_errno(err));
+        done_socket(sock);
+        return (err == ERR_CLSD) ? 0 : -1;
+      }
+    }
+    ret = q->tot_len;
+    netconn_tcp_recvd(sock->conn, (size_t)ret);
+    lwip_recv_tcp_from(sock, from, fromlen, "lwip_recv_pbuf", s, ret);
+    *p = q;
+  } else
+#endif /* LWIP_TCP */
+  {
+#if LWIP_UDP || LWIP_RAW
+    struct netbuf *buf = sock->lastdata.netbuf;
+    if (buf != NULL) {
+      sock->lastdata.netbuf = NULL;
+    } else {
+      err = netconn_recv_udp_raw_netbuf_flags(sock->conn, &buf, apiflags);
+      if (err != ERR_OK) {
+        LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recv_pbuf(%d): error is \"%s\"!\n", s, lwip_strerr(err)));
+        set_errno(err_to_errno(err));
+        done_socket(sock);
+        return -1;
+      }
+    }
+    if (from && fromlen) {
+      lwip_sock_make_addr(sock->conn, netbuf_fromaddr(buf), netbuf_fromport(buf), from, fromlen);
+    }
+    /* hand out the pbuf and free only the netbuf */
+    *p = buf->p;
+    buf->p = buf->ptr = NULL;
+    netbuf_delete(buf);
+    ret = (*p)->tot_len;
+#else /* LWIP_UDP || LWIP_RAW */
+    LWIP_UNUSED_ARG(from);
+    LWIP_UNUSED_ARG(fromlen);
+    set_errno(err_to_errno(ERR_ARG));
+    done_socket(sock);
+    return -1;
+#endif /* LWIP_UDP || LWIP_RAW */
+  }
+
+  set_errno(0);
+  done_socket(sock);
+  return ret;
+}
+#endif /* LWIP_ZEROCOPY */
+
 ssize_t
 lwip_send(int s, const void *data, size_t size, int flags)
 {
@@ -1456,6 +1678,103 @@ lwip_send(int s, const void *data, size_t size, int flags)
   return (err == ERR_OK ? (ssize_t)written : -1);
 }
 
+#if LWIP_UDP || LWIP_RAW
+/* Helper function to build the datagram of a msghdr for a udp or raw netconn.
+ * chain_buf must be zeroed by the caller and freed with netbuf_free() also
+ * when this fails. Returns 0 or an errno value.
+ */
+static int
+lwip_sendmsg_fill_netbuf(const struct msghdr *msg, struct netbuf *chain_buf)
+{
+  msg_iovlen_t i;
+#if LWIP_NETIF_TX_SINGLE_PBUF
+  ssize_t size = 0;
+#endif /* LWIP_NETIF_TX_SINGLE_PBUF */
+
+  if ((msg->msg_iov == NULL) || (msg->msg_iovlen <= 0) || (msg->msg_iovlen > IOV_MAX)) {
+    return EMSGSIZE;
+  }
+  LWIP_ERROR("lwip_sendmsg: invalid msghdr name", (((msg->msg_name == NULL) && (msg->msg_namelen == 0)) ||
+             IS_SOCK_ADDR_LEN_VALID(msg->msg_namelen)),
+             return err_to_errno(ERR_ARG););
+
+  /* initialize chain buffer with destination */
+  if (msg->msg_name) {
+    u16_t remote_port;
+    SOCKADDR_TO_IPADDR_PORT((const struct sockaddr *)msg->msg_name, &chain_buf->addr, remote_port);
+    netbuf_fromport(chain_buf) = remote_port;
+  }
+#if LWIP_NETIF_TX_SINGLE_PBUF
+  for (i = 0; i < msg->msg_iovlen; i++) {
+    size += msg->msg_iov[i].iov_len;
+    if ((msg->msg_iov[i].iov_len > INT_MAX) || (size < (int)msg->msg_iov[i].iov_len)) {
+      /* overflow */
+      return EMSGSIZE;
+    }
+  }
+  if (size > 0xFFFF) {
+    /* overflow */
+    return EMSGSIZE;
+  }
+  /* Allocate a new netbuf and copy the data into it. */
+  if (netbuf_alloc(chain_buf, (u16_t)size) == NULL) {
+    return err_to_errno(ERR_MEM);
+  } else {
+    /* flatten the IO vectors */
+    size_t offset = 0;
+    for (i = 0; i < msg->msg_iovlen; i++) {
+      MEMCPY(&((u8_t *)chain_buf->p->payload)[offset], msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+      offset += msg->msg_iov[i].iov_len;
+    }
+#if LWIP_CHECKSUM_ON_COPY
+    {
+      /* This can be improved by using LWIP_CHKSUM_COPY() and aggregating the checksum for each IO vector */
+      u16_t chksum = ~inet_chksum_pbuf(chain_buf->p);
+      netbuf_set_chksum(chain_buf, chksum);
+    }
+#endif /* LWIP_CHECKSUM_ON_COPY */
+  }
+#else /* LWIP_NETIF_TX_SINGLE_PBUF */
+  /* create a chained netbuf from the IO vectors. NOTE: we assemble a pbuf chain
+     manually to avoid having to allocate, chain, and delete a netbuf for each iov */
+  for (i = 0; i < msg->msg_iovlen; i++) {
+    struct pbuf *p;
+    if (msg->msg_iov[i].iov_len > 0xFFFF) {
+      /* overflow */
+      return EMSGSIZE;
+    }
+    p = pbuf_alloc(PBUF_TRANSPORT, 0, PBUF_REF);
+    if (p == NULL) {
+      return err_to_errno(ERR_MEM); /* let netbuf_free() cleanup chain_buf */
+    }
+    p->payload = msg->msg_iov[i].iov_base;
+    p->len = p->tot_len = (u16_t)msg->msg_iov[i].iov_len;
+    /* netbuf empty, add new pbuf */
+    if (chain_buf->p == NULL) {
+      chain_buf->p = chain_buf->ptr = p;
+      /* add pbuf to existing pbuf chain */
+    } else {
+      if (chain_buf->p->tot_len + p->len > 0xffff) {
+        /* overflow */
+        pbuf_free(p);
+        return EMSGSIZE;
+      }
+      pbuf_cat(chain_buf->p, p);
+    }
+  }
+#endif /* LWIP_NETIF_TX_SINGLE_PBUF */
+
+#if LWIP_IPV4 && LWIP_IPV6
+  /* Dual-stack: Unmap IPv4 mapped IPv6 addresses */
+  if (IP_IS_V6_VAL(chain_buf->addr) && ip6_addr_isipv4mappedipv6(ip_2_ip6(&chain_buf->addr))) {
+    unmap_ipv4_mapped_ipv6(ip_2_ip4(&chain_buf->addr), ip_2_ip6(&chain_buf->addr));
+    IP_SET_TYPE_VAL(chain_buf->addr, IPADDR_TYPE_V4);
+  }
+#endif /* LWIP_IPV4 && LWIP_IPV6 */
+  return 0;
+}
+#endif /* LWIP_UDP || LWIP_RAW */
+
 ssize_t
 lwip_sendmsg(int s, const struct msghdr *msg, int flags)
 {
@@ -1506,111 +1825,26 @@ lwip_sendmsg(int s, const struct msghdr *msg, int flags)
 #if LWIP_UDP || LWIP_RAW
   {
     struct netbuf chain_buf;
-    msg_iovlen_t i;
     ssize_t size = 0;
+    int ret;
 
     LWIP_UNUSED_ARG(flags);
-    LWIP_ERROR("lwip_sendmsg: invalid msghdr name", (((msg->msg_name == NULL) && (msg->msg_namelen == 0)) ||
-               IS_SOCK_ADDR_LEN_VALID(msg->msg_namelen)),
-               set_errno(err_to_errno(ERR_ARG)); done_socket(sock); return -1;);
 
-    /* initialize chain buffer with destination */
     memset(&chain_buf, 0, sizeof(struct netbuf));
-    if (msg->msg_name) {
-      u16_t remote_port;
-      SOCKADDR_TO_IPADDR_PORT((const struct sockaddr *)msg->msg_name, &chain_buf.addr, remote_port);
-      netbuf_fromport(&chain_buf) = remote_port;
-    }
-#if LWIP_NETIF_TX_SINGLE_PBUF
-    for (i = 0; i < msg->msg_iovlen; i++) {
-      size += msg->msg_iov[i].iov_len;
-      if ((msg->msg_iov[i].iov_len > INT_MAX) || (size < (int)msg->msg_iov[i].iov_len)) {
-        /* overflow */
-        goto sendmsg_emsgsize;
-      }
-    }
-    if (size > 0xFFFF) {
-      /* overflow */
-      goto sendmsg_emsgsize;
-    }
-    /* Allocate a new netbuf and copy the data into it. */
-    if (netbuf_alloc(&chain_buf, (u16_t)size) == NULL) {
-      err = ERR_MEM;
-    } else {
-      /* flatten the IO vectors */
-      size_t offset = 0;
-      for (i = 0; i < msg->msg_iovlen; i++) {
-        MEMCPY(&((u8_t *)chain_buf.p->payload)[offset], msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
-        offset += msg->msg_iov[i].iov_len;
-      }
-#if LWIP_CHECKSUM_ON_COPY
-      {
-        /* This can be improved by using LWIP_CHKSUM_COPY() and aggregating the checksum for each IO vector */
-        u16_t chksum = ~inet_chksum_pbuf(chain_buf.p);
-        netbuf_set_chksum(&chain_buf, chksum);
-      }
-#endif /* LWIP_CHECKSUM_ON_COPY */
-      err = ERR_OK;
-    }
-#else /* LWIP_NETIF_TX_SINGLE_PBUF */
-    /* create a chained netbuf from the IO vectors. NOTE: we assemble a pbuf chain
-       manually to avoid having to allocate, chain, and delete a netbuf for each iov */
-    for (i = 0; i < msg->msg_iovlen; i++) {
-      struct pbuf *p;
-      if (msg->msg_iov[i].iov_len > 0xFFFF) {
-        /* overflow */
-        goto sendmsg_emsgsize;
-      }
-      p = pbuf_alloc(PBUF_TRANSPORT, 0, PBUF_REF);
-      if (p == NULL) {
-        err = ERR_MEM; /* let netbuf_delete() cleanup chain_buf */
-        break;
-      }
-      p->payload = msg->msg_iov[i].iov_base;
-      p->len = p->tot_len = (u16_t)msg->msg_iov[i].iov_len;
-      /* netbuf empty, add new pbuf */
-      if (chain_buf.p == NULL) {
-        chain_buf.p = chain_buf.ptr = p;
-        /* add pbuf to existing pbuf chain */
-      } else {
-        if (chain_buf.p->tot_len + p->len > 0xffff) {
-          /* overflow */
-          pbuf_free(p);
-          goto sendmsg_emsgsize;
-        }
-        pbuf_cat(chain_buf.p, p);
-      }
-    }
-    /* save size of total chain */
-    if (err == ERR_OK) {
+    ret = lwip_sendmsg_fill_netbuf(msg, &chain_buf);
+    if (ret == 0) {
       size = netbuf_len(&chain_buf);
-    }
-#endif /* LWIP_NETIF_TX_SINGLE_PBUF */
-
-    if (err == ERR_OK) {
-#if LWIP_IPV4 && LWIP_IPV6
-      /* Dual-stack: Unmap IPv4 mapped IPv6 addresses */
-      if (IP_IS_V6_VAL(chain_buf.addr) && ip6_addr_isipv4mappedipv6(ip_2_ip6(&chain_buf.addr))) {
-        unmap_ipv4_mapped_ipv6(ip_2_ip4(&chain_buf.addr), ip_2_ip6(&chain_buf.addr));
-        IP_SET_TYPE_VAL(chain_buf.addr, IPADDR_TYPE_V4);
-      }
-#endif /* LWIP_IPV4 && LWIP_IPV6 */
-
       /* send the data */
       err = netconn_send(sock->conn, &chain_buf);
+      ret = err_to_errno(err);
     }
 
     /* deallocated the buffer */
     netbuf_free(&chain_buf);
 
-    set_errno(err_to_errno(err));
-    done_socket(sock);
-    return (err == ERR_OK ? size : -1);
-sendmsg_emsgsize:
-    set_errno(EMSGSIZE);
-    netbuf_free(&chain_buf);
+    set_errno(ret);
     done_socket(sock);
-    return -1;
+    return (ret == 0 ? size : -1);
   }
 #else /* LWIP_UDP || LWIP_RAW */
   set_errno(err_to_errno(ERR_ARG));
@@ -1619,15 +1853,30 @@ sendmsg_emsgsize:
 #endif /* LWIP_UDP || LWIP_RAW */
 }
 
-ssize_t
-lwip_sendto(int s, const void *data, size_t size, int flags,
-            const struct sockaddr *to, socklen_t tolen)
+/**
+ * @ingroup socket
+ * Send up to vlen messages with one call, like sendmmsg() on Linux.
+ * On datagram sockets, up to LWIP_SOCKET_MMSG_BATCH datagrams are passed to
+ * the tcpip_thread at once. Sending stops at the first datagram that fails.
+ * On stream sockets, this behaves like consecutive calls to lwip_sendmsg().
+ *
+ * @return the number of messages sent (their msg_len set to the number of
+ *         bytes sent), or -1 with errno set if none was sent
+ */
+int
+lwip_sendmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags)
 {
   struct lwip_sock *sock;
-  err_t err;
-  u16_t short_size;
-  u16_t remote_port;
-  struct netbuf buf;
+  unsigned int sent = 0;
+#if LWIP_UDP || LWIP_RAW
+  int err = 0;
+#endif /* LWIP_UDP || LWIP_RAW */
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_sendmmsg(%d, msgvec=%p, vlen=%u, flags=0x%x)\n", s, (void *)msgvec, vlen, flags));
+  LWIP_ERROR("lwip_sendmmsg: invalid msgvec", (msgvec != NULL) || (vlen == 0),
+             set_errno(err_to_errno(ERR_ARG)); return -1;);
+  LWIP_ERROR("lwip_sendmmsg: unsupported flags", (flags & ~(MSG_DONTWAIT | MSG_MORE)) == 0,
+             set_errno(EOPNOTSUPP); return -1;);
 
   sock = get_socket(s);
   if (!sock) {
@@ -1635,21 +1884,97 @@ lwip_sendto(int s, const void *data, size_t size, int flags,
   }
 
   if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
-#if LWIP_TCP
-    done_socket(sock);
-    return lwip_send(s, data, size, flags);
-#else /* LWIP_TCP */
-    LWIP_UNUSED_ARG(flags);
-    set_errno(err_to_errno(ERR_ARG));
     done_socket(sock);
-    return -1;
-#endif /* LWIP_TCP */
+    for (; sent < vlen; sent++) {
+      ssize_t ret = lwip_sendmsg(s, &msgvec[sent].msg_hdr, flags);
+      if (ret < 0) {
+        break;
+      }
+      msgvec[sent].msg_len = (unsigned int)ret;
+    }
+    return ((sent > 0) || (vlen == 0)) ? (int)sent : -1;
   }
+  /* else, UDP and RAW NETCONNs */
+#if LWIP_UDP || LWIP_RAW
+  while ((sent < vlen) && (err == 0)) {
+    struct netbuf bufs[LWIP_SOCKET_MMSG_BATCH];
+    struct netbuf *buf_ptrs[LWIP_SOCKET_MMSG_BATCH];
+    u16_t count, batch_sent, i;
+    err_t send_err;
+
+    /* build the datagrams of one batch */
+    for (count = 0; (count < LWIP_SOCKET_MMSG_BATCH) && (sent + count < vlen); count++) {
+      memset(&bufs[count], 0, sizeof(struct netbuf));
+      buf_ptrs[count] = &bufs[count];
+      err = lwip_sendmsg_fill_netbuf(&msgvec[sent + count].msg_hdr, &bufs[count]);
+      if (err != 0) {
+        netbuf_free(&bufs[count]);
+        break;
+      }
+    }
+    if (count == 0) {
+      break;
+    }
 
-  if (size > LWIP_MIN(0xFFFF, SSIZE_MAX)) {
-    /* cannot fit into one datagram (at least for us) */
-    set_errno(EMSGSIZE);
-    done_socket(sock);
+    /* send them with one message to the tcpip_thread */
+    send_err = netconn_send_multi(sock->conn, buf_ptrs, count, &batch_sent);
+    if (send_err != ERR_OK) {
+      err = err_to_errno(send_err);
+    }
+    for (i = 0; i < count; i++) {
+      if (i < batch_sent) {
+        msgvec[sent + i].msg_len = netbuf_len(&bufs[i]);
+      }
+      netbuf_free(&bufs[i]);
+    }
+    sent += batch_sent;
+  }
+
+  done_socket(sock);
+  if ((sent == 0) && (err != 0)) {
+    set_errno(err);
+    return -1;
+  }
+  set_errno(0);
+  return (int)sent;
+#else /* LWIP_UDP || LWIP_RAW */
+  set_errno(err_to_errno(ERR_ARG));
+  done_socket(sock);
+  return -1;
+#endif /* LWIP_UDP || LWIP_RAW */
+}
+
+ssize_t
+lwip_sendto(int s, const void *data, size_t size, int flags,
+            const struct sockaddr *to, socklen_t tolen)
+{
+  struct lwip_sock *sock;
+  err_t err;
+  u16_t short_size;
+  u16_t remote_port;
+  struct netbuf buf;
+
+  sock = get_socket(s);
+  if (!sock) {
+    return -1;
+  }
+
+  if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+#if LWIP_TCP
+    done_socket(sock);
+    return lwip_send(s, data, size, flags);
+#else /* LWIP_TCP */
+    LWIP_UNUSED_ARG(flags);
+    set_errno(err_to_errno(ERR_ARG));
+    done_socket(sock);
+    return -1;
+#endif /* LWIP_TCP */
+  }
+
+  if (size > LWIP_MIN(0xFFFF, SSIZE_MAX)) {
+    /* cannot fit into one datagram (at least for us) */
+    set_errno(EMSGSIZE);
+    done_socket(sock);
     return -1;
   }
   short_size = (u16_t)size;
@@ -1719,6 +2044,111 @@ lwip_sendto(int s, const void *data, size_t size, int flags,
   return (err == ERR_OK ? short_size : -1);
 }
 
+#if LWIP_ZEROCOPY
+/**
+ * @ingroup socket
+ * Send the data of a pbuf chain without copying it (see lwip_sendto_pbuf()).
+ */
+ssize_t
+lwip_send_pbuf(int s, struct pbuf *p, int flags)
+{
+  return lwip_sendto_pbuf(s, p, flags, NULL, 0);
+}
+
+/**
+ * @ingroup socket
+ * Send the data of a pbuf chain without copying it. The stack takes its own
+ * references on the pbufs for as long as it needs them (on stream sockets
+ * until the data is ACKed), so the caller releases its reference with
+ * pbuf_free() whenever it likes, also right after this call, but must not
+ * change the data any more. On datagram sockets, headers may be prepended to
+ * the payload of p. A pbuf_custom can be used to learn when the stack is done.
+ * On stream sockets, only MSG_MORE and MSG_DONTWAIT are supported as flags
+ * (and a partial write may be returned as with lwip_send()).
+ *
+ * @return the number of bytes sent or -1 with errno set
+ */
+ssize_t
+lwip_sendto_pbuf(int s, struct pbuf *p, int flags, const struct sockaddr *to, socklen_t tolen)
+{
+  struct lwip_sock *sock;
+  err_t err;
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_sendto_pbuf(%d, p=%p, flags=0x%x)\n", s, (void *)p, flags));
+  LWIP_ERROR("lwip_sendto_pbuf: invalid p", p != NULL,
+             set_errno(err_to_errno(ERR_ARG)); return -1;);
+
+  sock = get_socket(s);
+  if (!sock) {
+    return -1;
+  }
+
+  if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+#if LWIP_TCP
+    u8_t write_flags = (u8_t)(((flags & MSG_MORE)     ? NETCONN_MORE      : 0) |
+                              ((flags & MSG_DONTWAIT) ? NETCONN_DONTBLOCK : 0));
+    size_t written = 0;
+
+    err = netconn_write_pbuf(sock->conn, p, write_flags, &written);
+    LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_sendto_pbuf(%d) err=%d written=%"SZT_F"\n", s, err, written));
+    set_errno(err_to_errno(err));
+    done_socket(sock);
+    return (err == ERR_OK ? (ssize_t)written : -1);
+#else /* LWIP_TCP */
+    set_errno(err_to_errno(ERR_ARG));
+    done_socket(sock);
+    return -1;
+#endif /* LWIP_TCP */
+  }
+
+#if LWIP_UDP || LWIP_RAW
+  {
+    struct netbuf buf;
+    u16_t remote_port;
+    u16_t size = p->tot_len;
+
+    LWIP_ERROR("lwip_sendto_pbuf: invalid address", (((to == NULL) && (tolen == 0)) ||
+               (IS_SOCK_ADDR_LEN_VALID(tolen) &&
+                ((to != NULL) && (IS_SOCK_ADDR_TYPE_VALID(to) && IS_SOCK_ADDR_ALIGNED(to))))),
+               set_errno(err_to_errno(ERR_ARG)); done_socket(sock); return -1;);
+    LWIP_UNUSED_ARG(tolen);
+
+    /* the netbuf only borrows p, the caller keeps its reference */
+    buf.p = buf.ptr = p;
+#if LWIP_CHECKSUM_ON_COPY
+    buf.flags = 0;
+#endif /* LWIP_CHECKSUM_ON_COPY */
+    if (to) {
+      SOCKADDR_TO_IPADDR_PORT(to, &buf.addr, remote_port);
+    } else {
+      remote_port = 0;
+      ip_addr_set_any(NETCONNTYPE_ISIPV6(netconn_type(sock->conn)), &buf.addr);
+    }
+    netbuf_fromport(&buf) = remote_port;
+#if LWIP_IPV4 && LWIP_IPV6
+    /* Dual-stack: Unmap IPv4 mapped IPv6 addresses */
+    if (IP_IS_V6_VAL(buf.addr) && ip6_addr_isipv4mappedipv6(ip_2_ip6(&buf.addr))) {
+      unmap_ipv4_mapped_ipv6(ip_2_ip4(&buf.addr), ip_2_ip6(&buf.addr));
+      IP_SET_TYPE_VAL(buf.addr, IPADDR_TYPE_V4);
+    }
+#endif /* LWIP_IPV4 && LWIP_IPV6 */
+
+    err = netconn_send(sock->conn, &buf);
+
+    set_errno(err_to_errno(err));
+    done_socket(sock);
+    return (err == ERR_OK ? size : -1);
+  }
+#else /* LWIP_UDP || LWIP_RAW */
+  LWIP_UNUSED_ARG(to);
+  LWIP_UNUSED_ARG(tolen);
+  set_errno(err_to_errno(ERR_ARG));
+  done_socket(sock);
+  return -1;
+#endif /* LWIP_UDP || LWIP_RAW */
+}
+#endif /* LWIP_ZEROCOPY */
+
 int
 lwip_socket(int domain, int type, int protocol)
 {
@@ -2505,6 +2935,478 @@ lwip_poll_should_wake(const struct lwip_select_cb *scb, int fd, int has_recveven
 }
 #endif /* LWIP_SOCKET_POLL */
 
+#if LWIP_SOCKET_EPOLL
+/** Translate an epoll descriptor into a pointer (does not set errno) */
+static struct lwip_epoll *
+get_epoll(int epfd)
+{
+  int i = epfd - LWIP_EPOLL_OFFSET;
+  if ((i < 0) || (i >= LWIP_SOCKET_EPOLL_NUM) || !epolls[i].used) {
+    return NULL;
+  }
+  return &epolls[i];
+}
+
+/** Events of a socket in epoll terms (called under SYS_ARCH_PROTECT) */
+static u32_t
+lwip_epoll_sock_events(const struct lwip_sock *sock)
+{
+  u32_t events = 0;
+  if ((sock->lastdata.pbuf != NULL) || (sock->rcvevent > 0)) {
+    events |= EPOLLIN;
+  }
+  if (sock->sendevent != 0) {
+    events |= EPOLLOUT;
+  }
+  if (sock->errevent != 0) {
+    events |= EPOLLERR;
+  }
+  return events;
+}
+
+/** Events reported for a registration: EPOLLERR is always reported
+ * unless the registration was disabled by EPOLLONESHOT */
+static u32_t
+lwip_epoll_item_mask(const struct lwip_epoll_item *item)
+{
+  if (item->events == 0) {
+    return 0;
+  }
+  return (item->events & (EPOLLIN | EPOLLOUT)) | EPOLLERR;
+}
+
+/**
+ * Put a registration on the ready list of its epoll instance if the socket
+ * has events for it. Called under SYS_ARCH_PROTECT like all epoll list
+ * accesses.
+ *
+ * @return 1 if the caller has to signal the semaphore of the instance
+ */
+static int
+lwip_epoll_item_check(struct lwip_epoll_item *item)
+{
+  struct lwip_epoll *ep = item->ep;
+
+  if (item->ready || ((lwip_epoll_sock_events(item->sock) & lwip_epoll_item_mask(item)) == 0)) {
+    return 0;
+  }
+  item->ready = 1;
+  item->ready_next = NULL;
+  if (ep->ready_tail != NULL) {
+    ep->ready_tail->ready_next = item;
+  } else {
+    ep->ready_head = item;
+  }
+  ep->ready_tail = item;
+  if (ep->waiting && !ep->sem_signalled) {
+    ep->sem_signalled = 1;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * Called from event_callback for new events of a socket.
+ * As for select_check_waiters(), the core lock is held for LWIP_TCPIP_CORE_LOCKING.
+ */
+static void
+lwip_epoll_notify(struct lwip_sock *sock)
+{
+  struct lwip_epoll_item *item;
+#if LWIP_TCPIP_CORE_LOCKING
+  /* a socket is registered at most once per instance */
+  struct lwip_epoll *wake[LWIP_SOCKET_EPOLL_NUM];
+  int nwake = 0;
+#endif /* LWIP_TCPIP_CORE_LOCKING */
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  LWIP_ASSERT_CORE_LOCKED();
+
+  if (sock->epoll_items == NULL) {
+    /* not registered anywhere */
+    return;
+  }
+  SYS_ARCH_PROTECT(lev);
+  for (item = sock->epoll_items; item != NULL; item = item->sock_next) {
+    if (lwip_epoll_item_check(item)) {
+#if LWIP_TCPIP_CORE_LOCKING
+      wake[nwake++] = item->ep;
+#else /* LWIP_TCPIP_CORE_LOCKING */
+      /* Like select_check_waiters(), signal while still protected, so that
+         the instance cannot be closed in between. */
+      sys_sem_signal(&item->ep->sem);
+#endif /* LWIP_TCPIP_CORE_LOCKING */
+    }
+  }
+  SYS_ARCH_UNPROTECT(lev);
+#if LWIP_TCPIP_CORE_LOCKING
+  /* lwip_epoll_close() takes the core lock before freeing the semaphore, so
+     signal unprotected: the woken thread does not have to wait for us */
+  while (nwake > 0) {
+    sys_sem_signal(&wake[--nwake]->sem);
+  }
+#endif /* LWIP_TCPIP_CORE_LOCKING */
+}
+
+/** Remove a registration from all lists (called under SYS_ARCH_PROTECT) */
+static void
+lwip_epoll_item_unlink(struct lwip_epoll_item *item)
+{
+  struct lwip_epoll *ep = item->ep;
+  struct lwip_epoll_item **pitem;
+
+  for (pitem = &item->sock->epoll_items; *pitem != item; pitem = &(*pitem)->sock_next) {
+    LWIP_ASSERT("item not registered for its socket", *pitem != NULL);
+  }
+  *pitem = item->sock_next;
+
+  if (item->prev != NULL) {
+    item->prev->next = item->next;
+  } else {
+    ep->items = item->next;
+  }
+  if (item->next != NULL) {
+    item->next->prev = item->prev;
+  }
+
+  if (item->ready) {
+    struct lwip_epoll_item *prev = NULL;
+    for (pitem = &ep->ready_head; *pitem != item; pitem = &prev->ready_next) {
+      LWIP_ASSERT("item not on the ready list", *pitem != NULL);
+      prev = *pitem;
+    }
+    *pitem = item->ready_next;
+    if (ep->ready_tail == item) {
+      ep->ready_tail = prev;
+    }
+    item->ready = 0;
+  }
+}
+
+/** Free registrations chained by sock_next after they have been unlinked */
+static void
+lwip_epoll_free_items(struct lwip_epoll_item *items)
+{
+  while (items != NULL) {
+    struct lwip_epoll_item *next = items->sock_next;
+    memp_free(MEMP_EPOLL_ITEM, items);
+    items = next;
+  }
+}
+
+/** Remove a socket from all epoll instances, called by lwip_close */
+static void
+lwip_epoll_drop_socket(struct lwip_sock *sock)
+{
+  struct lwip_epoll_item *items = NULL;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  SYS_ARCH_PROTECT(lev);
+  while (sock->epoll_items != NULL) {
+    struct lwip_epoll_item *item = sock->epoll_items;
+    lwip_epoll_item_unlink(item);
+    item->sock_next = items;
+    items = item;
+  }
+  SYS_ARCH_UNPROTECT(lev);
+
+  lwip_epoll_free_items(items);
+}
+
+/** Free an epoll instance and its registrations, called by lwip_close */
+static int
+lwip_epoll_close(struct lwip_epoll *ep)
+{
+  struct lwip_epoll_item *items = NULL;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+#if LWIP_TCPIP_CORE_LOCKING
+  /* wait for event_callback to finish signalling this instance */
+  LOCK_TCPIP_CORE();
+#endif /* LWIP_TCPIP_CORE_LOCKING */
+  SYS_ARCH_PROTECT(lev);
+  LWIP_ASSERT("closing an epoll instance with threads waiting", ep->waiting == 0);
+  while (ep->items != NULL) {
+    struct lwip_epoll_item *item = ep->items;
+    lwip_epoll_item_unlink(item);
+    item->sock_next = items;
+    items = item;
+  }
+  SYS_ARCH_UNPROTECT(lev);
+#if LWIP_TCPIP_CORE_LOCKING
+  UNLOCK_TCPIP_CORE();
+#endif /* LWIP_TCPIP_CORE_LOCKING */
+
+  lwip_epoll_free_items(items);
+  sys_sem_free(&ep->sem);
+
+  SYS_ARCH_PROTECT(lev);
+  ep->used = 0;
+  SYS_ARCH_UNPROTECT(lev);
+  set_errno(0);
+  return 0;
+}
+
+/**
+ * Create an epoll instance, to be freed with lwip_close().
+ *
+ * @param size ignored (must be > 0 like for epoll_create)
+ * @return the epoll descriptor; -1 on error
+ */
+int
+lwip_epoll_create(int size)
+{
+  int i;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_epoll_create(%d)\n", size));
+  LWIP_ERROR("lwip_epoll_create: invalid size", size > 0, set_errno(EINVAL); return -1;);
+
+  for (i = 0; i < LWIP_SOCKET_EPOLL_NUM; i++) {
+    SYS_ARCH_PROTECT(lev);
+    if (!epolls[i].used) {
+      epolls[i].used = 1;
+      SYS_ARCH_UNPROTECT(lev);
+      /* Not registered in any socket yet, so no need to protect. */
+      epolls[i].items = NULL;
+      epolls[i].ready_head = NULL;
+      epolls[i].ready_tail = NULL;
+      epolls[i].waiting = 0;
+      epolls[i].sem_signalled = 0;
+      if (sys_sem_new(&epolls[i].sem, 0) != ERR_OK) {
+        epolls[i].used = 0;
+        set_errno(ENOMEM);
+        return -1;
+      }
+      set_errno(0);
+      return i + LWIP_EPOLL_OFFSET;
+    }
+    SYS_ARCH_UNPROTECT(lev);
+  }
+  set_errno(EMFILE);
+  return -1;
+}
+
+/**
+ * Register, modify or remove a socket in an epoll instance.
+ * Supported events are EPOLLIN, EPOLLOUT and EPOLLERR (always reported)
+ * with EPOLLET and EPOLLONESHOT; sockets are removed by lwip_close().
+ *
+ * @param epfd epoll descriptor returned by lwip_epoll_create()
+ * @param op EPOLL_CTL_ADD, EPOLL_CTL_MOD or EPOLL_CTL_DEL
+ * @param fd socket
+ * @param event events to wait for and user data to return (unused for EPOLL_CTL_DEL)
+ * @return 0 on success; -1 on error
+ */
+int
+lwip_epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+  struct lwip_epoll *ep;
+  struct lwip_sock *sock;
+  struct lwip_epoll_item *item, *free_item = NULL;
+  int err = 0, do_signal = 0;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_epoll_ctl(%d, %d, %d)\n", epfd, op, fd));
+  ep = get_epoll(epfd);
+  if (ep == NULL) {
+    set_errno(EBADF);
+    return -1;
+  }
+  LWIP_ERROR("lwip_epoll_ctl: invalid event", (op == EPOLL_CTL_DEL) || (event != NULL),
+             set_errno(EFAULT); return -1;);
+
+  sock = get_socket(fd);
+  if (!sock) {
+    return -1;
+  }
+  if (op == EPOLL_CTL_ADD) {
+    free_item = (struct lwip_epoll_item *)memp_malloc(MEMP_EPOLL_ITEM);
+    if (free_item == NULL) {
+      set_errno(ENOMEM);
+      done_socket(sock);
+      return -1;
+    }
+  }
+
+  SYS_ARCH_PROTECT(lev);
+  for (item = sock->epoll_items; item != NULL; item = item->sock_next) {
+    if (item->ep == ep) {
+      break;
+    }
+  }
+  switch (op) {
+    case EPOLL_CTL_ADD:
+      if (item != NULL) {
+        err = EEXIST;
+        break;
+      }
+      item = free_item;
+      free_item = NULL;
+      item->ep = ep;
+      item->sock = sock;
+      item->ready = 0;
+      item->sock_next = sock->epoll_items;
+      sock->epoll_items = item;
+      item->prev = NULL;
+      item->next = ep->items;
+      if (ep->items != NULL) {
+        ep->items->prev = item;
+      }
+      ep->items = item;
+      item->events = event->events;
+      item->data = event->data;
+      /* report events that happened before */
+      do_signal = lwip_epoll_item_check(item);
+      break;
+    case EPOLL_CTL_MOD:
+      if (item == NULL) {
+        err = ENOENT;
+        break;
+      }
+      item->events = event->events;
+      item->data = event->data;
+      do_signal = lwip_epoll_item_check(item);
+      break;
+    case EPOLL_CTL_DEL:
+      if (item == NULL) {
+        err = ENOENT;
+        break;
+      }
+      lwip_epoll_item_unlink(item);
+      free_item = item;
+      break;
+    default:
+      err = EINVAL;
+      break;
+  }
+  SYS_ARCH_UNPROTECT(lev);
+
+  if (do_signal) {
+    sys_sem_signal(&ep->sem);
+  }
+  if (free_item != NULL) {
+    memp_free(MEMP_EPOLL_ITEM, free_item);
+  }
+  done_socket(sock);
+  set_errno(err);
+  return (err == 0) ? 0 : -1;
+}
+
+/**
+ * Take registrations off the ready list and report their events.
+ * Level-triggered registrations that had events go back to the end of the
+ * ready list, so the next wait checks them again. Registrations without
+ * events (any more) are dropped until event_callback queues them again.
+ * Called with the epoll lists protected.
+ */
+static int
+lwip_epoll_collect(struct lwip_epoll *ep, struct epoll_event *events, int maxevents)
+{
+  struct lwip_epoll_item *requeue_head = NULL, *requeue_tail = NULL;
+  int nready = 0;
+
+  while ((nready < maxevents) && (ep->ready_head != NULL)) {
+    struct lwip_epoll_item *item = ep->ready_head;
+    u32_t revents = lwip_epoll_sock_events(item->sock) & lwip_epoll_item_mask(item);
+
+    ep->ready_head = item->ready_next;
+    if (ep->ready_head == NULL) {
+      ep->ready_tail = NULL;
+    }
+    item->ready = 0;
+    if (revents != 0) {
+      events[nready].events = revents;
+      events[nready].data = item->data;
+      nready++;
+      if ((item->events & EPOLLONESHOT) != 0) {
+        /* disabled until the next EPOLL_CTL_MOD */
+        item->events = 0;
+      } else if ((item->events & EPOLLET) == 0) {
+        item->ready = 1;
+        item->ready_next = NULL;
+        if (requeue_tail != NULL) {
+          requeue_tail->ready_next = item;
+        } else {
+          requeue_head = item;
+        }
+        requeue_tail = item;
+      }
+    }
+  }
+  if (requeue_head != NULL) {
+    if (ep->ready_tail != NULL) {
+      ep->ready_tail->ready_next = requeue_head;
+    } else {
+      ep->ready_head = requeue_head;
+    }
+    ep->ready_tail = requeue_tail;
+  }
+  return nready;
+}
+
+/**
+ * Wait for events on the sockets registered in an epoll instance.
+ * Unlike lwip_select() and lwip_poll(), this only looks at the sockets
+ * that had events, not at all sockets registered.
+ *
+ * @param epfd epoll descriptor returned by lwip_epoll_create()
+ * @param events the events are stored here
+ * @param maxevents maximum number of events to return
+ * @param timeout timeout in milliseconds, -1 to wait forever, 0 to return immediately
+ * @return number of events stored in events; -1 on error
+ */
+int
+lwip_epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout)
+{
+  struct lwip_epoll *ep;
+  u32_t start = sys_now();
+  int nready;
+  SYS_ARCH_DECL_PROTECT(lev);
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_epoll_wait(%d, %p, %d, %d)\n",
+                              epfd, (void *)events, maxevents, timeout));
+  ep = get_epoll(epfd);
+  if (ep == NULL) {
+    set_errno(EBADF);
+    return -1;
+  }
+  LWIP_ERROR("lwip_epoll_wait: invalid events", (events != NULL) && (maxevents > 0),
+             set_errno(EINVAL); return -1;);
+
+  SYS_ARCH_PROTECT(lev);
+  for (;;) {
+    u32_t msectimeout = 0;
+
+    nready = lwip_epoll_collect(ep, events, maxevents);
+    if ((nready > 0) || (timeout == 0)) {
+      break;
+    }
+    if (timeout > 0) {
+      u32_t elapsed = sys_now() - start;
+      if (elapsed >= (u32_t)timeout) {
+        break;
+      }
+      msectimeout = (u32_t)timeout - elapsed;
+    }
+    ep->waiting++;
+    SYS_ARCH_UNPROTECT(lev);
+
+    /* A signal left over from a wait that timed out only costs another loop */
+    sys_arch_sem_wait(&ep->sem, msectimeout);
+
+    SYS_ARCH_PROTECT(lev);
+    ep->waiting--;
+    ep->sem_signalled = 0;
+  }
+  SYS_ARCH_UNPROTECT(lev);
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_epoll_wait: nready=%d\n", nready));
+  set_errno(0);
+  return nready;
+}
+#endif /* LWIP_SOCKET_EPOLL */
+
 #if LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL
 /**
  * Callback registered in the netconn layer for each socket-netconn.
@@ -2602,6 +3504,12 @@ event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len)
   } else {
     SYS_ARCH_UNPROTECT(lev);
   }
+#if LWIP_SOCKET_EPOLL
+  if ((evt != NETCONN_EVT_RCVMINUS) && (evt != NETCONN_EVT_SENDMINUS)) {
+    /* Queue the socket in the epoll instances it is registered in */
+    lwip_epoll_notify(sock);
+  }
+#endif /* LWIP_SOCKET_EPOLL */
   done_socket(sock);
 }
 
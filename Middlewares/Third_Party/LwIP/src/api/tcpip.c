@@ -49,6 +49,12 @@
 #include "lwip/pbuf.h"
 #include "lwip/etharp.h"
 #include "netif/ethernet.h"
+#if TCPIP_CHECKSUM_THREADS
+#include "lwip/inet_chksum.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/tcp.h"
+#include "lwip/prot/udp.h"
+#endif /* TCPIP_CHECKSUM_THREADS */
 
 #define TCPIP_MSG_VAR_REF(name)     API_VAR_REF(name)
 #define TCPIP_MSG_VAR_DECLARE(name) API_VAR_DECLARE(struct tcpip_msg, name)
@@ -65,6 +71,11 @@ static sys_mbox_t tcpip_mbox;
 sys_mutex_t lock_tcpip_core;
 #endif /* LWIP_TCPIP_CORE_LOCKING */
 
+#if TCPIP_CHECKSUM_THREADS
+/** One mbox per checksum offload thread, see TCPIP_CHECKSUM_THREADS */
+static sys_mbox_t tcpip_chksum_mbox[TCPIP_CHECKSUM_THREADS];
+#endif /* TCPIP_CHECKSUM_THREADS */
+
 static void tcpip_thread_handle_msg(struct tcpip_msg *msg);
 
 #if !LWIP_TIMERS
@@ -234,27 +245,261 @@ tcpip_thread_poll_one(void)
 }
 #endif
 
+#if TCPIP_CHECKSUM_THREADS
 /**
- * Pass a received packet to tcpip_thread for input processing
+ * Find the IPv4 header of a received packet before it is passed to input_fn.
  *
  * @param p the received packet
- * @param inp the network interface on which the packet was received
- * @param input_fn input function to call
+ * @param input_fn input function the packet is passed to
+ * @param link_hlen returns the offset of the IPv4 header in p
+ * @return the IPv4 header or NULL if p is no IPv4 packet (or too short)
  */
-err_t
-tcpip_inpkt(struct pbuf *p, struct netif *inp, netif_input_fn input_fn)
+static struct ip_hdr *
+tcpip_input_iphdr(struct pbuf *p, netif_input_fn input_fn, u16_t *link_hlen)
+{
+  struct ip_hdr *iphdr;
+  u16_t hlen = 0;
+
+#if LWIP_ETHERNET
+  if (input_fn == ethernet_input) {
+    struct eth_hdr *ethhdr = (struct eth_hdr *)p->payload;
+    u16_t type;
+
+    if (p->len < SIZEOF_ETH_HDR + IP_HLEN) {
+      return NULL;
+    }
+    type = ethhdr->type;
+    hlen = SIZEOF_ETH_HDR;
+#if ETHARP_SUPPORT_VLAN
+    if (type == PP_HTONS(ETHTYPE_VLAN)) {
+      struct eth_vlan_hdr *vlan = (struct eth_vlan_hdr *)(((u8_t *)ethhdr) + SIZEOF_ETH_HDR);
+      if (p->len < SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR + IP_HLEN) {
+        return NULL;
+      }
+      type = vlan->tpid;
+      hlen += SIZEOF_VLAN_HDR;
+    }
+#endif /* ETHARP_SUPPORT_VLAN */
+    if (type != PP_HTONS(ETHTYPE_IP)) {
+      return NULL;
+    }
+  } else
+#endif /* LWIP_ETHERNET */
+  {
+    LWIP_UNUSED_ARG(input_fn);
+    if (p->len < IP_HLEN) {
+      return NULL;
+    }
+  }
+  iphdr = (struct ip_hdr *)(((u8_t *)p->payload) + hlen);
+  if (IPH_V(iphdr) != 4) {
+    return NULL;
+  }
+  *link_hlen = hlen;
+  return iphdr;
+}
+
+/**
+ * Select the checksum thread for a received packet: the hash over addresses
+ * and ports keeps all packets of a flow on one thread (and thus in order).
+ *
+ * @return the thread index or -1 if the packet is passed to tcpip_thread directly
+ */
+static int
+tcpip_chksum_thread_index(struct pbuf *p, netif_input_fn input_fn)
+{
+  u16_t link_hlen, iphdr_hlen;
+  u32_t hash;
+  struct ip_hdr *iphdr = tcpip_input_iphdr(p, input_fn, &link_hlen);
+
+  if (iphdr == NULL) {
+    return -1;
+  }
+  hash = iphdr->src.addr ^ iphdr->dest.addr;
+  iphdr_hlen = IPH_HL_BYTES(iphdr);
+  if (((IPH_PROTO(iphdr) == IP_PROTO_TCP) || (IPH_PROTO(iphdr) == IP_PROTO_UDP)) &&
+      ((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) == 0) &&
+      (p->len >= link_hlen + iphdr_hlen + 4)) {
+    /* source and destination port are the first 4 bytes of TCP and UDP headers */
+    const u8_t *ports = ((const u8_t *)iphdr) + iphdr_hlen;
+    hash ^= ((u32_t)ports[0] << 24) | ((u32_t)ports[1] << 16) | ((u32_t)ports[2] << 8) | ports[3];
+  }
+  hash ^= hash >> 16;
+  hash ^= hash >> 8;
+  return (int)(hash % TCPIP_CHECKSUM_THREADS);
+}
+
+/**
+ * Verify the IPv4 header checksum and the TCP or UDP checksum of a received
+ * packet and set PBUF_FLAG_CHECKSUM_OK if both are correct, so that the core
+ * does not verify them again. Anything not checked here (fragments, other
+ * protocols, failing checksums) is left to the core as is.
+ */
+static void
+tcpip_chksum_verify(struct pbuf *p, struct netif *inp, netif_input_fn input_fn)
+{
+  u16_t link_hlen, iphdr_hlen, iphdr_len;
+  ip4_addr_t src, dest;
+  u8_t proto;
+  u8_t ok = 1;
+  struct ip_hdr *iphdr = tcpip_input_iphdr(p, input_fn, &link_hlen);
+
+  LWIP_UNUSED_ARG(inp);
+  if (iphdr == NULL) {
+    return;
+  }
+  iphdr_hlen = IPH_HL_BYTES(iphdr);
+  iphdr_len = lwip_ntohs(IPH_LEN(iphdr));
+  proto = IPH_PROTO(iphdr);
+  if ((iphdr_hlen < IP_HLEN) || (iphdr_len < iphdr_hlen) ||
+      (link_hlen + iphdr_hlen > p->len) || (link_hlen + iphdr_len > p->tot_len) ||
+      ((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0) ||
+      ((proto != IP_PROTO_TCP) && (proto != IP_PROTO_UDP))) {
+    return;
+  }
+#if CHECKSUM_CHECK_IP
+  IF__NETIF_CHECKSUM_ENABLED(inp, NETIF_CHECKSUM_CHECK_IP) {
+    if (inet_chksum(iphdr, iphdr_hlen) != 0) {
+      return;
+    }
+  }
+#endif /* CHECKSUM_CHECK_IP */
+  ip4_addr_copy(src, iphdr->src);
+  ip4_addr_copy(dest, iphdr->dest);
+
+  /* the transport checksum covers iphdr_len - iphdr_hlen bytes only: Ethernet
+     padding is trimmed later by ip4_input */
+  if (pbuf_remove_header(p, (size_t)link_hlen + iphdr_hlen)) {
+    return;
+  }
+  iphdr_len = (u16_t)(iphdr_len - iphdr_hlen);
+  if (proto == IP_PROTO_UDP) {
+#if CHECKSUM_CHECK_UDP
+    IF__NETIF_CHECKSUM_ENABLED(inp, NETIF_CHECKSUM_CHECK_UDP) {
+      if (p->len < UDP_HLEN) {
+        ok = 0;
+      } else if (((struct udp_hdr *)p->payload)->chksum != 0) {
+        /* a UDP checksum of 0 means 'none', udp_input accepts that, too */
+        ok = (inet_chksum_pseudo_partial(p, IP_PROTO_UDP, iphdr_len, iphdr_len, &src, &dest) == 0);
+      }
+    }
+#endif /* CHECKSUM_CHECK_UDP */
+  } else {
+#if CHECKSUM_CHECK_TCP
+    IF__NETIF_CHECKSUM_ENABLED(inp, NETIF_CHECKSUM_CHECK_TCP) {
+      ok = (inet_chksum_pseudo_partial(p, IP_PROTO_TCP, iphdr_len, iphdr_len, &src, &dest) == 0);
+    }
+#endif /* CHECKSUM_CHECK_TCP */
+  }
+  pbuf_add_header_force(p, (size_t)link_hlen + iphdr_hlen);
+  if (ok) {
+    p->flags |= PBUF_FLAG_CHECKSUM_OK;
+  }
+}
+
+/**
+ * Verify the checksums of a packet queued to a checksum thread and pass it on
+ * to tcpip_thread (or, with LWIP_TCPIP_CORE_LOCKING_INPUT, to the core under
+ * the core lock).
+ *
+ * @param msg the TCPIP_MSG_INPKT message fetched from the thread's mbox
+ */
+static void
+tcpip_chksum_thread_handle_msg(struct tcpip_msg *msg)
 {
+  LWIP_ASSERT("tcpip_chksum_thread: invalid message",
+              (msg != NULL) && (msg->type == TCPIP_MSG_INPKT));
+  tcpip_chksum_verify(msg->msg.inp.p, msg->msg.inp.netif, msg->msg.inp.input_fn);
 #if LWIP_TCPIP_CORE_LOCKING_INPUT
-  err_t ret;
-  LWIP_DEBUGF(TCPIP_DEBUG, ("tcpip_inpkt: PACKET %p/%p\n", (void *)p, (void *)inp));
   LOCK_TCPIP_CORE();
-  ret = input_fn(p, inp);
+  if (msg->msg.inp.input_fn(msg->msg.inp.p, msg->msg.inp.netif) != ERR_OK) {
+    pbuf_free(msg->msg.inp.p);
+  }
   UNLOCK_TCPIP_CORE();
-  return ret;
+  memp_free(MEMP_TCPIP_MSG_INPKT, msg);
 #else /* LWIP_TCPIP_CORE_LOCKING_INPUT */
+  /* blocking: a busy tcpip_thread throttles the checksum threads */
+  sys_mbox_post(&tcpip_mbox, msg);
+#endif /* LWIP_TCPIP_CORE_LOCKING_INPUT */
+}
+
+/**
+ * A checksum offload thread: verifies the checksums of the packets queued to
+ * it by tcpip_inpkt() and passes them on. It owns no protocol state: PCBs
+ * and timers are only touched by tcpip_thread (or under the core lock).
+ *
+ * @param arg the mbox of this thread
+ */
+static void
+tcpip_chksum_thread(void *arg)
+{
+  sys_mbox_t *mbox = (sys_mbox_t *)arg;
   struct tcpip_msg *msg;
 
-  LWIP_ASSERT("Invalid mbox", sys_mbox_valid_val(tcpip_mbox));
+  while (1) {
+    sys_mbox_fetch(mbox, (void **)&msg);
+    tcpip_chksum_thread_handle_msg(msg);
+  }
+}
+
+#ifdef TCPIP_THREAD_TEST
+/** Work on one packet queued to a checksum thread in single-threaded test mode */
+int
+tcpip_chksum_thread_poll_one(void)
+{
+  int i;
+  struct tcpip_msg *msg;
+
+  for (i = 0; i < TCPIP_CHECKSUM_THREADS; i++) {
+    if (sys_arch_mbox_tryfetch(&tcpip_chksum_mbox[i], (void **)&msg) != SYS_MBOX_EMPTY) {
+      tcpip_chksum_thread_handle_msg(msg);
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif /* TCPIP_THREAD_TEST */
+#endif /* TCPIP_CHECKSUM_THREADS */
+
+/**
+ * Pass a received packet to tcpip_thread for input processing (with
+ * TCPIP_CHECKSUM_THREADS, IPv4 TCP/UDP packets are queued to a checksum thread
+ * first)
+ *
+ * @param p the received packet
+ * @param inp the network interface on which the packet was received
+ * @param input_fn input function to call
+ */
+err_t
+tcpip_inpkt(struct pbuf *p, struct netif *inp, netif_input_fn input_fn)
+{
+#if !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS
+  struct tcpip_msg *msg;
+  sys_mbox_t *mbox = &tcpip_mbox;
+#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS */
+#if TCPIP_CHECKSUM_THREADS
+  int chksum_thread = tcpip_chksum_thread_index(p, input_fn);
+
+  if (chksum_thread >= 0) {
+    mbox = &tcpip_chksum_mbox[chksum_thread];
+  }
+#endif /* TCPIP_CHECKSUM_THREADS */
+
+#if LWIP_TCPIP_CORE_LOCKING_INPUT
+#if TCPIP_CHECKSUM_THREADS
+  if (chksum_thread < 0)
+#endif /* TCPIP_CHECKSUM_THREADS */
+  {
+    err_t ret;
+    LWIP_DEBUGF(TCPIP_DEBUG, ("tcpip_inpkt: PACKET %p/%p\n", (void *)p, (void *)inp));
+    LOCK_TCPIP_CORE();
+    ret = input_fn(p, inp);
+    UNLOCK_TCPIP_CORE();
+    return ret;
+  }
+#endif /* LWIP_TCPIP_CORE_LOCKING_INPUT */
+#if !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS
+  LWIP_ASSERT("Invalid mbox", sys_mbox_valid(mbox));
 
   msg = (struct tcpip_msg *)memp_malloc(MEMP_TCPIP_MSG_INPKT);
   if (msg == NULL) {
@@ -265,12 +510,12 @@ tcpip_inpkt(struct pbuf *p, struct netif *inp, netif_input_fn input_fn)
   msg->msg.inp.p = p;
   msg->msg.inp.netif = inp;
   msg->msg.inp.input_fn = input_fn;
-  if (sys_mbox_trypost(&tcpip_mbox, msg) != ERR_OK) {
+  if (sys_mbox_trypost(mbox, msg) != ERR_OK) {
     memp_free(MEMP_TCPIP_MSG_INPKT, msg);
     return ERR_MEM;
   }
   return ERR_OK;
-#endif /* LWIP_TCPIP_CORE_LOCKING_INPUT */
+#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS */
 }
 
 /**
@@ -663,6 +908,19 @@ tcpip_init(tcpip_init_done_fn initfunc, void *arg)
 #endif /* LWIP_TCPIP_CORE_LOCKING */
 
   sys_thread_new(TCPIP_THREAD_NAME, tcpip_thread, NULL, TCPIP_THREAD_STACKSIZE, TCPIP_THREAD_PRIO);
+
+#if TCPIP_CHECKSUM_THREADS
+  {
+    int i;
+    for (i = 0; i < TCPIP_CHECKSUM_THREADS; i++) {
+      if (sys_mbox_new(&tcpip_chksum_mbox[i], TCPIP_CHECKSUM_THREAD_MBOX_SIZE) != ERR_OK) {
+        LWIP_ASSERT("failed to create tcpip_chksum_thread mbox", 0);
+      }
+      sys_thread_new(TCPIP_CHECKSUM_THREAD_NAME, tcpip_chksum_thread, &tcpip_chksum_mbox[i],
+                     TCPIP_CHECKSUM_THREAD_STACKSIZE, TCPIP_CHECKSUM_THREAD_PRIO);
+    }
+  }
+#endif /* TCPIP_CHECKSUM_THREADS */
 }
 
 /**
@@ -113,6 +113,12 @@ PACK_STRUCT_END
 #if (LWIP_TCP && (MEMP_NUM_TCP_PCB<=0))
 #error "If you want to use TCP, you have to define MEMP_NUM_TCP_PCB>=1 in your lwipopts.h"
 #endif
+#if (LWIP_TCP && (TCP_PCB_HASH_SIZE & (TCP_PCB_HASH_SIZE - 1)))
+#error "TCP_PCB_HASH_SIZE must be 0 or a power of two"
+#endif
+#if (LWIP_UDP && (UDP_PCB_HASH_SIZE & (UDP_PCB_HASH_SIZE - 1)))
+#error "UDP_PCB_HASH_SIZE must be 0 or a power of two"
+#endif
 #if (LWIP_IGMP && (MEMP_NUM_IGMP_GROUP<=1))
 #error "If you want to use IGMP, you have to define MEMP_NUM_IGMP_GROUP>1 in your lwipopts.h"
 #endif
@@ -175,6 +181,12 @@ PACK_STRUCT_END
 #if ((LWIP_SOCKET || LWIP_NETCONN) && (NO_SYS==1))
 #error "If you want to use Sequential API, you have to define NO_SYS=0 in your lwipopts.h"
 #endif
+#if (LWIP_SOCKET && LWIP_SOCKET_EPOLL && !(LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL))
+#error "If you want to use LWIP_SOCKET_EPOLL, you have to define LWIP_SOCKET_SELECT=1 and/or LWIP_SOCKET_POLL=1 in your lwipopts.h"
+#endif
+#if (LWIP_SOCKET && LWIP_SOCKET_EPOLL && (LWIP_SOCKET_EPOLL_NUM < 1 || MEMP_NUM_EPOLL_ITEM < 1))
+#error "If you want to use LWIP_SOCKET_EPOLL, you have to define LWIP_SOCKET_EPOLL_NUM>=1 and MEMP_NUM_EPOLL_ITEM>=1 in your lwipopts.h"
+#endif
 #if (LWIP_PPP_API && (NO_SYS==1))
 #error "If you want to use PPP API, you have to define NO_SYS=0 in your lwipopts.h"
 #endif
@@ -229,6 +241,9 @@ PACK_STRUCT_END
 #if LWIP_TCPIP_CORE_LOCKING_INPUT && !LWIP_TCPIP_CORE_LOCKING
 #error "When using LWIP_TCPIP_CORE_LOCKING_INPUT, LWIP_TCPIP_CORE_LOCKING must be enabled, too"
 #endif
+#if TCPIP_CHECKSUM_THREADS && (NO_SYS || !LWIP_IPV4)
+#error "TCPIP_CHECKSUM_THREADS needs the tcpip_thread (NO_SYS == 0) and LWIP_IPV4"
+#endif
 #if LWIP_TCP && LWIP_NETIF_TX_SINGLE_PBUF && !TCP_OVERSIZE
 #error "LWIP_NETIF_TX_SINGLE_PBUF needs TCP_OVERSIZE enabled to create single-pbuf TCP packets"
 #endif
@@ -243,6 +258,9 @@ PACK_STRUCT_END
 #if LWIP_NETCONN_FULLDUPLEX && !LWIP_NETCONN_SEM_PER_THREAD
 #error "For LWIP_NETCONN_FULLDUPLEX to work, LWIP_NETCONN_SEM_PER_THREAD is required"
 #endif
+#if LWIP_SOCKET && ((LWIP_SOCKET_MMSG_BATCH < 1) || (LWIP_SOCKET_MMSG_BATCH > 0xFFFF))
+#error "LWIP_SOCKET_MMSG_BATCH must be in the range 1..65535"
+#endif
 
 
 /* Compile-time checks for deprecated options.
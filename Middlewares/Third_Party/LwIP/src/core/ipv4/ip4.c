@@ -528,9 +528,9 @@ ip4_input(struct pbuf *p, struct netif *inp)
     return ERR_OK;
   }
 
-  /* verify checksum */
+  /* verify checksum (unless an input worker did already) */
 #if CHECKSUM_CHECK_IP
-  IF__NETIF_CHECKSUM_ENABLED(inp, NETIF_CHECKSUM_CHECK_IP) {
+  IF__NETIF_CHECKSUM_CHECK_NEEDED(inp, p, NETIF_CHECKSUM_CHECK_IP) {
     if (inet_chksum(iphdr, iphdr_hlen) != 0) {
 
       LWIP_DEBUGF(IP_DEBUG | LWIP_DBG_LEVEL_SERIOUS,
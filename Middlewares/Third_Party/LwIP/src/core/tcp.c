@@ -184,6 +184,11 @@ struct tcp_pcb **const tcp_pcb_lists[] = {&tcp_listen_pcbs.pcbs, &tcp_bound_pcbs
 
 u8_t tcp_active_pcbs_changed;
 
+#if TCP_PCB_HASH_SIZE
+/** Active and TIME-WAIT PCBs by 4-tuple, chained through tcp_pcb.hash_next */
+static struct tcp_pcb *tcp_pcb_hash[TCP_PCB_HASH_SIZE];
+#endif /* TCP_PCB_HASH_SIZE */
+
 /** Timer counter to handle calling slow-timer from tcp_tmr() */
 static u8_t tcp_timer;
 static u8_t tcp_timer_ctr;
@@ -1196,7 +1201,6 @@ void
 tcp_slowtmr(void)
 {
   struct tcp_pcb *pcb, *prev;
-  tcpwnd_size_t eff_wnd;
   u8_t pcb_remove;      /* flag if a PCB should be removed */
   u8_t pcb_reset;       /* flag if a RST should be sent when removing */
   err_t err;
@@ -1297,11 +1301,7 @@ tcp_slowtmr_start:
             pcb->rtime = 0;
 
             /* Reduce congestion window and ssthresh. */
-            eff_wnd = LWIP_MIN(pcb->cwnd, pcb->snd_wnd);
-            pcb->ssthresh = eff_wnd >> 1;
-            if (pcb->ssthresh < (tcpwnd_size_t)(pcb->mss << 1)) {
-              pcb->ssthresh = (tcpwnd_size_t)(pcb->mss << 1);
-            }
+            TCP_CC_ON_RTO(pcb);
             pcb->cwnd = pcb->mss;
             LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_slowtmr: cwnd %"TCPWNDSIZE_F
                                          " ssthresh %"TCPWNDSIZE_F"\n",
@@ -1397,6 +1397,9 @@ tcp_slowtmr_start:
         LWIP_ASSERT("tcp_slowtmr: first pcb == tcp_active_pcbs", tcp_active_pcbs == pcb);
         tcp_active_pcbs = pcb->next;
       }
+#if TCP_PCB_HASH_SIZE
+      tcp_pcb_hash_remove(pcb);
+#endif /* TCP_PCB_HASH_SIZE */
 
       if (pcb_reset) {
         tcp_rst(pcb, pcb->snd_nxt, pcb->rcv_nxt, &pcb->local_ip, &pcb->remote_ip,
@@ -1463,6 +1466,9 @@ tcp_slowtmr_start:
         LWIP_ASSERT("tcp_slowtmr: first pcb == tcp_tw_pcbs", tcp_tw_pcbs == pcb);
         tcp_tw_pcbs = pcb->next;
       }
+#if TCP_PCB_HASH_SIZE
+      tcp_pcb_hash_remove(pcb);
+#endif /* TCP_PCB_HASH_SIZE */
       pcb2 = pcb;
       pcb = pcb->next;
       tcp_free(pcb2);
@@ -1654,6 +1660,97 @@ tcp_setprio(struct tcp_pcb *pcb, u8_t prio)
   pcb->prio = prio;
 }
 
+/**
+ * Reno congestion control: grow cwnd when new data has been acked outside
+ * of fast recovery (RFC 5681 with byte counting as in RFC 3465).
+ *
+ * @param pcb the tcp_pcb that received the ACK
+ * @param acked number of bytes acked
+ * @param rtt round-trip time sample (ms) or 0 (unused)
+ */
+void
+tcp_cc_reno_on_ack(struct tcp_pcb *pcb, tcpwnd_size_t acked, u32_t rtt)
+{
+  LWIP_UNUSED_ARG(rtt);
+
+  if (pcb->cwnd < pcb->ssthresh) {
+    tcpwnd_size_t increase;
+    /* limit to 1 SMSS segment during period following RTO */
+    u8_t num_seg = (pcb->flags & TF_RTO) ? 1 : 2;
+    /* RFC 3465, section 2.2 Slow Start */
+    increase = LWIP_MIN(acked, (tcpwnd_size_t)(num_seg * pcb->mss));
+    TCP_WND_INC(pcb->cwnd, increase);
+    LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_receive: slow start cwnd %"TCPWNDSIZE_F"\n", pcb->cwnd));
+  } else {
+    /* RFC 3465, section 2.1 Congestion Avoidance */
+    TCP_WND_INC(pcb->bytes_acked, acked);
+    if (pcb->bytes_acked >= pcb->cwnd) {
+      pcb->bytes_acked = (tcpwnd_size_t)(pcb->bytes_acked - pcb->cwnd);
+      TCP_WND_INC(pcb->cwnd, pcb->mss);
+    }
+    LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_receive: congestion avoidance cwnd %"TCPWNDSIZE_F"\n", pcb->cwnd));
+  }
+}
+
+/**
+ * Reno congestion control: on fast retransmit or retransmission timeout,
+ * set ssthresh to half of the minimum of the current cwnd and the
+ * advertised window.
+ *
+ * @param pcb the tcp_pcb that lost a segment
+ */
+void
+tcp_cc_reno_on_loss(struct tcp_pcb *pcb)
+{
+  pcb->ssthresh = LWIP_MIN(pcb->cwnd, pcb->snd_wnd) / 2;
+
+  /* The minimum value for ssthresh should be 2 MSS */
+  if (pcb->ssthresh < (2U * pcb->mss)) {
+    LWIP_DEBUGF(TCP_FR_DEBUG,
+                ("tcp_cc_reno_on_loss: The minimum value for ssthresh %"TCPWNDSIZE_F
+                 " should be min 2 mss %"U16_F"...\n",
+                 pcb->ssthresh, (u16_t)(2 * pcb->mss)));
+    pcb->ssthresh = (tcpwnd_size_t)(2 * pcb->mss);
+  }
+}
+
+#if LWIP_TCP_CC
+/** Reno congestion control (the default, see @ref LWIP_TCP_CC_DEFAULT) */
+const struct tcp_cc_ops tcp_cc_reno = {
+  "reno",
+  tcp_cc_reno_on_ack,
+  tcp_cc_reno_on_loss,
+  tcp_cc_reno_on_loss,
+  NULL
+};
+
+/**
+ * @ingroup tcp_raw
+ * Selects the congestion control module of a connection (see @ref LWIP_TCP_CC).
+ * Connections accepted by a listening pcb start with @ref LWIP_TCP_CC_DEFAULT,
+ * change it from the accept callback.
+ *
+ * @param pcb the tcp_pcb to manipulate
+ * @param cc the module, e.g. &tcp_cc_cubic
+ */
+void
+tcp_set_cc(struct tcp_pcb *pcb, const struct tcp_cc_ops *cc)
+{
+  LWIP_ASSERT_CORE_LOCKED();
+
+  LWIP_ERROR("tcp_set_cc: invalid pcb", pcb != NULL, return);
+  LWIP_ERROR("tcp_set_cc: invalid cc", (cc != NULL) && (cc->on_ack != NULL) &&
+             (cc->on_loss != NULL) && (cc->on_rto != NULL), return);
+  LWIP_ERROR("tcp_set_cc: called on listen-pcb", pcb->state != LISTEN, return);
+
+  pcb->cc = cc;
+  memset(pcb->cc_priv, 0, sizeof(pcb->cc_priv));
+  if ((pcb->state >= ESTABLISHED) && (cc->cwnd_event != NULL)) {
+    cc->cwnd_event(pcb, TCP_CC_EVENT_ESTABLISHED);
+  }
+}
+#endif /* LWIP_TCP_CC */
+
 #if TCP_QUEUE_OOSEQ
 /**
  * Returns a copy of the given TCP segment.
@@ -1917,6 +2014,9 @@ tcp_alloc(u8_t prio)
     connection is established. To avoid these complications, we set ssthresh to the
     largest effective cwnd (amount of in-flight data) that the sender can have. */
     pcb->ssthresh = TCP_SND_BUF;
+#if LWIP_TCP_CC
+    pcb->cc = LWIP_TCP_CC_DEFAULT;
+#endif /* LWIP_TCP_CC */
 
 #if LWIP_CALLBACK_API
     pcb->recv = tcp_recv_null;
@@ -2216,6 +2316,108 @@ tcp_pcb_remove(struct tcp_pcb **pcblist, struct tcp_pcb *pcb)
   LWIP_ASSERT("tcp_pcb_remove: tcp_pcbs_sane()", tcp_pcbs_sane());
 }
 
+#if TCP_PCB_HASH_SIZE
+/** Mix the ports and the remote address of a connection into a bucket index
+ * (multiplicative hashing, so that correlated address and port bits of
+ * consecutive connections do not cancel out).
+ * The local address is left out: it rarely varies between connections. */
+static u16_t
+tcp_pcb_hash_idx(u16_t local_port, const ip_addr_t *remote_ip, u16_t remote_port)
+{
+  u32_t h = 0;
+
+#if LWIP_IPV6
+  if (IP_IS_V6(remote_ip)) {
+    h = ip_2_ip6(remote_ip)->addr[3] ^ ip_2_ip6(remote_ip)->addr[2];
+  } else
+#endif /* LWIP_IPV6 */
+  {
+#if LWIP_IPV4
+    h = ip4_addr_get_u32(ip_2_ip4(remote_ip));
+#endif /* LWIP_IPV4 */
+  }
+  h = (h * 0x9E3779B1UL) ^ (((u32_t)local_port << 16) | remote_port);
+  h *= 0x9E3779B1UL;
+  return (u16_t)((h >> 16) & (TCP_PCB_HASH_SIZE - 1));
+}
+
+/**
+ * Insert an active or TIME-WAIT pcb into the 4-tuple hash table.
+ * Called from TCP_REG, the 4-tuple of the pcb must be set already.
+ *
+ * @param pcb tcp_pcb to insert
+ */
+void
+tcp_pcb_hash_add(struct tcp_pcb *pcb)
+{
+  u16_t idx = tcp_pcb_hash_idx(pcb->local_port, &pcb->remote_ip, pcb->remote_port);
+
+  pcb->hash_next = tcp_pcb_hash[idx];
+  tcp_pcb_hash[idx] = pcb;
+}
+
+/**
+ * Remove a pcb from the 4-tuple hash table (called from TCP_RMV).
+ *
+ * @param pcb tcp_pcb to remove
+ */
+void
+tcp_pcb_hash_remove(struct tcp_pcb *pcb)
+{
+  struct tcp_pcb **pp;
+  u16_t idx = tcp_pcb_hash_idx(pcb->local_port, &pcb->remote_ip, pcb->remote_port);
+
+  for (pp = &tcp_pcb_hash[idx]; *pp != NULL; pp = &(*pp)->hash_next) {
+    if (*pp == pcb) {
+      *pp = pcb->hash_next;
+      break;
+    }
+  }
+  pcb->hash_next = NULL;
+}
+
+/**
+ * Find the active or TIME-WAIT pcb of a connection. An active pcb is
+ * preferred over a TIME-WAIT pcb with the same 4-tuple, like the list
+ * walks in tcp_input() do.
+ *
+ * @param local_ip local address of the connection
+ * @param local_port local port of the connection
+ * @param remote_ip remote address of the connection
+ * @param remote_port remote port of the connection
+ * @param netif_idx index of the netif the segment arrived on
+ * @return the matching pcb or NULL
+ */
+struct tcp_pcb *
+tcp_pcb_hash_lookup(const ip_addr_t *local_ip, u16_t local_port,
+                    const ip_addr_t *remote_ip, u16_t remote_port,
+                    u8_t netif_idx)
+{
+  struct tcp_pcb *pcb;
+  struct tcp_pcb *tw_pcb = NULL;
+
+  for (pcb = tcp_pcb_hash[tcp_pcb_hash_idx(local_port, remote_ip, remote_port)];
+       pcb != NULL; pcb = pcb->hash_next) {
+    /* check if PCB is bound to specific netif */
+    if ((pcb->netif_idx != NETIF_NO_INDEX) && (pcb->netif_idx != netif_idx)) {
+      continue;
+    }
+    if (pcb->remote_port == remote_port &&
+        pcb->local_port == local_port &&
+        ip_addr_eq(&pcb->remote_ip, remote_ip) &&
+        ip_addr_eq(&pcb->local_ip, local_ip)) {
+      if (pcb->state != TIME_WAIT) {
+        return pcb;
+      }
+      if (tw_pcb == NULL) {
+        tw_pcb = pcb;
+      }
+    }
+  }
+  return tw_pcb;
+}
+#endif /* TCP_PCB_HASH_SIZE */
+
 /**
  * Calculates a new initial sequence number for new connections.
  *
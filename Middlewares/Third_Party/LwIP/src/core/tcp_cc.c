@@ -0,0 +1,247 @@
+/**
+ * @file
+ * Transmission Control Protocol, congestion control modules
+ *
+ * CUBIC and Vegas for @ref LWIP_TCP_CC, Reno is in tcp.c.
+ *
+ */
+
+/*
+ * Copyright (c) 2026 The lwIP contributors.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+#include "lwip/opt.h"
+
+#if LWIP_TCP && LWIP_TCP_CC /* don't build if not configured for use in lwipopts.h */
+
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/def.h"
+#include "lwip/sys.h"
+
+#if LWIP_HAVE_INT64
+
+/* CUBIC (RFC 9438): C = 0.4 segments/s^3, beta = 0.7 */
+#define TCP_CUBIC_C_NUM        4
+#define TCP_CUBIC_C_DEN        10
+#define TCP_CUBIC_BETA_NUM     7
+#define TCP_CUBIC_BETA_DEN     10
+/* the cubic function is not evaluated further than this from K (ms) */
+#define TCP_CUBIC_MAX_OFFSET   30000
+
+struct tcp_cc_cubic {
+  /* cwnd before the last reduction */
+  u32_t w_max;
+  /* time from the start of the epoch until cwnd is back at w_max (ms) */
+  u32_t k;
+  /* sys_now() when the current congestion avoidance epoch started, 0: none */
+  u32_t epoch_start;
+  /* cwnd the cubic function is centered on */
+  u32_t origin;
+  /* what Reno would use as cwnd in this epoch */
+  u32_t w_est;
+  /* smallest RTT sample (ms) */
+  u32_t min_rtt;
+};
+
+#if LWIP_TCP_CC_PRIV_SIZE < 6
+#error "LWIP_TCP_CC_PRIV_SIZE too small for tcp_cc_cubic"
+#endif
+
+/* Integer cube root (from Hacker's Delight) */
+static u32_t
+tcp_cc_cbrt(u64_t x)
+{
+  u64_t y = 0;
+  int s;
+
+  for (s = 63; s >= 0; s -= 3) {
+    u64_t b;
+    y += y;
+    b = 3 * y * (y + 1) + 1;
+    if ((x >> s) >= b) {
+      x -= b << s;
+      y++;
+    }
+  }
+  return (u32_t)y;
+}
+
+static void
+tcp_cc_cubic_on_ack(struct tcp_pcb *pcb, tcpwnd_size_t acked, u32_t rtt)
+{
+  struct tcp_cc_cubic *ca = (struct tcp_cc_cubic *)pcb->cc_priv;
+  u32_t now, t, offset, target;
+  u64_t delta;
+
+  if ((rtt != 0) && ((ca->min_rtt == 0) || (rtt < ca->min_rtt))) {
+    ca->min_rtt = rtt;
+  }
+  if (pcb->cwnd < pcb->ssthresh) {
+    tcp_cc_reno_on_ack(pcb, acked, rtt);
+    return;
+  }
+
+  now = sys_now();
+  if (ca->epoch_start == 0) {
+    ca->epoch_start = LWIP_MAX(now, 1);
+    ca->w_est = pcb->cwnd;
+    if (pcb->cwnd < ca->w_max) {
+      /* K = cbrt((W_max - cwnd) / C), in ms */
+      ca->k = tcp_cc_cbrt((u64_t)(ca->w_max - pcb->cwnd) * 1000000000 * TCP_CUBIC_C_DEN /
+                          TCP_CUBIC_C_NUM / pcb->mss);
+      ca->origin = ca->w_max;
+    } else {
+      ca->k = 0;
+      ca->origin = pcb->cwnd;
+    }
+  }
+
+  /* W_cubic(t + RTT) = C * (t + RTT - K)^3 + W_max */
+  t = now - ca->epoch_start + ca->min_rtt;
+  offset = LWIP_MIN((t > ca->k) ? (t - ca->k) : (ca->k - t), TCP_CUBIC_MAX_OFFSET);
+  delta = (u64_t)offset * offset * offset * TCP_CUBIC_C_NUM * pcb->mss /
+          (TCP_CUBIC_C_DEN * (u64_t)1000000000);
+  if (t > ca->k) {
+    target = (u32_t)LWIP_MIN(ca->origin + delta, (u64_t)pcb->cwnd * 3 / 2);
+  } else {
+    target = (delta < ca->origin) ? (u32_t)(ca->origin - delta) : 0;
+  }
+
+  /* Reno-friendly region: W_est grows by 3 * (1 - beta) / (1 + beta) segments per RTT */
+  ca->w_est += (u32_t)((u64_t)acked * pcb->mss * 3 * (TCP_CUBIC_BETA_DEN - TCP_CUBIC_BETA_NUM) /
+                       (TCP_CUBIC_BETA_DEN + TCP_CUBIC_BETA_NUM) / pcb->cwnd);
+  target = LWIP_MAX(target, ca->w_est);
+
+  if (target > pcb->cwnd) {
+    /* approach the target within one RTT, but not faster than slow start */
+    u32_t increase = (u32_t)((u64_t)(target - pcb->cwnd) * acked / pcb->cwnd);
+    TCP_WND_INC(pcb->cwnd, (tcpwnd_size_t)LWIP_MIN(increase, acked));
+  }
+  LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_cc_cubic_on_ack: cwnd %"TCPWNDSIZE_F" target %"U32_F"\n",
+                               pcb->cwnd, target));
+}
+
+static void
+tcp_cc_cubic_on_loss(struct tcp_pcb *pcb)
+{
+  struct tcp_cc_cubic *ca = (struct tcp_cc_cubic *)pcb->cc_priv;
+  u32_t flight = LWIP_MIN(pcb->cwnd, pcb->snd_wnd);
+
+  ca->epoch_start = 0;
+  if (flight < ca->w_max) {
+    /* fast convergence: leave bandwidth to newer flows */
+    ca->w_max = (u32_t)((u64_t)flight * (TCP_CUBIC_BETA_DEN + TCP_CUBIC_BETA_NUM) / (2 * TCP_CUBIC_BETA_DEN));
+  } else {
+    ca->w_max = flight;
+  }
+  pcb->ssthresh = (tcpwnd_size_t)((u64_t)flight * TCP_CUBIC_BETA_NUM / TCP_CUBIC_BETA_DEN);
+  if (pcb->ssthresh < (2U * pcb->mss)) {
+    pcb->ssthresh = (tcpwnd_size_t)(2 * pcb->mss);
+  }
+  LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_cc_cubic_on_loss: w_max %"U32_F" ssthresh %"TCPWNDSIZE_F"\n",
+                               ca->w_max, pcb->ssthresh));
+}
+
+/** CUBIC congestion control (RFC 9438): grows cwnd as a cubic function of the
+ * time since the last loss, independent of the RTT */
+const struct tcp_cc_ops tcp_cc_cubic = {
+  "cubic",
+  tcp_cc_cubic_on_ack,
+  tcp_cc_cubic_on_loss,
+  tcp_cc_cubic_on_loss,
+  NULL
+};
+
+#endif /* LWIP_HAVE_INT64 */
+
+/* Vegas: keep between alpha and beta segments queued in the network, leave
+   slow start when more than gamma segments are queued */
+#define TCP_VEGAS_ALPHA        2
+#define TCP_VEGAS_BETA         4
+#define TCP_VEGAS_GAMMA        1
+
+struct tcp_cc_vegas {
+  /* smallest RTT sample (ms), 0: none yet */
+  u32_t base_rtt;
+};
+
+#if LWIP_TCP_CC_PRIV_SIZE < 1
+#error "LWIP_TCP_CC_PRIV_SIZE too small for tcp_cc_vegas"
+#endif
+
+static void
+tcp_cc_vegas_on_ack(struct tcp_pcb *pcb, tcpwnd_size_t acked, u32_t rtt)
+{
+  struct tcp_cc_vegas *ca = (struct tcp_cc_vegas *)pcb->cc_priv;
+  u32_t frac, queued;
+
+  if (rtt == 0) {
+    /* lwIP times one segment per RTT, so cwnd is adjusted once per RTT */
+    if (pcb->cwnd < pcb->ssthresh) {
+      tcp_cc_reno_on_ack(pcb, acked, rtt);
+    }
+    return;
+  }
+  if ((ca->base_rtt == 0) || (rtt < ca->base_rtt)) {
+    ca->base_rtt = rtt;
+  }
+
+  /* Data queued in the network: cwnd * (1 - base_rtt / rtt), which is the
+     difference of the expected and the actual rate times base_rtt */
+  frac = ((rtt - ca->base_rtt) << 8) / rtt;
+  queued = (u32_t)((pcb->cwnd >> 8) * frac + (((pcb->cwnd & 0xff) * frac) >> 8));
+
+  if (pcb->cwnd < pcb->ssthresh) {
+    if (queued > (u32_t)TCP_VEGAS_GAMMA * pcb->mss) {
+      /* the path is full: leave slow start */
+      pcb->cwnd = (tcpwnd_size_t)LWIP_MAX(pcb->cwnd - queued, 2U * pcb->mss);
+      pcb->ssthresh = pcb->cwnd;
+    } else {
+      tcp_cc_reno_on_ack(pcb, acked, rtt);
+    }
+  } else if (queued < (u32_t)TCP_VEGAS_ALPHA * pcb->mss) {
+    TCP_WND_INC(pcb->cwnd, pcb->mss);
+  } else if ((queued > (u32_t)TCP_VEGAS_BETA * pcb->mss) && (pcb->cwnd > 2U * pcb->mss)) {
+    pcb->cwnd = (tcpwnd_size_t)(pcb->cwnd - pcb->mss);
+  }
+  LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_cc_vegas_on_ack: rtt %"U32_F" base %"U32_F" cwnd %"TCPWNDSIZE_F"\n",
+                               rtt, ca->base_rtt, pcb->cwnd));
+}
+
+/** Vegas congestion control: a delay based module that keeps the queue at
+ * the bottleneck short, losses are handled like Reno */
+const struct tcp_cc_ops tcp_cc_vegas = {
+  "vegas",
+  tcp_cc_vegas_on_ack,
+  tcp_cc_reno_on_loss,
+  tcp_cc_reno_on_loss,
+  NULL
+};
+
+#endif /* LWIP_TCP && LWIP_TCP_CC */
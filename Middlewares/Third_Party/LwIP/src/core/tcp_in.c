@@ -53,6 +53,9 @@
 #include "lwip/memp.h"
 #include "lwip/inet_chksum.h"
 #include "lwip/stats.h"
+#if LWIP_TCP_CC
+#include "lwip/sys.h"
+#endif
 #include "lwip/ip6.h"
 #include "lwip/ip6_addr.h"
 #if LWIP_ND6_TCP_REACHABILITY_HINTS
@@ -85,6 +88,13 @@ static u8_t flags;
 static u8_t recv_flags;
 static struct pbuf *recv_data;
 
+#if LWIP_TCP_SACK_IN
+/* SACK blocks of the incoming segment (set by tcp_parseopt()) */
+#define TCP_SACK_IN_MAX_BLOCKS 4
+static struct tcp_sack_range tcp_sack_blocks[TCP_SACK_IN_MAX_BLOCKS];
+static u8_t tcp_sack_blocks_num;
+#endif /* LWIP_TCP_SACK_IN */
+
 struct tcp_pcb *tcp_input_pcb;
 
 /* Forward declarations. */
@@ -104,6 +114,10 @@ static void tcp_remove_sacks_lt(struct tcp_pcb *pcb, u32_t seq);
 static void tcp_remove_sacks_gt(struct tcp_pcb *pcb, u32_t seq);
 #endif /* TCP_OOSEQ_BYTES_LIMIT || TCP_OOSEQ_PBUFS_LIMIT */
 #endif /* LWIP_TCP_SACK_OUT */
+#if LWIP_TCP_SACK_IN
+static u32_t tcp_sack_update_scoreboard(struct tcp_pcb *pcb);
+static void tcp_sack_end_recovery(struct tcp_pcb *pcb);
+#endif /* LWIP_TCP_SACK_IN */
 
 /**
  * The initial input processing of TCP. It verifies the TCP header, demultiplexes
@@ -157,7 +171,7 @@ tcp_input(struct pbuf *p, struct netif *inp)
   }
 
 #if CHECKSUM_CHECK_TCP
-  IF__NETIF_CHECKSUM_ENABLED(inp, NETIF_CHECKSUM_CHECK_TCP) {
+  IF__NETIF_CHECKSUM_CHECK_NEEDED(inp, p, NETIF_CHECKSUM_CHECK_TCP) {
     /* Verify TCP checksum. */
     u16_t chksum = ip_chksum_pseudo(p, IP_PROTO_TCP, p->tot_len,
                                     ip_current_src_addr(), ip_current_dest_addr());
@@ -247,6 +261,23 @@ tcp_input(struct pbuf *p, struct netif *inp)
      for an active connection. */
   prev = NULL;
 
+#if TCP_PCB_HASH_SIZE
+  pcb = tcp_pcb_hash_lookup(ip_current_dest_addr(), tcphdr->dest,
+                            ip_current_src_addr(), tcphdr->src,
+                            netif_get_index(ip_data.current_input_netif));
+  if ((pcb != NULL) && (pcb->state == TIME_WAIT)) {
+    LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_input: packed for TIME_WAITing connection.\n"));
+#ifdef LWIP_HOOK_TCP_INPACKET_PCB
+    if (LWIP_HOOK_TCP_INPACKET_PCB(pcb, tcphdr, tcphdr_optlen, tcphdr_opt1len,
+                                   tcphdr_opt2, p) == ERR_OK)
+#endif
+    {
+      tcp_timewait_input(pcb);
+    }
+    pbuf_free(p);
+    return;
+  }
+#else /* TCP_PCB_HASH_SIZE */
   for (pcb = tcp_active_pcbs; pcb != NULL; pcb = pcb->next) {
     LWIP_ASSERT("tcp_input: active pcb->state != CLOSED", pcb->state != CLOSED);
     LWIP_ASSERT("tcp_input: active pcb->state != TIME-WAIT", pcb->state != TIME_WAIT);
@@ -279,8 +310,10 @@ tcp_input(struct pbuf *p, struct netif *inp)
     }
     prev = pcb;
   }
+#endif /* TCP_PCB_HASH_SIZE */
 
   if (pcb == NULL) {
+#if !TCP_PCB_HASH_SIZE
     /* If it did not go to an active connection, we check the connections
        in the TIME-WAIT state. */
     for (pcb = tcp_tw_pcbs; pcb != NULL; pcb = pcb->next) {
@@ -311,6 +344,7 @@ tcp_input(struct pbuf *p, struct netif *inp)
         return;
       }
     }
+#endif /* !TCP_PCB_HASH_SIZE */
 
     /* Finally, if we still did not get a match, we check all PCBs that
        are LISTENing for incoming connections. */
@@ -884,6 +918,7 @@ tcp_process(struct tcp_pcb *pcb)
         LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_process (SENT): cwnd %"TCPWNDSIZE_F
                                      " ssthresh %"TCPWNDSIZE_F"\n",
                                      pcb->cwnd, pcb->ssthresh));
+        TCP_CC_EVENT(pcb, TCP_CC_EVENT_ESTABLISHED);
         LWIP_ASSERT("pcb->snd_queuelen > 0", (pcb->snd_queuelen > 0));
         --pcb->snd_queuelen;
         LWIP_DEBUGF(TCP_QLEN_DEBUG, ("tcp_process: SYN-SENT --queuelen %"TCPWNDSIZE_F"\n", (tcpwnd_size_t)pcb->snd_queuelen));
@@ -977,6 +1012,7 @@ tcp_process(struct tcp_pcb *pcb)
           LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_process (SYN_RCVD): cwnd %"TCPWNDSIZE_F
                                        " ssthresh %"TCPWNDSIZE_F"\n",
                                        pcb->cwnd, pcb->ssthresh));
+          TCP_CC_EVENT(pcb, TCP_CC_EVENT_ESTABLISHED);
 
           if (recv_flags & TF_GOT_FIN) {
             tcp_ack_now(pcb);
@@ -1155,6 +1191,9 @@ tcp_receive(struct tcp_pcb *pcb)
 {
   s16_t m;
   u32_t right_wnd_edge;
+#if LWIP_TCP_SACK_IN
+  u32_t sacked = 0;
+#endif /* LWIP_TCP_SACK_IN */
 
   LWIP_ASSERT("tcp_receive: invalid pcb", pcb != NULL);
   LWIP_ASSERT("tcp_receive: wrong state", pcb->state >= ESTABLISHED);
@@ -1186,6 +1225,12 @@ tcp_receive(struct tcp_pcb *pcb)
 #endif /* TCP_WND_DEBUG */
     }
 
+#if LWIP_TCP_SACK_IN
+    if ((pcb->flags & TF_SACK) && (tcp_sack_blocks_num > 0)) {
+      sacked = tcp_sack_update_scoreboard(pcb);
+    }
+#endif /* LWIP_TCP_SACK_IN */
+
     /* (From Stevens TCP/IP Illustrated Vol II, p970.) Its only a
      * duplicate ack if:
      * 1) It doesn't ACK new data
@@ -1219,13 +1264,30 @@ tcp_receive(struct tcp_pcb *pcb)
               if ((u8_t)(pcb->dupacks + 1) > pcb->dupacks) {
                 ++pcb->dupacks;
               }
-              if (pcb->dupacks > 3) {
-                /* Inflate the congestion window */
-                TCP_WND_INC(pcb->cwnd, pcb->mss);
-              }
-              if (pcb->dupacks >= 3) {
-                /* Do fast retransmit (checked via TF_INFR, not via dupacks count) */
-                tcp_rexmit_fast(pcb);
+#if LWIP_TCP_SACK_IN
+              if (pcb->flags & TF_SACK) {
+                /* RFC 6675: start loss recovery after 3 dupacks or as soon as more
+                   than 2 * MSS above the first unacked segment have been SACKed,
+                   then retransmit every hole the scoreboard regards as lost.
+                   Not while retransmitting after an RTO: the duplicates sent
+                   then cause dupacks, too (RFC 6675, section 5.1) */
+                if (!(pcb->flags & TF_RTO) && ((pcb->dupacks >= 3) || (sacked > 2U * pcb->mss))) {
+                  tcp_rexmit_fast(pcb);
+                }
+                if (pcb->flags & TF_INFR) {
+                  tcp_rexmit_sack(pcb, 0);
+                }
+              } else
+#endif /* LWIP_TCP_SACK_IN */
+              {
+                if (pcb->dupacks > 3) {
+                  /* Inflate the congestion window */
+                  TCP_WND_INC(pcb->cwnd, pcb->mss);
+                }
+                if (pcb->dupacks >= 3) {
+                  /* Do fast retransmit (checked via TF_INFR, not via dupacks count) */
+                  tcp_rexmit_fast(pcb);
+                }
               }
             }
           }
@@ -1239,9 +1301,20 @@ tcp_receive(struct tcp_pcb *pcb)
          in fast retransmit. Also reset the congestion window to the
          slow start threshold. */
       if (pcb->flags & TF_INFR) {
-        tcp_clear_flags(pcb, TF_INFR);
-        pcb->cwnd = pcb->ssthresh;
-        pcb->bytes_acked = 0;
+#if LWIP_TCP_SACK_IN
+        if ((pcb->flags & TF_SACK) && TCP_SEQ_LT(ackno, pcb->recover)) {
+          /* A partial ACK does not end SACK based recovery (RFC 6675) */
+        } else
+#endif /* LWIP_TCP_SACK_IN */
+        {
+          tcp_clear_flags(pcb, TF_INFR);
+          pcb->cwnd = pcb->ssthresh;
+          pcb->bytes_acked = 0;
+#if LWIP_TCP_SACK_IN
+          tcp_sack_end_recovery(pcb);
+#endif /* LWIP_TCP_SACK_IN */
+          TCP_CC_EVENT(pcb, TCP_CC_EVENT_RECOVERY_END);
+        }
       }
 
       /* Reset the number of retransmissions. */
@@ -1258,25 +1331,16 @@ tcp_receive(struct tcp_pcb *pcb)
       pcb->lastack = ackno;
 
       /* Update the congestion control variables (cwnd and
-         ssthresh). */
-      if (pcb->state >= ESTABLISHED) {
-        if (pcb->cwnd < pcb->ssthresh) {
-          tcpwnd_size_t increase;
-          /* limit to 1 SMSS segment during period following RTO */
-          u8_t num_seg = (pcb->flags & TF_RTO) ? 1 : 2;
-          /* RFC 3465, section 2.2 Slow Start */
-          increase = LWIP_MIN(acked, (tcpwnd_size_t)(num_seg * pcb->mss));
-          TCP_WND_INC(pcb->cwnd, increase);
-          LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_receive: slow start cwnd %"TCPWNDSIZE_F"\n", pcb->cwnd));
-        } else {
-          /* RFC 3465, section 2.1 Congestion Avoidance */
-          TCP_WND_INC(pcb->bytes_acked, acked);
-          if (pcb->bytes_acked >= pcb->cwnd) {
-            pcb->bytes_acked = (tcpwnd_size_t)(pcb->bytes_acked - pcb->cwnd);
-            TCP_WND_INC(pcb->cwnd, pcb->mss);
-          }
-          LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_receive: congestion avoidance cwnd %"TCPWNDSIZE_F"\n", pcb->cwnd));
+         ssthresh), but not while still in (SACK based) fast recovery. */
+      if ((pcb->state >= ESTABLISHED) && !(pcb->flags & TF_INFR)) {
+#if LWIP_TCP_CC
+        u32_t rtt = 0;
+        if (pcb->rttest && TCP_SEQ_LT(pcb->rtseq, ackno)) {
+          /* the same sample as for the RTO below, but in milliseconds */
+          rtt = LWIP_MAX(sys_now() - pcb->cc_rtt_start, 1);
         }
+#endif /* LWIP_TCP_CC */
+        TCP_CC_ON_ACK(pcb, acked, rtt);
       }
       LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_receive: ACK for %"U32_F", unacked->seqno %"U32_F":%"U32_F"\n",
                                     ackno,
@@ -1295,6 +1359,13 @@ tcp_receive(struct tcp_pcb *pcb)
          ->unsent list after a retransmission, so these segments may
          in fact have been sent once. */
       pcb->unsent = tcp_free_acked_segments(pcb, pcb->unsent, "unsent", pcb->unacked);
+#if LWIP_TCP_SACK_IN
+      if (pcb->flags & TF_INFR) {
+        /* Partial ACK in SACK based recovery: the new first unacked segment is
+           lost, too (unless it has been retransmitted already) */
+        tcp_rexmit_sack(pcb, 1);
+      }
+#endif /* LWIP_TCP_SACK_IN */
 
       /* If there's nothing left to acknowledge, stop the retransmit
          timer, otherwise reset it to start again */
@@ -1922,6 +1993,10 @@ tcp_parseopt(struct tcp_pcb *pcb)
 
   LWIP_ASSERT("tcp_parseopt: invalid pcb", pcb != NULL);
 
+#if LWIP_TCP_SACK_IN
+  tcp_sack_blocks_num = 0;
+#endif /* LWIP_TCP_SACK_IN */
+
   /* Parse the TCP MSS option, if present. */
   if (tcphdr_optlen != 0) {
     for (tcp_optidx = 0; tcp_optidx < tcphdr_optlen; ) {
@@ -1999,7 +2074,7 @@ tcp_parseopt(struct tcp_pcb *pcb)
           tcp_optidx += LWIP_TCP_OPT_LEN_TS - 6;
           break;
 #endif /* LWIP_TCP_TIMESTAMPS */
-#if LWIP_TCP_SACK_OUT
+#if LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN
         case LWIP_TCP_OPT_SACK_PERM:
           LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: SACK_PERM\n"));
           if (tcp_get_next_optbyte() != LWIP_TCP_OPT_LEN_SACK_PERM || (tcp_optidx - 2 + LWIP_TCP_OPT_LEN_SACK_PERM) > tcphdr_optlen) {
@@ -2013,7 +2088,34 @@ tcp_parseopt(struct tcp_pcb *pcb)
             tcp_set_flags(pcb, TF_SACK);
           }
           break;
-#endif /* LWIP_TCP_SACK_OUT */
+#endif /* LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN */
+#if LWIP_TCP_SACK_IN
+        case LWIP_TCP_OPT_SACK:
+          LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: SACK\n"));
+          data = tcp_get_next_optbyte();
+          if ((data < 10) || (((data - 2) % 8) != 0) || (tcp_optidx - 2 + data) > tcphdr_optlen) {
+            /* Bad length */
+            LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: bad length\n"));
+            return;
+          }
+          /* TCP SACK option with valid length: 1..4 blocks of left and right edge */
+          for (data = (u8_t)((data - 2) / 8); data > 0; data--) {
+            u32_t left = 0, right = 0;
+            int i;
+            for (i = 0; i < 4; i++) {
+              left = (left << 8) | tcp_get_next_optbyte();
+            }
+            for (i = 0; i < 4; i++) {
+              right = (right << 8) | tcp_get_next_optbyte();
+            }
+            if ((tcp_sack_blocks_num < TCP_SACK_IN_MAX_BLOCKS) && TCP_SEQ_LT(left, right)) {
+              tcp_sack_blocks[tcp_sack_blocks_num].left = left;
+              tcp_sack_blocks[tcp_sack_blocks_num].right = right;
+              tcp_sack_blocks_num++;
+            }
+          }
+          break;
+#endif /* LWIP_TCP_SACK_IN */
         default:
           LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: other\n"));
           data = tcp_get_next_optbyte();
@@ -2181,4 +2283,60 @@ tcp_remove_sacks_gt(struct tcp_pcb *pcb, u32_t seq)
 
 #endif /* LWIP_TCP_SACK_OUT */
 
+#if LWIP_TCP_SACK_IN
+/**
+ * Called by tcp_receive() to mark the unacked segments covered by the SACK
+ * blocks of the incoming segment (the scoreboard of RFC 6675).
+ *
+ * @param pcb the tcp_pcb for which a segment arrived
+ * @return the number of bytes of all unacked segments SACKed so far
+ */
+static u32_t
+tcp_sack_update_scoreboard(struct tcp_pcb *pcb)
+{
+  struct tcp_seg *seg;
+  u32_t sacked = 0;
+
+  for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+    if (!(seg->flags & TF_SEG_SACKED)) {
+      u32_t left = lwip_ntohl(seg->tcphdr->seqno);
+      u32_t right = left + TCP_TCPLEN(seg);
+      u8_t i;
+
+      for (i = 0; i < tcp_sack_blocks_num; i++) {
+        if (TCP_SEQ_LEQ(tcp_sack_blocks[i].left, left) &&
+            TCP_SEQ_GEQ(tcp_sack_blocks[i].right, right)) {
+          LWIP_DEBUGF(TCP_FR_DEBUG, ("tcp_receive: SACKed %"U32_F":%"U32_F"\n", left, right));
+          seg->flags |= TF_SEG_SACKED;
+          break;
+        }
+      }
+    }
+    if (seg->flags & TF_SEG_SACKED) {
+      sacked += seg->len;
+    }
+  }
+  return sacked;
+}
+
+/**
+ * Called by tcp_receive() when fast recovery ends: segments retransmitted
+ * during this recovery may be retransmitted again in the next one.
+ *
+ * @param pcb the tcp_pcb that left fast recovery
+ */
+static void
+tcp_sack_end_recovery(struct tcp_pcb *pcb)
+{
+  struct tcp_seg *seg;
+
+  for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+    seg->flags &= (u8_t)~TF_SEG_SACK_REXMIT;
+  }
+  for (seg = pcb->unsent; seg != NULL; seg = seg->next) {
+    seg->flags &= (u8_t)~TF_SEG_SACK_REXMIT;
+  }
+}
+#endif /* LWIP_TCP_SACK_IN */
+
 #endif /* LWIP_TCP */
@@ -74,7 +74,7 @@
 #include "lwip/stats.h"
 #include "lwip/ip6.h"
 #include "lwip/ip6_addr.h"
-#if LWIP_TCP_TIMESTAMPS
+#if LWIP_TCP_TIMESTAMPS || LWIP_TCP_CC
 #include "lwip/sys.h"
 #endif
 
@@ -129,6 +129,15 @@ static err_t tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb, struct
 static err_t tcp_output_control_segment_netif(const struct tcp_pcb *pcb, struct pbuf *p,
                                               const ip_addr_t *src, const ip_addr_t *dst,
                                               struct netif *netif);
+#if LWIP_TCP_SACK_IN
+static u32_t tcp_sack_pipe(struct tcp_pcb *pcb);
+
+/* In SACK recovery, a segment may be sent if it fits into what cwnd leaves of
+   the pipe, the first unacked one is always retransmitted right away
+   (RFC 6675, section 5, step 4.3) */
+#define TCP_SACK_CWND_ALLOWS(pcb, seg, cwnd_room) (((seg)->len <= (cwnd_room)) || \
+                                                  (lwip_ntohl((seg)->tcphdr->seqno) == (pcb)->lastack))
+#endif /* LWIP_TCP_SACK_IN */
 
 /* tcp_route: common code that returns a fixed bound netif or calls ip_route */
 static struct netif *
@@ -350,6 +359,57 @@ tcp_write_checks(struct tcp_pcb *pcb, u16_t len)
   return ERR_OK;
 }
 
+#if LWIP_ZEROCOPY
+/** Free-callback of a struct tcp_pbuf_ref: releases the referenced pbuf */
+static void
+tcp_pbuf_ref_free(struct pbuf *p)
+{
+  struct tcp_pbuf_ref *pr = (struct tcp_pbuf_ref *)p;
+
+  LWIP_ASSERT("p != NULL", p != NULL);
+  if (pr->original != NULL) {
+    pbuf_free(pr->original);
+  }
+  memp_free(MEMP_TCP_PBUF_REF, pr);
+}
+#endif /* LWIP_ZEROCOPY */
+
+/** Allocate a pbuf that references (does not copy) len bytes at data.
+ * Without ref, the data must stay valid until ACKed (PBUF_ROM). With ref, the
+ * new pbuf holds a reference on the pbuf containing data until it is freed.
+ */
+static struct pbuf *
+tcp_pbuf_alloc_nocopy(pbuf_layer layer, const u8_t *data, u16_t len, struct pbuf *ref)
+{
+  struct pbuf *p;
+
+#if LWIP_ZEROCOPY
+  if (ref != NULL) {
+    struct tcp_pbuf_ref *pr = (struct tcp_pbuf_ref *)memp_malloc(MEMP_TCP_PBUF_REF);
+    if (pr == NULL) {
+      return NULL;
+    }
+    pr->pc.custom_free_function = tcp_pbuf_ref_free;
+    /* PBUF_RAW: headers always go into a separate pbuf for referenced data */
+    p = pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &pr->pc, LWIP_CONST_CAST(u8_t *, data), len);
+    LWIP_ASSERT("pbuf_alloced_custom failed", p != NULL);
+    pbuf_ref(ref);
+    pr->original = ref;
+    return p;
+  }
+#else /* LWIP_ZEROCOPY */
+  LWIP_UNUSED_ARG(ref);
+#endif /* LWIP_ZEROCOPY */
+  p = pbuf_alloc(layer, len, PBUF_ROM);
+  if (p != NULL) {
+    /* reference the non-volatile payload data */
+    ((struct pbuf_rom *)p)->payload = data;
+  }
+  return p;
+}
+
+static err_t tcp_write_data(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags, struct pbuf *ref);
+
 /**
  * @ingroup tcp_raw
  * Write data for sending (but does not send it immediately).
@@ -391,6 +451,42 @@ tcp_write_checks(struct tcp_pcb *pcb, u16_t len)
  */
 err_t
 tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
+{
+  return tcp_write_data(pcb, arg, len, apiflags, NULL);
+}
+
+#if LWIP_ZEROCOPY
+/**
+ * @ingroup tcp_raw
+ * Write data of a pbuf for sending without copying it (but does not send it
+ * immediately, see tcp_write()).
+ *
+ * Instead of relying on the application to keep the data unchanged until it is
+ * ACKed, the queued segments hold a reference on p until they are freed. The
+ * application may pbuf_free() its own reference right after this call but must
+ * not change the data any more. Only the payload of p itself is used, not the
+ * rest of its chain.
+ *
+ * @param pcb Protocol control block for the TCP connection to enqueue data for.
+ * @param p pbuf holding the data to be enqueued for sending.
+ * @param offset Offset of the data in p->payload
+ * @param len Data length in bytes
+ * @param apiflags TCP_WRITE_FLAG_MORE or 0 (TCP_WRITE_FLAG_COPY is ignored)
+ * @return ERR_OK if enqueued, another err_t on error (as tcp_write())
+ */
+err_t
+tcp_write_pbuf(struct tcp_pcb *pcb, struct pbuf *p, u16_t offset, u16_t len, u8_t apiflags)
+{
+  LWIP_ERROR("tcp_write_pbuf: invalid pbuf", (p != NULL) && ((u32_t)offset + len <= p->len), return ERR_ARG);
+  return tcp_write_data(pcb, (const u8_t *)p->payload + offset, len,
+                        (u8_t)(apiflags & ~TCP_WRITE_FLAG_COPY), p);
+}
+#endif /* LWIP_ZEROCOPY */
+
+/** Implementation of tcp_write() and tcp_write_pbuf(): ref is the pbuf
+ * containing the data for tcp_write_pbuf() or NULL. */
+static err_t
+tcp_write_data(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags, struct pbuf *ref)
 {
   struct pbuf *concat_p = NULL;
   struct tcp_seg *last_unsent = NULL, *seg = NULL, *prev_seg = NULL, *queue = NULL;
@@ -559,18 +655,17 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
         /* If the last unsent pbuf is of type PBUF_ROM, try to extend it. */
         struct pbuf *p;
         for (p = last_unsent->p; p->next != NULL; p = p->next);
-        if (((p->type_internal & (PBUF_TYPE_FLAG_STRUCT_DATA_CONTIGUOUS | PBUF_TYPE_FLAG_DATA_VOLATILE)) == 0) &&
+        if ((ref == NULL) &&
+            ((p->type_internal & (PBUF_TYPE_FLAG_STRUCT_DATA_CONTIGUOUS | PBUF_TYPE_FLAG_DATA_VOLATILE)) == 0) &&
             (const u8_t *)p->payload + p->len == (const u8_t *)arg) {
           LWIP_ASSERT("tcp_write: ROM pbufs cannot be oversized", pos == 0);
           extendlen = seglen;
         } else {
-          if ((concat_p = pbuf_alloc(PBUF_RAW, seglen, PBUF_ROM)) == NULL) {
+          if ((concat_p = tcp_pbuf_alloc_nocopy(PBUF_RAW, (const u8_t *)arg + pos, seglen, ref)) == NULL) {
             LWIP_DEBUGF(TCP_OUTPUT_DEBUG | LWIP_DBG_LEVEL_SERIOUS,
                         ("tcp_write: could not allocate memory for zero-copy pbuf\n"));
             goto memerr;
           }
-          /* reference the non-volatile payload data */
-          ((struct pbuf_rom *)concat_p)->payload = (const u8_t *)arg + pos;
           queuelen += pbuf_clen(concat_p);
         }
 #if TCP_CHECKSUM_ON_COPY
@@ -621,13 +716,14 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
       /* Copy is not set: First allocate a pbuf for holding the data.
        * Since the referenced data is available at least until it is
        * sent out on the link (as it has to be ACKed by the remote
-       * party) we can safely use PBUF_ROM instead of PBUF_REF here.
+       * party) we can safely use PBUF_ROM instead of PBUF_REF here
+       * (tcp_write_pbuf() additionally keeps a reference on the pbuf).
        */
       struct pbuf *p2;
 #if TCP_OVERSIZE
       LWIP_ASSERT("oversize == 0", oversize == 0);
 #endif /* TCP_OVERSIZE */
-      if ((p2 = pbuf_alloc(PBUF_TRANSPORT, seglen, PBUF_ROM)) == NULL) {
+      if ((p2 = tcp_pbuf_alloc_nocopy(PBUF_TRANSPORT, (const u8_t *)arg + pos, seglen, ref)) == NULL) {
         LWIP_DEBUGF(TCP_OUTPUT_DEBUG | LWIP_DBG_LEVEL_SERIOUS, ("tcp_write: could not allocate memory for zero-copy pbuf\n"));
         goto memerr;
       }
@@ -639,8 +735,6 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
         chksum = SWAP_BYTES_IN_WORD(chksum);
       }
 #endif /* TCP_CHECKSUM_ON_COPY */
-      /* reference the non-volatile payload data */
-      ((struct pbuf_rom *)p2)->payload = (const u8_t *)arg + pos;
 
       /* Second, allocate a pbuf for the headers. */
       if ((p = pbuf_alloc(PBUF_TRANSPORT, optlen, PBUF_RAM)) == NULL) {
@@ -1059,13 +1153,13 @@ tcp_enqueue_flags(struct tcp_pcb *pcb, u8_t flags)
       optflags |= TF_SEG_OPTS_WND_SCALE;
     }
 #endif /* LWIP_WND_SCALE */
-#if LWIP_TCP_SACK_OUT
+#if LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN
     if ((pcb->state != SYN_RCVD) || (pcb->flags & TF_SACK)) {
       /* In a <SYN,ACK> (sent in state SYN_RCVD), the SACK_PERM option may only
          be sent if we received a SACK_PERM option from the remote host. */
       optflags |= TF_SEG_OPTS_SACK_PERM;
     }
-#endif /* LWIP_TCP_SACK_OUT */
+#endif /* LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN */
   }
 #if LWIP_TCP_TIMESTAMPS
   if ((pcb->flags & TF_TIMESTAMP) || ((flags & TCP_SYN) && (pcb->state != SYN_RCVD))) {
@@ -1244,6 +1338,10 @@ tcp_output(struct tcp_pcb *pcb)
   u32_t wnd, snd_nxt;
   err_t err;
   struct netif *netif;
+#if LWIP_TCP_SACK_IN
+  /* room left in cwnd: only limits sending while in SACK recovery */
+  u32_t cwnd_room = 0xFFFFFFFFUL;
+#endif /* LWIP_TCP_SACK_IN */
 #if TCP_CWND_DEBUG
   s16_t i = 0;
 #endif /* TCP_CWND_DEBUG */
@@ -1264,6 +1362,15 @@ tcp_output(struct tcp_pcb *pcb)
   }
 
   wnd = LWIP_MIN(pcb->snd_wnd, pcb->cwnd);
+#if LWIP_TCP_SACK_IN
+  if ((pcb->flags & (TF_SACK | TF_INFR)) == (TF_SACK | TF_INFR)) {
+    /* RFC 6675: in recovery, cwnd limits the data in flight ('pipe'), not the
+       distance to lastack (which includes SACKed and lost segments) */
+    u32_t pipe = tcp_sack_pipe(pcb);
+    wnd = pcb->snd_wnd;
+    cwnd_room = (pipe < pcb->cwnd) ? (pcb->cwnd - pipe) : 0;
+  }
+#endif /* LWIP_TCP_SACK_IN */
 
   seg = pcb->unsent;
 
@@ -1306,7 +1413,11 @@ tcp_output(struct tcp_pcb *pcb)
   }
 
   /* Handle the current segment not fitting within the window */
-  if (lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len > wnd) {
+  if ((lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len > wnd)
+#if LWIP_TCP_SACK_IN
+      || !TCP_SACK_CWND_ALLOWS(pcb, seg, cwnd_room)
+#endif /* LWIP_TCP_SACK_IN */
+     ) {
     /* We need to start the persistent timer when the next unsent segment does not fit
      * within the remaining (could be 0) send window and RTO timer is not running (we
      * have no in-flight data). If window is still too small after persist timer fires,
@@ -1334,7 +1445,11 @@ tcp_output(struct tcp_pcb *pcb)
   }
   /* data available and window allows it to be sent? */
   while (seg != NULL &&
-         lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len <= wnd) {
+         lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len <= wnd
+#if LWIP_TCP_SACK_IN
+         && TCP_SACK_CWND_ALLOWS(pcb, seg, cwnd_room)
+#endif /* LWIP_TCP_SACK_IN */
+        ) {
     LWIP_ASSERT("RST not expected here!",
                 (TCPH_FLAGS(seg->tcphdr) & TCP_RST) == 0);
     /* Stop sending if the nagle algorithm would prevent it
@@ -1374,6 +1489,11 @@ tcp_output(struct tcp_pcb *pcb)
     if (pcb->state != SYN_SENT) {
       tcp_clear_flags(pcb, TF_ACK_DELAY | TF_ACK_NOW);
     }
+#if LWIP_TCP_SACK_IN
+    if (cwnd_room != 0xFFFFFFFFUL) {
+      cwnd_room -= LWIP_MIN(cwnd_room, seg->len);
+    }
+#endif /* LWIP_TCP_SACK_IN */
     snd_nxt = lwip_ntohl(seg->tcphdr->seqno) + TCP_TCPLEN(seg);
     if (TCP_SEQ_LT(pcb->snd_nxt, snd_nxt)) {
       pcb->snd_nxt = snd_nxt;
@@ -1522,7 +1642,7 @@ tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb, struct netif *netif
     opts += 1;
   }
 #endif
-#if LWIP_TCP_SACK_OUT
+#if LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN
   if (seg->flags & TF_SEG_OPTS_SACK_PERM) {
     /* Pad with two NOP options to make everything nicely aligned
      * NOTE: When we send both timestamp and SACK_PERM options,
@@ -1539,9 +1659,18 @@ tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb, struct netif *netif
     pcb->rtime = 0;
   }
 
+#if LWIP_TCP_CC
+  /* Time new data only: the ACK of a retransmission is ambiguous (Karn), and
+     a near zero sample would mislead delay based congestion control */
+  if ((pcb->rttest == 0) && TCP_SEQ_GEQ(lwip_ntohl(seg->tcphdr->seqno), pcb->snd_nxt)) {
+#else /* LWIP_TCP_CC */
   if (pcb->rttest == 0) {
+#endif /* LWIP_TCP_CC */
     pcb->rttest = tcp_ticks;
     pcb->rtseq = lwip_ntohl(seg->tcphdr->seqno);
+#if LWIP_TCP_CC
+    pcb->cc_rtt_start = sys_now();
+#endif /* LWIP_TCP_CC */
 
     LWIP_DEBUGF(TCP_RTO_DEBUG, ("tcp_output_segment: rtseq %"U32_F"\n", pcb->rtseq));
   }
@@ -1673,6 +1802,16 @@ tcp_rexmit_rto_prepare(struct tcp_pcb *pcb)
   tcp_set_flags(pcb, TF_RTO);
   /* Record the next byte following retransmit */
   pcb->rto_end = lwip_ntohl(seg->tcphdr->seqno) + TCP_TCPLEN(seg);
+#if LWIP_TCP_SACK_IN
+  /* The remote host may discard data it has SACKed (RFC 2018, section 8), so
+     forget the scoreboard and retransmit everything. This ends a SACK recovery. */
+  for (seg = pcb->unsent; seg != NULL; seg = seg->next) {
+    seg->flags &= (u8_t)~(TF_SEG_SACKED | TF_SEG_SACK_REXMIT);
+  }
+  if (pcb->flags & TF_SACK) {
+    tcp_clear_flags(pcb, TF_INFR);
+  }
+#endif /* LWIP_TCP_SACK_IN */
   /* Don't take any RTT measurements after retransmitting. */
   pcb->rttest = 0;
 
@@ -1717,6 +1856,42 @@ tcp_rexmit_rto(struct tcp_pcb *pcb)
   }
 }
 
+/**
+ * Insert a segment removed from the unacked queue into the unsent queue
+ * for retransmission, keeping the unsent queue sorted.
+ *
+ * @param pcb the tcp_pcb the segment belongs to
+ * @param seg the segment to retransmit
+ */
+static void
+tcp_rexmit_requeue(struct tcp_pcb *pcb, struct tcp_seg *seg)
+{
+  struct tcp_seg **cur_seg;
+
+  cur_seg = &(pcb->unsent);
+  while (*cur_seg &&
+         TCP_SEQ_LT(lwip_ntohl((*cur_seg)->tcphdr->seqno), lwip_ntohl(seg->tcphdr->seqno))) {
+    cur_seg = &((*cur_seg)->next );
+  }
+  seg->next = *cur_seg;
+  *cur_seg = seg;
+#if TCP_OVERSIZE
+  if (seg->next == NULL) {
+    /* the retransmitted segment is last in unsent, so reset unsent_oversize */
+    pcb->unsent_oversize = 0;
+  }
+#endif /* TCP_OVERSIZE */
+#if LWIP_TCP_SACK_IN
+  seg->flags |= TF_SEG_SACK_REXMIT;
+#endif /* LWIP_TCP_SACK_IN */
+
+  /* Don't take any rtt measurements after retransmitting. */
+  pcb->rttest = 0;
+
+  /* Do the actual retransmission. */
+  MIB2_STATS_INC(mib2.tcpretranssegs);
+}
+
 /**
  * Requeue the first unacked segment for retransmission
  *
@@ -1728,7 +1903,6 @@ err_t
 tcp_rexmit(struct tcp_pcb *pcb)
 {
   struct tcp_seg *seg;
-  struct tcp_seg **cur_seg;
 
   LWIP_ASSERT("tcp_rexmit: invalid pcb", pcb != NULL);
 
@@ -1746,32 +1920,15 @@ tcp_rexmit(struct tcp_pcb *pcb)
   }
 
   /* Move the first unacked segment to the unsent queue */
-  /* Keep the unsent queue sorted. */
   pcb->unacked = seg->next;
+  tcp_rexmit_requeue(pcb, seg);
 
-  cur_seg = &(pcb->unsent);
-  while (*cur_seg &&
-         TCP_SEQ_LT(lwip_ntohl((*cur_seg)->tcphdr->seqno), lwip_ntohl(seg->tcphdr->seqno))) {
-    cur_seg = &((*cur_seg)->next );
-  }
-  seg->next = *cur_seg;
-  *cur_seg = seg;
-#if TCP_OVERSIZE
-  if (seg->next == NULL) {
-    /* the retransmitted segment is last in unsent, so reset unsent_oversize */
-    pcb->unsent_oversize = 0;
-  }
-#endif /* TCP_OVERSIZE */
-
+  /* Only retransmissions of the first unacked segment count towards
+     TCP_MAXRTX, a SACK recovery may retransmit many holes at once */
   if (pcb->nrtx < 0xFF) {
     ++pcb->nrtx;
   }
 
-  /* Don't take any rtt measurements after retransmitting. */
-  pcb->rttest = 0;
-
-  /* Do the actual retransmission. */
-  MIB2_STATS_INC(mib2.tcpretranssegs);
   /* No need to call tcp_output: we are always called from tcp_input()
      and thus tcp_output directly returns. */
   return ERR_OK;
@@ -1796,20 +1953,20 @@ tcp_rexmit_fast(struct tcp_pcb *pcb)
                  (u16_t)pcb->dupacks, pcb->lastack,
                  lwip_ntohl(pcb->unacked->tcphdr->seqno)));
     if (tcp_rexmit(pcb) == ERR_OK) {
-      /* Set ssthresh to half of the minimum of the current
-       * cwnd and the advertised window */
-      pcb->ssthresh = LWIP_MIN(pcb->cwnd, pcb->snd_wnd) / 2;
-
-      /* The minimum value for ssthresh should be 2 MSS */
-      if (pcb->ssthresh < (2U * pcb->mss)) {
-        LWIP_DEBUGF(TCP_FR_DEBUG,
-                    ("tcp_receive: The minimum value for ssthresh %"TCPWNDSIZE_F
-                     " should be min 2 mss %"U16_F"...\n",
-                     pcb->ssthresh, (u16_t)(2 * pcb->mss)));
-        pcb->ssthresh = 2 * pcb->mss;
+      /* Let congestion control set ssthresh */
+      TCP_CC_ON_LOSS(pcb);
+
+#if LWIP_TCP_SACK_IN
+      if (pcb->flags & TF_SACK) {
+        /* tcp_output() limits the data in flight by the pipe estimate
+           instead of an inflated cwnd */
+        pcb->cwnd = pcb->ssthresh;
+        pcb->recover = pcb->snd_nxt;
+      } else
+#endif /* LWIP_TCP_SACK_IN */
+      {
+        pcb->cwnd = pcb->ssthresh + 3 * pcb->mss;
       }
-
-      pcb->cwnd = pcb->ssthresh + 3 * pcb->mss;
       tcp_set_flags(pcb, TF_INFR);
 
       /* Reset the retransmission timer to prevent immediate rto retransmissions */
@@ -1818,6 +1975,83 @@ tcp_rexmit_fast(struct tcp_pcb *pcb)
   }
 }
 
+#if LWIP_TCP_SACK_IN
+/**
+ * Requeue the unacked segments the scoreboard regards as lost for
+ * retransmission (RFC 6675): a segment is lost if more than 2 * MSS bytes
+ * above it were SACKed. Each segment is retransmitted only once per recovery,
+ * tcp_output() sends them first and as far as the pipe estimate allows.
+ *
+ * Called by tcp_receive() while in SACK based fast recovery.
+ *
+ * @param pcb the tcp_pcb for which to retransmit lost segments
+ * @param head_lost regard the first unacked segment as lost, too (after a
+ *                  partial ACK, like NewReno)
+ */
+void
+tcp_rexmit_sack(struct tcp_pcb *pcb, u8_t head_lost)
+{
+  struct tcp_seg *seg, **cur_seg;
+  u32_t sacked = 0;
+
+  LWIP_ASSERT("tcp_rexmit_sack: invalid pcb", pcb != NULL);
+
+  for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+    if (seg->flags & TF_SEG_SACKED) {
+      sacked += seg->len;
+    }
+  }
+  cur_seg = &pcb->unacked;
+  while ((seg = *cur_seg) != NULL) {
+    if (seg->flags & TF_SEG_SACKED) {
+      sacked -= seg->len;
+    } else if (!(seg->flags & TF_SEG_SACK_REXMIT) &&
+               (head_lost || (sacked > 2U * pcb->mss)) &&
+               !tcp_output_segment_busy(seg)) {
+      LWIP_DEBUGF(TCP_FR_DEBUG, ("tcp_rexmit_sack: retransmit %"U32_F"\n",
+                                 lwip_ntohl(seg->tcphdr->seqno)));
+      *cur_seg = seg->next;
+      tcp_rexmit_requeue(pcb, seg);
+      head_lost = 0;
+      continue;
+    }
+    head_lost = 0;
+    cur_seg = &seg->next;
+  }
+}
+
+/**
+ * Estimate the number of bytes in flight while in SACK based fast recovery
+ * (RFC 6675 'pipe'): unacked segments that are neither SACKed nor lost count
+ * once, retransmitted segments count (again) as well.
+ */
+static u32_t
+tcp_sack_pipe(struct tcp_pcb *pcb)
+{
+  struct tcp_seg *seg;
+  u32_t sacked = 0, pipe = 0;
+
+  for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+    if (seg->flags & TF_SEG_SACKED) {
+      sacked += seg->len;
+    }
+  }
+  for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+    if (seg->flags & TF_SEG_SACKED) {
+      sacked -= seg->len;
+      continue;
+    }
+    if (sacked <= 2U * pcb->mss) {
+      pipe += seg->len;
+    }
+    if (seg->flags & TF_SEG_SACK_REXMIT) {
+      pipe += seg->len;
+    }
+  }
+  return pipe;
+}
+#endif /* LWIP_TCP_SACK_IN */
+
 static struct pbuf *
 tcp_output_alloc_header_common(u32_t ackno, u16_t optlen, u16_t datalen,
                         u32_t seqno_be /* already in network byte order */,
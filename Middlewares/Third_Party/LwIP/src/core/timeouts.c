@@ -60,6 +60,10 @@
 #include "lwip/dhcp6.h"
 #include "lwip/sys.h"
 #include "lwip/pbuf.h"
+#if LWIP_TIMERS_WHEEL
+/* needed by default MEMP_NUM_SYS_TIMEOUT */
+#include "netif/ppp/ppp_opts.h"
+#endif /* LWIP_TIMERS_WHEEL */
 
 #if LWIP_DEBUG_TIMERNAMES
 #define HANDLER(x) x, #x
@@ -118,17 +122,38 @@ const int lwip_num_cyclic_timers = LWIP_ARRAYSIZE(lwip_cyclic_timers);
 
 #if LWIP_TIMERS && !LWIP_TIMERS_CUSTOM
 
+#if LWIP_TIMERS_WHEEL
+/** All pending timeouts */
+static struct sys_timeo_wheel timeo_wheel;
+/** Pending timeouts hashed by arg, for sys_untimeout() */
+static struct sys_timeo *timeo_by_arg[MEMP_NUM_SYS_TIMEOUT];
+#else /* LWIP_TIMERS_WHEEL */
 /** The one and only timeout list */
 static struct sys_timeo *next_timeout;
+#endif /* LWIP_TIMERS_WHEEL */
 
 static u32_t current_timeout_due_time;
 
 #if LWIP_TESTMODE
+#if LWIP_TIMERS_WHEEL
+struct sys_timeo_wheel*
+sys_timeouts_get_wheel(void)
+{
+  return &timeo_wheel;
+}
+
+struct sys_timeo**
+sys_timeouts_get_by_arg(void)
+{
+  return timeo_by_arg;
+}
+#else /* LWIP_TIMERS_WHEEL */
 struct sys_timeo**
 sys_timeouts_get_next_timeout(void)
 {
   return &next_timeout;
 }
+#endif /* LWIP_TIMERS_WHEEL */
 #endif
 
 #if LWIP_TCP
@@ -176,6 +201,236 @@ tcp_timer_needed(void)
 }
 #endif /* LWIP_TCP */
 
+#if LWIP_TIMERS_WHEEL
+/*
+ * The wheel has 8 levels of 16 slots. A timeout that expires in the same
+ * 16 ms block as timeo_wheel.time sits on level 0 in the slot of its exact
+ * expiry time, one that expires in the same 256 ms block (but a later 16 ms
+ * one) on level 1 in the slot of its 16 ms block, and so on up to level 7,
+ * whose slots split the u32_t time range into 16 blocks.
+ * Every level thus only holds timeouts that expire after all timeouts of the
+ * levels below. When the wheel is advanced into a new block, the slot of that
+ * block is moved down ("cascaded") to the lower levels.
+ * Timeouts with equal expiry time always share a slot and keep the order in
+ * which they were added, like in the sorted list.
+ */
+#define SYS_TIMEO_WHEEL_MASK   (SYS_TIMEO_WHEEL_SLOTS - 1)
+#define SYS_TIMEO_SLOT_LEVEL(slot)  ((slot) >> SYS_TIMEO_WHEEL_BITS)
+#define SYS_TIMEO_SLOT_INDEX(slot)  ((slot) & SYS_TIMEO_WHEEL_MASK)
+#define SYS_TIMEO_ARG_HASH(arg) \
+  ((((u32_t)(mem_ptr_t)(arg) * 0x9E3779B1UL) >> 16) % MEMP_NUM_SYS_TIMEOUT)
+
+/* Insert t before pos in a circular slot list */
+static void
+sys_timeo_insert_before(struct sys_timeo *pos, struct sys_timeo *t)
+{
+  t->next = pos;
+  t->prev = pos->prev;
+  pos->prev->next = t;
+  pos->prev = t;
+}
+
+/* Add t to the slot for its expiry time (relative to timeo_wheel.time) */
+static void
+sys_timeo_wheel_place(struct sys_timeo *t)
+{
+  struct sys_timeo **slot;
+  struct sys_timeo *pos;
+  u32_t diff;
+  u8_t level = 0;
+  u8_t idx;
+
+  if (TIME_LESS_THAN(t->time, timeo_wheel.time)) {
+    /* already overdue: due in the current slot, sorted in before the
+       timeouts that expire later (like in the sorted list) */
+    idx = (u8_t)(timeo_wheel.time & SYS_TIMEO_WHEEL_MASK);
+    slot = &timeo_wheel.slots[0][idx];
+    t->slot = idx;
+    timeo_wheel.used[0] |= (u16_t)(1U << idx);
+    if (*slot == NULL) {
+      t->next = t->prev = t;
+      *slot = t;
+      return;
+    }
+    pos = *slot;
+    do {
+      if (TIME_LESS_THAN(t->time, pos->time)) {
+        sys_timeo_insert_before(pos, t);
+        if (pos == *slot) {
+          *slot = t;
+        }
+        return;
+      }
+      pos = pos->next;
+    } while (pos != *slot);
+    sys_timeo_insert_before(pos, t);
+    return;
+  }
+
+  /* the lowest level whose block contains both t->time and the wheel time */
+  diff = t->time ^ timeo_wheel.time;
+  while ((level < SYS_TIMEO_WHEEL_LEVELS - 1) &&
+         ((diff >> (SYS_TIMEO_WHEEL_BITS * (level + 1))) != 0)) {
+    level++;
+  }
+  idx = (u8_t)((t->time >> (SYS_TIMEO_WHEEL_BITS * level)) & SYS_TIMEO_WHEEL_MASK);
+  slot = &timeo_wheel.slots[level][idx];
+  t->slot = (u8_t)((level << SYS_TIMEO_WHEEL_BITS) | idx);
+  timeo_wheel.used[level] |= (u16_t)(1U << idx);
+  /* append to keep the timeouts of equal expiry time in order */
+  if (*slot == NULL) {
+    t->next = t->prev = t;
+    *slot = t;
+  } else {
+    sys_timeo_insert_before(*slot, t);
+  }
+}
+
+/* Remove t from its slot */
+static void
+sys_timeo_wheel_unlink(struct sys_timeo *t)
+{
+  u8_t level = SYS_TIMEO_SLOT_LEVEL(t->slot);
+  u8_t idx = SYS_TIMEO_SLOT_INDEX(t->slot);
+  struct sys_timeo **slot = &timeo_wheel.slots[level][idx];
+
+  if (t->next == t) {
+    *slot = NULL;
+    timeo_wheel.used[level] &= (u16_t)~(1U << idx);
+  } else {
+    t->prev->next = t->next;
+    t->next->prev = t->prev;
+    if (*slot == t) {
+      *slot = t->next;
+    }
+  }
+}
+
+/* Find the first non-empty slot, starting at the current slot of each level.
+ * Returns its level (-1 if the wheel is empty) and sets *start to the time
+ * the slot begins, which is the exact expiry time for level 0. */
+static int
+sys_timeo_wheel_next(u32_t *start)
+{
+  int level;
+
+  for (level = 0; level < SYS_TIMEO_WHEEL_LEVELS; level++) {
+    u32_t shift = (u32_t)(SYS_TIMEO_WHEEL_BITS * level);
+    u32_t cur = (timeo_wheel.time >> shift) & SYS_TIMEO_WHEEL_MASK;
+    u32_t used = timeo_wheel.used[level];
+    u32_t dist = 0;
+
+    if (used == 0) {
+      continue;
+    }
+    /* rotate the bitmap so that bit 0 is the current slot */
+    used = ((used >> cur) | (used << (SYS_TIMEO_WHEEL_SLOTS - cur))) & 0xFFFF;
+    while ((used & (1U << dist)) == 0) {
+      dist++;
+    }
+    *start = (u32_t)(((timeo_wheel.time >> shift) + dist) << shift);
+    return level;
+  }
+  return -1;
+}
+
+/* Move the current slots of the given level and the levels below it down
+ * to where they belong now that timeo_wheel.time has entered their block */
+static void
+sys_timeo_wheel_cascade(int level)
+{
+  for (; level > 0; level--) {
+    u8_t idx = (u8_t)((timeo_wheel.time >> (SYS_TIMEO_WHEEL_BITS * level)) & SYS_TIMEO_WHEEL_MASK);
+    struct sys_timeo *t = timeo_wheel.slots[level][idx];
+    struct sys_timeo *last;
+
+    if (t == NULL) {
+      continue;
+    }
+    timeo_wheel.slots[level][idx] = NULL;
+    timeo_wheel.used[level] &= (u16_t)~(1U << idx);
+    last = t->prev;
+    for (;;) {
+      struct sys_timeo *next = t->next;
+      sys_timeo_wheel_place(t);
+      if (t == last) {
+        break;
+      }
+      t = next;
+    }
+  }
+}
+
+/* Advance the wheel up to 'now' until a timeout is found in the current
+ * level 0 slot. Returns the first timeout of that slot or NULL. */
+static struct sys_timeo *
+sys_timeo_wheel_first(u32_t now)
+{
+  for (;;) {
+    u32_t start;
+    int level;
+    struct sys_timeo *t = timeo_wheel.slots[0][timeo_wheel.time & SYS_TIMEO_WHEEL_MASK];
+
+    if (t != NULL) {
+      return t;
+    }
+    level = sys_timeo_wheel_next(&start);
+    if ((level < 0) || TIME_LESS_THAN(now, start)) {
+      /* nothing due: all slots passed on the way to 'now' are empty */
+      if (TIME_LESS_THAN(timeo_wheel.time, now)) {
+        timeo_wheel.time = now;
+      }
+      return NULL;
+    }
+    timeo_wheel.time = start;
+    sys_timeo_wheel_cascade(level);
+  }
+}
+
+/* Expiry time of the first pending timeout (the wheel must not be empty) */
+static u32_t
+sys_timeo_wheel_earliest(void)
+{
+  u32_t start;
+  int level = sys_timeo_wheel_next(&start);
+  struct sys_timeo *first, *t;
+
+  LWIP_ASSERT("timeout wheel empty", level >= 0);
+  first = timeo_wheel.slots[level][(start >> (SYS_TIMEO_WHEEL_BITS * level)) & SYS_TIMEO_WHEEL_MASK];
+  if (level == 0) {
+    /* the slot is sorted */
+    return first->time;
+  }
+  start = first->time;
+  for (t = first->next; t != first; t = t->next) {
+    if (TIME_LESS_THAN(t->time, start)) {
+      start = t->time;
+    }
+  }
+  return start;
+}
+
+/* Remove t from the wheel; prev is its predecessor in the timeo_by_arg bucket
+ * (NULL if not known yet) */
+static void
+sys_timeo_wheel_remove(struct sys_timeo *t, struct sys_timeo *prev)
+{
+  sys_timeo_wheel_unlink(t);
+  if (prev == NULL) {
+    struct sys_timeo **bucket = &timeo_by_arg[SYS_TIMEO_ARG_HASH(t->arg)];
+    if (*bucket != t) {
+      for (prev = *bucket; prev->hash_next != t; prev = prev->hash_next);
+    }
+  }
+  if (prev == NULL) {
+    timeo_by_arg[SYS_TIMEO_ARG_HASH(t->arg)] = t->hash_next;
+  } else {
+    prev->hash_next = t->hash_next;
+  }
+  timeo_wheel.count--;
+}
+#endif /* LWIP_TIMERS_WHEEL */
+
 static void
 #if LWIP_DEBUG_TIMERNAMES
 sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg, const char *handler_name)
@@ -183,7 +438,12 @@ sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg, const ch
 sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg)
 #endif
 {
-  struct sys_timeo *timeout, *t;
+  struct sys_timeo *timeout;
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo **bucket;
+#else /* LWIP_TIMERS_WHEEL */
+  struct sys_timeo *t;
+#endif /* LWIP_TIMERS_WHEEL */
 
   timeout = (struct sys_timeo *)memp_malloc(MEMP_SYS_TIMEOUT);
   if (timeout == NULL) {
@@ -202,6 +462,17 @@ sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg)
                              (void *)timeout, abs_time, handler_name, (void *)arg));
 #endif /* LWIP_DEBUG_TIMERNAMES */
 
+#if LWIP_TIMERS_WHEEL
+  if (timeo_wheel.count == 0) {
+    /* an idle wheel need not be advanced through the idle time */
+    timeo_wheel.time = sys_now();
+  }
+  sys_timeo_wheel_place(timeout);
+  bucket = &timeo_by_arg[SYS_TIMEO_ARG_HASH(arg)];
+  timeout->hash_next = *bucket;
+  *bucket = timeout;
+  timeo_wheel.count++;
+#else /* LWIP_TIMERS_WHEEL */
   if (next_timeout == NULL) {
     next_timeout = timeout;
     return;
@@ -218,6 +489,7 @@ sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg)
       }
     }
   }
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /**
@@ -317,9 +589,28 @@ void
 sys_untimeout(sys_timeout_handler handler, void *arg)
 {
   struct sys_timeo *prev_t, *t;
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo *best = NULL, *best_prev = NULL;
+#endif /* LWIP_TIMERS_WHEEL */
 
   LWIP_ASSERT_CORE_LOCKED();
 
+#if LWIP_TIMERS_WHEEL
+  /* The bucket holds the newest timeout first, so the last of the earliest
+     matches is the one the sorted list would have found first. */
+  for (t = timeo_by_arg[SYS_TIMEO_ARG_HASH(arg)], prev_t = NULL; t != NULL;
+       prev_t = t, t = t->hash_next) {
+    if ((t->h == handler) && (t->arg == arg) &&
+        ((best == NULL) || !TIME_LESS_THAN(best->time, t->time))) {
+      best = t;
+      best_prev = prev_t;
+    }
+  }
+  if (best != NULL) {
+    sys_timeo_wheel_remove(best, best_prev);
+    memp_free(MEMP_SYS_TIMEOUT, best);
+  }
+#else /* LWIP_TIMERS_WHEEL */
   if (next_timeout == NULL) {
     return;
   }
@@ -337,6 +628,7 @@ sys_untimeout(sys_timeout_handler handler, void *arg)
       return;
     }
   }
+#endif /* LWIP_TIMERS_WHEEL */
   return;
 }
 
@@ -365,7 +657,11 @@ sys_check_timeouts(void)
 
     PBUF_CHECK_FREE_OOSEQ();
 
+#if LWIP_TIMERS_WHEEL
+    tmptimeout = sys_timeo_wheel_first(now);
+#else /* LWIP_TIMERS_WHEEL */
     tmptimeout = next_timeout;
+#endif /* LWIP_TIMERS_WHEEL */
     if (tmptimeout == NULL) {
       return;
     }
@@ -375,7 +671,11 @@ sys_check_timeouts(void)
     }
 
     /* Timeout has expired */
+#if LWIP_TIMERS_WHEEL
+    sys_timeo_wheel_remove(tmptimeout, NULL);
+#else /* LWIP_TIMERS_WHEEL */
     next_timeout = tmptimeout->next;
+#endif /* LWIP_TIMERS_WHEEL */
     handler = tmptimeout->h;
     arg = tmptimeout->arg;
     current_timeout_due_time = tmptimeout->time;
@@ -406,6 +706,39 @@ sys_restart_timeouts(void)
   u32_t now;
   u32_t base;
   struct sys_timeo *t;
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo *all = NULL, **tail = &all;
+  int level, idx;
+
+  if (timeo_wheel.count == 0) {
+    return;
+  }
+
+  now = sys_now();
+  base = sys_timeo_wheel_earliest();
+
+  /* take all timeouts out of their slots (keeping the order of each slot)
+     and add them again relative to 'now' */
+  for (level = 0; level < SYS_TIMEO_WHEEL_LEVELS; level++) {
+    for (idx = 0; idx < SYS_TIMEO_WHEEL_SLOTS; idx++) {
+      struct sys_timeo *first = timeo_wheel.slots[level][idx];
+      if (first != NULL) {
+        first->prev->next = NULL;
+        *tail = first;
+        tail = &first->prev->next;
+        timeo_wheel.slots[level][idx] = NULL;
+      }
+    }
+    timeo_wheel.used[level] = 0;
+  }
+  timeo_wheel.time = now;
+  while (all != NULL) {
+    t = all;
+    all = t->next;
+    t->time = (t->time - base) + now;
+    sys_timeo_wheel_place(t);
+  }
+#else /* LWIP_TIMERS_WHEEL */
 
   if (next_timeout == NULL) {
     return;
@@ -417,6 +750,7 @@ sys_restart_timeouts(void)
   for (t = next_timeout; t != NULL; t = t->next) {
     t->time = (t->time - base) + now;
   }
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /** Return the time left before the next timeout is due. If no timeouts are
@@ -426,17 +760,26 @@ u32_t
 sys_timeouts_sleeptime(void)
 {
   u32_t now;
+  u32_t next_time;
 
   LWIP_ASSERT_CORE_LOCKED();
 
+#if LWIP_TIMERS_WHEEL
+  if (timeo_wheel.count == 0) {
+    return SYS_TIMEOUTS_SLEEPTIME_INFINITE;
+  }
+  next_time = sys_timeo_wheel_earliest();
+#else /* LWIP_TIMERS_WHEEL */
   if (next_timeout == NULL) {
     return SYS_TIMEOUTS_SLEEPTIME_INFINITE;
   }
+  next_time = next_timeout->time;
+#endif /* LWIP_TIMERS_WHEEL */
   now = sys_now();
-  if (TIME_LESS_THAN(next_timeout->time, now)) {
+  if (TIME_LESS_THAN(next_time, now)) {
     return 0;
   } else {
-    u32_t ret = (u32_t)(next_timeout->time - now);
+    u32_t ret = (u32_t)(next_time - now);
     LWIP_ASSERT("invalid sleeptime", ret <= LWIP_MAX_TIMEOUT);
     return ret;
   }
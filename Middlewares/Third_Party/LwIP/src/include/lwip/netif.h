@@ -410,10 +410,14 @@ struct netif {
   (netif)->chksum_flags = chksumflags; } while(0)
 #define NETIF_CHECKSUM_ENABLED(netif, chksumflag) (((netif) == NULL) || (((netif)->chksum_flags & (chksumflag)) != 0))
 #define IF__NETIF_CHECKSUM_ENABLED(netif, chksumflag) if NETIF_CHECKSUM_ENABLED(netif, chksumflag)
+#define IF__NETIF_CHECKSUM_CHECK_NEEDED(netif, p, chksumflag) \
+  if ((((p)->flags & PBUF_FLAG_CHECKSUM_OK) == 0) && NETIF_CHECKSUM_ENABLED(netif, chksumflag))
 #else /* LWIP_CHECKSUM_CTRL_PER_NETIF */
 #define NETIF_CHECKSUM_ENABLED(netif, chksumflag) 0
 #define NETIF_SET_CHECKSUM_CTRL(netif, chksumflags)
 #define IF__NETIF_CHECKSUM_ENABLED(netif, chksumflag)
+#define IF__NETIF_CHECKSUM_CHECK_NEEDED(netif, p, chksumflag) \
+  if (((p)->flags & PBUF_FLAG_CHECKSUM_OK) == 0)
 #endif /* LWIP_CHECKSUM_CTRL_PER_NETIF */
 
 #if LWIP_SINGLE_NETIF
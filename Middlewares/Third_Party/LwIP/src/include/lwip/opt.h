@@ -120,6 +120,18 @@
 #if !defined LWIP_TIMERS_CUSTOM || defined __DOXYGEN__
 #define LWIP_TIMERS_CUSTOM              0
 #endif
+
+/**
+ * LWIP_TIMERS_WHEEL==1: Keep the timeouts of sys_timeout() in a hierarchical
+ * timing wheel instead of one sorted list. sys_timeout() and sys_untimeout()
+ * then take constant time however many timeouts are pending; expiry order
+ * and the API stay the same. Costs 8 * 16 slot pointers, one pointer per
+ * MEMP_NUM_SYS_TIMEOUT for the sys_untimeout() lookup and two pointers per
+ * timeout.
+ */
+#if !defined LWIP_TIMERS_WHEEL || defined __DOXYGEN__
+#define LWIP_TIMERS_WHEEL               0
+#endif
 /**
  * @}
  */
@@ -474,6 +486,15 @@
 #define MEMP_NUM_FRAG_PBUF              15
 #endif
 
+/**
+ * MEMP_NUM_TCP_PBUF_REF: the number of pbufs simultaneously queued on TCP
+ * connections that reference application pbufs (see tcp_write_pbuf()).
+ * This is only used with LWIP_ZEROCOPY==1.
+ */
+#if !defined MEMP_NUM_TCP_PBUF_REF || defined __DOXYGEN__
+#define MEMP_NUM_TCP_PBUF_REF           TCP_SND_QUEUELEN
+#endif
+
 /**
  * MEMP_NUM_ARP_QUEUE: the number of simultaneously queued outgoing
  * packets (pbufs) that are waiting for an ARP request (to resolve
@@ -534,6 +555,14 @@
 #define MEMP_NUM_SELECT_CB              4
 #endif
 
+/**
+ * MEMP_NUM_EPOLL_ITEM: the number of struct lwip_epoll_item, one per socket
+ * registered in an epoll instance (only needed with LWIP_SOCKET_EPOLL==1).
+ */
+#if !defined MEMP_NUM_EPOLL_ITEM || defined __DOXYGEN__
+#define MEMP_NUM_EPOLL_ITEM             MEMP_NUM_NETCONN
+#endif
+
 /**
  * MEMP_NUM_TCPIP_MSG_API: the number of struct tcpip_msg, which are used
  * for callback/timeout API communication.
@@ -1242,6 +1271,16 @@
 #if !defined LWIP_NETBUF_RECVINFO || defined __DOXYGEN__
 #define LWIP_NETBUF_RECVINFO            0
 #endif
+
+/**
+ * UDP_PCB_HASH_SIZE: Number of buckets (a power of two) in a table that
+ * indexes bound UDP PCBs by local port, so udp_input() and udp_bind() only
+ * walk the PCBs sharing the destination port instead of the whole udp_pcbs
+ * list. 0 disables the table and keeps the plain list walk.
+ */
+#if !defined UDP_PCB_HASH_SIZE || defined __DOXYGEN__
+#define UDP_PCB_HASH_SIZE               0
+#endif
 /**
  * @}
  */
@@ -1310,6 +1349,19 @@
 #define LWIP_TCP_SACK_OUT               0
 #endif
 
+/**
+ * LWIP_TCP_SACK_IN==1: TCP will use selective acknowledgements (SACKs) received
+ * from the remote host for loss recovery (RFC 6675): segments the remote host
+ * SACKed are not retransmitted, all holes below them are retransmitted in one
+ * fast recovery and the amount of data in flight is limited by the 'pipe'
+ * estimate instead of the distance to the cumulative ACK.
+ * The scoreboard is kept in the flags of the unacked segments, each tcp_pcb
+ * only grows by the recovery point.
+ */
+#if !defined LWIP_TCP_SACK_IN || defined __DOXYGEN__
+#define LWIP_TCP_SACK_IN                0
+#endif
+
 /**
  * LWIP_TCP_MAX_SACK_NUM: The maximum number of SACK values to include in TCP segments.
  * Must be at least 1, but is only used if LWIP_TCP_SACK_OUT is enabled.
@@ -1357,6 +1409,33 @@
 #define LWIP_TCP_RTO_TIME               3000
 #endif
 
+/**
+ * LWIP_TCP_CC==1: Congestion control is done by a module (struct tcp_cc_ops)
+ * selected per tcp_pcb with tcp_set_cc(). Modules included are tcp_cc_reno,
+ * tcp_cc_cubic (RFC 9438, needs LWIP_HAVE_INT64) and tcp_cc_vegas (delay
+ * based), applications may add their own.
+ * LWIP_TCP_CC==0: Reno is built in.
+ */
+#if !defined LWIP_TCP_CC || defined __DOXYGEN__
+#define LWIP_TCP_CC                     0
+#endif
+
+/**
+ * LWIP_TCP_CC_DEFAULT: The congestion control module of new tcp_pcbs if
+ * LWIP_TCP_CC is enabled.
+ */
+#if !defined LWIP_TCP_CC_DEFAULT || defined __DOXYGEN__
+#define LWIP_TCP_CC_DEFAULT             (&tcp_cc_reno)
+#endif
+
+/**
+ * LWIP_TCP_CC_PRIV_SIZE: Number of u32_t words per tcp_pcb the congestion
+ * control module can use for its state if LWIP_TCP_CC is enabled.
+ */
+#if !defined LWIP_TCP_CC_PRIV_SIZE || defined __DOXYGEN__
+#define LWIP_TCP_CC_PRIV_SIZE           6
+#endif
+
 /**
  * TCP_SND_BUF: TCP sender buffer space (bytes).
  * To achieve good performance, this should be at least 2 * TCP_MSS.
@@ -1530,6 +1609,28 @@
 #define LWIP_TCP_PCB_NUM_EXT_ARGS       0
 #endif
 
+/**
+ * TCP_PCB_HASH_SIZE: Number of buckets (a power of two) in a table that
+ * indexes active and TIME-WAIT PCBs by their 4-tuple. tcp_input() then finds
+ * the connection of an incoming segment with one bucket walk and only falls
+ * back to the (usually short) list of listening PCBs for new connections.
+ * Costs one pointer per bucket plus one per tcp_pcb.
+ * 0 disables the table and keeps the linear list walks.
+ */
+#if !defined TCP_PCB_HASH_SIZE || defined __DOXYGEN__
+#define TCP_PCB_HASH_SIZE               0
+#endif
+
+/**
+ * LWIP_ZEROCOPY==1: Enable lending pbufs between the stack and the
+ * application instead of copying: tcp_write_pbuf(), netconn_write_pbuf() and
+ * (with LWIP_SOCKET) lwip_recv_pbuf(), lwip_send_pbuf() and lwip_sendto_pbuf().
+ * Data written by reference stays referenced until it is ACKed.
+ */
+#if !defined LWIP_ZEROCOPY || defined __DOXYGEN__
+#define LWIP_ZEROCOPY                   0
+#endif
+
 /** LWIP_ALTCP==1: enable the altcp API.
  * altcp is an abstraction layer that prevents applications linking against the
  * tcp.h functions but provides the same functionality. It is used to e.g. add
@@ -1834,6 +1935,63 @@
 #define TCPIP_MBOX_SIZE                 0
 #endif
 
+/**
+ * TCPIP_CHECKSUM_THREADS: Number of checksum offload threads between
+ * tcpip_input() and tcpip_thread (0 = packets are passed to tcpip_thread
+ * directly). A checksum thread verifies the IPv4 header checksum and the
+ * TCP/UDP checksum of a received packet, marks the pbuf with
+ * PBUF_FLAG_CHECKSUM_OK and passes it on to tcpip_thread, which skips these
+ * checks then. Nothing else moves: all PCBs and timers stay owned by
+ * tcpip_thread, and every IPv4 TCP/UDP packet takes one more mbox hop (or,
+ * with LWIP_TCPIP_CORE_LOCKING_INPUT, one queueing step) before it is
+ * processed. Packets are distributed by a hash over addresses and ports, so
+ * the packets of one flow stay in order; all other packets bypass the threads.
+ * This only pays off on a multi-core system where the checksums are a
+ * considerable part of the input work, i.e. with large packets and without
+ * checksum offloading in hardware: tcpip_thread saves at most the time of the
+ * checksums per packet, and pays for the additional hop. Measure before
+ * enabling it (see contrib/ports/unix/chksum_bench).
+ * Each checksum thread needs a thread, a mbox and MEMP_NUM_TCPIP_MSG_INPKT
+ * entries for the packets queued to it.
+ */
+#if !defined TCPIP_CHECKSUM_THREADS || defined __DOXYGEN__
+#define TCPIP_CHECKSUM_THREADS          0
+#endif
+
+/**
+ * TCPIP_CHECKSUM_THREAD_NAME: The name assigned to the checksum threads.
+ */
+#if !defined TCPIP_CHECKSUM_THREAD_NAME || defined __DOXYGEN__
+#define TCPIP_CHECKSUM_THREAD_NAME      "tcpip_chksum"
+#endif
+
+/**
+ * TCPIP_CHECKSUM_THREAD_STACKSIZE: The stack size used by the checksum threads.
+ * The stack size value itself is platform-dependent, but is passed to
+ * sys_thread_new() when the threads are created.
+ */
+#if !defined TCPIP_CHECKSUM_THREAD_STACKSIZE || defined __DOXYGEN__
+#define TCPIP_CHECKSUM_THREAD_STACKSIZE TCPIP_THREAD_STACKSIZE
+#endif
+
+/**
+ * TCPIP_CHECKSUM_THREAD_PRIO: The priority assigned to the checksum threads.
+ * The priority value itself is platform-dependent, but is passed to
+ * sys_thread_new() when the threads are created.
+ */
+#if !defined TCPIP_CHECKSUM_THREAD_PRIO || defined __DOXYGEN__
+#define TCPIP_CHECKSUM_THREAD_PRIO      TCPIP_THREAD_PRIO
+#endif
+
+/**
+ * TCPIP_CHECKSUM_THREAD_MBOX_SIZE: The mailbox size of each checksum thread.
+ * The queue size value itself is platform-dependent, but is passed to
+ * sys_mbox_new() when tcpip_init is called.
+ */
+#if !defined TCPIP_CHECKSUM_THREAD_MBOX_SIZE || defined __DOXYGEN__
+#define TCPIP_CHECKSUM_THREAD_MBOX_SIZE TCPIP_MBOX_SIZE
+#endif
+
 /**
  * Define this to something that triggers a watchdog. This is called from
  * tcpip_thread after processing a message.
@@ -2145,6 +2303,33 @@
 #if !defined LWIP_SOCKET_POLL || defined __DOXYGEN__
 #define LWIP_SOCKET_POLL                1
 #endif
+
+/**
+ * LWIP_SOCKET_EPOLL==1: enable lwip_epoll_create(), lwip_epoll_ctl() and
+ * lwip_epoll_wait(). The sockets to watch are registered once and the netconn
+ * event callback puts them on a ready list, so waiting does not scan all of
+ * them like select() and poll() do. Needs LWIP_SOCKET_SELECT or LWIP_SOCKET_POLL.
+ */
+#if !defined LWIP_SOCKET_EPOLL || defined __DOXYGEN__
+#define LWIP_SOCKET_EPOLL               0
+#endif
+
+/**
+ * LWIP_SOCKET_EPOLL_NUM: the number of epoll instances (each one needs a
+ * semaphore). Their descriptors follow the socket descriptors.
+ */
+#if !defined LWIP_SOCKET_EPOLL_NUM || defined __DOXYGEN__
+#define LWIP_SOCKET_EPOLL_NUM           1
+#endif
+
+/**
+ * LWIP_SOCKET_MMSG_BATCH: maximum number of datagrams lwip_sendmmsg() passes
+ * to the tcpip_thread in one message. Each one costs a struct netbuf and a
+ * pointer on the stack of the calling thread.
+ */
+#if !defined LWIP_SOCKET_MMSG_BATCH || defined __DOXYGEN__
+#define LWIP_SOCKET_MMSG_BATCH          8
+#endif
 /**
  * @}
  */
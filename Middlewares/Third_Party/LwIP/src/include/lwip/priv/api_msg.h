@@ -86,6 +86,12 @@ struct api_msg {
   union {
     /** used for lwip_netconn_do_send */
     struct netbuf *b;
+    /** used for lwip_netconn_do_send_multi */
+    struct {
+      struct netbuf **bufs;
+      /** number of netbufs to send, output: number of netbufs sent */
+      u16_t count;
+    } bm;
     /** used for lwip_netconn_do_newconn */
     struct {
       u8_t proto;
@@ -110,6 +116,10 @@ struct api_msg {
       u16_t vector_cnt;
       /** offset into current vector */
       size_t vector_off;
+#if LWIP_ZEROCOPY
+      /** current pbuf to write by reference instead of vector (if != NULL) */
+      struct pbuf *pbuf;
+#endif /* LWIP_ZEROCOPY */
       /** total length across vectors */
       size_t len;
       /** offset into total length/output of bytes written when err == ERR_OK */
@@ -199,6 +209,7 @@ void lwip_netconn_do_connect         (void *m);
 void lwip_netconn_do_disconnect      (void *m);
 void lwip_netconn_do_listen          (void *m);
 void lwip_netconn_do_send            (void *m);
+void lwip_netconn_do_send_multi      (void *m);
 void lwip_netconn_do_recv            (void *m);
 #if TCP_LISTEN_BACKLOG
 void lwip_netconn_do_accepted        (void *m);
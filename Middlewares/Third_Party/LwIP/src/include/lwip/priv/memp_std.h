@@ -50,6 +50,9 @@ LWIP_MEMPOOL(UDP_PCB,        MEMP_NUM_UDP_PCB,         sizeof(struct udp_pcb),
 LWIP_MEMPOOL(TCP_PCB,        MEMP_NUM_TCP_PCB,         sizeof(struct tcp_pcb),        "TCP_PCB")
 LWIP_MEMPOOL(TCP_PCB_LISTEN, MEMP_NUM_TCP_PCB_LISTEN,  sizeof(struct tcp_pcb_listen), "TCP_PCB_LISTEN")
 LWIP_MEMPOOL(TCP_SEG,        MEMP_NUM_TCP_SEG,         sizeof(struct tcp_seg),        "TCP_SEG")
+#if LWIP_ZEROCOPY
+LWIP_MEMPOOL(TCP_PBUF_REF,   MEMP_NUM_TCP_PBUF_REF,    sizeof(struct tcp_pbuf_ref),   "TCP_PBUF_REF")
+#endif /* LWIP_ZEROCOPY */
 #endif /* LWIP_TCP */
 
 #if LWIP_ALTCP && LWIP_TCP
@@ -85,9 +88,12 @@ LWIP_MEMPOOL(SELECT_CB,      MEMP_NUM_SELECT_CB,       sizeof(struct lwip_select
 LWIP_MEMPOOL(NETIFAPI_MSG,   MEMP_NUM_NETIFAPI_MSG,    sizeof(struct netifapi_msg),   "NETIFAPI_MSG")
 #endif
 #endif /* LWIP_MPU_COMPATIBLE */
-#if !LWIP_TCPIP_CORE_LOCKING_INPUT
+#if !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS
 LWIP_MEMPOOL(TCPIP_MSG_INPKT,MEMP_NUM_TCPIP_MSG_INPKT, sizeof(struct tcpip_msg),      "TCPIP_MSG_INPKT")
-#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT */
+#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS */
+#if LWIP_SOCKET && LWIP_SOCKET_EPOLL
+LWIP_MEMPOOL(EPOLL_ITEM,     MEMP_NUM_EPOLL_ITEM,      sizeof(struct lwip_epoll_item), "EPOLL_ITEM")
+#endif /* LWIP_SOCKET && LWIP_SOCKET_EPOLL */
 #endif /* NO_SYS==0 */
 
 #if LWIP_IPV4 && LWIP_ARP && ARP_QUEUEING
@@ -81,6 +81,10 @@ struct lwip_sock {
   /** counter of how many threads are waiting for this socket using select */
   SELWAIT_T select_waiting;
 #endif /* LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL */
+#if LWIP_SOCKET_EPOLL
+  /** epoll instances this socket is registered in */
+  struct lwip_epoll_item *epoll_items;
+#endif /* LWIP_SOCKET_EPOLL */
 #if LWIP_NETCONN_FULLDUPLEX
   /* counter of how many threads are using a struct lwip_sock (not the 'int') */
   u8_t fd_used;
@@ -170,6 +174,47 @@ struct lwip_select_cb {
 };
 #endif /* LWIP_SOCKET_SELECT || LWIP_SOCKET_POLL */
 
+#if LWIP_SOCKET_EPOLL
+/** A socket registered in an epoll instance */
+struct lwip_epoll_item {
+  /** next registration of the same socket */
+  struct lwip_epoll_item *sock_next;
+  /** previous registration in the same epoll instance */
+  struct lwip_epoll_item *prev;
+  /** next registration in the same epoll instance */
+  struct lwip_epoll_item *next;
+  /** next entry on the ready list of the epoll instance */
+  struct lwip_epoll_item *ready_next;
+  /** the epoll instance */
+  struct lwip_epoll *ep;
+  /** the socket */
+  struct lwip_sock *sock;
+  /** events passed to epoll_ctl, 0 after an EPOLLONESHOT event was reported */
+  u32_t events;
+  /** user data passed to epoll_ctl */
+  epoll_data_t data;
+  /** 1 while on the ready list */
+  u8_t ready;
+};
+
+/** An epoll instance */
+struct lwip_epoll {
+  /** all sockets registered */
+  struct lwip_epoll_item *items;
+  /** sockets that had events since the last wait (filled by event_callback) */
+  struct lwip_epoll_item *ready_head;
+  struct lwip_epoll_item *ready_tail;
+  /** number of threads waiting in epoll_wait */
+  u16_t waiting;
+  /** don't signal the semaphore twice: set to 1 when signalled */
+  u8_t sem_signalled;
+  /** 1 if this instance is allocated */
+  u8_t used;
+  /** semaphore to wake up a thread waiting in epoll_wait */
+  sys_sem_t sem;
+};
+#endif /* LWIP_SOCKET_EPOLL */
+
 #endif /* LWIP_SOCKET */
 
 #endif /* LWIP_HDR_SOCKETS_PRIV_H */
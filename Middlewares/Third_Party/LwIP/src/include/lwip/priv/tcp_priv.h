@@ -85,9 +85,31 @@ err_t            tcp_rexmit_rto_prepare(struct tcp_pcb *pcb);
 void             tcp_rexmit_rto_commit(struct tcp_pcb *pcb);
 void             tcp_rexmit_rto  (struct tcp_pcb *pcb);
 void             tcp_rexmit_fast (struct tcp_pcb *pcb);
+#if LWIP_TCP_SACK_IN
+void             tcp_rexmit_sack (struct tcp_pcb *pcb, u8_t head_lost);
+#endif /* LWIP_TCP_SACK_IN */
 u32_t            tcp_update_rcv_ann_wnd(struct tcp_pcb *pcb);
 err_t            tcp_process_refused_data(struct tcp_pcb *pcb);
 
+/* Reno congestion control, also used by the other modules of LWIP_TCP_CC */
+void             tcp_cc_reno_on_ack(struct tcp_pcb *pcb, tcpwnd_size_t acked, u32_t rtt);
+void             tcp_cc_reno_on_loss(struct tcp_pcb *pcb);
+
+#if LWIP_TCP_CC
+#define TCP_CC_ON_ACK(pcb, acked, rtt)  (pcb)->cc->on_ack(pcb, acked, rtt)
+#define TCP_CC_ON_LOSS(pcb)             (pcb)->cc->on_loss(pcb)
+#define TCP_CC_ON_RTO(pcb)              (pcb)->cc->on_rto(pcb)
+#define TCP_CC_EVENT(pcb, event)        do { \
+                                          if ((pcb)->cc->cwnd_event != NULL) { \
+                                            (pcb)->cc->cwnd_event(pcb, event); \
+                                          } } while(0)
+#else /* LWIP_TCP_CC */
+#define TCP_CC_ON_ACK(pcb, acked, rtt)  tcp_cc_reno_on_ack(pcb, acked, 0)
+#define TCP_CC_ON_LOSS(pcb)             tcp_cc_reno_on_loss(pcb)
+#define TCP_CC_ON_RTO(pcb)              tcp_cc_reno_on_loss(pcb)
+#define TCP_CC_EVENT(pcb, event)
+#endif /* LWIP_TCP_CC */
+
 /**
  * This is the Nagle algorithm: try to combine user data to send as few TCP
  * segments as possible. Only send if
@@ -267,14 +289,26 @@ struct tcp_seg {
                                                checksummed into 'chksum' */
 #define TF_SEG_OPTS_WND_SCALE   (u8_t)0x08U /* Include WND SCALE option (only used in SYN segments) */
 #define TF_SEG_OPTS_SACK_PERM   (u8_t)0x10U /* Include SACK Permitted option (only used in SYN segments) */
+#define TF_SEG_SACKED           (u8_t)0x20U /* Segment was SACKed by the remote host (only used on unacked) */
+#define TF_SEG_SACK_REXMIT      (u8_t)0x40U /* Segment was retransmitted in the current SACK recovery */
   struct tcp_hdr *tcphdr;  /* the TCP header */
 };
 
+#if LWIP_ZEROCOPY
+/** A pbuf of a segment that references data of an application pbuf (see
+ * tcp_write_pbuf()) and holds a reference on it until the segment is freed */
+struct tcp_pbuf_ref {
+  struct pbuf_custom pc;
+  struct pbuf *original;
+};
+#endif /* LWIP_ZEROCOPY */
+
 #define LWIP_TCP_OPT_EOL        0
 #define LWIP_TCP_OPT_NOP        1
 #define LWIP_TCP_OPT_MSS        2
 #define LWIP_TCP_OPT_WS         3
 #define LWIP_TCP_OPT_SACK_PERM  4
+#define LWIP_TCP_OPT_SACK       5
 #define LWIP_TCP_OPT_TS         8
 
 #define LWIP_TCP_OPT_LEN_MSS    4
@@ -291,7 +325,7 @@ struct tcp_seg {
 #define LWIP_TCP_OPT_LEN_WS_OUT 0
 #endif
 
-#if LWIP_TCP_SACK_OUT
+#if LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN
 #define LWIP_TCP_OPT_LEN_SACK_PERM     2
 #define LWIP_TCP_OPT_LEN_SACK_PERM_OUT 4 /* aligned for output (includes NOP padding) */
 #else
@@ -346,6 +380,24 @@ extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
    3) All PCBs in the tcp_listen_pcbs list is in LISTEN state.
    4) All PCBs in the tcp_tw_pcbs list is in TIME-WAIT state.
 */
+#if TCP_PCB_HASH_SIZE
+/* Active and TIME-WAIT PCBs are also kept in a 4-tuple hash table for
+   tcp_input(). TCP_REG and TCP_RMV keep it in sync with those two lists. */
+#define TCP_PCB_HASH_REG(pcbs, npcb) do { \
+    if (((pcbs) == &tcp_active_pcbs) || ((pcbs) == &tcp_tw_pcbs)) { \
+      tcp_pcb_hash_add(npcb); \
+    } \
+  } while (0)
+#define TCP_PCB_HASH_RMV(pcbs, npcb) do { \
+    if (((pcbs) == &tcp_active_pcbs) || ((pcbs) == &tcp_tw_pcbs)) { \
+      tcp_pcb_hash_remove(npcb); \
+    } \
+  } while (0)
+#else /* TCP_PCB_HASH_SIZE */
+#define TCP_PCB_HASH_REG(pcbs, npcb)
+#define TCP_PCB_HASH_RMV(pcbs, npcb)
+#endif /* TCP_PCB_HASH_SIZE */
+
 /* Define two macros, TCP_REG and TCP_RMV that registers a TCP PCB
    with a PCB list or removes a PCB from a list, respectively. */
 #ifndef TCP_DEBUG_PCB_LISTS
@@ -364,6 +416,7 @@ extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
                             (npcb)->next = *(pcbs); \
                             LWIP_ASSERT("TCP_REG: npcb->next != npcb", (npcb)->next != (npcb)); \
                             *(pcbs) = (npcb); \
+                            TCP_PCB_HASH_REG(pcbs, npcb); \
                             LWIP_ASSERT("TCP_REG: tcp_pcbs sane", tcp_pcbs_sane()); \
               tcp_timer_needed(); \
                             } while(0)
@@ -380,6 +433,7 @@ extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
                                } \
                             } \
                             (npcb)->next = NULL; \
+                            TCP_PCB_HASH_RMV(pcbs, npcb); \
                             LWIP_ASSERT("TCP_RMV: tcp_pcbs sane", tcp_pcbs_sane()); \
                             LWIP_DEBUGF(TCP_DEBUG, ("TCP_RMV: removed %p from %p\n", (void *)(npcb), (void *)(*(pcbs)))); \
                             } while(0)
@@ -390,6 +444,7 @@ extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
   do {                                             \
     (npcb)->next = *pcbs;                          \
     *(pcbs) = (npcb);                              \
+    TCP_PCB_HASH_REG(pcbs, npcb);                  \
     tcp_timer_needed();                            \
   } while (0)
 
@@ -410,6 +465,7 @@ extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
       }                                            \
     }                                              \
     (npcb)->next = NULL;                           \
+    TCP_PCB_HASH_RMV(pcbs, npcb);                  \
   } while(0)
 
 #endif /* LWIP_DEBUG */
@@ -437,6 +493,13 @@ extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
 struct tcp_pcb *tcp_pcb_copy(struct tcp_pcb *pcb);
 void tcp_pcb_purge(struct tcp_pcb *pcb);
 void tcp_pcb_remove(struct tcp_pcb **pcblist, struct tcp_pcb *pcb);
+#if TCP_PCB_HASH_SIZE
+void tcp_pcb_hash_add(struct tcp_pcb *pcb);
+void tcp_pcb_hash_remove(struct tcp_pcb *pcb);
+struct tcp_pcb *tcp_pcb_hash_lookup(const ip_addr_t *local_ip, u16_t local_port,
+                                    const ip_addr_t *remote_ip, u16_t remote_port,
+                                    u8_t netif_idx);
+#endif /* TCP_PCB_HASH_SIZE */
 
 void tcp_segs_free(struct tcp_seg *seg);
 void tcp_seg_free(struct tcp_seg *seg);
@@ -115,9 +115,9 @@ enum tcpip_msg_type {
   TCPIP_MSG_API,
   TCPIP_MSG_API_CALL,
 #endif /* !LWIP_TCPIP_CORE_LOCKING */
-#if !LWIP_TCPIP_CORE_LOCKING_INPUT
+#if !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS
   TCPIP_MSG_INPKT,
-#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT */
+#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS */
 #if LWIP_TCPIP_TIMEOUT && LWIP_TIMERS
   TCPIP_MSG_TIMEOUT,
   TCPIP_MSG_UNTIMEOUT,
@@ -146,13 +146,13 @@ struct tcpip_msg {
       sys_sem_t *sem;
     } cb_wait;
 #endif /* LWIP_TCPIP_CORE_LOCKING */
-#if !LWIP_TCPIP_CORE_LOCKING_INPUT
+#if !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS
     struct {
       struct pbuf *p;
       struct netif *netif;
       netif_input_fn input_fn;
     } inp;
-#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT */
+#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT || TCPIP_CHECKSUM_THREADS */
     struct {
       tcpip_callback_fn function;
       void *ctx;
@@ -153,8 +153,8 @@ typedef err_t (*tcp_connected_fn)(void *arg, struct tcp_pcb *tpcb, err_t err);
                                   } \
                                 } while(0)
 
-#if LWIP_TCP_SACK_OUT
-/** SACK ranges to include in ACK packets.
+#if LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN
+/** SACK ranges to include in ACK packets (or received from the remote host).
  * SACK entry is invalid if left==right. */
 struct tcp_sack_range {
   /** Left edge of the SACK: the first acknowledged sequence number. */
@@ -162,7 +162,7 @@ struct tcp_sack_range {
   /** Right edge of the SACK: the last acknowledged sequence number +1 (so first NOT acknowledged). */
   u32_t right;
 };
-#endif /* LWIP_TCP_SACK_OUT */
+#endif /* LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN */
 
 /** Function prototype for deallocation of arguments. Called *just before* the
  * pcb is freed, so don't expect to be able to do anything with this pcb!
@@ -238,12 +238,43 @@ struct tcp_pcb_listen {
 };
 
 
+#if LWIP_TCP_CC
+/** Events passed to @ref tcp_cc_ops cwnd_event */
+enum tcp_cc_event {
+  /** The connection is established, cwnd has its initial value */
+  TCP_CC_EVENT_ESTABLISHED,
+  /** Fast recovery has ended, cwnd was set to ssthresh */
+  TCP_CC_EVENT_RECOVERY_END
+};
+
+/** A congestion control module (see @ref LWIP_TCP_CC). The functions are
+ * called from tcp_input() or tcp_slowtmr() and work on cwnd, ssthresh,
+ * bytes_acked and cc_priv of the pcb. */
+struct tcp_cc_ops {
+  /** Name of the module */
+  const char *name;
+  /** New data has been acked outside of fast recovery: grow cwnd. rtt is a
+   * round-trip time sample in milliseconds taken with this ACK or 0. */
+  void (*on_ack)(struct tcp_pcb *pcb, tcpwnd_size_t acked, u32_t rtt);
+  /** Fast retransmit: set ssthresh, cwnd is derived from it by the caller */
+  void (*on_loss)(struct tcp_pcb *pcb);
+  /** Retransmission timeout: set ssthresh, the caller sets cwnd to 1 MSS */
+  void (*on_rto)(struct tcp_pcb *pcb);
+  /** Other events (optional, may be NULL) */
+  void (*cwnd_event)(struct tcp_pcb *pcb, enum tcp_cc_event event);
+};
+#endif /* LWIP_TCP_CC */
+
 /** the TCP protocol control block */
 struct tcp_pcb {
 /** common PCB members */
   IP_PCB;
 /** protocol specific PCB members */
   TCP_PCB_COMMON(struct tcp_pcb);
+#if TCP_PCB_HASH_SIZE
+  /* next pcb in the same 4-tuple bucket (active and TIME-WAIT pcbs only) */
+  struct tcp_pcb *hash_next;
+#endif /* TCP_PCB_HASH_SIZE */
 
   /* ports are in host byte order */
   u16_t remote_port;
@@ -267,7 +298,7 @@ struct tcp_pcb {
 #define TF_TIMESTAMP   0x0400U   /* Timestamp option enabled */
 #endif
 #define TF_RTO         0x0800U /* RTO timer has fired, in-flight data moved to unsent and being retransmitted */
-#if LWIP_TCP_SACK_OUT
+#if LWIP_TCP_SACK_OUT || LWIP_TCP_SACK_IN
 #define TF_SACK        0x1000U /* Selective ACKs enabled */
 #endif
 
@@ -314,6 +345,10 @@ struct tcp_pcb {
 
   /* first byte following last rto byte */
   u32_t rto_end;
+#if LWIP_TCP_SACK_IN
+  /* snd_nxt when SACK based loss recovery was entered (RFC 6675 RecoveryPoint) */
+  u32_t recover;
+#endif /* LWIP_TCP_SACK_IN */
 
   /* sender variables */
   u32_t snd_nxt;   /* next new seqno to be sent */
@@ -334,6 +369,14 @@ struct tcp_pcb {
 
   tcpwnd_size_t bytes_acked;
 
+#if LWIP_TCP_CC
+  const struct tcp_cc_ops *cc;
+  /* sys_now() when the segment timed for the RTT (rtseq) was sent */
+  u32_t cc_rtt_start;
+  /* state of the congestion control module */
+  u32_t cc_priv[LWIP_TCP_CC_PRIV_SIZE];
+#endif /* LWIP_TCP_CC */
+
   /* These are ordered by sequence number: */
   struct tcp_seg *unsent;   /* Unsent (queued) segments. */
   struct tcp_seg *unacked;  /* Sent but unacknowledged segments. */
@@ -472,9 +515,22 @@ err_t            tcp_shutdown(struct tcp_pcb *pcb, int shut_rx, int shut_tx);
 
 err_t            tcp_write   (struct tcp_pcb *pcb, const void *dataptr, u16_t len,
                               u8_t apiflags);
+#if LWIP_ZEROCOPY
+err_t            tcp_write_pbuf(struct tcp_pcb *pcb, struct pbuf *p, u16_t offset, u16_t len,
+                                u8_t apiflags);
+#endif /* LWIP_ZEROCOPY */
 
 void             tcp_setprio (struct tcp_pcb *pcb, u8_t prio);
 
+#if LWIP_TCP_CC
+void             tcp_set_cc  (struct tcp_pcb *pcb, const struct tcp_cc_ops *cc);
+extern const struct tcp_cc_ops tcp_cc_reno;
+extern const struct tcp_cc_ops tcp_cc_vegas;
+#if LWIP_HAVE_INT64
+extern const struct tcp_cc_ops tcp_cc_cubic;
+#endif /* LWIP_HAVE_INT64 */
+#endif /* LWIP_TCP_CC */
+
 err_t            tcp_output  (struct tcp_pcb *pcb);
 
 err_t            tcp_tcp_get_tcp_addrinfo(struct tcp_pcb *pcb, int local, ip_addr_t *addr, u16_t *port);
@@ -103,6 +103,9 @@ err_t  tcpip_untimeout(sys_timeout_handler h, void *arg);
 
 #ifdef TCPIP_THREAD_TEST
 int tcpip_thread_poll_one(void);
+#if TCPIP_CHECKSUM_THREADS
+int tcpip_chksum_thread_poll_one(void);
+#endif /* TCPIP_CHECKSUM_THREADS */
 #endif
 
 #ifdef __cplusplus
@@ -92,6 +92,11 @@ typedef void (* sys_timeout_handler)(void *arg);
 
 struct sys_timeo {
   struct sys_timeo *next;
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo *prev;
+  struct sys_timeo *hash_next;
+  u8_t slot;
+#endif /* LWIP_TIMERS_WHEEL */
   u32_t time;
   sys_timeout_handler h;
   void *arg;
@@ -100,6 +105,25 @@ struct sys_timeo {
 #endif /* LWIP_DEBUG_TIMERNAMES */
 };
 
+#if LWIP_TIMERS_WHEEL
+#define SYS_TIMEO_WHEEL_BITS    4
+#define SYS_TIMEO_WHEEL_SLOTS   (1 << SYS_TIMEO_WHEEL_BITS)
+#define SYS_TIMEO_WHEEL_LEVELS  (32 / SYS_TIMEO_WHEEL_BITS)
+
+/** Pending timeouts for LWIP_TIMERS_WHEEL==1 */
+struct sys_timeo_wheel {
+  /** Circular lists of timeouts. Slots of level 0 are 1 ms wide, each level
+   * up has 16 times wider slots. */
+  struct sys_timeo *slots[SYS_TIMEO_WHEEL_LEVELS][SYS_TIMEO_WHEEL_SLOTS];
+  /** Bitmap of the non-empty slots of each level */
+  u16_t used[SYS_TIMEO_WHEEL_LEVELS];
+  /** Time the wheel has been advanced to */
+  u32_t time;
+  /** Number of pending timeouts */
+  u16_t count;
+};
+#endif /* LWIP_TIMERS_WHEEL */
+
 void sys_timeouts_init(void);
 
 #if LWIP_DEBUG_TIMERNAMES
@@ -115,7 +139,12 @@ void sys_check_timeouts(void);
 u32_t sys_timeouts_sleeptime(void);
 
 #if LWIP_TESTMODE
+#if LWIP_TIMERS_WHEEL
+struct sys_timeo_wheel* sys_timeouts_get_wheel(void);
+struct sys_timeo** sys_timeouts_get_by_arg(void);
+#else /* LWIP_TIMERS_WHEEL */
 struct sys_timeo** sys_timeouts_get_next_timeout(void);
+#endif /* LWIP_TIMERS_WHEEL */
 void lwip_cyclic_timer(void *arg);
 #endif
 
@@ -85,6 +85,10 @@ struct udp_pcb {
 /* Protocol specific PCB members */
 
   struct udp_pcb *next;
+#if UDP_PCB_HASH_SIZE
+  /** next pcb in the same local port bucket */
+  struct udp_pcb *hash_next;
+#endif /* UDP_PCB_HASH_SIZE */
 
   u8_t flags;
   /** ports are in host byte order */
@@ -634,6 +634,281 @@ static void test_sockets_msgapi_cmsg(int domain)
 }
 #endif /* LWIP_IPV4 */
 
+static void test_sockets_mmsg_udp(int domain)
+{
+  int s, i, ret;
+  struct sockaddr_storage addr_storage;
+  socklen_t addr_size;
+  struct mmsghdr smsgs[12];
+  struct iovec siovs[12];
+  struct mmsghdr rmsgs[16];
+  struct iovec riovs[16];
+  u8_t snd_buf[12];
+  u8_t rcv_buf[16][16];
+
+  test_sockets_init_loopback_addr(domain, &addr_storage, &addr_size);
+
+  s = test_sockets_alloc_socket_nonblocking(domain, SOCK_DGRAM);
+  fail_unless(s >= 0);
+
+  ret = lwip_bind(s, (struct sockaddr*)&addr_storage, addr_size);
+  fail_unless(ret == 0);
+
+  /* Update addr with epehermal port */
+  ret = lwip_getsockname(s, (struct sockaddr*)&addr_storage, &addr_size);
+  fail_unless(ret == 0);
+
+  /* nothing queued yet */
+  memset(rmsgs, 0, sizeof(rmsgs));
+  for (i = 0; i < 16; i++) {
+    riovs[i].iov_base = rcv_buf[i];
+    riovs[i].iov_len = sizeof(rcv_buf[i]);
+    rmsgs[i].msg_hdr.msg_iov = &riovs[i];
+    rmsgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  ret = lwip_recvmmsg(s, rmsgs, 16, 0);
+  fail_unless(ret == -1);
+  fail_unless(errno == EWOULDBLOCK);
+
+  /* send 12 datagrams of 1..12 bytes to self (more than one batch) */
+  memset(smsgs, 0, sizeof(smsgs));
+  for (i = 0; i < 12; i++) {
+    snd_buf[i] = (u8_t)(0xA0 + i);
+    siovs[i].iov_base = snd_buf;
+    siovs[i].iov_len = (size_t)(i + 1);
+    smsgs[i].msg_hdr.msg_iov = &siovs[i];
+    smsgs[i].msg_hdr.msg_iovlen = 1;
+    smsgs[i].msg_hdr.msg_name = &addr_storage;
+    smsgs[i].msg_hdr.msg_namelen = addr_size;
+  }
+  ret = lwip_sendmmsg(s, smsgs, 12, 0);
+  fail_unless(ret == 12);
+  for (i = 0; i < 12; i++) {
+    fail_unless(smsgs[i].msg_len == (unsigned int)(i + 1));
+  }
+
+  while (tcpip_thread_poll_one());
+
+  /* receive them in two calls, in order */
+  ret = lwip_recvmmsg(s, rmsgs, 5, 0);
+  fail_unless(ret == 5);
+  ret = lwip_recvmmsg(s, &rmsgs[5], 11, 0);
+  fail_unless(ret == 7);
+  for (i = 0; i < 12; i++) {
+    fail_unless(rmsgs[i].msg_len == (unsigned int)(i + 1));
+    fail_unless(!memcmp(rcv_buf[i], snd_buf, (size_t)(i + 1)));
+    fail_unless(rmsgs[i].msg_hdr.msg_flags == 0);
+  }
+  ret = lwip_recvmmsg(s, rmsgs, 16, 0);
+  fail_unless(ret == -1);
+  fail_unless(errno == EWOULDBLOCK);
+
+  /* a datagram larger than its buffer is truncated */
+  siovs[0].iov_len = 12;
+  riovs[0].iov_len = 4;
+  ret = lwip_sendmmsg(s, smsgs, 1, 0);
+  fail_unless(ret == 1);
+  while (tcpip_thread_poll_one());
+  ret = lwip_recvmmsg(s, rmsgs, 2, 0);
+  fail_unless(ret == 1);
+  fail_unless(rmsgs[0].msg_len == 12);
+  fail_unless(rmsgs[0].msg_hdr.msg_flags & MSG_TRUNC);
+
+  /* an invalid message stops sending, the ones before it are sent */
+  siovs[0].iov_len = 1;
+  smsgs[1].msg_hdr.msg_iovlen = 0;
+  ret = lwip_sendmmsg(s, smsgs, 3, 0);
+  fail_unless(ret == 1);
+  ret = lwip_sendmmsg(s, &smsgs[1], 2, 0);
+  fail_unless(ret == -1);
+  fail_unless(errno == EMSGSIZE);
+  while (tcpip_thread_poll_one());
+  ret = lwip_recvmmsg(s, rmsgs, 16, 0);
+  fail_unless(ret == 1);
+
+  ret = lwip_close(s);
+  fail_unless(ret == 0);
+}
+
+START_TEST(test_sockets_mmsg)
+{
+  LWIP_UNUSED_ARG(_i);
+#if LWIP_IPV4
+  test_sockets_mmsg_udp(AF_INET);
+#endif
+#if LWIP_IPV6
+  test_sockets_mmsg_udp(AF_INET6);
+#endif
+}
+END_TEST
+
+#if LWIP_ZEROCOPY
+static int test_sockets_zerocopy_freed;
+
+static void
+test_sockets_zerocopy_free(struct pbuf *p)
+{
+  LWIP_UNUSED_ARG(p);
+  test_sockets_zerocopy_freed++;
+}
+
+static void test_sockets_zerocopy_udp(int domain)
+{
+  int s, ret;
+  struct sockaddr_storage addr_storage, from_storage;
+  socklen_t addr_size, from_size;
+  struct pbuf *p;
+  u8_t snd_buf[100];
+  u16_t i;
+
+  test_sockets_init_loopback_addr(domain, &addr_storage, &addr_size);
+
+  s = test_sockets_alloc_socket_nonblocking(domain, SOCK_DGRAM);
+  fail_unless(s >= 0);
+  ret = lwip_bind(s, (struct sockaddr*)&addr_storage, addr_size);
+  fail_unless(ret == 0);
+  ret = lwip_getsockname(s, (struct sockaddr*)&addr_storage, &addr_size);
+  fail_unless(ret == 0);
+
+  ret = lwip_recv_pbuf(s, &p, 0, NULL, NULL);
+  fail_unless(ret == -1);
+  fail_unless(errno == EWOULDBLOCK);
+  fail_unless(p == NULL);
+  ret = lwip_recv_pbuf(s, &p, MSG_PEEK, NULL, NULL);
+  fail_unless(ret == -1);
+  fail_unless(errno == EOPNOTSUPP);
+
+  for (i = 0; i < sizeof(snd_buf); i++) {
+    snd_buf[i] = (u8_t)i;
+  }
+  p = pbuf_alloc(PBUF_TRANSPORT, sizeof(snd_buf), PBUF_RAM);
+  fail_unless(p != NULL);
+  pbuf_take(p, snd_buf, sizeof(snd_buf));
+  ret = lwip_sendto_pbuf(s, p, 0, (struct sockaddr*)&addr_storage, addr_size);
+  fail_unless(ret == sizeof(snd_buf));
+  pbuf_free(p);
+
+  while (tcpip_thread_poll_one());
+
+  from_size = sizeof(from_storage);
+  ret = lwip_recv_pbuf(s, &p, 0, (struct sockaddr*)&from_storage, &from_size);
+  fail_unless(ret == sizeof(snd_buf));
+  fail_unless(p != NULL);
+  fail_unless(p->tot_len == sizeof(snd_buf));
+  fail_unless(pbuf_memcmp(p, 0, snd_buf, sizeof(snd_buf)) == 0);
+  fail_unless(from_size == addr_size);
+  fail_unless(!memcmp(&from_storage, &addr_storage, addr_size));
+  pbuf_free(p);
+
+  ret = lwip_close(s);
+  fail_unless(ret == 0);
+}
+
+static void test_sockets_zerocopy_tcp(int domain)
+{
+  int listnr, s1, s2, ret;
+  struct sockaddr_storage addr_storage;
+  socklen_t addr_size;
+  struct pbuf_custom pc;
+  struct pbuf *p, *q;
+  u8_t snd_buf[1500];
+  u16_t i, received;
+
+  test_sockets_init_loopback_addr(domain, &addr_storage, &addr_size);
+
+  listnr = test_sockets_alloc_socket_nonblocking(domain, SOCK_STREAM);
+  fail_unless(listnr >= 0);
+  s1 = test_sockets_alloc_socket_nonblocking(domain, SOCK_STREAM);
+  fail_unless(s1 >= 0);
+  ret = lwip_bind(listnr, (struct sockaddr*)&addr_storage, addr_size);
+  fail_unless(ret == 0);
+  ret = lwip_listen(listnr, 0);
+  fail_unless(ret == 0);
+  ret = lwip_getsockname(listnr, (struct sockaddr*)&addr_storage, &addr_size);
+  fail_unless(ret == 0);
+  ret = lwip_connect(s1, (struct sockaddr*)&addr_storage, addr_size);
+  fail_unless(ret == -1);
+  fail_unless(errno == EINPROGRESS);
+  while (tcpip_thread_poll_one());
+  s2 = lwip_accept(listnr, NULL, NULL);
+  fail_unless(s2 >= 0);
+
+  /* send a chain of application memory and a RAM pbuf by reference */
+  for (i = 0; i < sizeof(snd_buf); i++) {
+    snd_buf[i] = (u8_t)(i * 7);
+  }
+  test_sockets_zerocopy_freed = 0;
+  pc.custom_free_function = test_sockets_zerocopy_free;
+  p = pbuf_alloced_custom(PBUF_RAW, 1000, PBUF_REF, &pc, snd_buf, 1000);
+  fail_unless(p != NULL);
+  q = pbuf_alloc(PBUF_RAW, sizeof(snd_buf) - 1000, PBUF_RAM);
+  fail_unless(q != NULL);
+  pbuf_take(q, &snd_buf[1000], sizeof(snd_buf) - 1000);
+  pbuf_cat(p, q);
+  ret = lwip_send_pbuf(s1, p, 0);
+  fail_unless(ret == sizeof(snd_buf));
+  pbuf_free(p);
+  /* still referenced by the unacked segments */
+  fail_unless(test_sockets_zerocopy_freed == 0);
+
+  /* the pbufs are handed out, whatever segment size they arrived in */
+  received = 0;
+  for (i = 0; (i < 100) && (received < sizeof(snd_buf)); i++) {
+    while (tcpip_thread_poll_one());
+    ret = lwip_recv_pbuf(s2, &p, MSG_DONTWAIT, NULL, NULL);
+    if (ret == -1) {
+      /* the rest is waiting for an ACK */
+      fail_unless(errno == EWOULDBLOCK);
+      tcp_fasttmr();
+      continue;
+    }
+    fail_unless(ret > 0);
+    fail_unless(p != NULL);
+    fail_unless(p->tot_len == ret);
+    fail_unless(received + ret <= (int)sizeof(snd_buf));
+    fail_unless(pbuf_memcmp(p, 0, &snd_buf[received], (u16_t)ret) == 0);
+    received = (u16_t)(received + ret);
+    pbuf_free(p);
+  }
+  fail_unless(received == sizeof(snd_buf));
+  ret = lwip_recv_pbuf(s2, &p, MSG_DONTWAIT, NULL, NULL);
+  fail_unless(ret == -1);
+  fail_unless(errno == EWOULDBLOCK);
+
+  /* once everything is ACKed, the application memory is released */
+  tcp_fasttmr();
+  while (tcpip_thread_poll_one());
+  fail_unless(test_sockets_zerocopy_freed == 1);
+
+  /* end of stream */
+  ret = lwip_close(s1);
+  fail_unless(ret == 0);
+  while (tcpip_thread_poll_one());
+  ret = lwip_recv_pbuf(s2, &p, MSG_DONTWAIT, NULL, NULL);
+  fail_unless(ret == 0);
+  fail_unless(p == NULL);
+
+  ret = lwip_close(s2);
+  fail_unless(ret == 0);
+  ret = lwip_close(listnr);
+  fail_unless(ret == 0);
+}
+
+START_TEST(test_sockets_zerocopy)
+{
+  LWIP_UNUSED_ARG(_i);
+#if LWIP_IPV4
+  test_sockets_zerocopy_udp(AF_INET);
+  test_sockets_zerocopy_tcp(AF_INET);
+#endif
+#if LWIP_IPV6
+  test_sockets_zerocopy_udp(AF_INET6);
+  test_sockets_zerocopy_tcp(AF_INET6);
+#endif
+}
+END_TEST
+#endif /* LWIP_ZEROCOPY */
+
 START_TEST(test_sockets_msgapis)
 {
   LWIP_UNUSED_ARG(_i);
@@ -685,6 +960,169 @@ START_TEST(test_sockets_select)
 }
 END_TEST
 
+#if LWIP_SOCKET_EPOLL
+static void test_sockets_epoll_send(int s, const struct sockaddr_storage *addr_storage, socklen_t addr_size)
+{
+  u8_t snd_buf = 0x5A;
+  ssize_t ret = lwip_sendto(s, &snd_buf, 1, 0, (const struct sockaddr*)addr_storage, addr_size);
+  fail_unless(ret == 1);
+  while (tcpip_thread_poll_one());
+}
+
+static void test_sockets_epoll_udp(int domain)
+{
+  int s1, s2, ep, ret;
+  struct sockaddr_storage addr1, addr2;
+  socklen_t addr1_size, addr2_size;
+  struct epoll_event ev, events[4];
+  u8_t rcv_buf[4];
+
+  test_sockets_init_loopback_addr(domain, &addr1, &addr1_size);
+  test_sockets_init_loopback_addr(domain, &addr2, &addr2_size);
+  s1 = test_sockets_alloc_socket_nonblocking(domain, SOCK_DGRAM);
+  fail_unless(s1 >= 0);
+  s2 = test_sockets_alloc_socket_nonblocking(domain, SOCK_DGRAM);
+  fail_unless(s2 >= 0);
+  ret = lwip_bind(s1, (struct sockaddr*)&addr1, addr1_size);
+  fail_unless(ret == 0);
+  ret = lwip_getsockname(s1, (struct sockaddr*)&addr1, &addr1_size);
+  fail_unless(ret == 0);
+  ret = lwip_bind(s2, (struct sockaddr*)&addr2, addr2_size);
+  fail_unless(ret == 0);
+  ret = lwip_getsockname(s2, (struct sockaddr*)&addr2, &addr2_size);
+  fail_unless(ret == 0);
+
+  ret = lwip_epoll_create(0);
+  fail_unless(ret == -1);
+  fail_unless(errno == EINVAL);
+  ep = lwip_epoll_create(1);
+  fail_unless(ep >= 0);
+  fail_unless(lwip_epoll_create(1) == -1);
+  fail_unless(errno == EMFILE);
+
+  /* s1 level-triggered, s2 edge-triggered */
+  ev.events = EPOLLIN;
+  ev.data.fd = s1;
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_ADD, s1, &ev);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_ADD, s1, &ev);
+  fail_unless(ret == -1);
+  fail_unless(errno == EEXIST);
+  ev.events = EPOLLIN | EPOLLET;
+  ev.data.fd = s2;
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_ADD, s2, &ev);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_ctl(s1, EPOLL_CTL_ADD, s2, &ev);
+  fail_unless(ret == -1);
+  fail_unless(errno == EBADF);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 0);
+
+  /* level-triggered: reported until the data is read */
+  test_sockets_epoll_send(s2, &addr1, addr1_size);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].events == EPOLLIN);
+  fail_unless(events[0].data.fd == s1);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].data.fd == s1);
+  ret = lwip_recv(s1, rcv_buf, sizeof(rcv_buf), 0);
+  fail_unless(ret == 1);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 0);
+
+  /* edge-triggered: reported once per datagram received */
+  test_sockets_epoll_send(s1, &addr2, addr2_size);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].events == EPOLLIN);
+  fail_unless(events[0].data.fd == s2);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 0);
+  test_sockets_epoll_send(s1, &addr2, addr2_size);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].data.fd == s2);
+
+  /* both ready, returned one at a time */
+  test_sockets_epoll_send(s2, &addr1, addr1_size);
+  test_sockets_epoll_send(s1, &addr2, addr2_size);
+  ret = lwip_epoll_wait(ep, events, 1, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].data.fd == s1);
+  ret = lwip_epoll_wait(ep, events, 1, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].data.fd == s2);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].data.fd == s1);
+
+  /* one-shot: disabled after the first report until modified again */
+  ev.events = EPOLLIN | EPOLLOUT | EPOLLONESHOT;
+  ev.data.u32 = 1234;
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_MOD, s1, &ev);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+  fail_unless(events[0].events == (EPOLLIN | EPOLLOUT));
+  fail_unless(events[0].data.u32 == 1234);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_MOD, s1, &ev);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+
+  /* removed sockets are not reported */
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_DEL, s1, NULL);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_DEL, s1, NULL);
+  fail_unless(ret == -1);
+  fail_unless(errno == ENOENT);
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_MOD, s1, &ev);
+  fail_unless(ret == -1);
+  fail_unless(errno == ENOENT);
+  test_sockets_epoll_send(s2, &addr1, addr1_size);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 0);
+
+  /* closing a socket removes it, the instance is closed like a socket */
+  ret = lwip_close(s2);
+  fail_unless(ret == 0);
+  ret = lwip_close(ep);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == -1);
+  fail_unless(errno == EBADF);
+
+  /* an instance closed with sockets still registered */
+  ep = lwip_epoll_create(1);
+  fail_unless(ep >= 0);
+  ev.events = EPOLLIN;
+  ret = lwip_epoll_ctl(ep, EPOLL_CTL_ADD, s1, &ev);
+  fail_unless(ret == 0);
+  ret = lwip_epoll_wait(ep, events, 4, 0);
+  fail_unless(ret == 1);
+  ret = lwip_close(ep);
+  fail_unless(ret == 0);
+  ret = lwip_close(s1);
+  fail_unless(ret == 0);
+}
+
+START_TEST(test_sockets_epoll)
+{
+  LWIP_UNUSED_ARG(_i);
+#if LWIP_IPV4
+  test_sockets_epoll_udp(AF_INET);
+#endif
+#if LWIP_IPV6
+  test_sockets_epoll_udp(AF_INET6);
+#endif
+}
+END_TEST
+#endif /* LWIP_SOCKET_EPOLL */
+
 START_TEST(test_sockets_recv_after_rst)
 {
   int sl, sact;
@@ -836,7 +1274,14 @@ sockets_suite(void)
     TESTFUNC(test_sockets_basics),
     TESTFUNC(test_sockets_allfunctions_basic),
     TESTFUNC(test_sockets_msgapis),
+    TESTFUNC(test_sockets_mmsg),
+#if LWIP_ZEROCOPY
+    TESTFUNC(test_sockets_zerocopy),
+#endif /* LWIP_ZEROCOPY */
     TESTFUNC(test_sockets_select),
+#if LWIP_SOCKET_EPOLL
+    TESTFUNC(test_sockets_epoll),
+#endif /* LWIP_SOCKET_EPOLL */
     TESTFUNC(test_sockets_recv_after_rst),
   };
   return create_suite("SOCKETS", tests, sizeof(tests)/sizeof(testfunc), sockets_setup, sockets_teardown);
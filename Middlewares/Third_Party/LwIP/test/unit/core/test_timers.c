@@ -3,9 +3,37 @@
 #include "lwip/def.h"
 #include "lwip/timeouts.h"
 #include "arch/sys_arch.h"
+#if LWIP_TIMERS_WHEEL
+/* needed by default MEMP_NUM_SYS_TIMEOUT */
+#include "netif/ppp/ppp_opts.h"
+#endif
 
 /* Setups/teardown functions */
 
+#if LWIP_TIMERS_WHEEL
+static struct sys_timeo_wheel old_wheel;
+static struct sys_timeo* old_by_arg[MEMP_NUM_SYS_TIMEOUT];
+
+static void
+timers_setup(void)
+{
+  struct sys_timeo_wheel* wheel = sys_timeouts_get_wheel();
+  struct sys_timeo** by_arg = sys_timeouts_get_by_arg();
+  old_wheel = *wheel;
+  memset(wheel, 0, sizeof(*wheel));
+  memcpy(old_by_arg, by_arg, sizeof(old_by_arg));
+  memset(by_arg, 0, sizeof(old_by_arg));
+}
+
+static void
+timers_teardown(void)
+{
+  struct sys_timeo_wheel* wheel = sys_timeouts_get_wheel();
+  *wheel = old_wheel;
+  memcpy(sys_timeouts_get_by_arg(), old_by_arg, sizeof(old_by_arg));
+  lwip_sys_now = 0;
+}
+#else /* LWIP_TIMERS_WHEEL */
 static struct sys_timeo* old_list_head;
 
 static void
@@ -23,6 +51,7 @@ timers_teardown(void)
   *list_head = old_list_head;
   lwip_sys_now = 0;
 }
+#endif /* LWIP_TIMERS_WHEEL */
 
 static int fired[3];
 static void
@@ -46,7 +75,9 @@ struct lwip_cyclic_timer test_cyclic = {10, dummy_cyclic_handler};
 static void
 do_test_cyclic_timers(u32_t offset)
 {
+#if !LWIP_TIMERS_WHEEL
   struct sys_timeo** list_head = sys_timeouts_get_next_timeout();
+#endif
 
   /* verify normal timer expiration */
   lwip_sys_now = offset + 0;
@@ -60,7 +91,11 @@ do_test_cyclic_timers(u32_t offset)
   sys_check_timeouts();
   fail_unless(cyclic_fired == 1);
 
+#if LWIP_TIMERS_WHEEL
+  fail_unless(sys_timeouts_sleeptime() == test_cyclic.interval_ms - HANDLER_EXECUTION_TIME);
+#else
   fail_unless((*list_head)->time == (u32_t)(lwip_sys_now + test_cyclic.interval_ms - HANDLER_EXECUTION_TIME));
+#endif
   
   sys_untimeout(lwip_cyclic_timer, &test_cyclic);
 
@@ -77,7 +112,11 @@ do_test_cyclic_timers(u32_t offset)
   sys_check_timeouts();
   fail_unless(cyclic_fired == 1);
 
+#if LWIP_TIMERS_WHEEL
+  fail_unless(sys_timeouts_sleeptime() == test_cyclic.interval_ms);
+#else
   fail_unless((*list_head)->time == (u32_t)(lwip_sys_now + test_cyclic.interval_ms));
+#endif
 }
 
 START_TEST(test_cyclic_timers)
@@ -127,8 +166,10 @@ END_TEST
 static void
 do_test_timers(u32_t offset)
 {
+#if !LWIP_TIMERS_WHEEL
   struct sys_timeo** list_head = sys_timeouts_get_next_timeout();
-  
+#endif
+
   lwip_sys_now = offset + 0;
 
   sys_timeout(10, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
@@ -138,11 +179,13 @@ do_test_timers(u32_t offset)
   sys_timeout( 5, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 2));
   fail_unless(sys_timeouts_sleeptime() == 5);
 
+#if !LWIP_TIMERS_WHEEL
   /* linked list correctly sorted? */
   fail_unless((*list_head)->time             == (u32_t)(lwip_sys_now + 5));
   fail_unless((*list_head)->next->time       == (u32_t)(lwip_sys_now + 10));
   fail_unless((*list_head)->next->next->time == (u32_t)(lwip_sys_now + 20));
-  
+#endif
+
   /* check timers expire in correct order */
   memset(&fired, 0, sizeof(fired));
 
@@ -219,6 +262,181 @@ START_TEST(test_long_timer)
 }
 END_TEST
 
+#define ORDER_TIMERS 10
+static const u32_t order_delays[ORDER_TIMERS] = {30, 5, 5000, 17, 5, 300, 17, 70000, 0, 256};
+/* indices into order_delays sorted by expiry, equal delays in the order added */
+static const int order_expected[ORDER_TIMERS] = {8, 1, 4, 3, 6, 0, 9, 5, 2, 7};
+static int order_fired[ORDER_TIMERS];
+static u32_t order_fired_at[ORDER_TIMERS];
+static int order_count;
+
+static void
+order_handler(void* arg)
+{
+  int index = LWIP_PTR_NUMERIC_CAST(int, arg);
+  order_fired_at[order_count] = lwip_sys_now;
+  order_fired[order_count++] = index;
+}
+
+static void
+do_test_timers_order(u32_t offset)
+{
+  int i;
+  u32_t t;
+
+  order_count = 0;
+  lwip_sys_now = offset;
+  for (i = 0; i < ORDER_TIMERS; i++) {
+    sys_timeout(order_delays[i], order_handler, LWIP_PTR_NUMERIC_CAST(void*, i));
+  }
+
+  /* step through time 1 ms at a time: every timeout has to fire exactly
+     when due and sys_timeouts_sleeptime() has to point at the next one */
+  for (t = 0; t <= order_delays[7]; t++) {
+    lwip_sys_now = offset + t;
+    sys_check_timeouts();
+    if (order_count < ORDER_TIMERS) {
+      fail_unless(sys_timeouts_sleeptime() == order_delays[order_expected[order_count]] - t);
+    }
+  }
+  fail_unless(order_count == ORDER_TIMERS);
+  for (i = 0; i < ORDER_TIMERS; i++) {
+    fail_unless(order_fired[i] == order_expected[i]);
+    fail_unless(order_fired_at[i] == (u32_t)(offset + order_delays[order_expected[i]]));
+  }
+  fail_unless(sys_timeouts_sleeptime() == SYS_TIMEOUTS_SLEEPTIME_INFINITE);
+}
+
+START_TEST(test_timers_order)
+{
+  LWIP_UNUSED_ARG(_i);
+
+  do_test_timers_order(0);
+  /* wraparound in the middle of the short timers and of the long ones */
+  do_test_timers_order(0xfffffff0);
+  do_test_timers_order(0xffff0000);
+}
+END_TEST
+
+START_TEST(test_timers_late_check)
+{
+  int i;
+  LWIP_UNUSED_ARG(_i);
+
+  /* all timeouts overdue at once: they still fire in order */
+  order_count = 0;
+  lwip_sys_now = 1000;
+  for (i = 0; i < ORDER_TIMERS; i++) {
+    sys_timeout(order_delays[i], order_handler, LWIP_PTR_NUMERIC_CAST(void*, i));
+  }
+  lwip_sys_now += 100000;
+  sys_check_timeouts();
+  fail_unless(order_count == ORDER_TIMERS);
+  for (i = 0; i < ORDER_TIMERS; i++) {
+    fail_unless(order_fired[i] == order_expected[i]);
+  }
+}
+END_TEST
+
+START_TEST(test_untimeout_first)
+{
+  LWIP_UNUSED_ARG(_i);
+
+  memset(&fired, 0, sizeof(fired));
+  lwip_sys_now = 100;
+
+  /* sys_untimeout() removes the matching timeout that would expire first */
+  sys_timeout(10, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
+  sys_timeout(5, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
+  sys_timeout(3, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 1));
+  sys_timeout(20, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
+  fail_unless(sys_timeouts_sleeptime() == 3);
+
+  sys_untimeout(dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
+  sys_untimeout(dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 1));
+  fail_unless(sys_timeouts_sleeptime() == 10);
+  sys_untimeout(dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
+  fail_unless(sys_timeouts_sleeptime() == 20);
+
+  /* no match: nothing removed */
+  sys_untimeout(dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 2));
+  fail_unless(sys_timeouts_sleeptime() == 20);
+
+  lwip_sys_now += 20;
+  sys_check_timeouts();
+  fail_unless(fired[0] == 1);
+  fail_unless(fired[1] == 0);
+  fail_unless(sys_timeouts_sleeptime() == SYS_TIMEOUTS_SLEEPTIME_INFINITE);
+}
+END_TEST
+
+static void
+rearm_handler(void* arg)
+{
+  LWIP_UNUSED_ARG(arg);
+  sys_timeout(0, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 2));
+}
+
+START_TEST(test_timeout_from_handler)
+{
+  LWIP_UNUSED_ARG(_i);
+
+  memset(&fired, 0, sizeof(fired));
+  lwip_sys_now = 200;
+
+  /* a timeout of 0 added by a handler fires in the same check */
+  sys_timeout(7, rearm_handler, NULL);
+  sys_timeout(9, dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
+  lwip_sys_now += 7;
+  sys_check_timeouts();
+  fail_unless(fired[2] == 1);
+  fail_unless(fired[0] == 0);
+  fail_unless(sys_timeouts_sleeptime() == 2);
+
+  sys_untimeout(dummy_handler, LWIP_PTR_NUMERIC_CAST(void*, 0));
+}
+END_TEST
+
+#define CASCADE_TIMERS 9
+/* delays just below and at the block boundaries of each wheel level */
+static const u32_t cascade_delays[CASCADE_TIMERS] = {15, 16, 255, 256, 4095, 4096, 65535, 65536, 0x100001};
+
+static void
+do_test_timers_cascade(u32_t offset)
+{
+  int i;
+
+  order_count = 0;
+  lwip_sys_now = offset;
+  for (i = CASCADE_TIMERS - 1; i >= 0; i--) {
+    sys_timeout(cascade_delays[i], order_handler, LWIP_PTR_NUMERIC_CAST(void*, i));
+  }
+
+  /* sleep exactly as long as sys_timeouts_sleeptime() says, like a NO_SYS
+     main loop: long timeouts must cascade down and fire on time */
+  for (i = 0; i < CASCADE_TIMERS; i++) {
+    u32_t sleeptime = sys_timeouts_sleeptime();
+    fail_unless(sleeptime == (u32_t)(offset + cascade_delays[i] - lwip_sys_now));
+    lwip_sys_now += sleeptime;
+    sys_check_timeouts();
+    fail_unless(order_count == i + 1);
+    fail_unless(order_fired[i] == i);
+    fail_unless(order_fired_at[i] == (u32_t)(offset + cascade_delays[i]));
+  }
+  fail_unless(sys_timeouts_sleeptime() == SYS_TIMEOUTS_SLEEPTIME_INFINITE);
+}
+
+START_TEST(test_timers_cascade)
+{
+  LWIP_UNUSED_ARG(_i);
+
+  do_test_timers_cascade(0);
+  /* unaligned start and wraparound while cascading */
+  do_test_timers_cascade(0x1234567);
+  do_test_timers_cascade(0xfffff000);
+}
+END_TEST
+
 /** Create the suite including all tests for this module */
 Suite *
 timers_suite(void)
@@ -228,6 +446,11 @@ timers_suite(void)
     TESTFUNC(test_cyclic_timers),
     TESTFUNC(test_timers),
     TESTFUNC(test_long_timer),
+    TESTFUNC(test_timers_order),
+    TESTFUNC(test_timers_late_check),
+    TESTFUNC(test_untimeout_first),
+    TESTFUNC(test_timeout_from_handler),
+    TESTFUNC(test_timers_cascade),
   };
   return create_suite("TIMERS", tests, LWIP_ARRAYSIZE(tests), timers_setup, timers_teardown);
 }
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2001-2003 Swedish Institute of Computer Science.
+ * All rights reserved. 
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission. 
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED 
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT 
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT 
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING 
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY 
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ * 
+ */
+#ifndef LWIP_HDR_LWIPOPTS_FEATURES_H
+#define LWIP_HDR_LWIPOPTS_FEATURES_H
+
+/* Second unit test configuration: the default one plus optional features
+ * that are off by default. The test suites are run with both. */
+#include "../lwipopts.h"
+
+/* Keep timeouts in a timing wheel for timer tests */
+#define LWIP_TIMERS_WHEEL               1
+
+/* Enable zero-copy pbuf lending for tcp and socket tests */
+#define LWIP_ZEROCOPY                   1
+
+/* Enable epoll for socket tests */
+#define LWIP_SOCKET_EPOLL               1
+
+/* Enable SACK based loss recovery for tcp tests */
+#define LWIP_TCP_SACK_IN                1
+
+/* Enable selectable congestion control for tcp tests */
+#define LWIP_TCP_CC                     1
+
+/* Verify input checksums in checksum offload threads for udp tests */
+#define TCPIP_CHECKSUM_THREADS          2
+
+#endif /* LWIP_HDR_LWIPOPTS_FEATURES_H */
@@ -80,7 +80,9 @@
 /* Minimal changes to opt.h required for etharp unit tests: */
 #define ETHARP_SUPPORT_STATIC_ENTRIES   1
 
-#define MEMP_NUM_SYS_TIMEOUT            (LWIP_NUM_SYS_TIMEOUT_INTERNAL + 8)
+#define MEMP_NUM_SYS_TIMEOUT            (LWIP_NUM_SYS_TIMEOUT_INTERNAL + 16)
+/* test_sockets_mmsg queues 12 datagrams on one socket */
+#define MEMP_NUM_NETBUF                 16
 
 /* MIB2 stats are required to check IPv4 reassembly results */
 #define MIB2_STATS                      1
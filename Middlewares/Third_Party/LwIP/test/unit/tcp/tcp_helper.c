@@ -146,6 +146,62 @@ struct pbuf* tcp_create_rx_segment_wnd(struct tcp_pcb* pcb, void* data, size_t d
     data, data_len, pcb->rcv_nxt + seqno_offset, pcb->lastack + ackno_offset, headerflags, wnd);
 }
 
+/** Create an ACK segment carrying a SACK option usable for passing to tcp_input
+ * - IP-addresses, ports, seqno and ackno are taken from pcb
+ * - ackno can be altered with an offset
+ * - sack_offsets holds num_blocks pairs of left and right edges relative to pcb->lastack
+ */
+struct pbuf*
+tcp_create_rx_sack(struct tcp_pcb* pcb, u32_t ackno_offset, const u32_t* sack_offsets, u8_t num_blocks)
+{
+  struct pbuf *p;
+  struct ip_hdr* iphdr;
+  struct tcp_hdr* tcphdr;
+  u8_t* opts;
+  u16_t optlen = (u16_t)(4 + 8 * num_blocks);
+  u16_t i;
+
+  p = pbuf_alloc(PBUF_RAW, (u16_t)(sizeof(struct ip_hdr) + sizeof(struct tcp_hdr) + optlen), PBUF_RAM);
+  EXPECT_RETNULL(p != NULL);
+  memset(p->payload, 0, p->len);
+
+  iphdr = (struct ip_hdr*)p->payload;
+  iphdr->dest.addr = ip_2_ip4(&pcb->local_ip)->addr;
+  iphdr->src.addr = ip_2_ip4(&pcb->remote_ip)->addr;
+  IPH_VHL_SET(iphdr, 4, IP_HLEN / 4);
+  IPH_LEN_SET(iphdr, htons(p->tot_len));
+  IPH_CHKSUM_SET(iphdr, inet_chksum(iphdr, IP_HLEN));
+
+  pbuf_header(p, -(s16_t)sizeof(struct ip_hdr));
+
+  tcphdr = (struct tcp_hdr*)p->payload;
+  tcphdr->src   = htons(pcb->remote_port);
+  tcphdr->dest  = htons(pcb->local_port);
+  tcphdr->seqno = htonl(pcb->rcv_nxt);
+  tcphdr->ackno = htonl(pcb->lastack + ackno_offset);
+  TCPH_HDRLEN_SET(tcphdr, (sizeof(struct tcp_hdr) + optlen)/4);
+  TCPH_FLAGS_SET(tcphdr, TCP_ACK);
+  tcphdr->wnd   = htons(TCP_WND);
+
+  /* NOP, NOP, SACK, len, edges */
+  opts = (u8_t*)(tcphdr + 1);
+  opts[0] = 1;
+  opts[1] = 1;
+  opts[2] = 5;
+  opts[3] = (u8_t)(optlen - 2);
+  for (i = 0; i < 2 * num_blocks; i++) {
+    u32_t edge = htonl(pcb->lastack + sack_offsets[i]);
+    memcpy(&opts[4 + 4 * i], &edge, sizeof(edge));
+  }
+
+  tcphdr->chksum = ip_chksum_pseudo(p,
+          IP_PROTO_TCP, p->tot_len, &pcb->remote_ip, &pcb->local_ip);
+
+  pbuf_header(p, sizeof(struct ip_hdr));
+
+  return p;
+}
+
 /** Safely bring a tcp_pcb into the requested state */
 void
 tcp_set_state(struct tcp_pcb* pcb, enum tcp_state state, const ip_addr_t* local_ip,
@@ -163,22 +219,23 @@ tcp_set_state(struct tcp_pcb* pcb, enum tcp_state state, const ip_addr_t* local_
   pcb->lastack = iss;
   pcb->snd_lbb = iss;
   
+  /* set the addresses first: TCP_REG may hash the pcb by them */
   if (state == ESTABLISHED) {
-    TCP_REG(&tcp_active_pcbs, pcb);
     ip_addr_copy(pcb->local_ip, *local_ip);
     pcb->local_port = local_port;
     ip_addr_copy(pcb->remote_ip, *remote_ip);
     pcb->remote_port = remote_port;
+    TCP_REG(&tcp_active_pcbs, pcb);
   } else if(state == LISTEN) {
-    TCP_REG(&tcp_listen_pcbs.pcbs, pcb);
     ip_addr_copy(pcb->local_ip, *local_ip);
     pcb->local_port = local_port;
+    TCP_REG(&tcp_listen_pcbs.pcbs, pcb);
   } else if(state == TIME_WAIT) {
-    TCP_REG(&tcp_tw_pcbs, pcb);
     ip_addr_copy(pcb->local_ip, *local_ip);
     pcb->local_port = local_port;
     ip_addr_copy(pcb->remote_ip, *remote_ip);
     pcb->remote_port = remote_port;
+    TCP_REG(&tcp_tw_pcbs, pcb);
   } else {
     fail();
   }
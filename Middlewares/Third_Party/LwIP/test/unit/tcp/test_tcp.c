@@ -5,6 +5,7 @@
 #include "lwip/inet.h"
 #include "tcp_helper.h"
 #include "lwip/inet_chksum.h"
+#include "arch/sys_arch.h"
 
 #ifdef _MSC_VER
 #pragma warning(disable: 4307) /* we explicitly wrap around TCP seqnos */
@@ -1188,6 +1189,444 @@ START_TEST(test_tcp_rto_tracking)
 }
 END_TEST
 
+#if LWIP_TCP_SACK_IN
+/* Pass a (duplicate) ACK with SACK blocks to the pcb, return the seqno of the
+   only segment sent in response or 0 if nothing was sent */
+static u32_t
+test_tcp_sack_input(struct tcp_pcb *pcb, struct netif *netif, struct test_tcp_txcounters *txcounters,
+                    u32_t ackno_offset, const u32_t *sack_offsets, u8_t num_blocks)
+{
+  struct pbuf *p;
+  u32_t seqno = 0;
+
+  memset(txcounters, 0, sizeof(*txcounters));
+  txcounters->copy_tx_packets = 1;
+  p = tcp_create_rx_sack(pcb, ackno_offset, sack_offsets, num_blocks);
+  EXPECT_RETX(p != NULL, 0);
+  test_tcp_input(p, netif);
+  txcounters->copy_tx_packets = 0;
+  EXPECT(txcounters->num_tx_calls <= 1);
+  if (txcounters->tx_packets != NULL) {
+    struct tcp_hdr tcphdr;
+    EXPECT(pbuf_copy_partial(txcounters->tx_packets, &tcphdr, 20, 20) == 20);
+    seqno = lwip_ntohl(tcphdr.seqno);
+    pbuf_free(txcounters->tx_packets);
+    txcounters->tx_packets = NULL;
+  }
+  return seqno;
+}
+
+/** Two segments lost in a window: SACK recovery retransmits only the holes
+ * and sends new data as the pipe allows */
+START_TEST(test_tcp_sack_recovery)
+{
+  struct netif netif;
+  struct test_tcp_txcounters txcounters;
+  struct test_tcp_counters counters;
+  struct tcp_pcb* pcb;
+  struct pbuf* p;
+  err_t err;
+  size_t i;
+  u32_t segs[9];
+  u32_t sack[4];
+  LWIP_UNUSED_ARG(_i);
+
+  for (i = 0; i < LWIP_ARRAYSIZE(segs); i++) {
+    segs[i] = SEQNO1 + (u32_t)(i * TCP_MSS);
+  }
+
+  /* initialize local vars */
+  test_tcp_init_netif(&netif, &txcounters, &test_local_ip, &test_netmask);
+  memset(&counters, 0, sizeof(counters));
+
+  /* create and initialize the pcb, SACK was negotiated */
+  tcp_ticks = SEQNO1 - ISS;
+  pcb = test_tcp_new_counters_pcb(&counters);
+  EXPECT_RET(pcb != NULL);
+  tcp_set_state(pcb, ESTABLISHED, &test_local_ip, &test_remote_ip, TEST_LOCAL_PORT, TEST_REMOTE_PORT);
+  pcb->mss = TCP_MSS;
+  tcp_set_flags(pcb, TF_SACK);
+  pcb->cwnd = 8*TCP_MSS;
+
+  /* 9 mss-sized segments, cwnd lets 8 of them go out */
+  for (i = 0; i < LWIP_ARRAYSIZE(segs); i++) {
+    err = tcp_write(pcb, &tx_data[i * TCP_MSS], TCP_MSS, TCP_WRITE_FLAG_COPY);
+    EXPECT_RET(err == ERR_OK);
+  }
+  err = tcp_output(pcb);
+  EXPECT_RET(err == ERR_OK);
+  EXPECT(txcounters.num_tx_calls == 8);
+  check_seqnos(pcb->unacked, 8, segs);
+  check_seqnos(pcb->unsent, 1, &segs[8]);
+
+  /* segments 0 and 2 are lost: the first two dupacks don't start recovery */
+  sack[0] = 1*TCP_MSS;
+  sack[1] = 2*TCP_MSS;
+  EXPECT(test_tcp_sack_input(pcb, &netif, &txcounters, 0, sack, 1) == 0);
+  sack[2] = 3*TCP_MSS;
+  sack[3] = 4*TCP_MSS;
+  EXPECT(test_tcp_sack_input(pcb, &netif, &txcounters, 0, sack, 2) == 0);
+  EXPECT(!(pcb->flags & TF_INFR));
+
+  /* the third one does: only segment 0 is lost so far (3 MSS SACKed above it) */
+  sack[3] = 5*TCP_MSS;
+  EXPECT(test_tcp_sack_input(pcb, &netif, &txcounters, 0, sack, 2) == segs[0]);
+  EXPECT(pcb->flags & TF_INFR);
+  EXPECT(pcb->ssthresh == 4*TCP_MSS);
+  EXPECT(pcb->cwnd == 4*TCP_MSS);
+  EXPECT(pcb->recover == segs[8]);
+  check_seqnos(pcb->unsent, 1, &segs[8]);
+
+  /* more SACKed data above it makes segment 2 lost, too */
+  sack[3] = 6*TCP_MSS;
+  EXPECT(test_tcp_sack_input(pcb, &netif, &txcounters, 0, sack, 2) == segs[2]);
+  check_seqnos(pcb->unsent, 1, &segs[8]);
+  /* only the retransmission of the first unacked segment counts for TCP_MAXRTX */
+  EXPECT(pcb->nrtx == 1);
+
+  /* another dupack does not retransmit anything again */
+  EXPECT(test_tcp_sack_input(pcb, &netif, &txcounters, 0, sack, 2) == 0);
+
+  /* partial ACK up to the second hole: still in recovery, segment 2 isn't
+     retransmitted again, but the pipe allows new data */
+  sack[0] = 3*TCP_MSS;
+  sack[1] = 6*TCP_MSS;
+  EXPECT(test_tcp_sack_input(pcb, &netif, &txcounters, 2*TCP_MSS, sack, 1) == segs[8]);
+  EXPECT(pcb->flags & TF_INFR);
+  EXPECT(pcb->lastack == segs[2]);
+  EXPECT(pcb->unsent == NULL);
+
+  /* ACK covering the recovery point ends it */
+  memset(&txcounters, 0, sizeof(txcounters));
+  p = tcp_create_rx_segment(pcb, NULL, 0, 0, 7*TCP_MSS, TCP_ACK);
+  EXPECT_RET(p != NULL);
+  test_tcp_input(p, &netif);
+  EXPECT(!(pcb->flags & TF_INFR));
+  /* cwnd is back at ssthresh, then congestion avoidance counts this ACK */
+  EXPECT(pcb->ssthresh == 4*TCP_MSS);
+  EXPECT(pcb->cwnd == 5*TCP_MSS);
+  EXPECT(pcb->unacked == NULL);
+  EXPECT(txcounters.num_tx_calls == 0);
+
+  /* make sure the pcb is freed */
+  EXPECT_RET(MEMP_STATS_GET(used, MEMP_TCP_PCB) == 1);
+  tcp_abort(pcb);
+  EXPECT_RET(MEMP_STATS_GET(used, MEMP_TCP_PCB) == 0);
+}
+END_TEST
+
+/** Dupacks caused by the retransmission after an RTO don't start SACK
+ * recovery (RFC 6675, section 5.1) */
+START_TEST(test_tcp_sack_after_rto)
+{
+  struct netif netif;
+  struct test_tcp_txcounters txcounters;
+  struct test_tcp_counters counters;
+  struct tcp_pcb* pcb;
+  err_t err;
+  size_t i;
+  u32_t sack[2];
+  LWIP_UNUSED_ARG(_i);
+
+  test_tcp_init_netif(&netif, &txcounters, &test_local_ip, &test_netmask);
+  memset(&counters, 0, sizeof(counters));
+
+  tcp_ticks = SEQNO1 - ISS;
+  pcb = test_tcp_new_counters_pcb(&counters);
+  EXPECT_RET(pcb != NULL);
+  tcp_set_state(pcb, ESTABLISHED, &test_local_ip, &test_remote_ip, TEST_LOCAL_PORT, TEST_REMOTE_PORT);
+  pcb->mss = TCP_MSS;
+  tcp_set_flags(pcb, TF_SACK);
+  pcb->cwnd = 5*TCP_MSS;
+
+  for (i = 0; i < 5; i++) {
+    err = tcp_write(pcb, &tx_data[i * TCP_MSS], TCP_MSS, TCP_WRITE_FLAG_COPY);
+    EXPECT_RET(err == ERR_OK);
+  }
+  err = tcp_output(pcb);
+  EXPECT_RET(err == ERR_OK);
+  EXPECT(txcounters.num_tx_calls == 5);
+
+  /* RTO: everything is sent again */
+  memset(&txcounters, 0, sizeof(txcounters));
+  tcp_rexmit_rto(pcb);
+  EXPECT(pcb->flags & TF_RTO);
+  EXPECT(txcounters.num_tx_calls == 5);
+
+  /* the remote host already had segments 1..4 */
+  sack[0] = 1*TCP_MSS;
+  sack[1] = 5*TCP_MSS;
+  for (i = 0; i < 3; i++) {
+    EXPECT(test_tcp_sack_input(pcb, &netif, &txcounters, 0, sack, 1) == 0);
+    EXPECT(!(pcb->flags & TF_INFR));
+  }
+  EXPECT(pcb->cwnd == 5*TCP_MSS);
+
+  tcp_abort(pcb);
+}
+END_TEST
+#endif /* LWIP_TCP_SACK_IN */
+
+#if LWIP_TCP_CC
+/* Pass one round-trip time worth of ACKs (one per segment in cwnd) to the
+   congestion control module, the first with an RTT sample */
+static void
+test_tcp_cc_round(struct tcp_pcb *pcb, u32_t rtt)
+{
+  u32_t i, segs = pcb->cwnd / pcb->mss;
+
+  for (i = 0; i < segs; i++) {
+    pcb->cc->on_ack(pcb, pcb->mss, (i == 0) ? rtt : 0);
+  }
+  lwip_sys_now += rtt;
+}
+
+/** New pcbs use Reno, tcp_set_cc() changes it */
+START_TEST(test_tcp_cc_select)
+{
+  struct test_tcp_counters counters;
+  struct tcp_pcb* pcb;
+  LWIP_UNUSED_ARG(_i);
+
+  memset(&counters, 0, sizeof(counters));
+  pcb = test_tcp_new_counters_pcb(&counters);
+  EXPECT_RET(pcb != NULL);
+  EXPECT(pcb->cc == &tcp_cc_reno);
+  pcb->cc_priv[0] = 1;
+  tcp_set_cc(pcb, &tcp_cc_vegas);
+  EXPECT(pcb->cc == &tcp_cc_vegas);
+  EXPECT(pcb->cc_priv[0] == 0);
+#if LWIP_HAVE_INT64
+  tcp_set_cc(pcb, &tcp_cc_cubic);
+  EXPECT(pcb->cc == &tcp_cc_cubic);
+#endif /* LWIP_HAVE_INT64 */
+  tcp_abort(pcb);
+}
+END_TEST
+
+#if LWIP_HAVE_INT64
+/** CUBIC returns to the cwnd of the last loss in K = cbrt(W_max * (1 - beta) / C)
+ * seconds, concave before and convex after that */
+START_TEST(test_tcp_cc_cubic)
+{
+  struct test_tcp_counters counters;
+  struct tcp_pcb* pcb;
+  u32_t w_max = 40 * TCP_MSS;
+  LWIP_UNUSED_ARG(_i);
+
+  memset(&counters, 0, sizeof(counters));
+  pcb = test_tcp_new_counters_pcb(&counters);
+  EXPECT_RET(pcb != NULL);
+  tcp_set_state(pcb, ESTABLISHED, &test_local_ip, &test_remote_ip, TEST_LOCAL_PORT, TEST_REMOTE_PORT);
+  pcb->mss = TCP_MSS;
+  pcb->snd_wnd = 100 * TCP_MSS;
+  tcp_set_cc(pcb, &tcp_cc_cubic);
+
+  /* loss at 40 MSS: beta = 0.7 */
+  lwip_sys_now = 1000;
+  pcb->cwnd = (tcpwnd_size_t)w_max;
+  pcb->cc->on_loss(pcb);
+  EXPECT(pcb->ssthresh == 28 * TCP_MSS);
+  pcb->cwnd = pcb->ssthresh;
+
+  /* K = cbrt(12 / 0.4) s = 3.1 s: cwnd grows fast first... */
+  while (lwip_sys_now < 2500) {
+    test_tcp_cc_round(pcb, 500);
+  }
+  EXPECT(pcb->cwnd > 35 * TCP_MSS);
+  EXPECT(pcb->cwnd < w_max);
+  /* ...then stays around W_max... */
+  while (lwip_sys_now < 4500) {
+    test_tcp_cc_round(pcb, 500);
+  }
+  EXPECT(pcb->cwnd >= w_max - TCP_MSS);
+  EXPECT(pcb->cwnd <= w_max + TCP_MSS);
+  /* ...and probes beyond it: 0.4 * 2.4^3 = 5.5 MSS more at K + 2.4 s */
+  while (lwip_sys_now < 6500) {
+    test_tcp_cc_round(pcb, 500);
+  }
+  EXPECT(pcb->cwnd > w_max + 2 * TCP_MSS);
+  EXPECT(pcb->cwnd < w_max + 6 * TCP_MSS);
+
+  /* fast convergence: a loss below W_max lowers W_max further */
+  pcb->cwnd = 30 * TCP_MSS;
+  pcb->cc->on_loss(pcb);
+  EXPECT(pcb->ssthresh == 21 * TCP_MSS);
+  EXPECT(pcb->cc_priv[0] == (30 * TCP_MSS * 17) / 20);
+
+  tcp_abort(pcb);
+}
+END_TEST
+#endif /* LWIP_HAVE_INT64 */
+
+/** Vegas keeps 2..4 segments queued: cwnd grows while the RTT stays at its
+ * minimum and shrinks when it rises */
+START_TEST(test_tcp_cc_vegas)
+{
+  struct netif netif;
+  struct test_tcp_txcounters txcounters;
+  struct test_tcp_counters counters;
+  struct tcp_pcb* pcb;
+  struct pbuf* p;
+  err_t err;
+  LWIP_UNUSED_ARG(_i);
+
+  test_tcp_init_netif(&netif, &txcounters, &test_local_ip, &test_netmask);
+  memset(&counters, 0, sizeof(counters));
+  /* tcp_ticks 0 would disable the RTT measurement */
+  tcp_ticks = SEQNO1 - ISS;
+  pcb = test_tcp_new_counters_pcb(&counters);
+  EXPECT_RET(pcb != NULL);
+  tcp_set_state(pcb, ESTABLISHED, &test_local_ip, &test_remote_ip, TEST_LOCAL_PORT, TEST_REMOTE_PORT);
+  pcb->mss = TCP_MSS;
+  pcb->cwnd = 2 * TCP_MSS;
+  tcp_set_cc(pcb, &tcp_cc_vegas);
+
+  /* tcp_receive() passes the RTT in milliseconds */
+  lwip_sys_now = 1000;
+  err = tcp_write(pcb, tx_data, TCP_MSS, TCP_WRITE_FLAG_COPY);
+  EXPECT_RET(err == ERR_OK);
+  err = tcp_output(pcb);
+  EXPECT_RET(err == ERR_OK);
+  EXPECT(txcounters.num_tx_calls == 1);
+  lwip_sys_now = 1100;
+  p = tcp_create_rx_segment(pcb, NULL, 0, 0, TCP_MSS, TCP_ACK);
+  EXPECT_RET(p != NULL);
+  test_tcp_input(p, &netif);
+  EXPECT(pcb->unacked == NULL);
+  EXPECT(pcb->cc_priv[0] == 100);
+
+  /* congestion avoidance: nothing queued yet, +1 MSS per RTT */
+  pcb->cwnd = 10 * TCP_MSS;
+  pcb->ssthresh = 5 * TCP_MSS;
+  pcb->cc->on_ack(pcb, TCP_MSS, 100);
+  EXPECT(pcb->cwnd == 11 * TCP_MSS);
+  pcb->cc->on_ack(pcb, TCP_MSS, 0);
+  EXPECT(pcb->cwnd == 11 * TCP_MSS);
+  /* the RTT doubled: half of cwnd is queued, -1 MSS per RTT */
+  pcb->cc->on_ack(pcb, TCP_MSS, 200);
+  EXPECT(pcb->cwnd == 10 * TCP_MSS);
+  /* 2.3 segments queued: keep cwnd */
+  pcb->cc->on_ack(pcb, TCP_MSS, 130);
+  EXPECT(pcb->cwnd == 10 * TCP_MSS);
+
+  /* slow start ends when more than one segment is queued */
+  pcb->cwnd = 4 * TCP_MSS;
+  pcb->ssthresh = 20 * TCP_MSS;
+  pcb->cc->on_ack(pcb, TCP_MSS, 100);
+  EXPECT(pcb->cwnd == 5 * TCP_MSS);
+  pcb->cc->on_ack(pcb, TCP_MSS, 150);
+  EXPECT(pcb->cwnd < 5 * TCP_MSS);
+  EXPECT(pcb->ssthresh == pcb->cwnd);
+
+  /* losses are handled like Reno */
+  pcb->cwnd = 10 * TCP_MSS;
+  pcb->snd_wnd = 20 * TCP_MSS;
+  pcb->cc->on_loss(pcb);
+  EXPECT(pcb->ssthresh == 5 * TCP_MSS);
+
+  tcp_abort(pcb);
+}
+END_TEST
+#endif /* LWIP_TCP_CC */
+
+#if LWIP_ZEROCOPY
+static int test_tcp_write_pbuf_freed;
+
+static void
+test_tcp_write_pbuf_free(struct pbuf *p)
+{
+  LWIP_UNUSED_ARG(p);
+  test_tcp_write_pbuf_freed++;
+}
+
+/** Write an application pbuf by reference and check that the stack keeps it
+ * until it is ACKed (or the pcb is aborted) */
+START_TEST(test_tcp_write_pbuf)
+{
+  struct netif netif;
+  struct test_tcp_txcounters txcounters;
+  struct test_tcp_counters counters;
+  struct tcp_pcb* pcb;
+  struct pbuf_custom pc;
+  struct pbuf* p;
+  u8_t data[TCP_MSS + 100];
+  u16_t i;
+  err_t err;
+  LWIP_UNUSED_ARG(_i);
+
+  for (i = 0; i < sizeof(data); i++) {
+    data[i] = (u8_t)i;
+  }
+  test_tcp_write_pbuf_freed = 0;
+  pc.custom_free_function = test_tcp_write_pbuf_free;
+
+  /* initialize local vars */
+  test_tcp_init_netif(&netif, &txcounters, &test_local_ip, &test_netmask);
+  memset(&counters, 0, sizeof(counters));
+
+  /* create and initialize the pcb */
+  pcb = test_tcp_new_counters_pcb(&counters);
+  EXPECT_RET(pcb != NULL);
+  tcp_set_state(pcb, ESTABLISHED, &test_local_ip, &test_remote_ip, TEST_LOCAL_PORT, TEST_REMOTE_PORT);
+  pcb->mss = TCP_MSS;
+  /* disable initial congestion window (we don't send a SYN here...) */
+  pcb->cwnd = pcb->snd_wnd;
+
+  /* write in two parts, then drop our own reference */
+  p = pbuf_alloced_custom(PBUF_RAW, sizeof(data), PBUF_REF, &pc, data, sizeof(data));
+  EXPECT_RET(p != NULL);
+  err = tcp_write_pbuf(pcb, p, 0, 10, TCP_WRITE_FLAG_MORE);
+  EXPECT_RET(err == ERR_OK);
+  err = tcp_write_pbuf(pcb, p, 10, sizeof(data) - 10, 0);
+  EXPECT_RET(err == ERR_OK);
+  err = tcp_write_pbuf(pcb, p, 10, sizeof(data), 0);
+  EXPECT_RET(err == ERR_ARG);
+  pbuf_free(p);
+  EXPECT_RET(test_tcp_write_pbuf_freed == 0);
+
+  /* send both segments at once */
+  tcp_nagle_disable(pcb);
+  txcounters.copy_tx_packets = 1;
+  err = tcp_output(pcb);
+  EXPECT_RET(err == ERR_OK);
+  EXPECT_RET(txcounters.num_tx_calls == 2);
+  EXPECT_RET(txcounters.num_tx_bytes == sizeof(data) + 2 * (sizeof(struct tcp_hdr) + sizeof(struct ip_hdr)));
+  EXPECT(pbuf_memcmp(txcounters.tx_packets, IP_HLEN + TCP_HLEN, data, TCP_MSS) == 0);
+  EXPECT(pbuf_memcmp(txcounters.tx_packets, 2 * (IP_HLEN + TCP_HLEN) + TCP_MSS, &data[TCP_MSS], 100) == 0);
+  pbuf_free(txcounters.tx_packets);
+  memset(&txcounters, 0, sizeof(txcounters));
+  EXPECT_RET(test_tcp_write_pbuf_freed == 0);
+
+  /* "recv" ACK for the first segment: the data is still referenced */
+  p = tcp_create_rx_segment(pcb, NULL, 0, 0, TCP_MSS, TCP_ACK);
+  EXPECT_RET(p != NULL);
+  test_tcp_input(p, &netif);
+  EXPECT_RET(test_tcp_write_pbuf_freed == 0);
+  /* "recv" ACK for the rest: the last reference is gone */
+  p = tcp_create_rx_segment(pcb, NULL, 0, 0, sizeof(data) - TCP_MSS, TCP_ACK);
+  EXPECT_RET(p != NULL);
+  test_tcp_input(p, &netif);
+  EXPECT_RET(pcb->unacked == NULL);
+  EXPECT_RET(test_tcp_write_pbuf_freed == 1);
+  EXPECT_RET(MEMP_STATS_GET(used, MEMP_TCP_PBUF_REF) == 0);
+
+  /* data that is never sent is released when the pcb goes away */
+  p = pbuf_alloced_custom(PBUF_RAW, sizeof(data), PBUF_REF, &pc, data, sizeof(data));
+  EXPECT_RET(p != NULL);
+  err = tcp_write_pbuf(pcb, p, 0, sizeof(data), 0);
+  EXPECT_RET(err == ERR_OK);
+  pbuf_free(p);
+  EXPECT_RET(test_tcp_write_pbuf_freed == 1);
+  EXPECT_RET(MEMP_STATS_GET(used, MEMP_TCP_PCB) == 1);
+  tcp_abort(pcb);
+  EXPECT_RET(MEMP_STATS_GET(used, MEMP_TCP_PCB) == 0);
+  EXPECT_RET(test_tcp_write_pbuf_freed == 2);
+  EXPECT_RET(MEMP_STATS_GET(used, MEMP_TCP_PBUF_REF) == 0);
+}
+END_TEST
+#endif /* LWIP_ZEROCOPY */
+
 static void test_tcp_rto_timeout_impl(int link_down)
 {
   struct netif netif;
@@ -1688,6 +2127,20 @@ tcp_suite(void)
     TESTFUNC(test_tcp_tx_full_window_lost_from_unsent),
     TESTFUNC(test_tcp_retx_add_to_sent),
     TESTFUNC(test_tcp_rto_tracking),
+#if LWIP_TCP_SACK_IN
+    TESTFUNC(test_tcp_sack_recovery),
+    TESTFUNC(test_tcp_sack_after_rto),
+#endif /* LWIP_TCP_SACK_IN */
+#if LWIP_TCP_CC
+    TESTFUNC(test_tcp_cc_select),
+#if LWIP_HAVE_INT64
+    TESTFUNC(test_tcp_cc_cubic),
+#endif /* LWIP_HAVE_INT64 */
+    TESTFUNC(test_tcp_cc_vegas),
+#endif /* LWIP_TCP_CC */
+#if LWIP_ZEROCOPY
+    TESTFUNC(test_tcp_write_pbuf),
+#endif /* LWIP_ZEROCOPY */
     TESTFUNC(test_tcp_rto_timeout),
     TESTFUNC(test_tcp_rto_timeout_link_down),
     TESTFUNC(test_tcp_rto_timeout_syn_sent),
@@ -3,6 +3,7 @@
 #include "lwip/udp.h"
 #include "lwip/stats.h"
 #include "lwip/inet_chksum.h"
+#include "lwip/tcpip.h"
 
 #if !LWIP_STATS || !UDP_STATS || !MEMP_STATS
 #error "This tests needs UDP- and MEMP-statistics enabled"
@@ -459,6 +460,101 @@ START_TEST(test_udp_bind)
 }
 END_TEST
 
+#if TCPIP_CHECKSUM_THREADS
+static u8_t test_recv_flags;
+
+static void test_recv_flags_fn(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+    const ip_addr_t *addr, u16_t port)
+{
+  test_recv_flags = p->flags;
+  test_recv(arg, pcb, p, addr, port);
+}
+
+/* fill in the UDP checksum of a packet from test_udp_create_test_packet() */
+static void
+test_udp_set_chksum(struct pbuf *p)
+{
+  struct ip_hdr *ih = (struct ip_hdr *)p->payload;
+  struct udp_hdr *uh;
+  ip4_addr_t src, dest;
+  u8_t ret;
+
+  ip4_addr_copy(src, ih->src);
+  ip4_addr_copy(dest, ih->dest);
+  ret = pbuf_remove_header(p, sizeof(struct ip_hdr));
+  fail_unless(!ret);
+  uh = (struct udp_hdr *)p->payload;
+  uh->chksum = inet_chksum_pseudo(p, IP_PROTO_UDP, p->tot_len, &src, &dest);
+  ret = pbuf_add_header(p, sizeof(struct ip_hdr));
+  fail_unless(!ret);
+}
+
+/* pass a packet through tcpip_inpkt(), a checksum thread and tcpip_thread */
+static void
+test_udp_input_through_chksum_thread(struct pbuf *p)
+{
+  err_t err = tcpip_inpkt(p, &test_netif1, ip4_input);
+  fail_unless(err == ERR_OK);
+  fail_unless(tcpip_chksum_thread_poll_one() == 1);
+  fail_unless(tcpip_chksum_thread_poll_one() == 0);
+  while (tcpip_thread_poll_one());
+}
+
+/* a checksum thread must only flag packets with correct checksums, the core
+   has to drop the others like without checksum threads */
+START_TEST(test_udp_chksum_thread)
+{
+  err_t err;
+  struct udp_pcb *pcb;
+  const u16_t port = 12345;
+  struct test_udp_rxdata ctr;
+  struct pbuf *p;
+  u16_t udp_chkerr = STATS_GET(udp.chkerr);
+  u16_t ip_chkerr = STATS_GET(ip.chkerr);
+  LWIP_UNUSED_ARG(_i);
+
+  pcb = udp_new();
+  fail_unless(pcb != NULL);
+  err = udp_bind(pcb, &test_netif1.ip_addr, port);
+  fail_unless(err == ERR_OK);
+  memset(&ctr, 0, sizeof(ctr));
+  ctr.pcb = pcb;
+  udp_recv(pcb, test_recv_flags_fn, &ctr);
+
+  /* correct checksums: verified by the checksum thread, delivered */
+  p = test_udp_create_test_packet(16, port, test_ipaddr1.addr);
+  EXPECT_RET(p != NULL);
+  test_udp_set_chksum(p);
+  test_recv_flags = 0;
+  test_udp_input_through_chksum_thread(p);
+  fail_unless(ctr.rx_cnt == 1);
+  fail_unless(ctr.rx_bytes == 16);
+  fail_unless((test_recv_flags & PBUF_FLAG_CHECKSUM_OK) != 0);
+
+  /* corrupted UDP payload: not flagged, dropped by udp_input */
+  p = test_udp_create_test_packet(16, port, test_ipaddr1.addr);
+  EXPECT_RET(p != NULL);
+  test_udp_set_chksum(p);
+  ((u8_t *)p->payload)[sizeof(struct ip_hdr) + sizeof(struct udp_hdr) + 3] ^= 0x10;
+  test_udp_input_through_chksum_thread(p);
+  fail_unless(ctr.rx_cnt == 1);
+  fail_unless(STATS_GET(udp.chkerr) == (u16_t)(udp_chkerr + 1));
+
+  /* corrupted IPv4 header: not flagged, dropped by ip4_input */
+  p = test_udp_create_test_packet(16, port, test_ipaddr1.addr);
+  EXPECT_RET(p != NULL);
+  test_udp_set_chksum(p);
+  ((struct ip_hdr *)p->payload)->_ttl--;
+  test_udp_input_through_chksum_thread(p);
+  fail_unless(ctr.rx_cnt == 1);
+  fail_unless(STATS_GET(ip.chkerr) == (u16_t)(ip_chkerr + 1));
+  fail_unless(STATS_GET(udp.chkerr) == (u16_t)(udp_chkerr + 1));
+
+  udp_remove(pcb);
+}
+END_TEST
+#endif /* TCPIP_CHECKSUM_THREADS */
+
 /** Create the suite including all tests for this module */
 Suite *
 udp_suite(void)
@@ -466,7 +562,10 @@ udp_suite(void)
   testfunc tests[] = {
     TESTFUNC(test_udp_new_remove),
     TESTFUNC(test_udp_broadcast_rx_with_2_netifs),
-    TESTFUNC(test_udp_bind)
+    TESTFUNC(test_udp_bind),
+#if TCPIP_CHECKSUM_THREADS
+    TESTFUNC(test_udp_chksum_thread),
+#endif /* TCPIP_CHECKSUM_THREADS */
   };
   return create_suite("UDP", tests, sizeof(tests)/sizeof(testfunc), udp_setup, udp_teardown);
 }
@@ -436,16 +436,30 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 {
   uint32_t i = 0U;
   struct pbuf *q = NULL;
+  struct pbuf *tx = p;
   err_t errval = ERR_OK;
+  uint32_t tickstart = 0U;
   ETH_BufferTypeDef Txbuffer[ETH_TX_DESC_CNT] = {0};
 
   memset(Txbuffer, 0 , ETH_TX_DESC_CNT*sizeof(ETH_BufferTypeDef));
 
-  for(q = p; q != NULL; q = q->next)
+  /* Each pbuf of the chain takes one DMA descriptor. A chain longer than the
+   * ring is sent from a contiguous copy instead of being dropped. */
+  if(pbuf_clen(p) > ETH_TX_DESC_CNT)
   {
-    if(i >= ETH_TX_DESC_CNT)
-      return ERR_IF;
+    tx = pbuf_clone(PBUF_RAW, PBUF_RAM, p);
+    if(tx == NULL)
+      return ERR_MEM;
+  }
+  else
+  {
+    /* The frame stays referenced until its descriptors are released,
+     * see HAL_ETH_TxFreeCallback() */
+    pbuf_ref(p);
+  }
 
+  for(q = tx; q != NULL; q = q->next)
+  {
     Txbuffer[i].buffer = q->payload;
     Txbuffer[i].len = q->len;
 
@@ -463,18 +477,26 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
   }
 
   TxConfig.ChecksumCtrl = ETH_CHECKSUM_IPHDR_PAYLOAD_INSERT_PHDR_CALC;
-  TxConfig.Length = p->tot_len;
+  TxConfig.Length = tx->tot_len;
   TxConfig.TxBuffer = Txbuffer;
-  TxConfig.pData = p;
+  TxConfig.pData = tx;
 
-  pbuf_ref(p);
+  /* Give back the descriptors and pbufs of the frames already sent */
+  HAL_ETH_ReleaseTxPacket(&heth);
 
-  HAL_ETH_Transmit_IT(&heth, &TxConfig);
-  while(osSemaphoreAcquire(TxPktSemaphore, TIME_WAITING_FOR_INPUT) != osOK)
+  /* Several frames may be in flight: only wait when the ring is full */
+  tickstart = HAL_GetTick();
+  while(HAL_ETH_Transmit_IT(&heth, &TxConfig) != HAL_OK)
   {
-  }
+    if((heth.gState != HAL_ETH_STATE_STARTED) || ((HAL_GetTick() - tickstart) > ETH_DMA_TRANSMIT_TIMEOUT))
+    {
+      pbuf_free(tx);
+      return ERR_IF;
+    }
 
-  HAL_ETH_ReleaseTxPacket(&heth);
+    osSemaphoreAcquire(TxPktSemaphore, ETH_DMA_TRANSMIT_TIMEOUT);
+    HAL_ETH_ReleaseTxPacket(&heth);
+  }
 
   return errval;
 }
@@ -0,0 +1,534 @@
+/**
+  ******************************************************************************
+  * @file    eth_tx_mock.c
+  * @brief   Host model of the ETH DMA Tx descriptor ring, and stubs of the
+  *          other HAL, CMSIS-RTOS2 and PHY calls of the ethernetif.c files.
+  *
+  *          HAL_ETH_Transmit_IT() and HAL_ETH_ReleaseTxPacket() follow
+  *          stm32mp2xx_hal_eth.c: a frame takes one descriptor per two
+  *          buffers, the packet address is kept with its last descriptor, a
+  *          descriptor is busy while the DMA owns it or while its packet has
+  *          not been released yet. The DMA sends the frames in ring order, one
+  *          after the other at WireNsPerByte, reads their buffers when a frame
+  *          is done and raises HAL_ETH_TxCpltCallback() IrqLatencyNs later.
+  *          Time only advances in EthTxMock_Advance(), in the waits of the
+  *          driver (osSemaphoreAcquire(), osDelay()) and by PollNs for every
+  *          HAL_ETH_Transmit_IT() call that finds the ring full.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32mp2xx_hal.h"
+#include "cmsis_os.h"
+#include "rtl8211.h"
+#include "lan8742.h"
+#include "eth_tx_mock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* preamble, FCS and inter-frame gap */
+#define ETH_WIRE_OVERHEAD     24U
+#define ETH_MIN_FRAME         60U
+#define ETH_MOCK_MAX_FRAME    (ETH_TX_DESC_CNT * 2U * 1536U)
+#define ETH_MOCK_IRQ_CNT      (ETH_TX_DESC_CNT + 1U)
+#define ETH_MOCK_SEM_CNT      4U
+#define ETH_MOCK_NEVER        UINT64_MAX
+
+#ifdef ETH_TX_MOCK_RTOS
+/* Defined by main.c in the RTOS applications, by ethernetif.c in the others */
+ETH_HandleTypeDef heth;
+ETH_TxPacketConfigTypeDef TxConfig;
+#endif
+extern ETH_HandleTypeDef heth;
+
+EthTxMockStats_t EthTxMockStats;
+
+static EthTxMockModel_t Model;
+static EthTxMockFrameCheck_t FrameCheck;
+static uint64_t Now;
+static uint64_t WireFree;
+static int Stalled;
+
+/* Shadow of the Tx descriptors: host buffer addresses do not fit DESC0/DESC1 */
+static uint8_t DescOwn[ETH_TX_DESC_CNT];
+static uint8_t *DescBuf[ETH_TX_DESC_CNT][2];
+static uint32_t DescLen[ETH_TX_DESC_CNT][2];
+/* Per frame, at its first descriptor */
+static uint32_t FrameLastDesc[ETH_TX_DESC_CNT];
+static uint32_t FrameLen[ETH_TX_DESC_CNT];
+static uint64_t FrameQueuedAt[ETH_TX_DESC_CNT];
+/* Next descriptor the DMA works on */
+static uint32_t DmaDesc;
+
+/* Pending Tx complete interrupts, in time order */
+static uint64_t IrqAt[ETH_MOCK_IRQ_CNT];
+static uint32_t IrqHead;
+static uint32_t IrqCount;
+
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Max;
+} EthTxMockSem_t;
+
+static EthTxMockSem_t Sems[ETH_MOCK_SEM_CNT];
+static uint32_t SemCount;
+
+static uint8_t Frame[ETH_MOCK_MAX_FRAME];
+
+static uint64_t NextCompletion(void)
+{
+  uint64_t start;
+  uint32_t len;
+
+  if (Stalled || (DescOwn[DmaDesc] == 0U))
+  {
+    return ETH_MOCK_NEVER;
+  }
+  start = (FrameQueuedAt[DmaDesc] > WireFree) ? FrameQueuedAt[DmaDesc] : WireFree;
+  len = (FrameLen[DmaDesc] < ETH_MIN_FRAME) ? ETH_MIN_FRAME : FrameLen[DmaDesc];
+  return start + (uint64_t)(len + ETH_WIRE_OVERHEAD) * Model.WireNsPerByte;
+}
+
+/* The DMA is done with the frame at DmaDesc: read it, give back its descriptors */
+static void CompleteFrame(void)
+{
+  uint32_t first = DmaDesc;
+  uint32_t last = FrameLastDesc[first];
+  uint32_t idx = first;
+  uint32_t len = 0U;
+  uint32_t b;
+
+  for (;;)
+  {
+    for (b = 0U; b < 2U; b++)
+    {
+      if ((DescLen[idx][b] != 0U) && (len + DescLen[idx][b] <= ETH_MOCK_MAX_FRAME))
+      {
+        memcpy(&Frame[len], DescBuf[idx][b], DescLen[idx][b]);
+      }
+      len += DescLen[idx][b];
+    }
+    DescOwn[idx] = 0U;
+    if (idx == last)
+    {
+      break;
+    }
+    idx = (idx + 1U) % ETH_TX_DESC_CNT;
+  }
+  if ((len != FrameLen[first]) || ((FrameCheck != NULL) && (FrameCheck(Frame, len) == 0)))
+  {
+    EthTxMockStats.BadFrames++;
+  }
+  EthTxMockStats.Sent++;
+  DmaDesc = (last + 1U) % ETH_TX_DESC_CNT;
+
+  if (IrqCount < ETH_MOCK_IRQ_CNT)
+  {
+    IrqAt[(IrqHead + IrqCount) % ETH_MOCK_IRQ_CNT] = Now + Model.IrqLatencyNs;
+    IrqCount++;
+  }
+}
+
+/* Run the next DMA or interrupt event up to deadline, returns 0 if there is none */
+static int RunNextEvent(uint64_t deadline)
+{
+  uint64_t done = NextCompletion();
+  uint64_t irq = (IrqCount != 0U) ? IrqAt[IrqHead] : ETH_MOCK_NEVER;
+
+  if ((done > deadline) && (irq > deadline))
+  {
+    return 0;
+  }
+  if (done <= irq)
+  {
+    Now = done;
+    WireFree = done;
+    CompleteFrame();
+  }
+  else
+  {
+    Now = irq;
+    IrqHead = (IrqHead + 1U) % ETH_MOCK_IRQ_CNT;
+    IrqCount--;
+    HAL_ETH_TxCpltCallback(&heth);
+  }
+  return 1;
+}
+
+void EthTxMock_Reset(const EthTxMockModel_t *model, EthTxMockFrameCheck_t check)
+{
+  Model = *model;
+  FrameCheck = check;
+  memset(&EthTxMockStats, 0, sizeof(EthTxMockStats));
+}
+
+void EthTxMock_Advance(uint64_t ns)
+{
+  uint64_t target = Now + ns;
+
+  while (RunNextEvent(target) != 0)
+  {
+  }
+  Now = target;
+}
+
+void EthTxMock_Stall(int stalled)
+{
+  if ((Stalled != 0) && (stalled == 0) && (WireFree < Now))
+  {
+    /* the frames held back start now */
+    WireFree = Now;
+  }
+  Stalled = stalled;
+}
+
+uint64_t EthTxMock_Now(void)
+{
+  return Now;
+}
+
+uint32_t EthTxMock_DescInUse(void)
+{
+  return heth.TxDescList.BuffersInUse;
+}
+
+/* ETH Tx ring ----------------------------------------------------------------*/
+
+/* As in the HAL: the applications without RTOS poll HAL_ETH_ReleaseTxPacket() */
+__attribute__((weak)) void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth)
+{
+  (void)heth;
+}
+
+HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig)
+{
+  ETH_TxDescListTypeDef *list = &heth->TxDescList;
+  ETH_BufferTypeDef *txbuffer;
+  uint32_t first = list->CurTxDesc;
+  uint32_t idx = first;
+  uint32_t buffers = 0U;
+  uint32_t descs;
+  uint32_t i;
+
+  if (pTxConfig == NULL)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+  list->CurrentPacketAddress = (uint32_t *)pTxConfig->pData;
+
+  for (txbuffer = pTxConfig->TxBuffer; txbuffer != NULL; txbuffer = txbuffer->next)
+  {
+    buffers++;
+  }
+  descs = (buffers + 1U) / 2U;
+
+  /* ETH_Prepare_Tx_Descriptors(): every descriptor of the frame must be free */
+  for (i = 0U; i < descs; i++)
+  {
+    if ((DescOwn[idx] != 0U) || (list->PacketAddress[idx] != NULL))
+    {
+      heth->ErrorCode |= HAL_ETH_ERROR_BUSY;
+      EthTxMockStats.RingFull++;
+      EthTxMock_Advance(Model.PollNs);
+      return HAL_ERROR;
+    }
+    idx = (idx + 1U) % ETH_TX_DESC_CNT;
+  }
+
+  txbuffer = pTxConfig->TxBuffer;
+  idx = first;
+  for (i = 0U; i < descs; i++)
+  {
+    DescBuf[idx][0] = txbuffer->buffer;
+    DescLen[idx][0] = txbuffer->len;
+    txbuffer = txbuffer->next;
+    DescBuf[idx][1] = (txbuffer != NULL) ? txbuffer->buffer : NULL;
+    DescLen[idx][1] = (txbuffer != NULL) ? txbuffer->len : 0U;
+    txbuffer = (txbuffer != NULL) ? txbuffer->next : NULL;
+    DescOwn[idx] = 1U;
+    if (i + 1U < descs)
+    {
+      idx = (idx + 1U) % ETH_TX_DESC_CNT;
+    }
+  }
+  FrameLastDesc[first] = idx;
+  FrameLen[first] = pTxConfig->Length;
+  FrameQueuedAt[first] = Now;
+
+  list->PacketAddress[idx] = list->CurrentPacketAddress;
+  list->BuffersInUse += descs;
+  list->CurTxDesc = (idx + 1U) % ETH_TX_DESC_CNT;
+  EthTxMockStats.Queued++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth)
+{
+  ETH_TxDescListTypeDef *list = &heth->TxDescList;
+  uint32_t numOfBuf = list->BuffersInUse;
+  uint32_t idx = list->releaseIndex;
+  uint8_t pktTxStatus = 1U;
+  uint8_t pktInUse;
+
+  while ((numOfBuf != 0U) && (pktTxStatus != 0U))
+  {
+    pktInUse = 1U;
+    numOfBuf--;
+    if (list->PacketAddress[idx] == NULL)
+    {
+      idx = (idx + 1U) % ETH_TX_DESC_CNT;
+      pktInUse = 0U;
+    }
+
+    if (pktInUse != 0U)
+    {
+      if (DescOwn[idx] == 0U)
+      {
+        EthTxMockStats.Freed++;
+        HAL_ETH_TxFreeCallback(list->PacketAddress[idx]);
+        list->PacketAddress[idx] = NULL;
+        idx = (idx + 1U) % ETH_TX_DESC_CNT;
+        list->BuffersInUse = numOfBuf;
+        list->releaseIndex = idx;
+      }
+      else
+      {
+        pktTxStatus = 0U;
+      }
+    }
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_Start_IT(ETH_HandleTypeDef *heth)
+{
+  heth->gState = HAL_ETH_STATE_STARTED;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_Stop_IT(ETH_HandleTypeDef *heth)
+{
+  heth->gState = HAL_ETH_STATE_READY;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth)
+{
+  return HAL_ETH_Stop_IT(heth);
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return (uint32_t)(Now / 1000000U);
+}
+
+/* Rest of the HAL: nothing to model ------------------------------------------*/
+
+HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth)
+{
+  heth->gState = HAL_ETH_STATE_READY;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
+{
+  (void)heth;
+  *pAppBuff = NULL;
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_ETH_RegisterRxAllocateCallback(ETH_HandleTypeDef *heth,
+                                                     pETH_rxAllocateCallbackTypeDef rxAllocateCallback)
+{
+  (void)heth;
+  (void)rxAllocateCallback;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_SetDMAConfig(ETH_HandleTypeDef *heth, ETH_DMAConfigTypeDef *dmaconf)
+{
+  (void)heth;
+  (void)dmaconf;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_GetMACConfig(ETH_HandleTypeDef *heth, ETH_MACConfigTypeDef *macconf)
+{
+  (void)heth;
+  memset(macconf, 0, sizeof(*macconf));
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_SetMACConfig(ETH_HandleTypeDef *heth, ETH_MACConfigTypeDef *macconf)
+{
+  (void)heth;
+  (void)macconf;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_SetMACFilterConfig(ETH_HandleTypeDef *heth, ETH_MACFilterConfigTypeDef *pFilterConfig)
+{
+  (void)heth;
+  (void)pFilterConfig;
+  return HAL_OK;
+}
+
+void HAL_ETH_SetMDIOClockRange(ETH_HandleTypeDef *heth)
+{
+  (void)heth;
+}
+
+HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
+                                          uint32_t *pRegValue)
+{
+  (void)heth;
+  (void)PHYAddr;
+  (void)PHYReg;
+  *pRegValue = 0U;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ETH_WritePHYRegister(const ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
+                                           uint32_t RegValue)
+{
+  (void)heth;
+  (void)PHYAddr;
+  (void)PHYReg;
+  (void)RegValue;
+  return HAL_OK;
+}
+
+uint32_t HAL_ETH_GetDMAError(const ETH_HandleTypeDef *heth)
+{
+  (void)heth;
+  return 0U;
+}
+
+/* PHY: the link stays down, the test starts the ETH itself -------------------*/
+
+int32_t RTL8211_RegisterBusIO(rtl8211_Object_t *pObj, rtl8211_IOCtx_t *ioctx)
+{
+  (void)pObj;
+  (void)ioctx;
+  return RTL8211_STATUS_OK;
+}
+
+int32_t RTL8211_Init(rtl8211_Object_t *pObj)
+{
+  (void)pObj;
+  return RTL8211_STATUS_OK;
+}
+
+int32_t RTL8211_GetLinkState(rtl8211_Object_t *pObj)
+{
+  (void)pObj;
+  return RTL8211_STATUS_LINK_DOWN;
+}
+
+int32_t LAN8742_RegisterBusIO(lan8742_Object_t *pObj, lan8742_IOCtx_t *ioctx)
+{
+  (void)pObj;
+  (void)ioctx;
+  return LAN8742_STATUS_OK;
+}
+
+int32_t LAN8742_Init(lan8742_Object_t *pObj)
+{
+  (void)pObj;
+  return LAN8742_STATUS_OK;
+}
+
+int32_t LAN8742_GetLinkState(lan8742_Object_t *pObj)
+{
+  (void)pObj;
+  return LAN8742_STATUS_LINK_DOWN;
+}
+
+/* CMSIS-RTOS2: semaphores released by the mocked interrupts ------------------*/
+
+osSemaphoreId_t osSemaphoreNew(uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr)
+{
+  (void)attr;
+  if (SemCount == ETH_MOCK_SEM_CNT)
+  {
+    return NULL;
+  }
+  Sems[SemCount].Count = initial_count;
+  Sems[SemCount].Max = max_count;
+  return &Sems[SemCount++];
+}
+
+osStatus_t osSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout)
+{
+  EthTxMockSem_t *sem = (EthTxMockSem_t *)semaphore_id;
+  uint64_t deadline;
+
+  if (sem->Count == 0U)
+  {
+    if (timeout == 0U)
+    {
+      return osErrorResource;
+    }
+    EthTxMockStats.SemWaits++;
+    deadline = (timeout == osWaitForever) ? ETH_MOCK_NEVER : Now + (uint64_t)timeout * 1000000U;
+    while (sem->Count == 0U)
+    {
+      if (RunNextEvent(deadline) == 0)
+      {
+        if (deadline == ETH_MOCK_NEVER)
+        {
+          fprintf(stderr, "osSemaphoreAcquire(osWaitForever) with nothing left to wait for\n");
+          abort();
+        }
+        Now = deadline;
+        EthTxMockStats.SemTimeouts++;
+        return osErrorTimeout;
+      }
+    }
+  }
+  sem->Count--;
+  return osOK;
+}
+
+osStatus_t osSemaphoreRelease(osSemaphoreId_t semaphore_id)
+{
+  EthTxMockSem_t *sem = (EthTxMockSem_t *)semaphore_id;
+
+  if (sem->Count == sem->Max)
+  {
+    return osErrorResource;
+  }
+  sem->Count++;
+  return osOK;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+  /* the Rx and link threads are not run */
+  (void)func;
+  (void)argument;
+  (void)attr;
+  return (osThreadId_t)&Sems[0];
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+  EthTxMock_Advance((uint64_t)ticks * 1000000U);
+  return osOK;
+}
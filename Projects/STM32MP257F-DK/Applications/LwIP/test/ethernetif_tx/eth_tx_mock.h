@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    eth_tx_mock.h
+  * @brief   Host model of the ETH DMA Tx descriptor ring, driven by the
+  *          low_level_output() of an application's ethernetif.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ETH_TX_MOCK_H
+#define ETH_TX_MOCK_H
+
+#include <stdint.h>
+
+/* Timing of the model, in ns of simulated time */
+typedef struct
+{
+  uint32_t WireNsPerByte;   /* 8 for 1 Gbit/s */
+  uint32_t IrqLatencyNs;    /* from the end of a frame to HAL_ETH_TxCpltCallback() */
+  uint32_t PollNs;          /* cost of a HAL_ETH_Transmit_IT() call that finds the ring full */
+} EthTxMockModel_t;
+
+typedef struct
+{
+  uint32_t Queued;          /* frames accepted by HAL_ETH_Transmit_IT() */
+  uint32_t RingFull;        /* HAL_ETH_Transmit_IT() calls that found the ring full */
+  uint32_t Sent;            /* frames the DMA has completed */
+  uint32_t Freed;           /* HAL_ETH_TxFreeCallback() calls */
+  uint32_t SemWaits;        /* osSemaphoreAcquire() calls that had to wait */
+  uint32_t SemTimeouts;     /* osSemaphoreAcquire() calls that timed out */
+  uint32_t BadFrames;       /* frames rejected by the frame check */
+} EthTxMockStats_t;
+
+/* Called for every frame when the DMA has sent it, with the bytes gathered
+ * from its descriptors. Returns 0 if the frame is not the expected one. */
+typedef int (*EthTxMockFrameCheck_t)(const uint8_t *frame, uint32_t len);
+
+extern EthTxMockStats_t EthTxMockStats;
+
+void EthTxMock_Reset(const EthTxMockModel_t *model, EthTxMockFrameCheck_t check);
+void EthTxMock_Advance(uint64_t ns);
+void EthTxMock_Stall(int stalled);
+uint64_t EthTxMock_Now(void);
+uint32_t EthTxMock_DescInUse(void);
+
+#endif /* ETH_TX_MOCK_H */
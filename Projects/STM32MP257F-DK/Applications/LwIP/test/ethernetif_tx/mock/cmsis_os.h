@@ -0,0 +1,67 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_os.h
+  * @brief   Host mock of the CMSIS-RTOS2 calls of the RTOS ethernetif.c files.
+  *          The semaphores count Tx completions of the mocked DMA, see
+  *          eth_tx_mock.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef CMSIS_OS_H_
+#define CMSIS_OS_H_
+
+#include <stdint.h>
+
+#define osWaitForever         0xFFFFFFFFU
+
+typedef enum
+{
+  osOK                      =  0,
+  osError                   = -1,
+  osErrorTimeout            = -2,
+  osErrorResource           = -3
+} osStatus_t;
+
+typedef enum
+{
+  osPriorityNormal          = 24,
+  osPriorityRealtime        = 48
+} osPriority_t;
+
+typedef void *osSemaphoreId_t;
+typedef void *osThreadId_t;
+typedef void (*osThreadFunc_t)(void *argument);
+
+typedef struct
+{
+  const char *name;
+  uint32_t attr_bits;
+  void *cb_mem;
+  uint32_t cb_size;
+  void *stack_mem;
+  uint32_t stack_size;
+  osPriority_t priority;
+} osThreadAttr_t;
+
+typedef struct
+{
+  const char *name;
+} osSemaphoreAttr_t;
+
+osSemaphoreId_t osSemaphoreNew(uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr);
+osStatus_t osSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout);
+osStatus_t osSemaphoreRelease(osSemaphoreId_t semaphore_id);
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osStatus_t osDelay(uint32_t ticks);
+
+#endif /* CMSIS_OS_H_ */
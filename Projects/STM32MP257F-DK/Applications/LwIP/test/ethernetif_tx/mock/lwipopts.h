@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file    lwipopts.h
+  * @brief   lwIP options of the host Tx ring test: the core only (NO_SYS), with
+  *          statistics to check that every pbuf is given back.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __LWIPOPTS__H__
+#define __LWIPOPTS__H__
+
+#define NO_SYS                          1
+#define SYS_LIGHTWEIGHT_PROT            0
+#define LWIP_NETCONN                    0
+#define LWIP_SOCKET                     0
+
+#define LWIP_IPV4                       1
+#define LWIP_IPV6                       0
+#define LWIP_ARP                        1
+#define LWIP_ETHERNET                   1
+#define LWIP_TCP                        0
+#define LWIP_UDP                        1
+
+#define MEM_ALIGNMENT                   4
+#define MEM_SIZE                        (60 * 1024)
+#define PBUF_POOL_SIZE                  16
+
+/* ETH_RX_BUFFER_SIZE of the RTOS applications' lwipopts.h, the others define it in ethernetif.c */
+#ifdef ETH_TX_MOCK_RTOS
+#define ETH_RX_BUFFER_SIZE              1536
+#endif
+
+#define LWIP_STATS                      1
+#define MEM_STATS                       1
+#define MEMP_STATS                      1
+#define LWIP_STATS_DISPLAY              0
+
+#endif /* __LWIPOPTS__H__ */
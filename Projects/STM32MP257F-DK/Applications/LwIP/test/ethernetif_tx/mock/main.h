@@ -0,0 +1,24 @@
+/**
+  ******************************************************************************
+  * @file    main.h
+  * @brief   Host mock of the application main.h included by the ethernetif.c
+  *          files of the RTOS applications.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include "stm32mp2xx_hal.h"
+
+#endif /* __MAIN_H */
@@ -0,0 +1,230 @@
+/**
+  ******************************************************************************
+  * @file    stm32mp2xx_hal.h
+  * @brief   Host mock of the parts of the HAL used by the LwIP ethernetif.c
+  *          files: types, constants and prototypes. The Tx descriptor ring is
+  *          modelled in eth_tx_mock.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32MP2xx_HAL_H
+#define STM32MP2xx_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define __ALIGNED(x)                   __attribute__((aligned(x)))
+
+typedef enum
+{
+  DISABLE = 0U,
+  ENABLE = !DISABLE
+} FunctionalState;
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/* Default ring sizes of stm32mp2xx_hal_eth.h: small, so that the tests fill the ring quickly */
+#ifndef ETH_TX_DESC_CNT
+#define ETH_TX_DESC_CNT                4U
+#endif
+#ifndef ETH_RX_DESC_CNT
+#define ETH_RX_DESC_CNT                4U
+#endif
+
+#define ETH_MAX_PAYLOAD                1500U
+#define ETH_MAC_ADDR0                  0x00U
+#define ETH_MAC_ADDR1                  0x80U
+#define ETH_MAC_ADDR2                  0xE1U
+#define ETH_MAC_ADDR3                  0x00U
+#define ETH_MAC_ADDR4                  0x00U
+#define ETH_MAC_ADDR5                  0x00U
+
+#define HAL_ETH_STATE_RESET            0x00000000U
+#define HAL_ETH_STATE_READY            0x00000010U
+#define HAL_ETH_STATE_STARTED          0x00000023U
+#define HAL_ETH_STATE_ERROR            0x000000E0U
+
+#define HAL_ETH_ERROR_NONE             0x00000000U
+#define HAL_ETH_ERROR_PARAM            0x00000001U
+#define HAL_ETH_ERROR_BUSY             0x00000002U
+
+#define HAL_ETH_RMII_MODE              0x00000001U
+
+#define ETH_TX_PACKETS_FEATURES_CSUM   0x00000001U
+#define ETH_TX_PACKETS_FEATURES_CRCPAD 0x00000020U
+#define ETH_CRC_PAD_DISABLE            0x00000000U
+#define ETH_CRC_PAD_INSERT             0x00000001U
+#define ETH_CHECKSUM_IPHDR_PAYLOAD_INSERT_PHDR_CALC 0x00030000U
+
+#define ETH_SPEED_10M                  0x00000000U
+#define ETH_SPEED_100M                 0x00004000U
+#define ETH_SPEED_1000M                0x00000000U
+#define ETH_FULLDUPLEX_MODE            0x00002000U
+#define ETH_HALFDUPLEX_MODE            0x00000000U
+
+/* ETH AXI support */
+#define ETH_DMASBMR_BLEN4              0x00000002U
+#define ETH_DMAARBITRATION_TX          0x00000001U
+#define ETH_DMAARBITRATION_RX1_TX1     0x00000000U
+#define ETH_BURSTLENGTH_FIXED          0x00000001U
+#define ETH_TXDMABURSTLENGTH_32BEAT    0x00200000U
+#define ETH_RXDMABURSTLENGTH_32BEAT    0x00200000U
+#define ETH_RX_OSR_LIMIT_3             0x00300000U
+#define ETH_TX_OSR_LIMIT_3             0x00030000U
+#define ETH_BLEN_MAX_SIZE_16           0x00000008U
+#define ETH_DMAC0SR_RBU                0x00000080U
+#define ETH_DMAC0SR_TBU                0x00000004U
+
+typedef struct
+{
+  uint32_t DESC0;
+  uint32_t DESC1;
+  uint32_t DESC2;
+  uint32_t DESC3;
+  uint32_t BackupAddr0;
+  uint32_t BackupAddr1;
+} ETH_DMADescTypeDef;
+
+typedef struct __ETH_BufferTypeDef
+{
+  uint8_t *buffer;
+  uint32_t len;
+  struct __ETH_BufferTypeDef *next;
+} ETH_BufferTypeDef;
+
+typedef struct
+{
+  uint32_t Attributes;
+  uint32_t Length;
+  ETH_BufferTypeDef *TxBuffer;
+  uint32_t SrcAddrCtrl;
+  uint32_t CRCPadCtrl;
+  uint32_t ChecksumCtrl;
+  uint32_t MaxSegmentSize;
+  uint32_t PayloadLen;
+  uint32_t TCPHeaderLen;
+  uint32_t VlanTag;
+  uint32_t VlanCtrl;
+  uint32_t InnerVlanTag;
+  uint32_t InnerVlanCtrl;
+  void *pData;
+} ETH_TxPacketConfigTypeDef;
+
+typedef ETH_TxPacketConfigTypeDef ETH_TxPacketConfig_t;
+
+/* The Tx descriptor list of the real HAL handle, see HAL_ETH_ReleaseTxPacket() */
+typedef struct
+{
+  uint32_t TxDesc[ETH_TX_DESC_CNT];
+  uint32_t CurTxDesc;
+  uint32_t *PacketAddress[ETH_TX_DESC_CNT];
+  uint32_t *CurrentPacketAddress;
+  uint32_t BuffersInUse;
+  uint32_t releaseIndex;
+} ETH_TxDescListTypeDef;
+
+typedef struct
+{
+  uint8_t *MACAddr;
+  uint32_t MediaInterface;
+  ETH_DMADescTypeDef *TxDesc;
+  ETH_DMADescTypeDef *RxDesc;
+  uint32_t RxBuffLen;
+} ETH_InitTypeDef;
+
+typedef struct
+{
+  void *Instance;
+  ETH_InitTypeDef Init;
+  ETH_TxDescListTypeDef TxDescList;
+  volatile uint32_t gState;
+  volatile uint32_t ErrorCode;
+} ETH_HandleTypeDef;
+
+typedef struct
+{
+  uint32_t DMAArbitration;
+  FunctionalState AddressAlignedBeats;
+  uint32_t BurstMode;
+  FunctionalState RebuildINCRxBurst;
+  FunctionalState PBLx8Mode;
+  uint32_t TxDMABurstLength;
+  FunctionalState SecondPacketOperate;
+  uint32_t RxDMABurstLength;
+  FunctionalState FlushRxPacket;
+  FunctionalState TCPSegmentation;
+  uint32_t MaximumSegmentSize;
+  uint32_t RxOSRLimit;
+  uint32_t TxOSRLimit;
+  uint32_t AXIBLENMaxSize;
+} ETH_DMAConfigTypeDef;
+
+typedef struct
+{
+  uint32_t DuplexMode;
+  uint32_t Speed;
+} ETH_MACConfigTypeDef;
+
+typedef struct
+{
+  FunctionalState PromiscuousMode;
+  FunctionalState ReceiveAllMode;
+  FunctionalState HachOrPerfectFilter;
+  FunctionalState HashUnicast;
+  FunctionalState HashMulticast;
+  FunctionalState PassAllMulticast;
+  FunctionalState SrcAddrFiltering;
+  FunctionalState SrcAddrInverseFiltering;
+  FunctionalState DestAddrInverseFiltering;
+  FunctionalState BroadcastFilter;
+  uint32_t ControlPacketsFilter;
+} ETH_MACFilterConfigTypeDef;
+
+typedef void (*pETH_rxAllocateCallbackTypeDef)(uint8_t **buffer);
+
+uint32_t HAL_GetTick(void);
+
+HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_Start_IT(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_Stop_IT(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig);
+HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff);
+HAL_StatusTypeDef HAL_ETH_RegisterRxAllocateCallback(ETH_HandleTypeDef *heth,
+                                                     pETH_rxAllocateCallbackTypeDef rxAllocateCallback);
+HAL_StatusTypeDef HAL_ETH_SetDMAConfig(ETH_HandleTypeDef *heth, ETH_DMAConfigTypeDef *dmaconf);
+HAL_StatusTypeDef HAL_ETH_GetMACConfig(ETH_HandleTypeDef *heth, ETH_MACConfigTypeDef *macconf);
+HAL_StatusTypeDef HAL_ETH_SetMACConfig(ETH_HandleTypeDef *heth, ETH_MACConfigTypeDef *macconf);
+HAL_StatusTypeDef HAL_ETH_SetMACFilterConfig(ETH_HandleTypeDef *heth, ETH_MACFilterConfigTypeDef *pFilterConfig);
+void HAL_ETH_SetMDIOClockRange(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
+                                          uint32_t *pRegValue);
+HAL_StatusTypeDef HAL_ETH_WritePHYRegister(const ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
+                                           uint32_t RegValue);
+uint32_t HAL_ETH_GetDMAError(const ETH_HandleTypeDef *heth);
+
+void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_ErrorCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_RxAllocateCallback(uint8_t **buff);
+void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length);
+void HAL_ETH_TxFreeCallback(uint32_t *buff);
+
+#endif /* STM32MP2xx_HAL_H */